@@ -33,14 +33,22 @@ LOCAL_SRC_FILES := \
 	$(LOCAL_PATH)/../source/brx_load_pvr_image_asset.cpp \
 	$(LOCAL_PATH)/../source/brx_malloc.cpp \
 	$(LOCAL_PATH)/../source/brx_pause.cpp \
+	$(LOCAL_PATH)/../source/brx_pipeline_compiler.cpp \
+	$(LOCAL_PATH)/../source/brx_staging_upload_ring.cpp \
+	$(LOCAL_PATH)/../source/brx_uniform_upload_ring.cpp \
+	$(LOCAL_PATH)/../source/brx_asset_buffer_sub_allocator.cpp \
+	$(LOCAL_PATH)/../source/brx_timestamp_query_label_list.cpp \
+	$(LOCAL_PATH)/../source/brx_upload_scheduler.cpp \
 	$(LOCAL_PATH)/../source/brx_vk_buffer.cpp \
 	$(LOCAL_PATH)/../source/brx_vk_command_buffer.cpp \
 	$(LOCAL_PATH)/../source/brx_vk_descriptor.cpp \
+	$(LOCAL_PATH)/../source/brx_vk_descriptor_allocator.cpp \
 	$(LOCAL_PATH)/../source/brx_vk_device.cpp \
 	$(LOCAL_PATH)/../source/brx_vk_fence.cpp \
 	$(LOCAL_PATH)/../source/brx_vk_frame_buffer.cpp \
 	$(LOCAL_PATH)/../source/brx_vk_image.cpp \
 	$(LOCAL_PATH)/../source/brx_vk_pipeline.cpp \
+	$(LOCAL_PATH)/../source/brx_vk_pipeline_state_cache.cpp \
 	$(LOCAL_PATH)/../source/brx_vk_queue.cpp \
 	$(LOCAL_PATH)/../source/brx_vk_render_pass.cpp \
 	$(LOCAL_PATH)/../source/brx_vk_sampler.cpp \
@@ -81,3 +89,45 @@ ifeq (true, $(APP_DEBUG))
 endif
 
 include $(BUILD_SHARED_LIBRARY)
+
+# Tests
+
+include $(CLEAR_VARS)
+
+LOCAL_MODULE := BRX-Benchmark-Descriptor-Set-Allocation
+
+LOCAL_SRC_FILES := \
+	$(LOCAL_PATH)/../test/brx_benchmark_descriptor_set_allocation.cpp
+
+LOCAL_CFLAGS :=
+LOCAL_CFLAGS += -fdiagnostics-format=msvc
+LOCAL_CFLAGS += -finput-charset=UTF-8 -fexec-charset=UTF-8
+LOCAL_CFLAGS += -Werror=return-type
+LOCAL_CFLAGS += -Wall
+
+LOCAL_CPPFLAGS :=
+LOCAL_CPPFLAGS += -std=c++11
+
+LOCAL_SHARED_LIBRARIES := BRX
+
+include $(BUILD_EXECUTABLE)
+
+include $(CLEAR_VARS)
+
+LOCAL_MODULE := BRX-Test-Command-Recording-Allocation
+
+LOCAL_SRC_FILES := \
+	$(LOCAL_PATH)/../test/brx_test_command_recording_allocation.cpp
+
+LOCAL_CFLAGS :=
+LOCAL_CFLAGS += -fdiagnostics-format=msvc
+LOCAL_CFLAGS += -finput-charset=UTF-8 -fexec-charset=UTF-8
+LOCAL_CFLAGS += -Werror=return-type
+LOCAL_CFLAGS += -Wall
+
+LOCAL_CPPFLAGS :=
+LOCAL_CPPFLAGS += -std=c++11
+
+LOCAL_SHARED_LIBRARIES := BRX
+
+include $(BUILD_EXECUTABLE)
@@ -24,27 +24,40 @@
 class brx_device;
 class brx_graphics_queue;
 class brx_upload_queue;
+class brx_compute_queue;
 class brx_graphics_command_buffer;
+class brx_secondary_graphics_command_buffer;
 class brx_upload_command_buffer;
+class brx_compute_command_buffer;
 class brx_fence;
+class brx_timeline_fence;
+class brx_upload_scheduler;
 class brx_descriptor_set_layout;
 class brx_pipeline_layout;
 class brx_descriptor_set;
+class brx_bindless_table;
+class brx_transient_descriptor_allocator;
 class brx_render_pass;
 class brx_graphics_pipeline;
 class brx_compute_pipeline;
+class brx_graphics_pipeline_compilation;
+class brx_compute_pipeline_compilation;
 class brx_frame_buffer;
 class brx_uniform_upload_buffer;
+class brx_uniform_upload_ring;
 class brx_staging_upload_buffer;
+class brx_staging_upload_ring;
 class brx_vertex_buffer;
 class brx_vertex_position_buffer;
 class brx_vertex_varying_buffer;
 class brx_index_buffer;
 class brx_storage_buffer;
+class brx_indirect_argument_buffer;
 class brx_intermediate_storage_buffer;
 class brx_asset_vertex_position_buffer;
 class brx_asset_vertex_varying_buffer;
 class brx_asset_index_buffer;
+class brx_asset_buffer_sub_allocator;
 class brx_sampled_image;
 class brx_color_attachment_image;
 class brx_depth_stencil_attachment_image;
@@ -53,6 +66,7 @@ class brx_asset_sampled_image;
 class brx_sampler;
 class brx_surface;
 class brx_swap_chain;
+class brx_timestamp_query_pool;
 class brx_scratch_buffer;
 class brx_staging_non_compacted_bottom_level_acceleration_structure_buffer;
 class brx_staging_non_compacted_bottom_level_acceleration_structure;
@@ -208,6 +222,40 @@ struct BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE
 	uint32_t offset;
 };
 
+struct BRX_PIPELINE_SPECIALIZATION_CONSTANT
+{
+	uint32_t constant_id;
+	// the bool, int, uint and float are all 32-bit (the float should be reinterpreted as the uint)
+	uint32_t value;
+};
+
+// the layout is the same as the "VkDrawIndirectCommand" and the "D3D12_DRAW_ARGUMENTS"
+struct BRX_DRAW_INDIRECT_COMMAND
+{
+	uint32_t vertex_count;
+	uint32_t instance_count;
+	uint32_t first_vertex;
+	uint32_t first_instance;
+};
+
+// the layout is the same as the "VkDrawIndexedIndirectCommand" and the "D3D12_DRAW_INDEXED_ARGUMENTS"
+struct BRX_DRAW_INDEX_INDIRECT_COMMAND
+{
+	uint32_t index_count;
+	uint32_t instance_count;
+	uint32_t first_index;
+	int32_t vertex_offset;
+	uint32_t first_instance;
+};
+
+// the layout is the same as the "VkDispatchIndirectCommand" and the "D3D12_DISPATCH_ARGUMENTS"
+struct BRX_DISPATCH_INDIRECT_COMMAND
+{
+	uint32_t group_count_x;
+	uint32_t group_count_y;
+	uint32_t group_count_z;
+};
+
 struct BRX_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY
 {
 	bool force_closest_hit;
@@ -232,6 +280,45 @@ struct BRX_TOP_LEVEL_ACCELERATION_STRUCTURE_INSTANCE
 	brx_asset_compacted_bottom_level_acceleration_structure *asset_compacted_bottom_level_acceleration_structure;
 };
 
+struct BRX_WRITE_DESCRIPTOR_SET
+{
+	brx_descriptor_set *descriptor_set;
+	BRX_DESCRIPTOR_TYPE descriptor_type;
+	uint32_t dst_binding;
+	uint32_t dst_array_element;
+	uint32_t src_descriptor_count;
+	brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers;
+	uint32_t const *src_dynamic_uniform_buffer_ranges;
+	brx_storage_buffer const *const *src_storage_buffers;
+	brx_sampled_image const *const *src_sampled_images;
+	brx_sampler const *const *src_samplers;
+	brx_storage_image const *const *src_storage_images;
+	brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures;
+};
+
+// the state commands are the binds of the pipelines, the descriptor sets, the vertex buffers and the index buffer, and the settings of the view port and the scissor
+struct BRX_GRAPHICS_COMMAND_BUFFER_STATISTICS
+{
+	uint32_t emitted_state_command_count;
+	uint32_t elided_state_command_count;
+};
+
+struct BRX_STAGING_UPLOAD_RING_STATISTICS
+{
+	uint64_t capacity;
+	uint64_t used_size;
+	uint64_t high_water_mark;
+};
+
+struct BRX_TIMESTAMP_LABEL_TIMING
+{
+	// owned by the timestamp query pool, and valid until the pool is reset
+	char const *label_name;
+	// the nesting level of the debug utils label, and zero means the outermost label
+	uint32_t depth;
+	double gpu_milliseconds;
+};
+
 extern "C" brx_device *brx_init_vk_device(bool support_ray_tracing);
 
 extern "C" void brx_destroy_vk_device(brx_device *device);
@@ -240,6 +327,12 @@ extern "C" brx_device *brx_init_d3d12_device(bool support_ray_tracing);
 
 extern "C" void brx_destroy_d3d12_device(brx_device *device);
 
+// the hook is called by each heap allocation of the library, and is intended to count the allocations (for example, by the tests)
+// the hook should be set when no other function of the library is being called, and NULL removes the hook
+typedef void (*PFN_brx_malloc_hook)(size_t size, size_t alignment, void *user_data);
+
+extern "C" void brx_set_malloc_hook(PFN_brx_malloc_hook pfn_malloc_hook, void *user_data);
+
 class brx_device
 {
 public:
@@ -247,38 +340,145 @@ public:
 	virtual void destroy_graphics_queue(brx_graphics_queue *graphics_queue) const = 0;
 	virtual brx_upload_queue *create_upload_queue() const = 0;
 	virtual void destroy_upload_queue(brx_upload_queue *upload_queue) const = 0;
+	// the compute queue is the dedicated compute queue when there is one, and thus the compute submissions may overlap the graphics submissions
+	// false is returned when the compute queue is the same queue as the graphics queue, and thus the compute submissions are serialized with the graphics submissions (and the compute queue and the graphics queue can still be used by different threads, since the submissions to the same queue are synchronized internally)
+	virtual bool is_async_compute_supported() const = 0;
+	virtual brx_compute_queue *create_compute_queue() const = 0;
+	virtual void destroy_compute_queue(brx_compute_queue *compute_queue) const = 0;
 	virtual brx_graphics_command_buffer *create_graphics_command_buffer() const = 0;
 	virtual void reset_graphics_command_buffer(brx_graphics_command_buffer *graphics_command_buffer) const = 0;
 	virtual void destroy_graphics_command_buffer(brx_graphics_command_buffer *graphics_command_buffer) const = 0;
+	// each secondary graphics command buffer owns its command pool, and thus the worker threads can record the different secondary graphics command buffers concurrently
+	virtual brx_secondary_graphics_command_buffer *create_secondary_graphics_command_buffer() const = 0;
+	virtual void reset_secondary_graphics_command_buffer(brx_secondary_graphics_command_buffer *secondary_graphics_command_buffer) const = 0;
+	virtual void destroy_secondary_graphics_command_buffer(brx_secondary_graphics_command_buffer *secondary_graphics_command_buffer) const = 0;
 	virtual brx_upload_command_buffer *create_upload_command_buffer() const = 0;
 	virtual void reset_upload_command_buffer(brx_upload_command_buffer *upload_command_buffer) const = 0;
 	virtual void destroy_upload_command_buffer(brx_upload_command_buffer *upload_command_buffer) const = 0;
+	virtual brx_compute_command_buffer *create_compute_command_buffer() const = 0;
+	virtual void reset_compute_command_buffer(brx_compute_command_buffer *compute_command_buffer) const = 0;
+	virtual void destroy_compute_command_buffer(brx_compute_command_buffer *compute_command_buffer) const = 0;
 	virtual brx_fence *create_fence(bool signaled) const = 0;
 	virtual void wait_for_fence(brx_fence *fence) const = 0;
 	virtual void reset_fence(brx_fence *fence) const = 0;
 	virtual void destroy_fence(brx_fence *fence) const = 0;
-	virtual brx_descriptor_set_layout *create_descriptor_set_layout(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings) const = 0;
+	// the timeline fence is a monotonically increasing value, which is signaled by the queues or by the host, and all the functions of the timeline fence should NOT be used when false is returned
+	virtual bool is_timeline_fence_supported() const = 0;
+	virtual brx_timeline_fence *create_timeline_fence(uint64_t initial_value) const = 0;
+	// non-blocking
+	virtual uint64_t get_timeline_fence_completed_value(brx_timeline_fence const *timeline_fence) const = 0;
+	// the value should be greater than the current value, and the value should NOT be signaled by the queue at the same time
+	virtual void signal_timeline_fence(brx_timeline_fence *timeline_fence, uint64_t value) const = 0;
+	// wait until all (or any when "wait_all" is false) of the fences reach the values
+	// "timeout": in nanoseconds, zero polls without blocking, and UINT64_MAX waits forever
+	// false is returned when the timeout expires
+	virtual bool wait_for_timeline_fences(uint32_t timeline_fence_count, brx_timeline_fence const *const *timeline_fences, uint64_t const *values, bool wait_all, uint64_t timeout) const = 0;
+	virtual void destroy_timeline_fence(brx_timeline_fence *timeline_fence) const = 0;
+	// the upload scheduler keeps at most "batch_count" upload batches in flight on the upload queue independently of the graphics submissions, and the timeline fence should be supported
+	// each batch is identified by the value of the timeline fence, which is reached when the batch completes
+	// NOT thread-safe
+	virtual brx_upload_scheduler *create_upload_scheduler(uint32_t batch_count) = 0;
+	// the returned upload command buffer has been begun, and NULL is returned (instead of waiting) when all batches are in flight
+	virtual brx_upload_command_buffer *begin_upload_batch(brx_upload_scheduler *upload_scheduler) const = 0;
+	// the upload command buffer is ended and submitted, and the value of the batch is returned
+	virtual uint64_t submit_upload_batch(brx_upload_scheduler *upload_scheduler, brx_upload_queue *upload_queue, brx_upload_command_buffer *upload_command_buffer) const = 0;
+	// the graphics submission, which acquires the resources uploaded by the batch, should wait for the value of the batch by the "wait_timeline_fence" of the graphics queue
+	virtual brx_timeline_fence const *get_upload_scheduler_timeline_fence(brx_upload_scheduler const *upload_scheduler) const = 0;
+	// non-blocking
+	virtual bool is_upload_batch_completed(brx_upload_scheduler const *upload_scheduler, uint64_t batch_value) const = 0;
+	// the host waits until all batches complete
+	virtual void destroy_upload_scheduler(brx_upload_scheduler *upload_scheduler) = 0;
+	virtual brx_descriptor_set_layout *create_descriptor_set_layout(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings, bool descriptor_update_template = false) const = 0;
 	virtual void destroy_descriptor_set_layout(brx_descriptor_set_layout *descriptor_set_layout) const = 0;
-	virtual brx_pipeline_layout *create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *descriptor_set_layouts) const = 0;
+	// the push constants are visible to all shader stages, and the size (in bytes) should be a multiple of 4 and NOT greater than 128
+	// the push constants are the "brx_push_constant" of the shader, and are mapped to the root constants by D3D12
+	virtual brx_pipeline_layout *create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *descriptor_set_layouts, uint32_t push_constant_size = 0U) const = 0;
 	virtual void destroy_pipeline_layout(brx_pipeline_layout *pipeline_layout) const = 0;
 	virtual brx_descriptor_set *create_descriptor_set(brx_descriptor_set_layout const *descriptor_set_layout) = 0;
 	virtual void write_descriptor_set(brx_descriptor_set *descriptor_set, BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t dst_binding, uint32_t dst_array_element, uint32_t src_descriptor_count, brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_storage_buffer const *const *src_storage_buffers, brx_sampled_image const *const *src_sampled_images, brx_sampler const *const *src_samplers, brx_storage_image const *const *src_storage_images, brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures) const = 0;
+	virtual void write_descriptor_sets(uint32_t write_descriptor_set_count, BRX_WRITE_DESCRIPTOR_SET const *write_descriptor_sets) const = 0;
+	// "src_descriptors": the packed handles of all descriptors in the order of the bindings of the descriptor set layout, which should be created with the "descriptor_update_template"
+	// "src_dynamic_uniform_buffer_ranges": the ranges of the dynamic uniform buffers in the same order
+	virtual void write_descriptor_set_with_template(brx_descriptor_set *descriptor_set, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges) const = 0;
 	virtual void destroy_descriptor_set(brx_descriptor_set *descriptor_set) = 0;
+	// the bindless table is one descriptor set with only the binding 0, and the returned descriptor index is used by the shader directly
+	// all functions of the bindless table should NOT be used when false is returned
+	virtual bool is_bindless_table_supported() const = 0;
+	// NULL is returned when the descriptor count exceeds the limit of the device
+	virtual brx_bindless_table *create_bindless_table(BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t descriptor_count) = 0;
+	virtual brx_descriptor_set_layout const *get_bindless_table_descriptor_set_layout(brx_bindless_table const *bindless_table) const = 0;
+	virtual brx_descriptor_set const *get_bindless_table_descriptor_set(brx_bindless_table const *bindless_table) const = 0;
+	virtual uint32_t alloc_bindless_descriptor(brx_bindless_table *bindless_table, brx_storage_buffer const *src_storage_buffer, brx_sampled_image const *src_sampled_image, brx_sampler const *src_sampler) const = 0;
+	virtual void free_bindless_descriptor(brx_bindless_table *bindless_table, uint32_t descriptor_index) const = 0;
+	virtual void destroy_bindless_table(brx_bindless_table *bindless_table) = 0;
+	// one transient descriptor allocator per frame in flight, which should be reset after the fence of the frame is signaled
+	// the transient descriptor sets are invalidated by the reset, and should NOT be destroyed by the "destroy_descriptor_set"
+	virtual brx_transient_descriptor_allocator *create_transient_descriptor_allocator() = 0;
+	virtual brx_descriptor_set *alloc_transient_descriptor_set(brx_transient_descriptor_allocator *transient_descriptor_allocator, brx_descriptor_set_layout const *descriptor_set_layout) const = 0;
+	virtual void reset_transient_descriptor_allocator(brx_transient_descriptor_allocator *transient_descriptor_allocator) const = 0;
+	virtual void destroy_transient_descriptor_allocator(brx_transient_descriptor_allocator *transient_descriptor_allocator) = 0;
 	virtual brx_render_pass *create_render_pass(uint32_t color_attachment_count, BRX_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment) const = 0;
 	virtual void destroy_render_pass(brx_render_pass *render_pass) const = 0;
+	// the identical pipelines may be shared, and each "create_graphics_pipeline" or "create_compute_pipeline" should still be paired with its own "destroy_graphics_pipeline" or "destroy_compute_pipeline"
+	// the pipeline layout is identified by its handle, and thus should not be destroyed before the pipelines created with it
 	virtual brx_graphics_pipeline *create_graphics_pipeline(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation) const = 0;
 	virtual void destroy_graphics_pipeline(brx_graphics_pipeline *graphics_pipeline) const = 0;
 	virtual brx_compute_pipeline *create_compute_pipeline(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) const = 0;
 	virtual void destroy_compute_pipeline(brx_compute_pipeline *compute_pipeline) const = 0;
+	// the variant is the base pipeline with the specialization constants replaced, and should be destroyed by the "destroy_graphics_pipeline" or "destroy_compute_pipeline"
+	// the render pass of the graphics variant should be compatible with (namely have the same attachment formats as) the one used to create the base pipeline, which may have been destroyed
+	// the pipeline layout of the base pipeline should be alive
+	// the "specialization_constant_count" should be zero when the "is_pipeline_specialization_constant_supported" returns false (D3D12), and the creation fails with NULL returned (after the assertion in the debug build) when it is NOT
+	// on D3D12, each permutation should be compiled into its own DXIL and created by the "create_graphics_pipeline" or "create_compute_pipeline", or the values should be passed by the push constants (namely the root constants) instead
+	virtual bool is_pipeline_specialization_constant_supported() const = 0;
+	virtual brx_graphics_pipeline *create_graphics_pipeline_variant(brx_graphics_pipeline const *base_graphics_pipeline, brx_render_pass const *render_pass, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants) const = 0;
+	virtual brx_compute_pipeline *create_compute_pipeline_variant(brx_compute_pipeline const *base_compute_pipeline, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants) const = 0;
+	// the pipeline is created on the internal worker threads, and the render pass and the pipeline layout should be alive until the compilation is waited
+	// the shader code and the vertex layout are copied, and can be released by the caller immediately
+	virtual brx_graphics_pipeline_compilation *create_graphics_pipeline_async(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation) = 0;
+	virtual bool is_graphics_pipeline_compilation_completed(brx_graphics_pipeline_compilation const *graphics_pipeline_compilation) const = 0;
+	// the compilation is destroyed, and the pipeline should be destroyed by the "destroy_graphics_pipeline"
+	virtual brx_graphics_pipeline *wait_graphics_pipeline_compilation(brx_graphics_pipeline_compilation *graphics_pipeline_compilation) = 0;
+	virtual brx_compute_pipeline_compilation *create_compute_pipeline_async(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) = 0;
+	virtual bool is_compute_pipeline_compilation_completed(brx_compute_pipeline_compilation const *compute_pipeline_compilation) const = 0;
+	virtual brx_compute_pipeline *wait_compute_pipeline_compilation(brx_compute_pipeline_compilation *compute_pipeline_compilation) = 0;
+	// the pipeline cache is used by all the pipelines created by this device, and should be loaded before any pipeline is created
+	// D3D12 has NO persistent pipeline cache (the drivers maintain their own on-disk shader caches), and thus "false" is always returned by the load and zero is always returned by the store
+	// the stale data, which was stored by the other driver or the other device, is ignored, and "false" is returned
+	// thread-safe, and the pipelines which are being compiled (e.g. by the "create_graphics_pipeline_async") are waited before the data is merged
+	virtual bool load_pipeline_cache(size_t pipeline_cache_data_size, void const *pipeline_cache_data) = 0;
+	// when the "pipeline_cache_data" is NULL, only the size is returned
+	virtual size_t store_pipeline_cache(size_t pipeline_cache_data_size, void *pipeline_cache_data) const = 0;
 	virtual brx_frame_buffer *create_frame_buffer(brx_render_pass const *render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_color_attachment_image const *const *color_attachments, brx_depth_stencil_attachment_image const *depth_stencil_attachment) const = 0;
 	virtual void destroy_frame_buffer(brx_frame_buffer *frame_buffer) const = 0;
 	virtual brx_uniform_upload_buffer *create_uniform_upload_buffer(uint32_t size) const = 0;
 	virtual void destroy_uniform_upload_buffer(brx_uniform_upload_buffer *uniform_upload_buffer) const = 0;
+	// the uniform upload ring is one uniform upload buffer divided into one slot of "frame_size" for each frame in flight
+	// the uniform upload buffer should be written to the descriptor set as the dynamic uniform buffer, and the range should NOT be greater than the size of each allocation
+	virtual brx_uniform_upload_ring *create_uniform_upload_ring(uint32_t frame_count, uint32_t frame_size) = 0;
+	virtual brx_uniform_upload_buffer const *get_uniform_upload_ring_buffer(brx_uniform_upload_ring const *uniform_upload_ring) const = 0;
+	// the frames should be begun in the round-robin order, after the fence of the same frame in the previous cycle is signaled
+	virtual void begin_uniform_upload_ring_frame(brx_uniform_upload_ring *uniform_upload_ring, uint32_t frame_index) const = 0;
+	// thread-safe, and the returned dynamic offset is aligned and can be passed to the "bind_graphics_descriptor_sets" or "bind_compute_descriptor_sets" directly
+	// NULL is returned (and the dynamic offset is NOT written) when the "frame_size" is NOT enough for all the allocations of the current frame, and the caller should skip the work which uses the range (or recreate the ring with a larger "frame_size")
+	virtual void *alloc_uniform_upload_ring_range(brx_uniform_upload_ring *uniform_upload_ring, uint32_t size, uint32_t *out_dynamic_offset) const = 0;
+	virtual void destroy_uniform_upload_ring(brx_uniform_upload_ring *uniform_upload_ring) = 0;
 	virtual uint32_t get_staging_upload_buffer_offset_alignment() const = 0;
 	virtual uint32_t get_staging_upload_buffer_row_pitch_alignment() const = 0;
 	virtual brx_staging_upload_buffer *create_staging_upload_buffer(uint32_t size) const = 0;
 	virtual void destroy_staging_upload_buffer(brx_staging_upload_buffer *staging_upload_buffer) const = 0;
-	virtual brx_intermediate_storage_buffer *create_intermediate_storage_buffer(uint32_t size, bool allow_vertex_position, bool allow_vertex_varying) const = 0;
+	// the staging upload ring is persistently mapped, and grows (rather than waiting for the in flight uploads) when there is NOT enough space
+	// the range is aligned to both the "get_staging_upload_buffer_offset_alignment" and the "get_staging_upload_buffer_row_pitch_alignment", and the returned host address is where the data should be written
+	// the ranges allocated since the last "submit_staging_upload_ring" are retired when the fence, which is passed to the "wait_and_submit" of the upload command buffer, is waited by the "wait_for_fence"
+	// the ranges allocated since the last "submit_staging_upload_ring_timeline_fence" are retired when the completed value of the timeline fence, which is polled by the "alloc_staging_upload_ring_range", reaches the value signaled after the uploads (e.g., by the "submit_and_signal_timeline_fence" of the upload queue)
+	virtual brx_staging_upload_ring *create_staging_upload_ring(uint32_t initial_size) = 0;
+	virtual void *alloc_staging_upload_ring_range(brx_staging_upload_ring *staging_upload_ring, uint32_t size, brx_staging_upload_buffer **out_staging_upload_buffer, uint64_t *out_offset) = 0;
+	virtual void submit_staging_upload_ring(brx_staging_upload_ring *staging_upload_ring, brx_fence const *fence) = 0;
+	virtual void submit_staging_upload_ring_timeline_fence(brx_staging_upload_ring *staging_upload_ring, brx_timeline_fence const *timeline_fence, uint64_t value) = 0;
+	virtual BRX_STAGING_UPLOAD_RING_STATISTICS get_staging_upload_ring_statistics(brx_staging_upload_ring const *staging_upload_ring) = 0;
+	// the ring should NOT be destroyed until the GPU has finished all the uploads from it
+	virtual void destroy_staging_upload_ring(brx_staging_upload_ring *staging_upload_ring) = 0;
+	virtual brx_intermediate_storage_buffer *create_intermediate_storage_buffer(uint32_t size, bool allow_vertex_position, bool allow_vertex_varying, bool allow_indirect_argument = false) const = 0;
 	virtual void destroy_intermediate_storage_buffer(brx_intermediate_storage_buffer *intermediate_storage_buffer) const = 0;
 	virtual brx_asset_vertex_position_buffer *create_asset_vertex_position_buffer(uint32_t size) const = 0;
 	virtual void destroy_asset_vertex_position_buffer(brx_asset_vertex_position_buffer *asset_vertex_position_buffer) const = 0;
@@ -286,6 +486,14 @@ public:
 	virtual void destroy_asset_vertex_varying_buffer(brx_asset_vertex_varying_buffer *asset_vertex_varying_buffer) const = 0;
 	virtual brx_asset_index_buffer *create_asset_index_buffer(uint32_t size) const = 0;
 	virtual void destroy_asset_index_buffer(brx_asset_index_buffer *asset_index_buffer) const = 0;
+	// the sub-allocator only manages the offsets within one large shared asset buffer, which is created by the "create_asset_vertex_position_buffer", "create_asset_vertex_varying_buffer" or "create_asset_index_buffer" with the same size
+	// the offset is aligned to the "alignment", which can be the vertex stride or the index size to derive the base vertex or the first index from the offset
+	// NOT thread-safe
+	virtual brx_asset_buffer_sub_allocator *create_asset_buffer_sub_allocator(uint64_t size, uint32_t alignment) const = 0;
+	// false is returned when there is NOT enough contiguous space
+	virtual bool alloc_asset_buffer_range(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator, uint32_t size, uint64_t *out_offset) const = 0;
+	virtual void free_asset_buffer_range(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator, uint64_t offset) const = 0;
+	virtual void destroy_asset_buffer_sub_allocator(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator) const = 0;
 	virtual brx_color_attachment_image *create_color_attachment_image(BRX_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const = 0;
 	virtual void destroy_color_attachment_image(brx_color_attachment_image *color_attachment_image) const = 0;
 	virtual BRX_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT get_depth_attachment_image_format() const = 0;
@@ -296,6 +504,8 @@ public:
 	virtual void destroy_storage_image(brx_storage_image *storage_image) const = 0;
 	virtual bool is_asset_sampled_image_compression_bc_supported() const = 0;
 	virtual bool is_asset_sampled_image_compression_astc_supported() const = 0;
+	// the count buffer of the "draw_indirect" and the "draw_index_indirect" is NOT supported when false is returned
+	virtual bool is_indirect_argument_count_supported() const = 0;
 	virtual brx_asset_sampled_image *create_asset_sampled_image(BRX_ASSET_IMAGE_FORMAT asset_sampled_image_format, uint32_t width, uint32_t height, uint32_t mip_levels) const = 0;
 	virtual void destroy_asset_sampled_image(brx_asset_sampled_image *asset_sampled_image) const = 0;
 	virtual brx_sampler *create_sampler(BRX_SAMPLER_FILTER filter) const = 0;
@@ -305,6 +515,18 @@ public:
 	virtual brx_swap_chain *create_swap_chain(brx_surface *surface) const = 0;
 	virtual bool acquire_next_image(brx_graphics_command_buffer *graphics_command_buffer, brx_swap_chain const *swap_chain, uint32_t *out_swap_chain_image_index) const = 0;
 	virtual void destroy_swap_chain(brx_swap_chain *swap_chain) const = 0;
+	// each frame in flight should use its own pool, since the pool should NOT be reset until the GPU has finished the previous writes
+	virtual brx_timestamp_query_pool *create_timestamp_query_pool(uint32_t query_count) const = 0;
+	// the duration (in milliseconds) of one timestamp tick
+	virtual double get_timestamp_period() const = 0;
+	// the "write_timestamp" of the upload command buffer does nothing (and thus the query never becomes available) when false is returned
+	virtual bool is_upload_command_buffer_timestamp_supported() const = 0;
+	// false is returned (instead of waiting) when any of the queries has NOT been written by the GPU yet
+	virtual bool get_timestamp_query_pool_results(brx_timestamp_query_pool const *timestamp_query_pool, uint32_t first_query, uint32_t query_count, uint64_t *out_timestamps) const = 0;
+	// the entries are in the order of the "begin_debug_utils_label" calls recorded since the pool was set by the "set_debug_utils_label_timestamp_query_pool"
+	// false is returned (instead of waiting) when any of the label regions has NOT been finished by the GPU yet
+	virtual bool get_timestamp_query_pool_label_timings(brx_timestamp_query_pool *timestamp_query_pool, uint32_t *out_label_timing_count, BRX_TIMESTAMP_LABEL_TIMING const **out_label_timings) const = 0;
+	virtual void destroy_timestamp_query_pool(brx_timestamp_query_pool *timestamp_query_pool) const = 0;
 	virtual brx_scratch_buffer *create_scratch_buffer(uint32_t size) const = 0;
 	virtual void destroy_scratch_buffer(brx_scratch_buffer *scratch_buffer) const = 0;
 	virtual void get_staging_non_compacted_bottom_level_acceleration_structure_size(uint32_t bottom_level_acceleration_structure_geometry_count, BRX_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY const *bottom_level_acceleration_structure_geometries, uint32_t *staging_non_compacted_bottom_level_acceleration_structure_size, uint32_t *build_scratch_size) const = 0;
@@ -322,17 +544,49 @@ public:
 	virtual void destroy_top_level_acceleration_structure(brx_top_level_acceleration_structure *top_level_acceleration_structure) const = 0;
 };
 
+// the "wait_timeline_fence" may be recorded by the queue and merged into the next submission of the same queue, and thus the queue should NOT be used by multiple threads at the same time
 class brx_graphics_queue
 {
 public:
-	virtual void wait_and_submit(brx_upload_command_buffer const *upload_command_buffer, brx_graphics_command_buffer const *graphics_command_buffer, brx_fence *fence) const = 0;
-	virtual bool submit_and_present(brx_graphics_command_buffer *graphics_command_buffer, brx_swap_chain *swap_chain, uint32_t swap_chain_image_index, brx_fence *fence) const = 0;
+	virtual void wait_and_submit(brx_upload_command_buffer const *upload_command_buffer, brx_graphics_command_buffer const *graphics_command_buffer, brx_fence *fence) = 0;
+	virtual bool submit_and_present(brx_graphics_command_buffer *graphics_command_buffer, brx_swap_chain *swap_chain, uint32_t swap_chain_image_index, brx_fence *fence) = 0;
+	// the value is signaled after all the previous submissions of this queue have completed
+	virtual void signal_timeline_fence(brx_timeline_fence *timeline_fence, uint64_t value) = 0;
+	// the following submissions of this queue are NOT executed until the fence reaches the value
+	// the waits (including the waits passed to the "submit_batch") are pending until the next submission, and an extra empty submission may be performed internally when too many different fences are waited
+	virtual void wait_timeline_fence(brx_timeline_fence const *timeline_fence, uint64_t value) = 0;
+	// the command buffers (e.g. recorded by the worker threads in parallel) are executed in the array order by one submission, and at most 32 command buffers and 16 signaled timeline fences are submitted at once
+	// the submission waits for all the timeline fences before the first command buffer, and signals all the timeline fences and the fence (which may be NULL) after the last command buffer completes
+	virtual void submit_batch(uint32_t graphics_command_buffer_count, brx_graphics_command_buffer const *const *graphics_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *signal_timeline_fences, uint64_t const *signal_values, brx_fence *fence) = 0;
+	// the last command buffer should be the one passed to the "acquire_next_image"
+	virtual bool submit_batch_and_present(uint32_t graphics_command_buffer_count, brx_graphics_command_buffer *const *graphics_command_buffers, brx_swap_chain *swap_chain, uint32_t swap_chain_image_index, brx_fence *fence) = 0;
 };
 
 class brx_upload_queue
 {
 public:
-	virtual void submit_and_signal(brx_upload_command_buffer const *upload_command_buffer) const = 0;
+	virtual void submit_and_signal(brx_upload_command_buffer const *upload_command_buffer) = 0;
+	// the upload command buffer is NOT waited by the "wait_and_submit" of the graphics queue, and the value is signaled when the upload command buffer completes
+	virtual void submit_and_signal_timeline_fence(brx_upload_command_buffer const *upload_command_buffer, brx_timeline_fence *timeline_fence, uint64_t value) = 0;
+	// the same as the "submit_and_signal_timeline_fence", but the upload command buffers are executed in the array order by one submission
+	// the wait is performed by the GPU even if there is no dedicated upload queue (the submission is performed on the graphics queue), and blocks the host ONLY when the uploads are performed by the host (D3D12 UMA)
+	virtual void submit_batch(uint32_t upload_command_buffer_count, brx_upload_command_buffer const *const *upload_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *signal_timeline_fences, uint64_t const *signal_values) = 0;
+	// when there is no dedicated upload queue, the upload command buffers are submitted to the graphics queue (and the submissions are serialized with the graphics queue internally), and thus the signal covers all the upload command buffers submitted by this queue, and the wait is performed by the GPU (but also delays the following graphics submissions)
+	// the wait blocks the host ONLY when the uploads are performed by the host
+	virtual void signal_timeline_fence(brx_timeline_fence *timeline_fence, uint64_t value) = 0;
+	virtual void wait_timeline_fence(brx_timeline_fence const *timeline_fence, uint64_t value) = 0;
+};
+
+// the compute queue is synchronized with the graphics queue ONLY by the timeline fences
+class brx_compute_queue
+{
+public:
+	// the value is signaled after all the previous submissions of this queue have completed
+	virtual void signal_timeline_fence(brx_timeline_fence *timeline_fence, uint64_t value) = 0;
+	// the following submissions of this queue are NOT executed until the fence reaches the value
+	virtual void wait_timeline_fence(brx_timeline_fence const *timeline_fence, uint64_t value) = 0;
+	// the same as the "submit_batch" of the graphics queue
+	virtual void submit_batch(uint32_t compute_command_buffer_count, brx_compute_command_buffer const *const *compute_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *signal_timeline_fences, uint64_t const *signal_values, brx_fence *fence) = 0;
 };
 
 class brx_graphics_command_buffer
@@ -346,24 +600,76 @@ public:
 	virtual void acquire_asset_compacted_bottom_level_acceleration_structure(brx_asset_compacted_bottom_level_acceleration_structure *asset_compacted_bottom_level_acceleration_structure) = 0;
 	virtual void begin_debug_utils_label(char const *label_name) = 0;
 	virtual void end_debug_utils_label() = 0;
-	virtual void begin_render_pass(brx_render_pass const *render_pass, brx_frame_buffer const *frame_buffer, uint32_t width, uint32_t height, uint32_t color_clear_value_count, float const (*color_clear_values)[4], float const *depth_clear_value, uint8_t const *stencil_clear_value) = 0;
+	// the queries should be reset outside the render pass before they are written
+	virtual void reset_timestamp_query_pool(brx_timestamp_query_pool *timestamp_query_pool) = 0;
+	// the timestamp is written after all previous commands have completed
+	virtual void write_timestamp(brx_timestamp_query_pool *timestamp_query_pool, uint32_t query_index) = 0;
+	// the pool (which is reset here, and thus this should be called outside the render pass) records the begin and end timestamps of each debug utils label region, and NULL stops recording
+	// the label regions are NOT timed when the pool is exhausted, and the pool is unset by the "begin"
+	virtual void set_debug_utils_label_timestamp_query_pool(brx_timestamp_query_pool *timestamp_query_pool) = 0;
+	// when the "secondary_graphics_command_buffers" is true, the render pass can ONLY be recorded by the "execute_secondary_graphics_command_buffers" until the "end_render_pass"
+	virtual void begin_render_pass(brx_render_pass const *render_pass, brx_frame_buffer const *frame_buffer, uint32_t width, uint32_t height, uint32_t color_clear_value_count, float const (*color_clear_values)[4], float const *depth_clear_value, uint8_t const *stencil_clear_value, bool secondary_graphics_command_buffers = false) = 0;
+	// the secondary graphics command buffers should have been ended, and should have begun with the same render pass and frame buffer as the current render pass
+	// the state (pipeline, descriptor sets, push constants, vertex buffers, view port and scissor) is NOT inherited from the secondary graphics command buffers, and should be set again before the next commands
+	virtual void execute_secondary_graphics_command_buffers(uint32_t secondary_graphics_command_buffer_count, brx_secondary_graphics_command_buffer const *const *secondary_graphics_command_buffers) = 0;
 	virtual void bind_graphics_pipeline(brx_graphics_pipeline const *graphics_pipeline) = 0;
 	virtual void set_view_port(uint32_t width, uint32_t height) = 0;
 	virtual void set_scissor(uint32_t width, uint32_t height) = 0;
 	virtual void bind_graphics_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) = 0;
-	virtual void bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers) = 0;
-	virtual void draw(uint32_t vertex_count, uint32_t instance_count) = 0;
-	virtual void draw_index(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, uint32_t index_count, uint32_t instance_count) = 0;
+	// the offset and the size (in bytes) should be multiples of 4, and the push constants should be pushed again after the descriptor sets are bound with an incompatible pipeline layout
+	virtual void push_graphics_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values) = 0;
+	// the offsets (in bytes) select the sub-ranges of the large shared vertex buffers, and NULL means that all offsets are zero
+	virtual void bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers, uint64_t const *vertex_buffer_offsets = NULL) = 0;
+	virtual void draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex = 0U, uint32_t first_instance = 0U) = 0;
+	// the "first_index" is in the units of the index type, and the "vertex_offset" (namely the base vertex) is added to each index before fetching the vertices
+	virtual void draw_index(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, uint32_t index_count, uint32_t instance_count, uint32_t first_index = 0U, int32_t vertex_offset = 0, uint32_t first_instance = 0U) = 0;
+	// the "max_draw_count" consecutive "BRX_DRAW_INDIRECT_COMMAND"s are read from the "argument_offset", and the actual draw count is read as the uint from the "count_offset" (and clamped by the "max_draw_count") when the "count_buffer" is NOT NULL
+	virtual void draw_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer = NULL, uint64_t count_offset = 0U) = 0;
+	// the same as the "draw_indirect" except that the "BRX_DRAW_INDEX_INDIRECT_COMMAND"s are read
+	virtual void draw_index_indirect(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer = NULL, uint64_t count_offset = 0U) = 0;
 	virtual void end_render_pass() = 0;
 	virtual void compute_pass_load_storage_image(brx_storage_image const *storage_image, BRX_STORAGE_IMAGE_LOAD_OPERATION load_operation) = 0;
+	// the indirect argument buffer can be written by the compute shader only between the "compute_pass_load_indirect_argument_buffer" and the "compute_pass_store_indirect_argument_buffer"
+	virtual void compute_pass_load_indirect_argument_buffer(brx_indirect_argument_buffer const *indirect_argument_buffer) = 0;
 	virtual void bind_compute_pipeline(brx_compute_pipeline const *compute_pipeline) = 0;
 	virtual void bind_compute_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) = 0;
+	virtual void push_compute_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values) = 0;
 	virtual void dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) = 0;
+	virtual void dispatch_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset) = 0;
 	virtual void compute_pass_store_storage_image(brx_storage_image const *storage_image, BRX_STORAGE_IMAGE_STORE_OPERATION store_operation) = 0;
+	virtual void compute_pass_store_indirect_argument_buffer(brx_indirect_argument_buffer const *indirect_argument_buffer) = 0;
+	// the queue family ownership transfer between the graphics queue and the compute queue
+	// the "release" is recorded by the command buffer of the source queue, and the "acquire" is recorded by the command buffer of the destination queue, whose submission should wait for the timeline fence signaled after the submission of the "release"
+	// the storage image should NOT be inside the compute pass
+	virtual void release_storage_buffer_to_compute_queue(brx_intermediate_storage_buffer const *storage_buffer) = 0;
+	virtual void release_storage_image_to_compute_queue(brx_storage_image const *storage_image) = 0;
+	virtual void acquire_storage_buffer_from_compute_queue(brx_intermediate_storage_buffer const *storage_buffer) = 0;
+	virtual void acquire_storage_image_from_compute_queue(brx_storage_image const *storage_image) = 0;
 	virtual void build_top_level_acceleration_structure(brx_top_level_acceleration_structure *top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, brx_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer, brx_scratch_buffer *scratch_buffer) = 0;
 	virtual void update_top_level_acceleration_structure(brx_top_level_acceleration_structure *top_level_acceleration_structure, brx_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer, brx_scratch_buffer *scratch_buffer) = 0;
 	virtual void acceleration_structure_pass_store_top_level(brx_top_level_acceleration_structure *top_level_acceleration_structure) = 0;
 	virtual void end() = 0;
+	// the statistics are reset by the "begin"
+	virtual BRX_GRAPHICS_COMMAND_BUFFER_STATISTICS get_statistics() const = 0;
+};
+
+// the secondary graphics command buffer records the draws of the part of the render pass (which is begun by the primary graphics command buffer) on the worker thread
+// the state is NOT inherited from the primary graphics command buffer, and the view port and scissor are set to the "width" and "height" by the "begin"
+class brx_secondary_graphics_command_buffer
+{
+public:
+	virtual void begin(brx_render_pass const *render_pass, brx_frame_buffer const *frame_buffer, uint32_t width, uint32_t height) = 0;
+	virtual void bind_graphics_pipeline(brx_graphics_pipeline const *graphics_pipeline) = 0;
+	virtual void bind_graphics_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) = 0;
+	virtual void push_graphics_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values) = 0;
+	virtual void bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers, uint64_t const *vertex_buffer_offsets = NULL) = 0;
+	virtual void draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex = 0U, uint32_t first_instance = 0U) = 0;
+	virtual void draw_index(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, uint32_t index_count, uint32_t instance_count, uint32_t first_index = 0U, int32_t vertex_offset = 0, uint32_t first_instance = 0U) = 0;
+	virtual void draw_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer = NULL, uint64_t count_offset = 0U) = 0;
+	virtual void draw_index_indirect(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer = NULL, uint64_t count_offset = 0U) = 0;
+	virtual void end() = 0;
+	// the statistics are reset by the "begin"
+	virtual BRX_GRAPHICS_COMMAND_BUFFER_STATISTICS get_statistics() const = 0;
 };
 
 class brx_upload_command_buffer
@@ -383,6 +689,31 @@ public:
 	virtual void release_asset_index_buffer(brx_asset_index_buffer *asset_index_buffer) = 0;
 	virtual void release_asset_sampled_image(brx_asset_sampled_image *asset_sampled_image, uint32_t dst_mip_level) = 0;
 	virtual void release_asset_compacted_bottom_level_acceleration_structure(brx_asset_compacted_bottom_level_acceleration_structure *asset_compacted_bottom_level_acceleration_structure) = 0;
+	virtual void reset_timestamp_query_pool(brx_timestamp_query_pool *timestamp_query_pool) = 0;
+	// the timestamps are only comparable with the other timestamps written by the upload command buffer
+	virtual void write_timestamp(brx_timestamp_query_pool *timestamp_query_pool, uint32_t query_index) = 0;
+	virtual void end() = 0;
+};
+
+// the compute command buffer is executed by the compute queue, and can ONLY record the compute passes
+// the resources written by the compute command buffer should be released to the graphics queue before they are used by the graphics command buffer
+class brx_compute_command_buffer
+{
+public:
+	virtual void begin() = 0;
+	virtual void acquire_storage_buffer_from_graphics_queue(brx_intermediate_storage_buffer const *storage_buffer) = 0;
+	virtual void acquire_storage_image_from_graphics_queue(brx_storage_image const *storage_image) = 0;
+	virtual void compute_pass_load_storage_image(brx_storage_image const *storage_image, BRX_STORAGE_IMAGE_LOAD_OPERATION load_operation) = 0;
+	virtual void compute_pass_load_indirect_argument_buffer(brx_indirect_argument_buffer const *indirect_argument_buffer) = 0;
+	virtual void bind_compute_pipeline(brx_compute_pipeline const *compute_pipeline) = 0;
+	virtual void bind_compute_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) = 0;
+	virtual void push_compute_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values) = 0;
+	virtual void dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) = 0;
+	virtual void dispatch_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset) = 0;
+	virtual void compute_pass_store_storage_image(brx_storage_image const *storage_image, BRX_STORAGE_IMAGE_STORE_OPERATION store_operation) = 0;
+	virtual void compute_pass_store_indirect_argument_buffer(brx_indirect_argument_buffer const *indirect_argument_buffer) = 0;
+	virtual void release_storage_buffer_to_graphics_queue(brx_intermediate_storage_buffer const *storage_buffer) = 0;
+	virtual void release_storage_image_to_graphics_queue(brx_storage_image const *storage_image) = 0;
 	virtual void end() = 0;
 };
 
@@ -390,6 +721,14 @@ class brx_fence
 {
 };
 
+class brx_timeline_fence
+{
+};
+
+class brx_upload_scheduler
+{
+};
+
 class brx_descriptor_set_layout
 {
 };
@@ -402,6 +741,14 @@ class brx_descriptor_set
 {
 };
 
+class brx_bindless_table
+{
+};
+
+class brx_transient_descriptor_allocator
+{
+};
+
 class brx_render_pass
 {
 };
@@ -414,6 +761,14 @@ class brx_compute_pipeline
 {
 };
 
+class brx_graphics_pipeline_compilation
+{
+};
+
+class brx_compute_pipeline_compilation
+{
+};
+
 class brx_frame_buffer
 {
 };
@@ -424,12 +779,20 @@ public:
 	virtual void *get_host_memory_range_base() const = 0;
 };
 
+class brx_uniform_upload_ring
+{
+};
+
 class brx_staging_upload_buffer
 {
 public:
 	virtual void *get_host_memory_range_base() const = 0;
 };
 
+class brx_staging_upload_ring
+{
+};
+
 class brx_vertex_buffer
 {
 };
@@ -450,6 +813,10 @@ class brx_storage_buffer
 {
 };
 
+class brx_indirect_argument_buffer
+{
+};
+
 class brx_intermediate_storage_buffer
 {
 public:
@@ -457,6 +824,8 @@ public:
 	virtual brx_vertex_position_buffer const *get_vertex_position_buffer() const = 0;
 	virtual brx_vertex_varying_buffer const *get_vertex_varying_buffer() const = 0;
 	virtual brx_storage_buffer const *get_storage_buffer() const = 0;
+	// only valid when the "allow_indirect_argument" is true
+	virtual brx_indirect_argument_buffer const *get_indirect_argument_buffer() const = 0;
 };
 
 class brx_asset_vertex_position_buffer
@@ -475,6 +844,10 @@ public:
 	virtual brx_storage_buffer const *get_storage_buffer() const = 0;
 };
 
+class brx_asset_buffer_sub_allocator
+{
+};
+
 class brx_asset_index_buffer
 {
 public:
@@ -518,6 +891,10 @@ class brx_surface
 {
 };
 
+class brx_timestamp_query_pool
+{
+};
+
 class brx_swap_chain
 {
 public:
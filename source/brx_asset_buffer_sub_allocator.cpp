@@ -0,0 +1,116 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_asset_buffer_sub_allocator.h"
+#include <assert.h>
+#include <iterator>
+
+brx_asset_buffer_sub_allocator_instance::brx_asset_buffer_sub_allocator_instance() : m_alignment(0U)
+{
+}
+
+void brx_asset_buffer_sub_allocator_instance::init(uint64_t size, uint32_t alignment)
+{
+	// the alignment is NOT necessarily the power of 2, since the vertex stride can be used as the alignment to derive the base vertex from the offset
+	assert(alignment > 0U);
+	this->m_alignment = alignment;
+
+	assert(this->m_free_ranges.empty());
+	assert(this->m_allocated_ranges.empty());
+	if (size > 0U)
+	{
+		this->m_free_ranges.emplace(0U, size);
+	}
+}
+
+void brx_asset_buffer_sub_allocator_instance::uninit()
+{
+	this->m_free_ranges.clear();
+	this->m_allocated_ranges.clear();
+}
+
+brx_asset_buffer_sub_allocator_instance::~brx_asset_buffer_sub_allocator_instance()
+{
+	assert(this->m_free_ranges.empty());
+	assert(this->m_allocated_ranges.empty());
+}
+
+bool brx_asset_buffer_sub_allocator_instance::alloc(uint32_t size, uint64_t *out_offset)
+{
+	assert(size > 0U);
+	assert(NULL != out_offset);
+
+	// first fit
+	for (auto free_range = this->m_free_ranges.begin(); free_range != this->m_free_ranges.end(); ++free_range)
+	{
+		uint64_t const free_range_begin = free_range->first;
+		uint64_t const free_range_end = free_range->first + free_range->second;
+		uint64_t const aligned_offset = ((free_range_begin + (this->m_alignment - 1U)) / this->m_alignment) * this->m_alignment;
+
+		if ((aligned_offset + size) <= free_range_end)
+		{
+			this->m_free_ranges.erase(free_range);
+
+			if (aligned_offset > free_range_begin)
+			{
+				this->m_free_ranges.emplace(free_range_begin, aligned_offset - free_range_begin);
+			}
+
+			if ((aligned_offset + size) < free_range_end)
+			{
+				this->m_free_ranges.emplace(aligned_offset + size, free_range_end - (aligned_offset + size));
+			}
+
+			this->m_allocated_ranges.emplace(aligned_offset, size);
+
+			(*out_offset) = aligned_offset;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void brx_asset_buffer_sub_allocator_instance::free(uint64_t offset)
+{
+	auto const allocated_range = this->m_allocated_ranges.find(offset);
+	assert(this->m_allocated_ranges.end() != allocated_range);
+
+	uint64_t free_range_begin = allocated_range->first;
+	uint64_t free_range_end = allocated_range->first + allocated_range->second;
+	this->m_allocated_ranges.erase(allocated_range);
+
+	// coalesce with the adjacent free ranges
+	auto next_free_range = this->m_free_ranges.lower_bound(free_range_begin);
+	if ((this->m_free_ranges.end() != next_free_range) && (next_free_range->first == free_range_end))
+	{
+		free_range_end = next_free_range->first + next_free_range->second;
+		next_free_range = this->m_free_ranges.erase(next_free_range);
+	}
+
+	if (this->m_free_ranges.begin() != next_free_range)
+	{
+		auto const previous_free_range = std::prev(next_free_range);
+		if ((previous_free_range->first + previous_free_range->second) == free_range_begin)
+		{
+			free_range_begin = previous_free_range->first;
+			this->m_free_ranges.erase(previous_free_range);
+		}
+	}
+
+	this->m_free_ranges.emplace(free_range_begin, free_range_end - free_range_begin);
+}
@@ -0,0 +1,41 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_ASSET_BUFFER_SUB_ALLOCATOR_H_
+#define _BRX_ASSET_BUFFER_SUB_ALLOCATOR_H_ 1
+
+#include "../include/brx_device.h"
+#include "brx_map.h"
+
+// only the offsets are managed, and the sub-ranges of the large shared asset buffer are uploaded by the "dst_offset" and bound by the offsets of the command buffer
+class brx_asset_buffer_sub_allocator_instance : public brx_asset_buffer_sub_allocator
+{
+	uint32_t m_alignment;
+	// offset => size
+	brx_map<uint64_t, uint64_t> m_free_ranges;
+	brx_map<uint64_t, uint64_t> m_allocated_ranges;
+
+public:
+	brx_asset_buffer_sub_allocator_instance();
+	void init(uint64_t size, uint32_t alignment);
+	void uninit();
+	~brx_asset_buffer_sub_allocator_instance();
+	bool alloc(uint32_t size, uint64_t *out_offset);
+	void free(uint64_t offset);
+};
+
+#endif
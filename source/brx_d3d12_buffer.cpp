@@ -140,11 +140,11 @@ void *brx_d3d12_staging_upload_buffer::get_host_memory_range_base() const
 	return this->m_host_memory_range_base;
 }
 
-brx_d3d12_intermediate_storage_buffer::brx_d3d12_intermediate_storage_buffer() : m_resource(NULL), m_allocation(NULL)
+brx_d3d12_intermediate_storage_buffer::brx_d3d12_intermediate_storage_buffer() : m_resource(NULL), m_allocation(NULL), m_indirect_argument_resource_state(D3D12_RESOURCE_STATE_COMMON)
 {
 }
 
-void brx_d3d12_intermediate_storage_buffer::init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *storage_buffer_memory_pool, uint32_t wrapped_size, bool allow_vertex_position, bool allow_vertex_varying)
+void brx_d3d12_intermediate_storage_buffer::init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *storage_buffer_memory_pool, uint32_t wrapped_size, bool allow_vertex_position, bool allow_vertex_varying, bool allow_indirect_argument)
 {
 	uint32_t const num_elements = ((wrapped_size - 1U) / sizeof(uint32_t)) + 1U;
 	uint32_t const size_elements = sizeof(uint32_t) * num_elements;
@@ -171,7 +171,14 @@ void brx_d3d12_intermediate_storage_buffer::init(D3D12MA::Allocator *memory_allo
 		D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
 		D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS};
 
-	HRESULT hr_create_resource = memory_allocator->CreateResource(&allocation_desc, &resource_desc, ((!allow_vertex_position) && (!allow_vertex_varying)) ? D3D12_RESOURCE_STATE_UNORDERED_ACCESS : (D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE), NULL, &this->m_allocation, IID_PPV_ARGS(&this->m_resource));
+	// the indirect argument buffer is created in the read state, and is transitioned to the unordered access state by the "compute_pass_load_indirect_argument_buffer"
+	assert(D3D12_RESOURCE_STATE_COMMON == this->m_indirect_argument_resource_state);
+	if (allow_indirect_argument)
+	{
+		this->m_indirect_argument_resource_state = ((!allow_vertex_position) && (!allow_vertex_varying)) ? (D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE) : (D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT | D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+	}
+
+	HRESULT hr_create_resource = memory_allocator->CreateResource(&allocation_desc, &resource_desc, allow_indirect_argument ? this->m_indirect_argument_resource_state : (((!allow_vertex_position) && (!allow_vertex_varying)) ? D3D12_RESOURCE_STATE_UNORDERED_ACCESS : (D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE)), NULL, &this->m_allocation, IID_PPV_ARGS(&this->m_resource));
 	assert(SUCCEEDED(hr_create_resource));
 
 	this->m_unordered_access_view_desc = D3D12_UNORDERED_ACCESS_VIEW_DESC{
@@ -247,6 +254,18 @@ brx_storage_buffer const *brx_d3d12_intermediate_storage_buffer::get_storage_buf
 	return static_cast<brx_d3d12_storage_buffer const *>(this);
 }
 
+D3D12_RESOURCE_STATES brx_d3d12_intermediate_storage_buffer::get_indirect_argument_resource_state() const
+{
+	assert(D3D12_RESOURCE_STATE_COMMON != this->m_indirect_argument_resource_state);
+	return this->m_indirect_argument_resource_state;
+}
+
+brx_indirect_argument_buffer const *brx_d3d12_intermediate_storage_buffer::get_indirect_argument_buffer() const
+{
+	assert(D3D12_RESOURCE_STATE_COMMON != this->m_indirect_argument_resource_state);
+	return static_cast<brx_d3d12_indirect_argument_buffer const *>(this);
+}
+
 brx_d3d12_asset_vertex_position_buffer::brx_d3d12_asset_vertex_position_buffer() : m_resource(NULL), m_allocation(NULL)
 {
 }
@@ -686,6 +705,114 @@ D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC volat
 	return this->m_host_memory_range_base;
 }
 
+brx_d3d12_timestamp_query_pool::brx_d3d12_timestamp_query_pool() : m_query_heap(NULL), m_resource(NULL), m_allocation(NULL), m_host_memory_range_base(NULL), m_query_count(0U)
+{
+}
+
+void brx_d3d12_timestamp_query_pool::init(ID3D12Device *device, D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *timestamp_query_buffer_memory_pool, uint32_t query_count)
+{
+	D3D12_QUERY_HEAP_DESC const query_heap_desc = {
+		D3D12_QUERY_HEAP_TYPE_TIMESTAMP,
+		query_count,
+		0U};
+
+	assert(NULL == this->m_query_heap);
+	HRESULT const hr_create_query_heap = device->CreateQueryHeap(&query_heap_desc, IID_PPV_ARGS(&this->m_query_heap));
+	assert(SUCCEEDED(hr_create_query_heap));
+
+	uint32_t const size = sizeof(uint64_t) * query_count;
+
+	D3D12MA::ALLOCATION_DESC const allocation_desc = {
+		D3D12MA::ALLOCATION_FLAG_NONE,
+		D3D12_HEAP_TYPE_CUSTOM,
+		D3D12_HEAP_FLAG_NONE,
+		timestamp_query_buffer_memory_pool,
+		NULL};
+
+	D3D12_RESOURCE_DESC const resource_desc = {
+		D3D12_RESOURCE_DIMENSION_BUFFER,
+		D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT,
+		size,
+		1U,
+		1U,
+		1U,
+		DXGI_FORMAT_UNKNOWN,
+		{1U, 0U},
+		D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+		D3D12_RESOURCE_FLAG_NONE};
+
+	// the destination of the "ResolveQueryData" should be in the copy dest state
+	HRESULT const hr_create_resource = memory_allocator->CreateResource(&allocation_desc, &resource_desc, D3D12_RESOURCE_STATE_COPY_DEST, NULL, &this->m_allocation, IID_PPV_ARGS(&this->m_resource));
+	assert(SUCCEEDED(hr_create_resource));
+
+	void *host_memory_range_base = NULL;
+	D3D12_RANGE const read_range = {0U, size};
+	HRESULT const hr_map = this->m_resource->Map(0U, &read_range, &host_memory_range_base);
+	assert(SUCCEEDED(hr_map));
+
+	assert(NULL == this->m_host_memory_range_base);
+	this->m_host_memory_range_base = static_cast<uint64_t *>(host_memory_range_base);
+
+	// all queries are unavailable until they are written
+	for (uint32_t query_index = 0U; query_index < query_count; ++query_index)
+	{
+		this->m_host_memory_range_base[query_index] = static_cast<uint64_t>(-1);
+	}
+
+	this->m_query_count = query_count;
+
+	this->m_label_list.init(query_count);
+}
+
+void brx_d3d12_timestamp_query_pool::uninit()
+{
+	this->m_label_list.uninit();
+
+	assert(NULL != this->m_resource);
+	this->m_resource->Release();
+	this->m_resource = NULL;
+
+	assert(NULL != this->m_allocation);
+	this->m_allocation->Release();
+	this->m_allocation = NULL;
+
+	assert(NULL != this->m_query_heap);
+	this->m_query_heap->Release();
+	this->m_query_heap = NULL;
+}
+
+brx_d3d12_timestamp_query_pool::~brx_d3d12_timestamp_query_pool()
+{
+	assert(NULL == this->m_query_heap);
+	assert(NULL == this->m_resource);
+	assert(NULL == this->m_allocation);
+}
+
+ID3D12QueryHeap *brx_d3d12_timestamp_query_pool::get_query_heap() const
+{
+	return this->m_query_heap;
+}
+
+ID3D12Resource *brx_d3d12_timestamp_query_pool::get_resource() const
+{
+	return this->m_resource;
+}
+
+uint64_t volatile *brx_d3d12_timestamp_query_pool::get_host_memory_range_base() const
+{
+	return this->m_host_memory_range_base;
+}
+
+uint32_t brx_d3d12_timestamp_query_pool::get_query_count() const
+{
+	return this->m_query_count;
+}
+
+brx_timestamp_query_label_list *brx_d3d12_timestamp_query_pool::get_label_list()
+{
+	return &this->m_label_list;
+}
+
 brx_d3d12_asset_compacted_bottom_level_acceleration_structure::brx_d3d12_asset_compacted_bottom_level_acceleration_structure() : m_resource(NULL), m_allocation(NULL)
 {
 }
@@ -24,23 +24,90 @@
 #include <pix.h>
 #endif
 
+brx_d3d12_pending_resource_barrier::brx_d3d12_pending_resource_barrier() : m_resource_barrier_count(0U)
+{
+}
+
+void brx_d3d12_pending_resource_barrier::resource_barrier(ID3D12GraphicsCommandList4 *command_list, uint32_t resource_barrier_count, D3D12_RESOURCE_BARRIER const *resource_barriers)
+{
+    // to be consistent with the Vulkan backend, the pending barriers on the same resource are flushed at first
+    bool same_resource = false;
+
+    for (uint32_t resource_barrier_index = 0U; (!same_resource) && (resource_barrier_index < resource_barrier_count); ++resource_barrier_index)
+    {
+        assert((D3D12_RESOURCE_BARRIER_TYPE_TRANSITION == resource_barriers[resource_barrier_index].Type) || (D3D12_RESOURCE_BARRIER_TYPE_UAV == resource_barriers[resource_barrier_index].Type));
+        ID3D12Resource *const resource = (D3D12_RESOURCE_BARRIER_TYPE_TRANSITION == resource_barriers[resource_barrier_index].Type) ? resource_barriers[resource_barrier_index].Transition.pResource : resource_barriers[resource_barrier_index].UAV.pResource;
+
+        for (uint32_t pending_resource_barrier_index = 0U; (!same_resource) && (pending_resource_barrier_index < this->m_resource_barrier_count); ++pending_resource_barrier_index)
+        {
+            ID3D12Resource *const pending_resource = (D3D12_RESOURCE_BARRIER_TYPE_TRANSITION == this->m_resource_barriers[pending_resource_barrier_index].Type) ? this->m_resource_barriers[pending_resource_barrier_index].Transition.pResource : this->m_resource_barriers[pending_resource_barrier_index].UAV.pResource;
+            same_resource = (pending_resource == resource);
+        }
+    }
+
+    if (same_resource)
+    {
+        this->flush(command_list);
+    }
+
+    // the order of the barriers is preserved, and thus they can be split into multiple commands when the array is full
+    for (uint32_t resource_barrier_index = 0U; resource_barrier_index < resource_barrier_count; ++resource_barrier_index)
+    {
+        if (this->m_resource_barrier_count >= g_d3d12_max_pending_resource_barrier_count)
+        {
+            this->flush(command_list);
+        }
+
+        this->m_resource_barriers[this->m_resource_barrier_count] = resource_barriers[resource_barrier_index];
+        ++this->m_resource_barrier_count;
+    }
+}
+
+void brx_d3d12_pending_resource_barrier::flush(ID3D12GraphicsCommandList4 *command_list)
+{
+    if (this->m_resource_barrier_count > 0U)
+    {
+        command_list->ResourceBarrier(this->m_resource_barrier_count, &this->m_resource_barriers[0]);
+
+        this->m_resource_barrier_count = 0U;
+    }
+}
+
+brx_d3d12_pending_resource_barrier::~brx_d3d12_pending_resource_barrier()
+{
+    assert(0U == this->m_resource_barrier_count);
+}
+
 brx_d3d12_graphics_command_buffer::brx_d3d12_graphics_command_buffer()
-    : m_command_allocator(NULL),
+    : m_command_list_type(static_cast<D3D12_COMMAND_LIST_TYPE>(-1)),
+      m_command_allocator(NULL),
       m_command_list(NULL),
       m_descriptor_allocator(NULL),
+      m_draw_indirect_command_signature(NULL),
+      m_draw_index_indirect_command_signature(NULL),
+      m_dispatch_indirect_command_signature(NULL),
       m_current_render_pass(NULL),
-      m_current_frame_buffer(NULL)
+      m_current_frame_buffer(NULL),
+      m_current_vertex_buffer_count(0U),
+      m_current_graphics_root_signature(NULL),
+      m_current_compute_root_signature(NULL),
+      m_debug_utils_label_timestamp_query_pool(NULL)
 {
+    this->m_statistics.emitted_state_command_count = 0U;
+    this->m_statistics.elided_state_command_count = 0U;
 }
 
-void brx_d3d12_graphics_command_buffer::init(ID3D12Device *device, bool uma, bool support_ray_tracing, brx_d3d12_descriptor_allocator *descriptor_allocator)
+void brx_d3d12_graphics_command_buffer::init(D3D12_COMMAND_LIST_TYPE command_list_type, ID3D12Device *device, bool uma, bool support_ray_tracing, brx_d3d12_descriptor_allocator *descriptor_allocator, ID3D12CommandSignature *draw_indirect_command_signature, ID3D12CommandSignature *draw_index_indirect_command_signature, ID3D12CommandSignature *dispatch_indirect_command_signature)
 {
+    assert(D3D12_COMMAND_LIST_TYPE_DIRECT == command_list_type || D3D12_COMMAND_LIST_TYPE_BUNDLE == command_list_type);
+    this->m_command_list_type = command_list_type;
+
     assert(NULL == this->m_command_allocator);
-    HRESULT const hr_create_command_allocator = device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&this->m_command_allocator));
+    HRESULT const hr_create_command_allocator = device->CreateCommandAllocator(command_list_type, IID_PPV_ARGS(&this->m_command_allocator));
     assert(SUCCEEDED(hr_create_command_allocator));
 
     assert(NULL == this->m_command_list);
-    HRESULT const hr_create_command_list = device->CreateCommandList(0U, D3D12_COMMAND_LIST_TYPE_DIRECT, this->m_command_allocator, NULL, IID_PPV_ARGS(&this->m_command_list));
+    HRESULT const hr_create_command_list = device->CreateCommandList(0U, command_list_type, this->m_command_allocator, NULL, IID_PPV_ARGS(&this->m_command_list));
     assert(SUCCEEDED(hr_create_command_list));
 
     HRESULT const hr_close = this->m_command_list->Close();
@@ -53,11 +120,19 @@ void brx_d3d12_graphics_command_buffer::init(ID3D12Device *device, bool uma, boo
     assert(NULL == this->m_descriptor_allocator);
     this->m_descriptor_allocator = descriptor_allocator;
 
+    // the command signatures are owned by the device
+    assert(NULL == this->m_draw_indirect_command_signature);
+    this->m_draw_indirect_command_signature = draw_indirect_command_signature;
+    assert(NULL == this->m_draw_index_indirect_command_signature);
+    this->m_draw_index_indirect_command_signature = draw_index_indirect_command_signature;
+    assert(NULL == this->m_dispatch_indirect_command_signature);
+    this->m_dispatch_indirect_command_signature = dispatch_indirect_command_signature;
+
     assert(NULL == this->m_current_render_pass);
 
     assert(NULL == this->m_current_frame_buffer);
 
-    assert(0U == this->m_current_vertex_buffer_strides.size());
+    assert(0U == this->m_current_vertex_buffer_count);
 }
 
 void brx_d3d12_graphics_command_buffer::uninit()
@@ -87,14 +162,46 @@ ID3D12GraphicsCommandList4 *brx_d3d12_graphics_command_buffer::get_command_list(
     return this->m_command_list;
 }
 
+void brx_d3d12_graphics_command_buffer::begin_bundle()
+{
+    assert(D3D12_COMMAND_LIST_TYPE_BUNDLE == this->m_command_list_type);
+
+    HRESULT hr_reset = this->m_command_list->Reset(this->m_command_allocator, NULL);
+    assert(SUCCEEDED(hr_reset));
+
+    // the descriptor heaps of the bundle should be the same as the direct command list
+    this->m_descriptor_allocator->bind_command_list(this->m_command_list);
+
+    this->m_current_vertex_buffer_count = 0U;
+
+    this->m_current_graphics_root_signature = NULL;
+    this->m_current_compute_root_signature = NULL;
+
+    this->m_debug_utils_label_timestamp_query_pool = NULL;
+
+    this->m_statistics.emitted_state_command_count = 0U;
+    this->m_statistics.elided_state_command_count = 0U;
+}
+
 void brx_d3d12_graphics_command_buffer::begin()
 {
+    assert(D3D12_COMMAND_LIST_TYPE_DIRECT == this->m_command_list_type);
+
     HRESULT hr_reset = this->m_command_list->Reset(this->m_command_allocator, NULL);
     assert(SUCCEEDED(hr_reset));
 
     this->m_descriptor_allocator->bind_command_list(this->m_command_list);
 
-    this->m_current_vertex_buffer_strides.clear();
+    this->m_current_vertex_buffer_count = 0U;
+
+    this->m_current_graphics_root_signature = NULL;
+    this->m_current_compute_root_signature = NULL;
+
+    this->m_debug_utils_label_timestamp_query_pool = NULL;
+
+    // the redundant state commands are NOT filtered by the D3D12 backend
+    this->m_statistics.emitted_state_command_count = 0U;
+    this->m_statistics.elided_state_command_count = 0U;
 }
 
 void brx_d3d12_graphics_command_buffer::acquire_asset_vertex_position_buffer(brx_asset_vertex_position_buffer *wrapped_asset_vertex_position_buffer)
@@ -113,7 +220,7 @@ void brx_d3d12_graphics_command_buffer::acquire_asset_vertex_position_buffer(brx
             D3D12_RESOURCE_STATE_COMMON,
             (!this->m_support_ray_tracing) ? D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER : (D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE)}};
 
-    this->m_command_list->ResourceBarrier(1U, &acquire_barrier);
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &acquire_barrier);
 }
 
 void brx_d3d12_graphics_command_buffer::acquire_asset_vertex_varying_buffer(brx_asset_vertex_varying_buffer *wrapped_asset_vertex_varying_buffer)
@@ -132,7 +239,7 @@ void brx_d3d12_graphics_command_buffer::acquire_asset_vertex_varying_buffer(brx_
             D3D12_RESOURCE_STATE_COMMON,
             (!this->m_support_ray_tracing) ? D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER : (D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE)}};
 
-    this->m_command_list->ResourceBarrier(1U, &acquire_barrier);
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &acquire_barrier);
 }
 
 void brx_d3d12_graphics_command_buffer::acquire_asset_index_buffer(brx_asset_index_buffer *wrapped_asset_index_buffer)
@@ -150,7 +257,7 @@ void brx_d3d12_graphics_command_buffer::acquire_asset_index_buffer(brx_asset_ind
             0U,
             D3D12_RESOURCE_STATE_COMMON,
             (!this->m_support_ray_tracing) ? D3D12_RESOURCE_STATE_INDEX_BUFFER : (D3D12_RESOURCE_STATE_INDEX_BUFFER | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE)}};
-    this->m_command_list->ResourceBarrier(1U, &acquire_barrier);
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &acquire_barrier);
 }
 
 void brx_d3d12_graphics_command_buffer::acquire_asset_sampled_image(brx_asset_sampled_image *wrapped_asset_sampled_image, uint32_t dst_mip_level)
@@ -168,7 +275,7 @@ void brx_d3d12_graphics_command_buffer::acquire_asset_sampled_image(brx_asset_sa
             dst_mip_level,
             D3D12_RESOURCE_STATE_COMMON,
             D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
-    this->m_command_list->ResourceBarrier(1U, &resource_acquire_barrier);
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &resource_acquire_barrier);
 }
 
 void brx_d3d12_graphics_command_buffer::acquire_asset_compacted_bottom_level_acceleration_structure(brx_asset_compacted_bottom_level_acceleration_structure *wrapped_asset_compacted_bottom_level_acceleration_structure)
@@ -181,7 +288,7 @@ void brx_d3d12_graphics_command_buffer::acquire_asset_compacted_bottom_level_acc
         .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
         .UAV = {
             asset_buffer_resource}};
-    this->m_command_list->ResourceBarrier(1U, &acquire_barrier);
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &acquire_barrier);
 }
 
 void brx_d3d12_graphics_command_buffer::begin_debug_utils_label(char const *label_name)
@@ -189,17 +296,83 @@ void brx_d3d12_graphics_command_buffer::begin_debug_utils_label(char const *labe
 #ifndef NDEBUG
     PIXBeginEvent(this->m_command_list, 0, label_name);
 #endif
+
+    // the label regions are timed even if the "NDEBUG" is defined
+    if (NULL != this->m_debug_utils_label_timestamp_query_pool)
+    {
+        uint32_t query_index;
+        if (this->m_debug_utils_label_timestamp_query_pool->get_label_list()->begin_label(label_name, &query_index))
+        {
+            this->write_timestamp(this->m_debug_utils_label_timestamp_query_pool, query_index);
+        }
+    }
 }
 
 void brx_d3d12_graphics_command_buffer::end_debug_utils_label()
 {
+    if (NULL != this->m_debug_utils_label_timestamp_query_pool)
+    {
+        uint32_t query_index;
+        if (this->m_debug_utils_label_timestamp_query_pool->get_label_list()->end_label(&query_index))
+        {
+            this->write_timestamp(this->m_debug_utils_label_timestamp_query_pool, query_index);
+        }
+    }
+
 #ifndef NDEBUG
     PIXEndEvent(this->m_command_list);
 #endif
 }
 
-void brx_d3d12_graphics_command_buffer::begin_render_pass(brx_render_pass const *brx_render_pass, brx_frame_buffer const *brx_frame_buffer, uint32_t width, uint32_t height, uint32_t color_clear_value_count, float const (*color_clear_values)[4], float const *depth_clear_value, uint8_t const *stencil_clear_value)
+void brx_d3d12_graphics_command_buffer::reset_timestamp_query_pool(brx_timestamp_query_pool *wrapped_timestamp_query_pool)
+{
+    assert(NULL != wrapped_timestamp_query_pool);
+    brx_d3d12_timestamp_query_pool *const unwrapped_timestamp_query_pool = static_cast<brx_d3d12_timestamp_query_pool *>(wrapped_timestamp_query_pool);
+
+    unwrapped_timestamp_query_pool->get_label_list()->reset();
+
+    // the D3D12 queries do NOT need to be reset, and the readback buffer is marked as unavailable by the CPU (the GPU should have finished the previous writes)
+    uint64_t volatile *const query_pool_memory_range_base = unwrapped_timestamp_query_pool->get_host_memory_range_base();
+    uint32_t const query_count = unwrapped_timestamp_query_pool->get_query_count();
+    for (uint32_t query_index = 0U; query_index < query_count; ++query_index)
+    {
+        query_pool_memory_range_base[query_index] = static_cast<uint64_t>(-1);
+    }
+}
+
+void brx_d3d12_graphics_command_buffer::write_timestamp(brx_timestamp_query_pool *wrapped_timestamp_query_pool, uint32_t query_index)
+{
+    assert(NULL != wrapped_timestamp_query_pool);
+    brx_d3d12_timestamp_query_pool *const unwrapped_timestamp_query_pool = static_cast<brx_d3d12_timestamp_query_pool *>(wrapped_timestamp_query_pool);
+
+    assert(query_index < unwrapped_timestamp_query_pool->get_query_count());
+
+    // the pending barriers belong to the previous commands
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
+    this->m_command_list->EndQuery(unwrapped_timestamp_query_pool->get_query_heap(), D3D12_QUERY_TYPE_TIMESTAMP, query_index);
+
+    this->m_command_list->ResolveQueryData(unwrapped_timestamp_query_pool->get_query_heap(), D3D12_QUERY_TYPE_TIMESTAMP, query_index, 1U, unwrapped_timestamp_query_pool->get_resource(), sizeof(uint64_t) * query_index);
+}
+
+void brx_d3d12_graphics_command_buffer::set_debug_utils_label_timestamp_query_pool(brx_timestamp_query_pool *wrapped_timestamp_query_pool)
+{
+    if (NULL != wrapped_timestamp_query_pool)
+    {
+        this->reset_timestamp_query_pool(wrapped_timestamp_query_pool);
+
+        this->m_debug_utils_label_timestamp_query_pool = static_cast<brx_d3d12_timestamp_query_pool *>(wrapped_timestamp_query_pool);
+    }
+    else
+    {
+        this->m_debug_utils_label_timestamp_query_pool = NULL;
+    }
+}
+
+void brx_d3d12_graphics_command_buffer::begin_render_pass(brx_render_pass const *brx_render_pass, brx_frame_buffer const *brx_frame_buffer, uint32_t width, uint32_t height, uint32_t color_clear_value_count, float const (*color_clear_values)[4], float const *depth_clear_value, uint8_t const *stencil_clear_value, bool secondary_graphics_command_buffers)
 {
+    // the bundles and the inline commands can be mixed in D3D12, and thus the "secondary_graphics_command_buffers" is NOT used
+
     assert(NULL != brx_render_pass);
     assert(NULL != brx_frame_buffer);
     assert(NULL == this->m_current_render_pass);
@@ -256,7 +429,7 @@ void brx_d3d12_graphics_command_buffer::begin_render_pass(brx_render_pass const
                 0U,
                 D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
                 D3D12_RESOURCE_STATE_RENDER_TARGET}};
-        this->m_command_list->ResourceBarrier(1U, &load_barrier);
+        this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &load_barrier);
     }
 
     for (uint32_t flush_for_present_index = 0U; flush_for_present_index < color_attachment_flush_for_present_count; ++flush_for_present_index)
@@ -272,7 +445,7 @@ void brx_d3d12_graphics_command_buffer::begin_render_pass(brx_render_pass const
                 0U,
                 D3D12_RESOURCE_STATE_PRESENT,
                 D3D12_RESOURCE_STATE_RENDER_TARGET}};
-        this->m_command_list->ResourceBarrier(1U, &load_barrier);
+        this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &load_barrier);
     }
 
     if (depth_stencil_attachment_flush_for_sampled_image)
@@ -285,10 +458,12 @@ void brx_d3d12_graphics_command_buffer::begin_render_pass(brx_render_pass const
                 0U,
                 D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
                 D3D12_RESOURCE_STATE_DEPTH_WRITE}};
-        this->m_command_list->ResourceBarrier(1U, &load_barrier);
+        this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &load_barrier);
     }
 #endif
 
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
     for (uint32_t clear_index = 0U; clear_index < color_clear_value_count; ++clear_index)
     {
         uint32_t const color_attachment_clear_index = color_attachment_clear_indices[clear_index];
@@ -335,6 +510,30 @@ void brx_d3d12_graphics_command_buffer::begin_render_pass(brx_render_pass const
     this->m_command_list->OMSetRenderTargets(num_render_targets, render_target_view_descriptors, FALSE, depth_stencil_view_descriptor);
 }
 
+void brx_d3d12_graphics_command_buffer::execute_secondary_graphics_command_buffers(uint32_t secondary_graphics_command_buffer_count, brx_secondary_graphics_command_buffer const *const *wrapped_secondary_graphics_command_buffers)
+{
+    assert(D3D12_COMMAND_LIST_TYPE_DIRECT == this->m_command_list_type);
+    assert(NULL != this->m_current_render_pass);
+    assert(NULL != wrapped_secondary_graphics_command_buffers);
+
+    for (uint32_t secondary_graphics_command_buffer_index = 0U; secondary_graphics_command_buffer_index < secondary_graphics_command_buffer_count; ++secondary_graphics_command_buffer_index)
+    {
+        assert(NULL != wrapped_secondary_graphics_command_buffers[secondary_graphics_command_buffer_index]);
+        brx_d3d12_secondary_graphics_command_buffer const *const unwrapped_secondary_graphics_command_buffer = static_cast<brx_d3d12_secondary_graphics_command_buffer const *>(wrapped_secondary_graphics_command_buffers[secondary_graphics_command_buffer_index]);
+
+        // the view port and scissor are inherited by the bundle
+        this->set_view_port(unwrapped_secondary_graphics_command_buffer->get_width(), unwrapped_secondary_graphics_command_buffer->get_height());
+        this->set_scissor(unwrapped_secondary_graphics_command_buffer->get_width(), unwrapped_secondary_graphics_command_buffer->get_height());
+
+        this->m_command_list->ExecuteBundle(unwrapped_secondary_graphics_command_buffer->get_command_list());
+    }
+
+    // the pipeline state and the root signature set by the bundle are inherited by the direct command list
+    this->m_current_vertex_buffer_count = 0U;
+    this->m_current_graphics_root_signature = NULL;
+    this->m_current_compute_root_signature = NULL;
+}
+
 void brx_d3d12_graphics_command_buffer::bind_graphics_pipeline(brx_graphics_pipeline const *wrapped_graphics_pipeline)
 {
     assert(NULL != wrapped_graphics_pipeline);
@@ -345,7 +544,8 @@ void brx_d3d12_graphics_command_buffer::bind_graphics_pipeline(brx_graphics_pipe
     D3D12_PRIMITIVE_TOPOLOGY const primitive_topology = unwrapped_graphics_pipeline->get_primitive_topology();
     ID3D12PipelineState *graphics_pipeline = unwrapped_graphics_pipeline->get_pipeline();
 
-    this->m_current_vertex_buffer_strides.resize(vertex_buffer_count);
+    assert(vertex_buffer_count <= g_d3d12_max_vertex_buffer_count);
+    this->m_current_vertex_buffer_count = vertex_buffer_count;
     for (uint32_t vertex_buffer_index = 0U; vertex_buffer_index < vertex_buffer_count; ++vertex_buffer_index)
     {
         this->m_current_vertex_buffer_strides[vertex_buffer_index] = vertex_buffer_strides[vertex_buffer_index];
@@ -354,18 +554,24 @@ void brx_d3d12_graphics_command_buffer::bind_graphics_pipeline(brx_graphics_pipe
     this->m_command_list->IASetPrimitiveTopology(primitive_topology);
 
     this->m_command_list->SetPipelineState(graphics_pipeline);
+
+    ++this->m_statistics.emitted_state_command_count;
 }
 
 void brx_d3d12_graphics_command_buffer::set_view_port(uint32_t width, uint32_t height)
 {
     D3D12_VIEWPORT view_port = {0.0F, 0.0F, static_cast<float>(width), static_cast<float>(height), 0.0F, 1.0F};
     this->m_command_list->RSSetViewports(1U, &view_port);
+
+    ++this->m_statistics.emitted_state_command_count;
 }
 
 void brx_d3d12_graphics_command_buffer::set_scissor(uint32_t width, uint32_t height)
 {
     D3D12_RECT rect = {0, 0, static_cast<LONG>(width), static_cast<LONG>(height)};
     this->m_command_list->RSSetScissorRects(1U, &rect);
+
+    ++this->m_statistics.emitted_state_command_count;
 }
 
 void brx_d3d12_graphics_command_buffer::bind_graphics_descriptor_sets(brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *wrapped_descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets)
@@ -374,7 +580,12 @@ void brx_d3d12_graphics_command_buffer::bind_graphics_descriptor_sets(brx_pipeli
     assert(NULL != wrapped_descriptor_sets);
     ID3D12RootSignature *root_signature = static_cast<brx_d3d12_pipeline_layout const *>(wrapped_pipeline_layout)->get_root_signature();
 
-    this->m_command_list->SetGraphicsRootSignature(root_signature);
+    // the root signature is NOT set again, otherwise the root constants which have been pushed are reset
+    if (this->m_current_graphics_root_signature != root_signature)
+    {
+        this->m_command_list->SetGraphicsRootSignature(root_signature);
+        this->m_current_graphics_root_signature = root_signature;
+    }
 
     uint32_t root_parameter_index = 0U;
     uint32_t dynamic_offet_index = 0U;
@@ -445,36 +656,63 @@ void brx_d3d12_graphics_command_buffer::bind_graphics_descriptor_sets(brx_pipeli
         }
     }
     assert(dynamic_offet_index == dynamic_offet_count);
+
+    ++this->m_statistics.emitted_state_command_count;
+}
+
+void brx_d3d12_graphics_command_buffer::push_graphics_constants(brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t offset, uint32_t size, void const *values)
+{
+    assert(NULL != wrapped_pipeline_layout);
+    assert(NULL != values);
+    brx_d3d12_pipeline_layout const *const unwrapped_pipeline_layout = static_cast<brx_d3d12_pipeline_layout const *>(wrapped_pipeline_layout);
+    ID3D12RootSignature *root_signature = unwrapped_pipeline_layout->get_root_signature();
+
+    assert(0U == (offset & 3U));
+    assert(0U == (size & 3U));
+    assert((offset + size) <= unwrapped_pipeline_layout->get_push_constant_size());
+
+    if (this->m_current_graphics_root_signature != root_signature)
+    {
+        this->m_command_list->SetGraphicsRootSignature(root_signature);
+        this->m_current_graphics_root_signature = root_signature;
+    }
+
+    this->m_command_list->SetGraphicsRoot32BitConstants(unwrapped_pipeline_layout->get_push_constant_root_parameter_index(), size / 4U, values, offset / 4U);
 }
 
-void brx_d3d12_graphics_command_buffer::bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers)
+void brx_d3d12_graphics_command_buffer::bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers, uint64_t const *vertex_buffer_offsets)
 {
-    assert(this->m_current_vertex_buffer_strides.size() == vertex_buffer_count);
+    assert(this->m_current_vertex_buffer_count == vertex_buffer_count);
 
-    brx_vector<D3D12_VERTEX_BUFFER_VIEW> vertex_buffer_views;
+    D3D12_VERTEX_BUFFER_VIEW vertex_buffer_views[g_d3d12_max_vertex_buffer_count];
     {
-        vertex_buffer_views.resize(vertex_buffer_count);
         for (uint32_t vertex_buffer_index = 0U; vertex_buffer_index < vertex_buffer_count; ++vertex_buffer_index)
         {
             assert(NULL != vertex_buffers[vertex_buffer_index]);
             ID3D12Resource *const resource = static_cast<brx_d3d12_vertex_buffer const *>(vertex_buffers[vertex_buffer_index])->get_resource();
             D3D12_RESOURCE_DESC const resource_desc = resource->GetDesc();
+            uint64_t const vertex_buffer_offset = (NULL != vertex_buffer_offsets) ? vertex_buffer_offsets[vertex_buffer_index] : 0U;
+            assert(vertex_buffer_offset <= resource_desc.Width);
 
-            vertex_buffer_views[vertex_buffer_index].BufferLocation = resource->GetGPUVirtualAddress();
-            vertex_buffer_views[vertex_buffer_index].SizeInBytes = static_cast<UINT>(resource_desc.Width);
+            vertex_buffer_views[vertex_buffer_index].BufferLocation = resource->GetGPUVirtualAddress() + vertex_buffer_offset;
+            vertex_buffer_views[vertex_buffer_index].SizeInBytes = static_cast<UINT>(resource_desc.Width - vertex_buffer_offset);
             vertex_buffer_views[vertex_buffer_index].StrideInBytes = this->m_current_vertex_buffer_strides[vertex_buffer_index];
         }
     }
 
-    this->m_command_list->IASetVertexBuffers(0U, vertex_buffer_count, &vertex_buffer_views[0]);
+    this->m_command_list->IASetVertexBuffers(0U, vertex_buffer_count, vertex_buffer_views);
+
+    ++this->m_statistics.emitted_state_command_count;
 }
 
-void brx_d3d12_graphics_command_buffer::draw(uint32_t vertex_count, uint32_t instance_count)
+void brx_d3d12_graphics_command_buffer::draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance)
 {
-    this->m_command_list->DrawInstanced(vertex_count, instance_count, 0U, 0U);
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
+    this->m_command_list->DrawInstanced(vertex_count, instance_count, first_vertex, first_instance);
 }
 
-void brx_d3d12_graphics_command_buffer::draw_index(brx_index_buffer const *wrapped_index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE wrapped_index_type, uint32_t index_count, uint32_t instance_count)
+void brx_d3d12_graphics_command_buffer::bind_index_buffer(brx_index_buffer const *wrapped_index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE wrapped_index_type)
 {
     assert(NULL != wrapped_index_buffer);
     ID3D12Resource *const resource = static_cast<brx_d3d12_index_buffer const *>(wrapped_index_buffer)->get_resource();
@@ -499,8 +737,46 @@ void brx_d3d12_graphics_command_buffer::draw_index(brx_index_buffer const *wrapp
         static_cast<UINT>(resource_desc.Width),
         index_format};
     this->m_command_list->IASetIndexBuffer(&index_buffer_view);
+    ++this->m_statistics.emitted_state_command_count;
+}
+
+void brx_d3d12_graphics_command_buffer::draw_index(brx_index_buffer const *wrapped_index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE wrapped_index_type, uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance)
+{
+    this->bind_index_buffer(wrapped_index_buffer, wrapped_index_type);
+
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
+    this->m_command_list->DrawIndexedInstanced(index_count, instance_count, first_index, vertex_offset, first_instance);
+}
+
+void brx_d3d12_graphics_command_buffer::draw_indirect(brx_indirect_argument_buffer const *wrapped_argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *wrapped_count_buffer, uint64_t count_offset)
+{
+    assert(NULL != wrapped_argument_buffer);
+    ID3D12Resource *const argument_resource = static_cast<brx_d3d12_indirect_argument_buffer const *>(wrapped_argument_buffer)->get_resource();
+    assert(0U == (argument_offset & 3U));
+
+    ID3D12Resource *const count_resource = (NULL != wrapped_count_buffer) ? static_cast<brx_d3d12_indirect_argument_buffer const *>(wrapped_count_buffer)->get_resource() : NULL;
+    assert(0U == (count_offset & 3U));
+
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
+    this->m_command_list->ExecuteIndirect(this->m_draw_indirect_command_signature, max_draw_count, argument_resource, argument_offset, count_resource, (NULL != count_resource) ? count_offset : 0U);
+}
+
+void brx_d3d12_graphics_command_buffer::draw_index_indirect(brx_index_buffer const *wrapped_index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE wrapped_index_type, brx_indirect_argument_buffer const *wrapped_argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *wrapped_count_buffer, uint64_t count_offset)
+{
+    this->bind_index_buffer(wrapped_index_buffer, wrapped_index_type);
+
+    assert(NULL != wrapped_argument_buffer);
+    ID3D12Resource *const argument_resource = static_cast<brx_d3d12_indirect_argument_buffer const *>(wrapped_argument_buffer)->get_resource();
+    assert(0U == (argument_offset & 3U));
+
+    ID3D12Resource *const count_resource = (NULL != wrapped_count_buffer) ? static_cast<brx_d3d12_indirect_argument_buffer const *>(wrapped_count_buffer)->get_resource() : NULL;
+    assert(0U == (count_offset & 3U));
+
+    this->m_pending_resource_barrier.flush(this->m_command_list);
 
-    this->m_command_list->DrawIndexedInstanced(index_count, instance_count, 0U, 0, 0U);
+    this->m_command_list->ExecuteIndirect(this->m_draw_index_indirect_command_signature, max_draw_count, argument_resource, argument_offset, count_resource, (NULL != count_resource) ? count_offset : 0U);
 }
 
 void brx_d3d12_graphics_command_buffer::end_render_pass()
@@ -538,7 +814,7 @@ void brx_d3d12_graphics_command_buffer::end_render_pass()
                 0U,
                 D3D12_RESOURCE_STATE_RENDER_TARGET,
                 D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
-        this->m_command_list->ResourceBarrier(1U, &flush_for_sampled_image_resource_barrier);
+        this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &flush_for_sampled_image_resource_barrier);
     }
 
     for (uint32_t flush_for_present_index = 0U; flush_for_present_index < color_attachment_flush_for_present_count; ++flush_for_present_index)
@@ -554,7 +830,7 @@ void brx_d3d12_graphics_command_buffer::end_render_pass()
                 0U,
                 D3D12_RESOURCE_STATE_RENDER_TARGET,
                 D3D12_RESOURCE_STATE_PRESENT}};
-        this->m_command_list->ResourceBarrier(1U, &flush_for_present_resource_barrier);
+        this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &flush_for_present_resource_barrier);
     }
 
     if (depth_stencil_attachment_flush_for_sampled_image)
@@ -567,7 +843,7 @@ void brx_d3d12_graphics_command_buffer::end_render_pass()
                 0U,
                 D3D12_RESOURCE_STATE_DEPTH_WRITE,
                 D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
-        this->m_command_list->ResourceBarrier(1U, &flush_for_sampled_image_resource_barrier);
+        this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &flush_for_sampled_image_resource_barrier);
     }
 
     this->m_current_render_pass = NULL;
@@ -590,7 +866,23 @@ void brx_d3d12_graphics_command_buffer::compute_pass_load_storage_image(brx_stor
             0U,
             D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
             D3D12_RESOURCE_STATE_UNORDERED_ACCESS}};
-    this->m_command_list->ResourceBarrier(1U, &load_barrier);
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &load_barrier);
+}
+
+void brx_d3d12_graphics_command_buffer::compute_pass_load_indirect_argument_buffer(brx_indirect_argument_buffer const *wrapped_indirect_argument_buffer)
+{
+    assert(NULL != wrapped_indirect_argument_buffer);
+    brx_d3d12_indirect_argument_buffer const *const unwrapped_indirect_argument_buffer = static_cast<brx_d3d12_indirect_argument_buffer const *>(wrapped_indirect_argument_buffer);
+
+    D3D12_RESOURCE_BARRIER const load_barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .Transition = {
+            unwrapped_indirect_argument_buffer->get_resource(),
+            0U,
+            unwrapped_indirect_argument_buffer->get_indirect_argument_resource_state(),
+            D3D12_RESOURCE_STATE_UNORDERED_ACCESS}};
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &load_barrier);
 }
 
 void brx_d3d12_graphics_command_buffer::bind_compute_pipeline(brx_compute_pipeline const *wrapped_compute_pipeline)
@@ -601,6 +893,8 @@ void brx_d3d12_graphics_command_buffer::bind_compute_pipeline(brx_compute_pipeli
     ID3D12PipelineState *compute_pipeline = unwrapped_compute_pipeline->get_pipeline();
 
     this->m_command_list->SetPipelineState(compute_pipeline);
+
+    ++this->m_statistics.emitted_state_command_count;
 }
 
 void brx_d3d12_graphics_command_buffer::bind_compute_descriptor_sets(brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *wrapped_descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets)
@@ -609,7 +903,12 @@ void brx_d3d12_graphics_command_buffer::bind_compute_descriptor_sets(brx_pipelin
     assert(NULL != wrapped_descriptor_sets);
     ID3D12RootSignature *root_signature = static_cast<brx_d3d12_pipeline_layout const *>(wrapped_pipeline_layout)->get_root_signature();
 
-    this->m_command_list->SetComputeRootSignature(root_signature);
+    // the root signature is NOT set again, otherwise the root constants which have been pushed are reset
+    if (this->m_current_compute_root_signature != root_signature)
+    {
+        this->m_command_list->SetComputeRootSignature(root_signature);
+        this->m_current_compute_root_signature = root_signature;
+    }
 
     uint32_t root_parameter_index = 0U;
     uint32_t dynamic_offet_index = 0U;
@@ -680,13 +979,48 @@ void brx_d3d12_graphics_command_buffer::bind_compute_descriptor_sets(brx_pipelin
         }
     }
     assert(dynamic_offet_index == dynamic_offet_count);
+
+    ++this->m_statistics.emitted_state_command_count;
+}
+
+void brx_d3d12_graphics_command_buffer::push_compute_constants(brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t offset, uint32_t size, void const *values)
+{
+    assert(NULL != wrapped_pipeline_layout);
+    assert(NULL != values);
+    brx_d3d12_pipeline_layout const *const unwrapped_pipeline_layout = static_cast<brx_d3d12_pipeline_layout const *>(wrapped_pipeline_layout);
+    ID3D12RootSignature *root_signature = unwrapped_pipeline_layout->get_root_signature();
+
+    assert(0U == (offset & 3U));
+    assert(0U == (size & 3U));
+    assert((offset + size) <= unwrapped_pipeline_layout->get_push_constant_size());
+
+    if (this->m_current_compute_root_signature != root_signature)
+    {
+        this->m_command_list->SetComputeRootSignature(root_signature);
+        this->m_current_compute_root_signature = root_signature;
+    }
+
+    this->m_command_list->SetComputeRoot32BitConstants(unwrapped_pipeline_layout->get_push_constant_root_parameter_index(), size / 4U, values, offset / 4U);
 }
 
 void brx_d3d12_graphics_command_buffer::dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z)
 {
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
     this->m_command_list->Dispatch(group_count_x, group_count_y, group_count_z);
 }
 
+void brx_d3d12_graphics_command_buffer::dispatch_indirect(brx_indirect_argument_buffer const *wrapped_argument_buffer, uint64_t argument_offset)
+{
+    assert(NULL != wrapped_argument_buffer);
+    ID3D12Resource *const argument_resource = static_cast<brx_d3d12_indirect_argument_buffer const *>(wrapped_argument_buffer)->get_resource();
+    assert(0U == (argument_offset & 3U));
+
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
+    this->m_command_list->ExecuteIndirect(this->m_dispatch_indirect_command_signature, 1U, argument_resource, argument_offset, NULL, 0U);
+}
+
 void brx_d3d12_graphics_command_buffer::compute_pass_store_storage_image(brx_storage_image const *wrapped_storage_image, BRX_STORAGE_IMAGE_STORE_OPERATION store_operation)
 {
     ID3D12Resource *const store_resource = static_cast<brx_d3d12_storage_image const *>(wrapped_storage_image)->get_resource();
@@ -699,7 +1033,68 @@ void brx_d3d12_graphics_command_buffer::compute_pass_store_storage_image(brx_sto
             0U,
             D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
             D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
-    this->m_command_list->ResourceBarrier(1U, &store_barrier);
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &store_barrier);
+}
+
+void brx_d3d12_graphics_command_buffer::compute_pass_store_indirect_argument_buffer(brx_indirect_argument_buffer const *wrapped_indirect_argument_buffer)
+{
+    assert(NULL != wrapped_indirect_argument_buffer);
+    brx_d3d12_indirect_argument_buffer const *const unwrapped_indirect_argument_buffer = static_cast<brx_d3d12_indirect_argument_buffer const *>(wrapped_indirect_argument_buffer);
+
+    D3D12_RESOURCE_BARRIER const store_barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .Transition = {
+            unwrapped_indirect_argument_buffer->get_resource(),
+            0U,
+            D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+            unwrapped_indirect_argument_buffer->get_indirect_argument_resource_state()}};
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &store_barrier);
+}
+
+void brx_d3d12_graphics_command_buffer::release_storage_buffer_to_compute_queue(brx_intermediate_storage_buffer const *wrapped_storage_buffer)
+{
+    // the resource states of the storage buffer are valid for both the direct queue and the compute queue
+    // there is no queue family ownership in D3D12
+    assert(NULL != wrapped_storage_buffer);
+}
+
+void brx_d3d12_graphics_command_buffer::release_storage_image_to_compute_queue(brx_storage_image const *wrapped_storage_image)
+{
+    assert(NULL != wrapped_storage_image);
+    ID3D12Resource *const release_resource = static_cast<brx_d3d12_storage_image const *>(wrapped_storage_image)->get_resource();
+
+    // the "D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE" is NOT valid for the compute queue
+    D3D12_RESOURCE_BARRIER const release_barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .Transition = {
+            release_resource,
+            0U,
+            D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+            D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE}};
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &release_barrier);
+}
+
+void brx_d3d12_graphics_command_buffer::acquire_storage_buffer_from_compute_queue(brx_intermediate_storage_buffer const *wrapped_storage_buffer)
+{
+    assert(NULL != wrapped_storage_buffer);
+}
+
+void brx_d3d12_graphics_command_buffer::acquire_storage_image_from_compute_queue(brx_storage_image const *wrapped_storage_image)
+{
+    assert(NULL != wrapped_storage_image);
+    ID3D12Resource *const acquire_resource = static_cast<brx_d3d12_storage_image const *>(wrapped_storage_image)->get_resource();
+
+    D3D12_RESOURCE_BARRIER const acquire_barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .Transition = {
+            acquire_resource,
+            0U,
+            D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+            D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE}};
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &acquire_barrier);
 }
 
 void brx_d3d12_graphics_command_buffer::build_top_level_acceleration_structure(brx_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, brx_top_level_acceleration_structure_instance_upload_buffer *wrapped_top_level_acceleration_structure_instance_upload_buffer, brx_scratch_buffer *wrapped_scratch_buffer)
@@ -727,6 +1122,8 @@ void brx_d3d12_graphics_command_buffer::build_top_level_acceleration_structure(b
         0U,
         scratch_buffer_device_memory_range_base};
 
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
     this->m_command_list->BuildRaytracingAccelerationStructure(&ray_tracing_acceleration_structure_desc, 0U, NULL);
 
     static_cast<brx_d3d12_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->set_instance_count(top_level_acceleration_structure_instance_count);
@@ -737,7 +1134,7 @@ void brx_d3d12_graphics_command_buffer::build_top_level_acceleration_structure(b
         .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
         .UAV = {
             destination_acceleration_structure_buffer_resource}};
-    this->m_command_list->ResourceBarrier(1U, &release_barrier);
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &release_barrier);
 }
 
 void brx_d3d12_graphics_command_buffer::update_top_level_acceleration_structure(brx_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, brx_top_level_acceleration_structure_instance_upload_buffer *wrapped_top_level_acceleration_structure_instance_upload_buffer, brx_scratch_buffer *wrapped_scratch_buffer)
@@ -768,6 +1165,8 @@ void brx_d3d12_graphics_command_buffer::update_top_level_acceleration_structure(
         destination_acceleration_structure_device_memory_range_base,
         scratch_buffer_device_memory_range_base};
 
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
     this->m_command_list->BuildRaytracingAccelerationStructure(&ray_tracing_acceleration_structure_desc, 0U, NULL);
 }
 
@@ -782,94 +1181,492 @@ void brx_d3d12_graphics_command_buffer::acceleration_structure_pass_store_top_le
         .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
         .UAV = {
             destination_acceleration_structure_buffer_resource}};
-    this->m_command_list->ResourceBarrier(1U, &release_barrier);
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &release_barrier);
 }
 
 void brx_d3d12_graphics_command_buffer::end()
 {
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
     HRESULT const hr_close = this->m_command_list->Close();
     assert(SUCCEEDED(hr_close));
 }
 
-brx_d3d12_upload_command_buffer::brx_d3d12_upload_command_buffer() : m_command_allocator(NULL), m_command_list(NULL), m_upload_queue_submit_fence(NULL)
+BRX_GRAPHICS_COMMAND_BUFFER_STATISTICS brx_d3d12_graphics_command_buffer::get_statistics() const
 {
+    return this->m_statistics;
 }
 
-void brx_d3d12_upload_command_buffer::init(ID3D12Device *device, bool uma, bool support_ray_tracing)
+brx_d3d12_secondary_graphics_command_buffer::brx_d3d12_secondary_graphics_command_buffer() : m_width(0U), m_height(0U)
 {
-    this->m_uma = uma;
-
-    this->m_support_ray_tracing = support_ray_tracing;
-
-    if ((!this->m_uma) || this->m_support_ray_tracing)
-    {
-        assert(NULL == this->m_command_allocator);
-        HRESULT const hr_create_command_allocator = device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COMPUTE, IID_PPV_ARGS(&this->m_command_allocator));
-        assert(SUCCEEDED(hr_create_command_allocator));
-
-        assert(NULL == this->m_command_list);
-        HRESULT const hr_create_command_list = device->CreateCommandList(0U, D3D12_COMMAND_LIST_TYPE_COMPUTE, this->m_command_allocator, NULL, IID_PPV_ARGS(&this->m_command_list));
-        assert(SUCCEEDED(hr_create_command_list));
-
-        HRESULT const hr_close = this->m_command_list->Close();
-        assert(SUCCEEDED(hr_close));
-
-        assert(NULL == this->m_upload_queue_submit_fence);
-        HRESULT const hr_create_fence = device->CreateFence(0U, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&this->m_upload_queue_submit_fence));
-        assert(SUCCEEDED(hr_create_fence));
-    }
-    else
-    {
-        assert(NULL == this->m_command_allocator);
-        assert(NULL == this->m_command_list);
-        assert(NULL == this->m_upload_queue_submit_fence);
-    }
 }
 
-void brx_d3d12_upload_command_buffer::uninit()
+void brx_d3d12_secondary_graphics_command_buffer::init(ID3D12Device *device, bool uma, bool support_ray_tracing, brx_d3d12_descriptor_allocator *descriptor_allocator, ID3D12CommandSignature *draw_indirect_command_signature, ID3D12CommandSignature *draw_index_indirect_command_signature, ID3D12CommandSignature *dispatch_indirect_command_signature)
 {
-    if ((!this->m_uma) || this->m_support_ray_tracing)
-    {
-        assert(NULL != this->m_upload_queue_submit_fence);
-        this->m_upload_queue_submit_fence->Release();
-        this->m_upload_queue_submit_fence = NULL;
-
-        assert(NULL != this->m_command_list);
-        this->m_command_list->Release();
-        this->m_command_list = NULL;
-
-        assert(NULL != this->m_command_allocator);
-        this->m_command_allocator->Release();
-        this->m_command_allocator = NULL;
-    }
-    else
-    {
-        assert(NULL == this->m_command_allocator);
-        assert(NULL == this->m_command_list);
-        assert(NULL == this->m_upload_queue_submit_fence);
-    }
+    this->m_graphics_command_buffer.init(D3D12_COMMAND_LIST_TYPE_BUNDLE, device, uma, support_ray_tracing, descriptor_allocator, draw_indirect_command_signature, draw_index_indirect_command_signature, dispatch_indirect_command_signature);
 }
 
-brx_d3d12_upload_command_buffer::~brx_d3d12_upload_command_buffer()
+void brx_d3d12_secondary_graphics_command_buffer::uninit()
 {
-    assert(NULL == this->m_command_allocator);
-    assert(NULL == this->m_command_list);
-    assert(NULL == this->m_upload_queue_submit_fence);
+    this->m_graphics_command_buffer.uninit();
 }
 
-ID3D12CommandAllocator *brx_d3d12_upload_command_buffer::get_command_allocator() const
+brx_d3d12_secondary_graphics_command_buffer::~brx_d3d12_secondary_graphics_command_buffer()
 {
-    return this->m_command_allocator;
 }
 
-ID3D12GraphicsCommandList4 *brx_d3d12_upload_command_buffer::get_command_list() const
+ID3D12CommandAllocator *brx_d3d12_secondary_graphics_command_buffer::get_command_allocator() const
 {
-    return this->m_command_list;
+    return this->m_graphics_command_buffer.get_command_allocator();
 }
 
-ID3D12Fence *brx_d3d12_upload_command_buffer::get_upload_queue_submit_fence() const
+ID3D12GraphicsCommandList4 *brx_d3d12_secondary_graphics_command_buffer::get_command_list() const
 {
-    return this->m_upload_queue_submit_fence;
+    return this->m_graphics_command_buffer.get_command_list();
+}
+
+uint32_t brx_d3d12_secondary_graphics_command_buffer::get_width() const
+{
+    return this->m_width;
+}
+
+uint32_t brx_d3d12_secondary_graphics_command_buffer::get_height() const
+{
+    return this->m_height;
+}
+
+void brx_d3d12_secondary_graphics_command_buffer::begin(brx_render_pass const *render_pass, brx_frame_buffer const *frame_buffer, uint32_t width, uint32_t height)
+{
+    // the render targets are inherited from the direct command list
+    assert(NULL != render_pass);
+    assert(NULL != frame_buffer);
+
+    this->m_width = width;
+    this->m_height = height;
+
+    this->m_graphics_command_buffer.begin_bundle();
+}
+
+void brx_d3d12_secondary_graphics_command_buffer::bind_graphics_pipeline(brx_graphics_pipeline const *graphics_pipeline)
+{
+    this->m_graphics_command_buffer.bind_graphics_pipeline(graphics_pipeline);
+}
+
+void brx_d3d12_secondary_graphics_command_buffer::bind_graphics_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets)
+{
+    this->m_graphics_command_buffer.bind_graphics_descriptor_sets(pipeline_layout, descriptor_set_count, descriptor_sets, dynamic_offet_count, dynamic_offsets);
+}
+
+void brx_d3d12_secondary_graphics_command_buffer::push_graphics_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values)
+{
+    this->m_graphics_command_buffer.push_graphics_constants(pipeline_layout, offset, size, values);
+}
+
+void brx_d3d12_secondary_graphics_command_buffer::bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers, uint64_t const *vertex_buffer_offsets)
+{
+    this->m_graphics_command_buffer.bind_vertex_buffers(vertex_buffer_count, vertex_buffers, vertex_buffer_offsets);
+}
+
+void brx_d3d12_secondary_graphics_command_buffer::draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance)
+{
+    this->m_graphics_command_buffer.draw(vertex_count, instance_count, first_vertex, first_instance);
+}
+
+void brx_d3d12_secondary_graphics_command_buffer::draw_index(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance)
+{
+    this->m_graphics_command_buffer.draw_index(index_buffer, index_type, index_count, instance_count, first_index, vertex_offset, first_instance);
+}
+
+void brx_d3d12_secondary_graphics_command_buffer::draw_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer, uint64_t count_offset)
+{
+    this->m_graphics_command_buffer.draw_indirect(argument_buffer, argument_offset, max_draw_count, count_buffer, count_offset);
+}
+
+void brx_d3d12_secondary_graphics_command_buffer::draw_index_indirect(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer, uint64_t count_offset)
+{
+    this->m_graphics_command_buffer.draw_index_indirect(index_buffer, index_type, argument_buffer, argument_offset, max_draw_count, count_buffer, count_offset);
+}
+
+void brx_d3d12_secondary_graphics_command_buffer::end()
+{
+    this->m_graphics_command_buffer.end();
+}
+
+BRX_GRAPHICS_COMMAND_BUFFER_STATISTICS brx_d3d12_secondary_graphics_command_buffer::get_statistics() const
+{
+    return this->m_graphics_command_buffer.get_statistics();
+}
+
+brx_d3d12_compute_command_buffer::brx_d3d12_compute_command_buffer()
+    : m_command_allocator(NULL),
+      m_command_list(NULL),
+      m_descriptor_allocator(NULL),
+      m_dispatch_indirect_command_signature(NULL),
+      m_current_compute_root_signature(NULL)
+{
+}
+
+void brx_d3d12_compute_command_buffer::init(ID3D12Device *device, brx_d3d12_descriptor_allocator *descriptor_allocator, ID3D12CommandSignature *dispatch_indirect_command_signature)
+{
+    assert(NULL == this->m_command_allocator);
+    HRESULT const hr_create_command_allocator = device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COMPUTE, IID_PPV_ARGS(&this->m_command_allocator));
+    assert(SUCCEEDED(hr_create_command_allocator));
+
+    assert(NULL == this->m_command_list);
+    HRESULT const hr_create_command_list = device->CreateCommandList(0U, D3D12_COMMAND_LIST_TYPE_COMPUTE, this->m_command_allocator, NULL, IID_PPV_ARGS(&this->m_command_list));
+    assert(SUCCEEDED(hr_create_command_list));
+
+    HRESULT const hr_close = this->m_command_list->Close();
+    assert(SUCCEEDED(hr_close));
+
+    assert(NULL == this->m_descriptor_allocator);
+    this->m_descriptor_allocator = descriptor_allocator;
+
+    // the command signature is owned by the device
+    assert(NULL == this->m_dispatch_indirect_command_signature);
+    this->m_dispatch_indirect_command_signature = dispatch_indirect_command_signature;
+}
+
+void brx_d3d12_compute_command_buffer::uninit()
+{
+    assert(NULL != this->m_command_list);
+    this->m_command_list->Release();
+    this->m_command_list = NULL;
+
+    assert(NULL != this->m_command_allocator);
+    this->m_command_allocator->Release();
+    this->m_command_allocator = NULL;
+}
+
+brx_d3d12_compute_command_buffer::~brx_d3d12_compute_command_buffer()
+{
+    assert(NULL == this->m_command_allocator);
+    assert(NULL == this->m_command_list);
+}
+
+ID3D12CommandAllocator *brx_d3d12_compute_command_buffer::get_command_allocator() const
+{
+    return this->m_command_allocator;
+}
+
+ID3D12GraphicsCommandList4 *brx_d3d12_compute_command_buffer::get_command_list() const
+{
+    return this->m_command_list;
+}
+
+void brx_d3d12_compute_command_buffer::begin()
+{
+    HRESULT hr_reset = this->m_command_list->Reset(this->m_command_allocator, NULL);
+    assert(SUCCEEDED(hr_reset));
+
+    this->m_descriptor_allocator->bind_command_list(this->m_command_list);
+
+    this->m_current_compute_root_signature = NULL;
+}
+
+void brx_d3d12_compute_command_buffer::acquire_storage_buffer_from_graphics_queue(brx_intermediate_storage_buffer const *wrapped_storage_buffer)
+{
+    // the resource states of the storage buffer are valid for both the direct queue and the compute queue
+    // there is no queue family ownership in D3D12
+    assert(NULL != wrapped_storage_buffer);
+}
+
+void brx_d3d12_compute_command_buffer::acquire_storage_image_from_graphics_queue(brx_storage_image const *wrapped_storage_image)
+{
+    // the storage image has been transitioned to "D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE" by the "release" on the direct queue
+    assert(NULL != wrapped_storage_image);
+}
+
+void brx_d3d12_compute_command_buffer::compute_pass_load_storage_image(brx_storage_image const *wrapped_storage_image, BRX_STORAGE_IMAGE_LOAD_OPERATION load_operation)
+{
+    ID3D12Resource *const load_resource = static_cast<brx_d3d12_storage_image const *>(wrapped_storage_image)->get_resource();
+
+    D3D12_RESOURCE_BARRIER const load_barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .Transition = {
+            load_resource,
+            0U,
+            D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+            D3D12_RESOURCE_STATE_UNORDERED_ACCESS}};
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &load_barrier);
+}
+
+void brx_d3d12_compute_command_buffer::compute_pass_load_indirect_argument_buffer(brx_indirect_argument_buffer const *wrapped_indirect_argument_buffer)
+{
+    assert(NULL != wrapped_indirect_argument_buffer);
+    brx_d3d12_indirect_argument_buffer const *const unwrapped_indirect_argument_buffer = static_cast<brx_d3d12_indirect_argument_buffer const *>(wrapped_indirect_argument_buffer);
+
+    D3D12_RESOURCE_BARRIER const load_barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .Transition = {
+            unwrapped_indirect_argument_buffer->get_resource(),
+            0U,
+            unwrapped_indirect_argument_buffer->get_indirect_argument_resource_state(),
+            D3D12_RESOURCE_STATE_UNORDERED_ACCESS}};
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &load_barrier);
+}
+
+void brx_d3d12_compute_command_buffer::bind_compute_pipeline(brx_compute_pipeline const *wrapped_compute_pipeline)
+{
+    assert(NULL != wrapped_compute_pipeline);
+    ID3D12PipelineState *compute_pipeline = static_cast<brx_d3d12_compute_pipeline const *>(wrapped_compute_pipeline)->get_pipeline();
+
+    this->m_command_list->SetPipelineState(compute_pipeline);
+}
+
+void brx_d3d12_compute_command_buffer::bind_compute_descriptor_sets(brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *wrapped_descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets)
+{
+    assert(NULL != wrapped_pipeline_layout);
+    assert(NULL != wrapped_descriptor_sets);
+    ID3D12RootSignature *root_signature = static_cast<brx_d3d12_pipeline_layout const *>(wrapped_pipeline_layout)->get_root_signature();
+
+    // the root signature is NOT set again, otherwise the root constants which have been pushed are reset
+    if (this->m_current_compute_root_signature != root_signature)
+    {
+        this->m_command_list->SetComputeRootSignature(root_signature);
+        this->m_current_compute_root_signature = root_signature;
+    }
+
+    uint32_t root_parameter_index = 0U;
+    uint32_t dynamic_offet_index = 0U;
+    for (uint32_t set_index = 0U; set_index < descriptor_set_count; ++set_index)
+    {
+        assert(NULL != wrapped_descriptor_sets[set_index]);
+        uint32_t const binding_count = static_cast<brx_d3d12_descriptor_set const *>(wrapped_descriptor_sets[set_index])->get_descriptor_count();
+        brx_d3d12_descriptor const *descriptors = static_cast<brx_d3d12_descriptor_set const *>(wrapped_descriptor_sets[set_index])->get_descriptors();
+        for (uint32_t binding_index = 0U; binding_index < binding_count; ++binding_index)
+        {
+            switch (descriptors[binding_index].root_parameter_type)
+            {
+            case BRX_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER:
+            {
+                D3D12_GPU_VIRTUAL_ADDRESS const buffer_location = {descriptors[binding_index].root_constant_buffer_view.address_base + dynamic_offsets[dynamic_offet_index]};
+                this->m_command_list->SetComputeRootConstantBufferView(root_parameter_index, buffer_location);
+                ++root_parameter_index;
+                ++dynamic_offet_index;
+            }
+            break;
+            case BRX_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER:
+            {
+                D3D12_GPU_DESCRIPTOR_HANDLE base_descriptor = this->m_descriptor_allocator->get_cbv_srv_uav_gpu_descriptor_handle(descriptors[binding_index].root_descriptor_table.base_descriptor_heap_index);
+                this->m_command_list->SetComputeRootDescriptorTable(root_parameter_index, base_descriptor);
+                ++root_parameter_index;
+            }
+            break;
+            case BRX_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            {
+                D3D12_GPU_DESCRIPTOR_HANDLE base_descriptor = this->m_descriptor_allocator->get_cbv_srv_uav_gpu_descriptor_handle(descriptors[binding_index].root_descriptor_table.base_descriptor_heap_index);
+                this->m_command_list->SetComputeRootDescriptorTable(root_parameter_index, base_descriptor);
+                ++root_parameter_index;
+            }
+            break;
+            case BRX_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            {
+                D3D12_GPU_DESCRIPTOR_HANDLE base_descriptor = this->m_descriptor_allocator->get_cbv_srv_uav_gpu_descriptor_handle(descriptors[binding_index].root_descriptor_table.base_descriptor_heap_index);
+                this->m_command_list->SetComputeRootDescriptorTable(root_parameter_index, base_descriptor);
+                ++root_parameter_index;
+            }
+            break;
+            case BRX_DESCRIPTOR_TYPE_SAMPLER:
+            {
+                D3D12_GPU_DESCRIPTOR_HANDLE base_descriptor = this->m_descriptor_allocator->get_sampler_gpu_descriptor_handle(descriptors[binding_index].root_descriptor_table.base_descriptor_heap_index);
+                this->m_command_list->SetComputeRootDescriptorTable(root_parameter_index, base_descriptor);
+                ++root_parameter_index;
+            }
+            break;
+            case BRX_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            {
+                D3D12_GPU_DESCRIPTOR_HANDLE base_descriptor = this->m_descriptor_allocator->get_cbv_srv_uav_gpu_descriptor_handle(descriptors[binding_index].root_descriptor_table.base_descriptor_heap_index);
+                this->m_command_list->SetComputeRootDescriptorTable(root_parameter_index, base_descriptor);
+                ++root_parameter_index;
+            }
+            break;
+            case BRX_DESCRIPTOR_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE:
+            {
+                D3D12_GPU_DESCRIPTOR_HANDLE base_descriptor = this->m_descriptor_allocator->get_cbv_srv_uav_gpu_descriptor_handle(descriptors[binding_index].root_descriptor_table.base_descriptor_heap_index);
+                this->m_command_list->SetComputeRootDescriptorTable(root_parameter_index, base_descriptor);
+                ++root_parameter_index;
+            }
+            break;
+            default:
+            {
+                assert(false);
+            }
+            }
+        }
+    }
+    assert(dynamic_offet_index == dynamic_offet_count);
+}
+
+void brx_d3d12_compute_command_buffer::push_compute_constants(brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t offset, uint32_t size, void const *values)
+{
+    assert(NULL != wrapped_pipeline_layout);
+    assert(NULL != values);
+    brx_d3d12_pipeline_layout const *const unwrapped_pipeline_layout = static_cast<brx_d3d12_pipeline_layout const *>(wrapped_pipeline_layout);
+    ID3D12RootSignature *root_signature = unwrapped_pipeline_layout->get_root_signature();
+
+    assert(0U == (offset & 3U));
+    assert(0U == (size & 3U));
+    assert((offset + size) <= unwrapped_pipeline_layout->get_push_constant_size());
+
+    if (this->m_current_compute_root_signature != root_signature)
+    {
+        this->m_command_list->SetComputeRootSignature(root_signature);
+        this->m_current_compute_root_signature = root_signature;
+    }
+
+    this->m_command_list->SetComputeRoot32BitConstants(unwrapped_pipeline_layout->get_push_constant_root_parameter_index(), size / 4U, values, offset / 4U);
+}
+
+void brx_d3d12_compute_command_buffer::dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z)
+{
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
+    this->m_command_list->Dispatch(group_count_x, group_count_y, group_count_z);
+}
+
+void brx_d3d12_compute_command_buffer::dispatch_indirect(brx_indirect_argument_buffer const *wrapped_argument_buffer, uint64_t argument_offset)
+{
+    assert(NULL != wrapped_argument_buffer);
+    ID3D12Resource *const argument_resource = static_cast<brx_d3d12_indirect_argument_buffer const *>(wrapped_argument_buffer)->get_resource();
+    assert(0U == (argument_offset & 3U));
+
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
+    this->m_command_list->ExecuteIndirect(this->m_dispatch_indirect_command_signature, 1U, argument_resource, argument_offset, NULL, 0U);
+}
+
+void brx_d3d12_compute_command_buffer::compute_pass_store_storage_image(brx_storage_image const *wrapped_storage_image, BRX_STORAGE_IMAGE_STORE_OPERATION store_operation)
+{
+    ID3D12Resource *const store_resource = static_cast<brx_d3d12_storage_image const *>(wrapped_storage_image)->get_resource();
+
+    D3D12_RESOURCE_BARRIER const store_barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .Transition = {
+            store_resource,
+            0U,
+            D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+            D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE}};
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &store_barrier);
+}
+
+void brx_d3d12_compute_command_buffer::compute_pass_store_indirect_argument_buffer(brx_indirect_argument_buffer const *wrapped_indirect_argument_buffer)
+{
+    assert(NULL != wrapped_indirect_argument_buffer);
+    brx_d3d12_indirect_argument_buffer const *const unwrapped_indirect_argument_buffer = static_cast<brx_d3d12_indirect_argument_buffer const *>(wrapped_indirect_argument_buffer);
+
+    D3D12_RESOURCE_BARRIER const store_barrier = {
+        .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+        .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+        .Transition = {
+            unwrapped_indirect_argument_buffer->get_resource(),
+            0U,
+            D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+            unwrapped_indirect_argument_buffer->get_indirect_argument_resource_state()}};
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &store_barrier);
+}
+
+void brx_d3d12_compute_command_buffer::release_storage_buffer_to_graphics_queue(brx_intermediate_storage_buffer const *wrapped_storage_buffer)
+{
+    assert(NULL != wrapped_storage_buffer);
+}
+
+void brx_d3d12_compute_command_buffer::release_storage_image_to_graphics_queue(brx_storage_image const *wrapped_storage_image)
+{
+    // the storage image is transitioned back to "D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE" by the "acquire" on the direct queue
+    assert(NULL != wrapped_storage_image);
+}
+
+void brx_d3d12_compute_command_buffer::end()
+{
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
+    HRESULT const hr_close = this->m_command_list->Close();
+    assert(SUCCEEDED(hr_close));
+}
+
+brx_d3d12_upload_command_buffer::brx_d3d12_upload_command_buffer() : m_command_allocator(NULL), m_command_list(NULL), m_upload_queue_submit_fence(NULL)
+{
+}
+
+void brx_d3d12_upload_command_buffer::init(ID3D12Device *device, bool uma, bool support_ray_tracing)
+{
+    this->m_uma = uma;
+
+    this->m_support_ray_tracing = support_ray_tracing;
+
+    if ((!this->m_uma) || this->m_support_ray_tracing)
+    {
+        assert(NULL == this->m_command_allocator);
+        HRESULT const hr_create_command_allocator = device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COMPUTE, IID_PPV_ARGS(&this->m_command_allocator));
+        assert(SUCCEEDED(hr_create_command_allocator));
+
+        assert(NULL == this->m_command_list);
+        HRESULT const hr_create_command_list = device->CreateCommandList(0U, D3D12_COMMAND_LIST_TYPE_COMPUTE, this->m_command_allocator, NULL, IID_PPV_ARGS(&this->m_command_list));
+        assert(SUCCEEDED(hr_create_command_list));
+
+        HRESULT const hr_close = this->m_command_list->Close();
+        assert(SUCCEEDED(hr_close));
+
+        assert(NULL == this->m_upload_queue_submit_fence);
+        HRESULT const hr_create_fence = device->CreateFence(0U, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&this->m_upload_queue_submit_fence));
+        assert(SUCCEEDED(hr_create_fence));
+    }
+    else
+    {
+        assert(NULL == this->m_command_allocator);
+        assert(NULL == this->m_command_list);
+        assert(NULL == this->m_upload_queue_submit_fence);
+    }
+}
+
+void brx_d3d12_upload_command_buffer::uninit()
+{
+    if ((!this->m_uma) || this->m_support_ray_tracing)
+    {
+        assert(NULL != this->m_upload_queue_submit_fence);
+        this->m_upload_queue_submit_fence->Release();
+        this->m_upload_queue_submit_fence = NULL;
+
+        assert(NULL != this->m_command_list);
+        this->m_command_list->Release();
+        this->m_command_list = NULL;
+
+        assert(NULL != this->m_command_allocator);
+        this->m_command_allocator->Release();
+        this->m_command_allocator = NULL;
+    }
+    else
+    {
+        assert(NULL == this->m_command_allocator);
+        assert(NULL == this->m_command_list);
+        assert(NULL == this->m_upload_queue_submit_fence);
+    }
+}
+
+brx_d3d12_upload_command_buffer::~brx_d3d12_upload_command_buffer()
+{
+    assert(NULL == this->m_command_allocator);
+    assert(NULL == this->m_command_list);
+    assert(NULL == this->m_upload_queue_submit_fence);
+}
+
+ID3D12CommandAllocator *brx_d3d12_upload_command_buffer::get_command_allocator() const
+{
+    return this->m_command_allocator;
+}
+
+ID3D12GraphicsCommandList4 *brx_d3d12_upload_command_buffer::get_command_list() const
+{
+    return this->m_command_list;
+}
+
+ID3D12Fence *brx_d3d12_upload_command_buffer::get_upload_queue_submit_fence() const
+{
+    return this->m_upload_queue_submit_fence;
 }
 
 void brx_d3d12_upload_command_buffer::begin()
@@ -893,6 +1690,8 @@ void brx_d3d12_upload_command_buffer::upload_from_staging_upload_buffer_to_asset
 
     if (!this->m_uma)
     {
+        this->m_pending_resource_barrier.flush(this->m_command_list);
+
         this->m_command_list->CopyBufferRegion(asset_buffer_resource, dst_offset, staging_upload_buffer_resource, src_offset, src_size);
 
         D3D12_RESOURCE_BARRIER const store_barrier = {
@@ -903,7 +1702,7 @@ void brx_d3d12_upload_command_buffer::upload_from_staging_upload_buffer_to_asset
                 0U,
                 D3D12_RESOURCE_STATE_COPY_DEST,
                 D3D12_RESOURCE_STATE_COMMON}};
-        this->m_command_list->ResourceBarrier(1U, &store_barrier);
+        this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &store_barrier);
     }
     else
     {
@@ -935,6 +1734,8 @@ void brx_d3d12_upload_command_buffer::upload_from_staging_upload_buffer_to_asset
 
     if (!this->m_uma)
     {
+        this->m_pending_resource_barrier.flush(this->m_command_list);
+
         this->m_command_list->CopyBufferRegion(asset_buffer_resource, dst_offset, staging_upload_buffer_resource, src_offset, src_size);
 
         assert(NULL != wrapped_asset_vertex_varying_buffer);
@@ -948,7 +1749,7 @@ void brx_d3d12_upload_command_buffer::upload_from_staging_upload_buffer_to_asset
                 0U,
                 D3D12_RESOURCE_STATE_COPY_DEST,
                 D3D12_RESOURCE_STATE_COMMON}};
-        this->m_command_list->ResourceBarrier(1U, &store_barrier);
+        this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &store_barrier);
     }
     else
     {
@@ -980,6 +1781,8 @@ void brx_d3d12_upload_command_buffer::upload_from_staging_upload_buffer_to_asset
 
     if (!this->m_uma)
     {
+        this->m_pending_resource_barrier.flush(this->m_command_list);
+
         this->m_command_list->CopyBufferRegion(asset_buffer_resource, dst_offset, staging_upload_buffer_resource, src_offset, src_size);
 
         D3D12_RESOURCE_BARRIER const store_barrier = {
@@ -990,7 +1793,7 @@ void brx_d3d12_upload_command_buffer::upload_from_staging_upload_buffer_to_asset
                 0U,
                 D3D12_RESOURCE_STATE_COPY_DEST,
                 D3D12_RESOURCE_STATE_COMMON}};
-        this->m_command_list->ResourceBarrier(1U, &store_barrier);
+        this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &store_barrier);
     }
     else
     {
@@ -1088,6 +1891,8 @@ void brx_d3d12_upload_command_buffer::upload_from_staging_upload_buffer_to_asset
                      1U,
                      src_row_pitch}}};
 
+            this->m_pending_resource_barrier.flush(this->m_command_list);
+
             this->m_command_list->CopyTextureRegion(&destination, 0U, 0U, 0U, &source, NULL);
         }
 
@@ -1099,7 +1904,7 @@ void brx_d3d12_upload_command_buffer::upload_from_staging_upload_buffer_to_asset
                 dst_mip_level,
                 D3D12_RESOURCE_STATE_COPY_DEST,
                 D3D12_RESOURCE_STATE_COMMON}};
-        this->m_command_list->ResourceBarrier(1U, &store_barrier);
+        this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &store_barrier);
     }
     else
     {
@@ -1129,16 +1934,16 @@ void brx_d3d12_upload_command_buffer::build_staging_non_compacted_bottom_level_a
     assert(0U == (destination_acceleration_structure_device_memory_range_base % D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT));
 
     assert(NULL != wrapped_bottom_level_acceleration_structure_geometries);
-    brx_vector<D3D12_RESOURCE_BARRIER> vertex_position_buffer_load_barriers;
-    brx_vector<D3D12_RESOURCE_BARRIER> vertex_position_buffer_store_barriers;
-    brx_vector<D3D12_RESOURCE_BARRIER> index_buffer_load_barriers;
-    brx_vector<D3D12_RESOURCE_BARRIER> index_buffer_store_barriers;
-    brx_vector<D3D12_RAYTRACING_GEOMETRY_DESC> ray_tracing_geometry_descs;
-    vertex_position_buffer_load_barriers.reserve(bottom_level_acceleration_structure_geometry_count);
-    vertex_position_buffer_store_barriers.reserve(bottom_level_acceleration_structure_geometry_count);
-    index_buffer_load_barriers.reserve(bottom_level_acceleration_structure_geometry_count);
-    index_buffer_store_barriers.reserve(bottom_level_acceleration_structure_geometry_count);
-    ray_tracing_geometry_descs.reserve(bottom_level_acceleration_structure_geometry_count);
+    D3D12_RAYTRACING_GEOMETRY_DESC *ray_tracing_geometry_descs;
+    if (bottom_level_acceleration_structure_geometry_count <= g_d3d12_max_inline_bottom_level_acceleration_structure_geometry_count)
+    {
+        ray_tracing_geometry_descs = this->m_inline_ray_tracing_geometry_descs;
+    }
+    else
+    {
+        this->m_scratch_ray_tracing_geometry_descs.resize(bottom_level_acceleration_structure_geometry_count);
+        ray_tracing_geometry_descs = &this->m_scratch_ray_tracing_geometry_descs[0];
+    }
     for (uint32_t bottom_level_acceleration_structure_geometry_index = 0U; bottom_level_acceleration_structure_geometry_index < bottom_level_acceleration_structure_geometry_count; ++bottom_level_acceleration_structure_geometry_index)
     {
         BRX_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY const &wrapped_bottom_level_acceleration_structure_geometry = wrapped_bottom_level_acceleration_structure_geometries[bottom_level_acceleration_structure_geometry_index];
@@ -1153,17 +1958,7 @@ void brx_d3d12_upload_command_buffer::build_staging_non_compacted_bottom_level_a
                 0U,
                 D3D12_RESOURCE_STATE_COMMON,
                 D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE}};
-        vertex_position_buffer_load_barriers.push_back(vertex_position_buffer_load_barrier);
-
-        D3D12_RESOURCE_BARRIER const vertex_position_buffer_store_barrier = {
-            .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
-            .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
-            .Transition = {
-                unwrapped_vertex_position_buffer_resource,
-                0U,
-                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
-                D3D12_RESOURCE_STATE_COMMON}};
-        vertex_position_buffer_store_barriers.push_back(vertex_position_buffer_store_barrier);
+        this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &vertex_position_buffer_load_barrier);
 
         ID3D12Resource *const unwrapped_index_buffer_resource = (BRX_GRAPHICS_PIPELINE_INDEX_TYPE_NONE != wrapped_bottom_level_acceleration_structure_geometry.index_type) ? static_cast<brx_d3d12_index_buffer const *>(wrapped_bottom_level_acceleration_structure_geometry.index_buffer)->get_resource() : NULL;
 
@@ -1177,17 +1972,7 @@ void brx_d3d12_upload_command_buffer::build_staging_non_compacted_bottom_level_a
                     0U,
                     D3D12_RESOURCE_STATE_COMMON,
                     D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE}};
-            index_buffer_load_barriers.push_back(index_buffer_load_barrier);
-
-            D3D12_RESOURCE_BARRIER const index_buffer_store_barrier = {
-                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
-                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
-                .Transition = {
-                    unwrapped_index_buffer_resource,
-                    0U,
-                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
-                    D3D12_RESOURCE_STATE_COMMON}};
-            index_buffer_store_barriers.push_back(index_buffer_store_barrier);
+            this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &index_buffer_load_barrier);
         }
 
         DXGI_FORMAT vertex_position_attribute_format;
@@ -1238,9 +2023,8 @@ void brx_d3d12_upload_command_buffer::build_staging_non_compacted_bottom_level_a
 
              }}};
 
-        ray_tracing_geometry_descs.push_back(ray_tracing_geometry_geometry_desc);
+        ray_tracing_geometry_descs[bottom_level_acceleration_structure_geometry_index] = ray_tracing_geometry_geometry_desc;
     }
-    assert(bottom_level_acceleration_structure_geometry_count == ray_tracing_geometry_descs.size());
 
     assert(NULL != wrapped_scratch_buffer);
     D3D12_GPU_VIRTUAL_ADDRESS const scratch_buffer_device_memory_range_base = static_cast<brx_d3d12_scratch_buffer *>(wrapped_scratch_buffer)->get_resource()->GetGPUVirtualAddress();
@@ -1253,9 +2037,9 @@ void brx_d3d12_upload_command_buffer::build_staging_non_compacted_bottom_level_a
         destination_acceleration_structure_device_memory_range_base,
         {D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL,
          D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_COMPACTION | D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE,
-         static_cast<UINT>(ray_tracing_geometry_descs.size()),
+         bottom_level_acceleration_structure_geometry_count,
          D3D12_ELEMENTS_LAYOUT_ARRAY,
-         {.pGeometryDescs = &ray_tracing_geometry_descs[0]}},
+         {.pGeometryDescs = ray_tracing_geometry_descs}},
         0U,
         scratch_buffer_device_memory_range_base};
 
@@ -1264,19 +2048,37 @@ void brx_d3d12_upload_command_buffer::build_staging_non_compacted_bottom_level_a
         D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE,
     };
 
-    assert(bottom_level_acceleration_structure_geometry_count == vertex_position_buffer_load_barriers.size());
-    this->m_command_list->ResourceBarrier(bottom_level_acceleration_structure_geometry_count, &vertex_position_buffer_load_barriers[0]);
-
-    assert(bottom_level_acceleration_structure_geometry_count >= index_buffer_load_barriers.size());
-    this->m_command_list->ResourceBarrier(static_cast<UINT>(index_buffer_load_barriers.size()), &index_buffer_load_barriers[0]);
+    this->m_pending_resource_barrier.flush(this->m_command_list);
 
     this->m_command_list->BuildRaytracingAccelerationStructure(&ray_tracing_acceleration_structure_desc, 1U, &ray_tracing_acceleration_structure_postbuild_info_desc);
 
-    assert(bottom_level_acceleration_structure_geometry_count == vertex_position_buffer_store_barriers.size());
-    this->m_command_list->ResourceBarrier(bottom_level_acceleration_structure_geometry_count, &vertex_position_buffer_store_barriers[0]);
+    for (uint32_t bottom_level_acceleration_structure_geometry_index = 0U; bottom_level_acceleration_structure_geometry_index < bottom_level_acceleration_structure_geometry_count; ++bottom_level_acceleration_structure_geometry_index)
+    {
+        BRX_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY const &wrapped_bottom_level_acceleration_structure_geometry = wrapped_bottom_level_acceleration_structure_geometries[bottom_level_acceleration_structure_geometry_index];
+
+        D3D12_RESOURCE_BARRIER const vertex_position_buffer_store_barrier = {
+            .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+            .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+            .Transition = {
+                static_cast<brx_d3d12_vertex_position_buffer const *>(wrapped_bottom_level_acceleration_structure_geometry.vertex_position_buffer)->get_resource(),
+                0U,
+                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+                D3D12_RESOURCE_STATE_COMMON}};
+        this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &vertex_position_buffer_store_barrier);
 
-    assert(bottom_level_acceleration_structure_geometry_count >= index_buffer_store_barriers.size());
-    this->m_command_list->ResourceBarrier(static_cast<UINT>(index_buffer_store_barriers.size()), &index_buffer_store_barriers[0]);
+        if (BRX_GRAPHICS_PIPELINE_INDEX_TYPE_NONE != wrapped_bottom_level_acceleration_structure_geometry.index_type)
+        {
+            D3D12_RESOURCE_BARRIER const index_buffer_store_barrier = {
+                .Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+                .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+                .Transition = {
+                    static_cast<brx_d3d12_index_buffer const *>(wrapped_bottom_level_acceleration_structure_geometry.index_buffer)->get_resource(),
+                    0U,
+                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
+                    D3D12_RESOURCE_STATE_COMMON}};
+            this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &index_buffer_store_barrier);
+        }
+    }
 }
 
 void brx_d3d12_upload_command_buffer::compact_bottom_level_acceleration_structure(brx_asset_compacted_bottom_level_acceleration_structure *wrapped_destination_asset_compacted_bottom_level_acceleration_structure, brx_staging_non_compacted_bottom_level_acceleration_structure *wrapped_source_staging_non_compacted_bottom_level_acceleration_structure)
@@ -1291,6 +2093,8 @@ void brx_d3d12_upload_command_buffer::compact_bottom_level_acceleration_structur
     D3D12_GPU_VIRTUAL_ADDRESS const source_acceleration_structure_device_memory_range_base = static_cast<brx_d3d12_staging_non_compacted_bottom_level_acceleration_structure *>(wrapped_source_staging_non_compacted_bottom_level_acceleration_structure)->get_resource()->GetGPUVirtualAddress();
     assert(0U == (source_acceleration_structure_device_memory_range_base % D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT));
 
+    this->m_pending_resource_barrier.flush(this->m_command_list);
+
     this->m_command_list->CopyRaytracingAccelerationStructure(destination_acceleration_structure_device_memory_range_base, source_acceleration_structure_device_memory_range_base, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE_COMPACT);
 
     // https://microsoft.github.io/DirectX-Specs/d3d/Raytracing.html#synchronizing-acceleration-structure-memory-writesreads
@@ -1299,7 +2103,7 @@ void brx_d3d12_upload_command_buffer::compact_bottom_level_acceleration_structur
         .Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
         .UAV = {
             destination_acceleration_structure_buffer_resource}};
-    this->m_command_list->ResourceBarrier(1U, &store_barrier);
+    this->m_pending_resource_barrier.resource_barrier(this->m_command_list, 1U, &store_barrier);
 }
 
 void brx_d3d12_upload_command_buffer::release_asset_vertex_position_buffer(brx_asset_vertex_position_buffer *asset_vertex_position_buffer)
@@ -1327,10 +2131,52 @@ void brx_d3d12_upload_command_buffer::release_asset_compacted_bottom_level_accel
     // do nothing
 }
 
+void brx_d3d12_upload_command_buffer::reset_timestamp_query_pool(brx_timestamp_query_pool *wrapped_timestamp_query_pool)
+{
+    assert(NULL != wrapped_timestamp_query_pool);
+    brx_d3d12_timestamp_query_pool *const unwrapped_timestamp_query_pool = static_cast<brx_d3d12_timestamp_query_pool *>(wrapped_timestamp_query_pool);
+
+    unwrapped_timestamp_query_pool->get_label_list()->reset();
+
+    uint64_t volatile *const query_pool_memory_range_base = unwrapped_timestamp_query_pool->get_host_memory_range_base();
+    uint32_t const query_count = unwrapped_timestamp_query_pool->get_query_count();
+    for (uint32_t query_index = 0U; query_index < query_count; ++query_index)
+    {
+        query_pool_memory_range_base[query_index] = static_cast<uint64_t>(-1);
+    }
+}
+
+void brx_d3d12_upload_command_buffer::write_timestamp(brx_timestamp_query_pool *wrapped_timestamp_query_pool, uint32_t query_index)
+{
+    assert(NULL != wrapped_timestamp_query_pool);
+    brx_d3d12_timestamp_query_pool *const unwrapped_timestamp_query_pool = static_cast<brx_d3d12_timestamp_query_pool *>(wrapped_timestamp_query_pool);
+
+    assert(query_index < unwrapped_timestamp_query_pool->get_query_count());
+
+    if ((!this->m_uma) || this->m_support_ray_tracing)
+    {
+        this->m_pending_resource_barrier.flush(this->m_command_list);
+
+        this->m_command_list->EndQuery(unwrapped_timestamp_query_pool->get_query_heap(), D3D12_QUERY_TYPE_TIMESTAMP, query_index);
+
+        this->m_command_list->ResolveQueryData(unwrapped_timestamp_query_pool->get_query_heap(), D3D12_QUERY_TYPE_TIMESTAMP, query_index, 1U, unwrapped_timestamp_query_pool->get_resource(), sizeof(uint64_t) * query_index);
+    }
+    else
+    {
+        assert(NULL == this->m_command_allocator);
+        assert(NULL == this->m_command_list);
+
+        // the upload is performed by the CPU, and thus costs no GPU time
+        unwrapped_timestamp_query_pool->get_host_memory_range_base()[query_index] = 0U;
+    }
+}
+
 void brx_d3d12_upload_command_buffer::end()
 {
     if ((!this->m_uma) || this->m_support_ray_tracing)
     {
+        this->m_pending_resource_barrier.flush(this->m_command_list);
+
         HRESULT hr_close = this->m_command_list->Close();
         assert(SUCCEEDED(hr_close));
     }
@@ -18,12 +18,15 @@
 #include "brx_d3d12_device.h"
 #include <assert.h>
 
-brx_d3d12_descriptor_set_layout::brx_d3d12_descriptor_set_layout()
+brx_d3d12_descriptor_set_layout::brx_d3d12_descriptor_set_layout() : m_descriptor_update_template(false)
 {
 }
 
-void brx_d3d12_descriptor_set_layout::init(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *wrapped_descriptor_set_bindings)
+void brx_d3d12_descriptor_set_layout::init(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *wrapped_descriptor_set_bindings, bool descriptor_update_template)
 {
+	// D3D12 does NOT have the descriptor update template, and the descriptor copy list is precomputed by each descriptor set instead
+	this->m_descriptor_update_template = descriptor_update_template;
+
 	assert(0U == this->m_descriptor_layouts.size());
 	this->m_descriptor_layouts.resize(descriptor_set_binding_count);
 	for (uint32_t binding_index = 0U; binding_index < descriptor_set_binding_count; ++binding_index)
@@ -114,11 +117,16 @@ brx_d3d12_descriptor_layout const *brx_d3d12_descriptor_set_layout::get_descript
 	return descriptor_layouts;
 }
 
-brx_d3d12_pipeline_layout::brx_d3d12_pipeline_layout() : m_root_signature(NULL)
+bool brx_d3d12_descriptor_set_layout::has_descriptor_update_template() const
+{
+	return this->m_descriptor_update_template;
+}
+
+brx_d3d12_pipeline_layout::brx_d3d12_pipeline_layout() : m_root_signature(NULL), m_push_constant_root_parameter_index(0U), m_push_constant_size(0U)
 {
 }
 
-void brx_d3d12_pipeline_layout::init(ID3D12Device *device, decltype(D3D12SerializeRootSignature) *pfn_d3d12_serialize_root_signature, uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *descriptor_set_layouts)
+void brx_d3d12_pipeline_layout::init(ID3D12Device *device, decltype(D3D12SerializeRootSignature) *pfn_d3d12_serialize_root_signature, uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *descriptor_set_layouts, uint32_t push_constant_size)
 {
 	brx_vector<D3D12_ROOT_PARAMETER> root_parameters;
 	brx_vector<D3D12_DESCRIPTOR_RANGE> root_descriptor_table_ranges;
@@ -269,6 +277,23 @@ void brx_d3d12_pipeline_layout::init(ID3D12Device *device, decltype(D3D12Seriali
 		}
 	}
 
+	// the root constants are the last root parameter, and thus the root parameter indices of the descriptor sets are NOT changed
+	assert(0U == (push_constant_size & 3U));
+	assert(push_constant_size <= g_d3d12_max_push_constant_size);
+	this->m_push_constant_root_parameter_index = static_cast<uint32_t>(root_parameters.size());
+	this->m_push_constant_size = push_constant_size;
+	if (push_constant_size > 0U)
+	{
+		uint32_t const new_root_parameter_index = static_cast<uint32_t>(root_parameters.size());
+		root_parameters.emplace_back();
+
+		root_parameters[new_root_parameter_index].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+		root_parameters[new_root_parameter_index].Constants.ShaderRegister = g_d3d12_push_constant_shader_register;
+		root_parameters[new_root_parameter_index].Constants.RegisterSpace = g_d3d12_push_constant_register_space;
+		root_parameters[new_root_parameter_index].Constants.Num32BitValues = push_constant_size / 4U;
+		root_parameters[new_root_parameter_index].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+	}
+
 	// The memory address within "root_descriptor_table_ranges" may change when "emplace_back"
 	uint32_t const num_root_parameters = static_cast<uint32_t>(root_parameters.size());
 	for (uint32_t root_parameter_index = 0U; root_parameter_index < num_root_parameters; ++root_parameter_index)
@@ -317,7 +342,17 @@ ID3D12RootSignature *brx_d3d12_pipeline_layout::get_root_signature() const
 	return this->m_root_signature;
 }
 
-brx_d3d12_descriptor_set::brx_d3d12_descriptor_set()
+uint32_t brx_d3d12_pipeline_layout::get_push_constant_root_parameter_index() const
+{
+	return this->m_push_constant_root_parameter_index;
+}
+
+uint32_t brx_d3d12_pipeline_layout::get_push_constant_size() const
+{
+	return this->m_push_constant_size;
+}
+
+brx_d3d12_descriptor_set::brx_d3d12_descriptor_set() : m_descriptor_update_template(false)
 {
 }
 
@@ -405,6 +440,8 @@ void brx_d3d12_descriptor_set::init(brx_d3d12_descriptor_allocator *descriptor_a
 		}
 		}
 	}
+
+	this->init_descriptor_copy_lists(unwrapped_descriptor_set_layout);
 }
 
 void brx_d3d12_descriptor_set::uninit(brx_d3d12_descriptor_allocator *descriptor_allocator)
@@ -453,6 +490,84 @@ void brx_d3d12_descriptor_set::uninit(brx_d3d12_descriptor_allocator *descriptor
 	}
 
 	this->m_descriptors.clear();
+
+	this->uninit_descriptor_copy_lists();
+}
+
+void brx_d3d12_descriptor_set::init_transient(brx_d3d12_transient_descriptor_allocator *transient_descriptor_allocator, brx_descriptor_set_layout const *wrapped_descriptor_set_layout)
+{
+	assert(NULL != wrapped_descriptor_set_layout);
+	brx_d3d12_descriptor_set_layout const *const unwrapped_descriptor_set_layout = static_cast<brx_d3d12_descriptor_set_layout const *>(wrapped_descriptor_set_layout);
+
+	uint32_t const descriptor_layout_count = unwrapped_descriptor_set_layout->get_descriptor_layout_count();
+	brx_d3d12_descriptor_layout const *unwrapped_descriptor_layouts = unwrapped_descriptor_set_layout->get_descriptor_layouts();
+
+	// the descriptors are bump-allocated out of the regions of the transient descriptor allocator, and are implicitly freed when the transient descriptor allocator is reset
+	assert(0U == this->m_descriptors.size());
+	this->m_descriptors.resize(descriptor_layout_count);
+	for (uint32_t descriptor_layout_index = 0U; descriptor_layout_index < descriptor_layout_count; ++descriptor_layout_index)
+	{
+		brx_d3d12_descriptor_layout const &unwrapped_descriptor_layout = unwrapped_descriptor_layouts[descriptor_layout_index];
+		brx_d3d12_descriptor &new_descriptor = this->m_descriptors[descriptor_layout_index];
+
+		new_descriptor.root_parameter_type = unwrapped_descriptor_layout.root_parameter_type;
+		new_descriptor.root_parameter_shader_register = unwrapped_descriptor_layout.root_parameter_shader_register;
+
+		if (BRX_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER != unwrapped_descriptor_layout.root_parameter_type)
+		{
+			new_descriptor.root_descriptor_table.num_descriptors = unwrapped_descriptor_layout.root_descriptor_table_num_descriptors;
+			new_descriptor.root_descriptor_table.base_descriptor_heap_index = (BRX_DESCRIPTOR_TYPE_SAMPLER != unwrapped_descriptor_layout.root_parameter_type) ? transient_descriptor_allocator->alloc_cbv_srv_uav_descriptor(new_descriptor.root_descriptor_table.num_descriptors) : transient_descriptor_allocator->alloc_sampler_descriptor(new_descriptor.root_descriptor_table.num_descriptors);
+			new_descriptor.root_descriptor_table.alloced_num_descriptors = new_descriptor.root_descriptor_table.num_descriptors;
+		}
+	}
+
+	this->init_descriptor_copy_lists(unwrapped_descriptor_set_layout);
+}
+
+void brx_d3d12_descriptor_set::uninit_transient()
+{
+	this->m_descriptors.clear();
+
+	this->uninit_descriptor_copy_lists();
+}
+
+void brx_d3d12_descriptor_set::init_descriptor_copy_lists(brx_d3d12_descriptor_set_layout const *unwrapped_descriptor_set_layout)
+{
+	assert(this->m_cbv_srv_uav_descriptor_copy_list.descriptor_range_sizes.empty());
+	assert(this->m_sampler_descriptor_copy_list.descriptor_range_sizes.empty());
+	this->m_descriptor_update_template = unwrapped_descriptor_set_layout->has_descriptor_update_template();
+	if (this->m_descriptor_update_template)
+	{
+		// the descriptor heap indices never change during the lifetime of the descriptor set, and thus the copy ranges can be precomputed
+		// the descriptor heaps may be recreated when grown, and thus the CPU descriptor handles are resolved by the "write_descriptor_with_template"
+		for (brx_d3d12_descriptor const &descriptor : this->m_descriptors)
+		{
+			if ((BRX_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER != descriptor.root_parameter_type) && (descriptor.root_descriptor_table.num_descriptors > 0U))
+			{
+				brx_d3d12_descriptor_copy_list &descriptor_copy_list = (BRX_DESCRIPTOR_TYPE_SAMPLER != descriptor.root_parameter_type) ? this->m_cbv_srv_uav_descriptor_copy_list : this->m_sampler_descriptor_copy_list;
+				descriptor_copy_list.base_descriptor_heap_indices.push_back(descriptor.root_descriptor_table.base_descriptor_heap_index);
+				descriptor_copy_list.descriptor_range_sizes.push_back(descriptor.root_descriptor_table.num_descriptors);
+			}
+		}
+
+		this->m_cbv_srv_uav_descriptor_copy_list.dest_descriptor_range_starts.resize(this->m_cbv_srv_uav_descriptor_copy_list.descriptor_range_sizes.size());
+		this->m_cbv_srv_uav_descriptor_copy_list.src_descriptor_range_starts.resize(this->m_cbv_srv_uav_descriptor_copy_list.descriptor_range_sizes.size());
+		this->m_sampler_descriptor_copy_list.dest_descriptor_range_starts.resize(this->m_sampler_descriptor_copy_list.descriptor_range_sizes.size());
+		this->m_sampler_descriptor_copy_list.src_descriptor_range_starts.resize(this->m_sampler_descriptor_copy_list.descriptor_range_sizes.size());
+	}
+}
+
+void brx_d3d12_descriptor_set::uninit_descriptor_copy_lists()
+{
+	this->m_descriptor_update_template = false;
+	this->m_cbv_srv_uav_descriptor_copy_list.base_descriptor_heap_indices.clear();
+	this->m_cbv_srv_uav_descriptor_copy_list.dest_descriptor_range_starts.clear();
+	this->m_cbv_srv_uav_descriptor_copy_list.src_descriptor_range_starts.clear();
+	this->m_cbv_srv_uav_descriptor_copy_list.descriptor_range_sizes.clear();
+	this->m_sampler_descriptor_copy_list.base_descriptor_heap_indices.clear();
+	this->m_sampler_descriptor_copy_list.dest_descriptor_range_starts.clear();
+	this->m_sampler_descriptor_copy_list.src_descriptor_range_starts.clear();
+	this->m_sampler_descriptor_copy_list.descriptor_range_sizes.clear();
 }
 
 brx_d3d12_descriptor_set::~brx_d3d12_descriptor_set()
@@ -460,7 +575,7 @@ brx_d3d12_descriptor_set::~brx_d3d12_descriptor_set()
 	assert(0U == this->m_descriptors.size());
 }
 
-void brx_d3d12_descriptor_set::write_descriptor(ID3D12Device *device, brx_d3d12_descriptor_allocator const *descriptor_allocator, BRX_DESCRIPTOR_TYPE wrapped_descriptor_type, uint32_t dst_binding, uint32_t dst_array_element, uint32_t src_descriptor_count, brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_storage_buffer const *const *src_storage_buffers, brx_sampled_image const *const *src_sampled_images, brx_sampler const *const *src_samplers, brx_storage_image const *const *src_storage_images, brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures)
+void brx_d3d12_descriptor_set::write_descriptor(ID3D12Device *device, brx_d3d12_descriptor_allocator const *descriptor_allocator, BRX_DESCRIPTOR_TYPE wrapped_descriptor_type, uint32_t dst_binding, uint32_t dst_array_element, uint32_t src_descriptor_count, brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_storage_buffer const *const *src_storage_buffers, brx_sampled_image const *const *src_sampled_images, brx_sampler const *const *src_samplers, brx_storage_image const *const *src_storage_images, brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures, uint32_t *out_copy_base_descriptor_heap_index)
 {
 	uint32_t destination_descriptor_layout_index = -1;
 	{
@@ -481,6 +596,10 @@ void brx_d3d12_descriptor_set::write_descriptor(ID3D12Device *device, brx_d3d12_
 
 	brx_d3d12_descriptor &destination_descriptor = this->m_descriptors[destination_descriptor_layout_index];
 
+	// the views are only created in the non shader visible descriptor heap, and the caller copies them into the shader visible descriptor heap by the "CopyDescriptors"
+	assert(NULL != out_copy_base_descriptor_heap_index);
+	(*out_copy_base_descriptor_heap_index) = (BRX_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER != wrapped_descriptor_type) ? (destination_descriptor.root_descriptor_table.base_descriptor_heap_index + dst_array_element) : static_cast<uint32_t>(-1);
+
 	switch (wrapped_descriptor_type)
 	{
 	case BRX_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER:
@@ -519,10 +638,8 @@ void brx_d3d12_descriptor_set::write_descriptor(ID3D12Device *device, brx_d3d12_
 			ID3D12Resource *const resource = static_cast<brx_d3d12_storage_buffer const *>(src_storage_buffers[descriptor_index])->get_resource();
 			D3D12_SHADER_RESOURCE_VIEW_DESC const *const shader_resource_view_desc = static_cast<brx_d3d12_storage_buffer const *>(src_storage_buffers[descriptor_index])->get_shader_resource_view_desc();
 
-			D3D12_CPU_DESCRIPTOR_HANDLE const shader_visible_shader_resource_view_descriptor = descriptor_allocator->get_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + dst_array_element + descriptor_index);
 			D3D12_CPU_DESCRIPTOR_HANDLE const non_shader_visible_shader_resource_view_descriptor = descriptor_allocator->get_non_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + dst_array_element + descriptor_index);
 
-			device->CreateShaderResourceView(resource, shader_resource_view_desc, shader_visible_shader_resource_view_descriptor);
 			device->CreateShaderResourceView(resource, shader_resource_view_desc, non_shader_visible_shader_resource_view_descriptor);
 		}
 	}
@@ -545,10 +662,8 @@ void brx_d3d12_descriptor_set::write_descriptor(ID3D12Device *device, brx_d3d12_
 			ID3D12Resource *const resource = static_cast<brx_d3d12_storage_buffer const *>(src_storage_buffers[descriptor_index])->get_resource();
 			D3D12_UNORDERED_ACCESS_VIEW_DESC unordered_access_view_desc = (*static_cast<brx_d3d12_storage_buffer const *>(src_storage_buffers[descriptor_index])->get_unordered_access_view_desc());
 
-			D3D12_CPU_DESCRIPTOR_HANDLE const shader_visible_shader_resource_view_descriptor = descriptor_allocator->get_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + dst_array_element + descriptor_index);
 			D3D12_CPU_DESCRIPTOR_HANDLE const non_shader_visible_shader_resource_view_descriptor = descriptor_allocator->get_non_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + dst_array_element + descriptor_index);
 
-			device->CreateUnorderedAccessView(resource, NULL, &unordered_access_view_desc, shader_visible_shader_resource_view_descriptor);
 			device->CreateUnorderedAccessView(resource, NULL, &unordered_access_view_desc, non_shader_visible_shader_resource_view_descriptor);
 		}
 	}
@@ -571,10 +686,8 @@ void brx_d3d12_descriptor_set::write_descriptor(ID3D12Device *device, brx_d3d12_
 			ID3D12Resource *const resource = static_cast<brx_d3d12_sampled_image const *>(src_sampled_images[descriptor_index])->get_resource();
 			D3D12_SHADER_RESOURCE_VIEW_DESC const *const shader_resource_view_desc = static_cast<brx_d3d12_sampled_image const *>(src_sampled_images[descriptor_index])->get_shader_resource_view_desc();
 
-			D3D12_CPU_DESCRIPTOR_HANDLE const shader_visible_shader_resource_view_descriptor = descriptor_allocator->get_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + dst_array_element + descriptor_index);
 			D3D12_CPU_DESCRIPTOR_HANDLE const non_shader_visible_shader_resource_view_descriptor = descriptor_allocator->get_non_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + dst_array_element + descriptor_index);
 
-			device->CreateShaderResourceView(resource, shader_resource_view_desc, shader_visible_shader_resource_view_descriptor);
 			device->CreateShaderResourceView(resource, shader_resource_view_desc, non_shader_visible_shader_resource_view_descriptor);
 		}
 	}
@@ -596,10 +709,8 @@ void brx_d3d12_descriptor_set::write_descriptor(ID3D12Device *device, brx_d3d12_
 
 			D3D12_SAMPLER_DESC const *const sampler_desc = static_cast<brx_d3d12_sampler const *>(src_samplers[descriptor_index])->get_sampler_desc();
 
-			D3D12_CPU_DESCRIPTOR_HANDLE const shader_visible_sampler_descriptor = descriptor_allocator->get_shader_visible_sampler_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + dst_array_element + descriptor_index);
 			D3D12_CPU_DESCRIPTOR_HANDLE const non_shader_visible_sampler_descriptor = descriptor_allocator->get_non_shader_visible_sampler_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + dst_array_element + descriptor_index);
 
-			device->CreateSampler(sampler_desc, shader_visible_sampler_descriptor);
 			device->CreateSampler(sampler_desc, non_shader_visible_sampler_descriptor);
 		}
 	}
@@ -622,10 +733,8 @@ void brx_d3d12_descriptor_set::write_descriptor(ID3D12Device *device, brx_d3d12_
 			ID3D12Resource *const resource = static_cast<brx_d3d12_storage_image const *>(src_storage_images[descriptor_index])->get_resource();
 			D3D12_UNORDERED_ACCESS_VIEW_DESC const *const unordered_access_view_desc = static_cast<brx_d3d12_storage_image const *>(src_storage_images[descriptor_index])->get_unordered_access_view_desc();
 
-			D3D12_CPU_DESCRIPTOR_HANDLE const shader_visible_shader_resource_view_descriptor = descriptor_allocator->get_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + dst_array_element + descriptor_index);
 			D3D12_CPU_DESCRIPTOR_HANDLE const non_shader_visible_shader_resource_view_descriptor = descriptor_allocator->get_non_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + dst_array_element + descriptor_index);
 
-			device->CreateUnorderedAccessView(resource, NULL, unordered_access_view_desc, shader_visible_shader_resource_view_descriptor);
 			device->CreateUnorderedAccessView(resource, NULL, unordered_access_view_desc, non_shader_visible_shader_resource_view_descriptor);
 		}
 	}
@@ -647,10 +756,8 @@ void brx_d3d12_descriptor_set::write_descriptor(ID3D12Device *device, brx_d3d12_
 
 			D3D12_SHADER_RESOURCE_VIEW_DESC const *const shader_resource_view_desc = static_cast<brx_d3d12_top_level_acceleration_structure const *>(src_top_level_acceleration_structures[descriptor_index])->get_shader_resource_view_desc();
 
-			D3D12_CPU_DESCRIPTOR_HANDLE const shader_visible_shader_resource_view_descriptor = descriptor_allocator->get_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + dst_array_element + descriptor_index);
 			D3D12_CPU_DESCRIPTOR_HANDLE const non_shader_visible_shader_resource_view_descriptor = descriptor_allocator->get_non_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + dst_array_element + descriptor_index);
 
-			device->CreateShaderResourceView(NULL, shader_resource_view_desc, shader_visible_shader_resource_view_descriptor);
 			device->CreateShaderResourceView(NULL, shader_resource_view_desc, non_shader_visible_shader_resource_view_descriptor);
 		}
 	}
@@ -662,6 +769,124 @@ void brx_d3d12_descriptor_set::write_descriptor(ID3D12Device *device, brx_d3d12_
 	}
 }
 
+void brx_d3d12_descriptor_set::write_descriptor_with_template(ID3D12Device *device, brx_d3d12_descriptor_allocator const *descriptor_allocator, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges)
+{
+	assert(this->m_descriptor_update_template);
+
+	uint32_t src_descriptor_index = 0U;
+	for (brx_d3d12_descriptor &destination_descriptor : this->m_descriptors)
+	{
+		switch (destination_descriptor.root_parameter_type)
+		{
+		case BRX_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER:
+		{
+			// the range is only used by Vulkan
+			assert(NULL != src_dynamic_uniform_buffer_ranges);
+			assert(NULL != src_descriptors[src_descriptor_index]);
+			destination_descriptor.root_constant_buffer_view.address_base = static_cast<brx_d3d12_uniform_upload_buffer const *>(static_cast<brx_uniform_upload_buffer const *>(src_descriptors[src_descriptor_index]))->get_resource()->GetGPUVirtualAddress();
+			++src_descriptor_index;
+		}
+		break;
+		case BRX_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER:
+		{
+			for (uint32_t descriptor_index = 0U; descriptor_index < destination_descriptor.root_descriptor_table.num_descriptors; ++descriptor_index)
+			{
+				assert(NULL != src_descriptors[src_descriptor_index]);
+				brx_d3d12_storage_buffer const *const storage_buffer = static_cast<brx_d3d12_storage_buffer const *>(static_cast<brx_storage_buffer const *>(src_descriptors[src_descriptor_index]));
+				device->CreateShaderResourceView(storage_buffer->get_resource(), storage_buffer->get_shader_resource_view_desc(), descriptor_allocator->get_non_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + descriptor_index));
+				++src_descriptor_index;
+			}
+		}
+		break;
+		case BRX_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+		{
+			for (uint32_t descriptor_index = 0U; descriptor_index < destination_descriptor.root_descriptor_table.num_descriptors; ++descriptor_index)
+			{
+				assert(NULL != src_descriptors[src_descriptor_index]);
+				brx_d3d12_storage_buffer const *const storage_buffer = static_cast<brx_d3d12_storage_buffer const *>(static_cast<brx_storage_buffer const *>(src_descriptors[src_descriptor_index]));
+				device->CreateUnorderedAccessView(storage_buffer->get_resource(), NULL, storage_buffer->get_unordered_access_view_desc(), descriptor_allocator->get_non_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + descriptor_index));
+				++src_descriptor_index;
+			}
+		}
+		break;
+		case BRX_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+		{
+			for (uint32_t descriptor_index = 0U; descriptor_index < destination_descriptor.root_descriptor_table.num_descriptors; ++descriptor_index)
+			{
+				assert(NULL != src_descriptors[src_descriptor_index]);
+				brx_d3d12_sampled_image const *const sampled_image = static_cast<brx_d3d12_sampled_image const *>(static_cast<brx_sampled_image const *>(src_descriptors[src_descriptor_index]));
+				device->CreateShaderResourceView(sampled_image->get_resource(), sampled_image->get_shader_resource_view_desc(), descriptor_allocator->get_non_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + descriptor_index));
+				++src_descriptor_index;
+			}
+		}
+		break;
+		case BRX_DESCRIPTOR_TYPE_SAMPLER:
+		{
+			for (uint32_t descriptor_index = 0U; descriptor_index < destination_descriptor.root_descriptor_table.num_descriptors; ++descriptor_index)
+			{
+				assert(NULL != src_descriptors[src_descriptor_index]);
+				brx_d3d12_sampler const *const sampler = static_cast<brx_d3d12_sampler const *>(static_cast<brx_sampler const *>(src_descriptors[src_descriptor_index]));
+				device->CreateSampler(sampler->get_sampler_desc(), descriptor_allocator->get_non_shader_visible_sampler_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + descriptor_index));
+				++src_descriptor_index;
+			}
+		}
+		break;
+		case BRX_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+		{
+			for (uint32_t descriptor_index = 0U; descriptor_index < destination_descriptor.root_descriptor_table.num_descriptors; ++descriptor_index)
+			{
+				assert(NULL != src_descriptors[src_descriptor_index]);
+				brx_d3d12_storage_image const *const storage_image = static_cast<brx_d3d12_storage_image const *>(static_cast<brx_storage_image const *>(src_descriptors[src_descriptor_index]));
+				device->CreateUnorderedAccessView(storage_image->get_resource(), NULL, storage_image->get_unordered_access_view_desc(), descriptor_allocator->get_non_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + descriptor_index));
+				++src_descriptor_index;
+			}
+		}
+		break;
+		case BRX_DESCRIPTOR_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE:
+		{
+			for (uint32_t descriptor_index = 0U; descriptor_index < destination_descriptor.root_descriptor_table.num_descriptors; ++descriptor_index)
+			{
+				assert(NULL != src_descriptors[src_descriptor_index]);
+				brx_d3d12_top_level_acceleration_structure const *const top_level_acceleration_structure = static_cast<brx_d3d12_top_level_acceleration_structure const *>(static_cast<brx_top_level_acceleration_structure const *>(src_descriptors[src_descriptor_index]));
+				device->CreateShaderResourceView(NULL, top_level_acceleration_structure->get_shader_resource_view_desc(), descriptor_allocator->get_non_shader_visible_cbv_srv_uav_cpu_descriptor_handle(destination_descriptor.root_descriptor_table.base_descriptor_heap_index + descriptor_index));
+				++src_descriptor_index;
+			}
+		}
+		break;
+		default:
+		{
+			assert(false);
+		}
+		}
+	}
+
+	uint32_t const cbv_srv_uav_copy_descriptor_range_count = static_cast<uint32_t>(this->m_cbv_srv_uav_descriptor_copy_list.descriptor_range_sizes.size());
+	if (cbv_srv_uav_copy_descriptor_range_count > 0U)
+	{
+		for (uint32_t copy_descriptor_range_index = 0U; copy_descriptor_range_index < cbv_srv_uav_copy_descriptor_range_count; ++copy_descriptor_range_index)
+		{
+			uint32_t const base_descriptor_heap_index = this->m_cbv_srv_uav_descriptor_copy_list.base_descriptor_heap_indices[copy_descriptor_range_index];
+			this->m_cbv_srv_uav_descriptor_copy_list.dest_descriptor_range_starts[copy_descriptor_range_index] = descriptor_allocator->get_shader_visible_cbv_srv_uav_cpu_descriptor_handle(base_descriptor_heap_index);
+			this->m_cbv_srv_uav_descriptor_copy_list.src_descriptor_range_starts[copy_descriptor_range_index] = descriptor_allocator->get_non_shader_visible_cbv_srv_uav_cpu_descriptor_handle(base_descriptor_heap_index);
+		}
+
+		device->CopyDescriptors(cbv_srv_uav_copy_descriptor_range_count, this->m_cbv_srv_uav_descriptor_copy_list.dest_descriptor_range_starts.data(), this->m_cbv_srv_uav_descriptor_copy_list.descriptor_range_sizes.data(), cbv_srv_uav_copy_descriptor_range_count, this->m_cbv_srv_uav_descriptor_copy_list.src_descriptor_range_starts.data(), this->m_cbv_srv_uav_descriptor_copy_list.descriptor_range_sizes.data(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+	}
+
+	uint32_t const sampler_copy_descriptor_range_count = static_cast<uint32_t>(this->m_sampler_descriptor_copy_list.descriptor_range_sizes.size());
+	if (sampler_copy_descriptor_range_count > 0U)
+	{
+		for (uint32_t copy_descriptor_range_index = 0U; copy_descriptor_range_index < sampler_copy_descriptor_range_count; ++copy_descriptor_range_index)
+		{
+			uint32_t const base_descriptor_heap_index = this->m_sampler_descriptor_copy_list.base_descriptor_heap_indices[copy_descriptor_range_index];
+			this->m_sampler_descriptor_copy_list.dest_descriptor_range_starts[copy_descriptor_range_index] = descriptor_allocator->get_shader_visible_sampler_cpu_descriptor_handle(base_descriptor_heap_index);
+			this->m_sampler_descriptor_copy_list.src_descriptor_range_starts[copy_descriptor_range_index] = descriptor_allocator->get_non_shader_visible_sampler_cpu_descriptor_handle(base_descriptor_heap_index);
+		}
+
+		device->CopyDescriptors(sampler_copy_descriptor_range_count, this->m_sampler_descriptor_copy_list.dest_descriptor_range_starts.data(), this->m_sampler_descriptor_copy_list.descriptor_range_sizes.data(), sampler_copy_descriptor_range_count, this->m_sampler_descriptor_copy_list.src_descriptor_range_starts.data(), this->m_sampler_descriptor_copy_list.descriptor_range_sizes.data(), D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+	}
+}
+
 uint32_t brx_d3d12_descriptor_set::get_descriptor_count() const
 {
 	return static_cast<uint32_t>(this->m_descriptors.size());
@@ -671,3 +896,83 @@ brx_d3d12_descriptor const *brx_d3d12_descriptor_set::get_descriptors() const
 {
 	return this->m_descriptors.data();
 }
+
+brx_d3d12_bindless_table::brx_d3d12_bindless_table() : m_descriptor_type(static_cast<BRX_DESCRIPTOR_TYPE>(-1)), m_descriptor_set_layout(NULL), m_descriptor_set(NULL)
+{
+}
+
+void brx_d3d12_bindless_table::init(BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t descriptor_count, brx_d3d12_descriptor_set_layout *descriptor_set_layout, brx_d3d12_descriptor_set *descriptor_set)
+{
+	this->m_descriptor_type = descriptor_type;
+
+	assert(NULL == this->m_descriptor_set_layout);
+	this->m_descriptor_set_layout = descriptor_set_layout;
+
+	assert(NULL == this->m_descriptor_set);
+	this->m_descriptor_set = descriptor_set;
+
+	// the free list is used as a stack, and the lower descriptor indices are allocated first
+	assert(this->m_free_descriptor_indices.empty());
+	this->m_free_descriptor_indices.resize(static_cast<size_t>(descriptor_count));
+	for (uint32_t descriptor_index = 0U; descriptor_index < descriptor_count; ++descriptor_index)
+	{
+		this->m_free_descriptor_indices[descriptor_index] = (descriptor_count - 1U) - descriptor_index;
+	}
+}
+
+void brx_d3d12_bindless_table::steal(brx_d3d12_descriptor_set_layout **out_descriptor_set_layout, brx_d3d12_descriptor_set **out_descriptor_set)
+{
+	assert(NULL != out_descriptor_set_layout);
+	assert(NULL != out_descriptor_set);
+
+	(*out_descriptor_set_layout) = this->m_descriptor_set_layout;
+	(*out_descriptor_set) = this->m_descriptor_set;
+
+	this->m_descriptor_set_layout = NULL;
+	this->m_descriptor_set = NULL;
+	this->m_free_descriptor_indices.clear();
+}
+
+brx_d3d12_bindless_table::~brx_d3d12_bindless_table()
+{
+	assert(NULL == this->m_descriptor_set_layout);
+	assert(NULL == this->m_descriptor_set);
+}
+
+BRX_DESCRIPTOR_TYPE brx_d3d12_bindless_table::get_descriptor_type() const
+{
+	return this->m_descriptor_type;
+}
+
+brx_d3d12_descriptor_set_layout *brx_d3d12_bindless_table::get_descriptor_set_layout() const
+{
+	return this->m_descriptor_set_layout;
+}
+
+brx_d3d12_descriptor_set *brx_d3d12_bindless_table::get_descriptor_set() const
+{
+	return this->m_descriptor_set;
+}
+
+uint32_t brx_d3d12_bindless_table::alloc_descriptor_index()
+{
+	uint32_t descriptor_index;
+	if (!this->m_free_descriptor_indices.empty())
+	{
+		descriptor_index = this->m_free_descriptor_indices.back();
+		this->m_free_descriptor_indices.pop_back();
+	}
+	else
+	{
+		assert(false);
+		descriptor_index = static_cast<uint32_t>(-1);
+	}
+
+	return descriptor_index;
+}
+
+void brx_d3d12_bindless_table::free_descriptor_index(uint32_t descriptor_index)
+{
+	// the stale descriptor is NOT accessed since the shader only uses the descriptor indices which are allocated
+	this->m_free_descriptor_indices.push_back(descriptor_index);
+}
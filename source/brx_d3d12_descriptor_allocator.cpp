@@ -19,6 +19,7 @@
 #include "brx_malloc.h"
 #include <algorithm>
 #include <assert.h>
+#include <new>
 
 brx_d3d12_descriptor_allocator::brx_d3d12_descriptor_allocator()
 	: m_device(NULL),
@@ -430,4 +431,139 @@ void brx_d3d12_descriptor_allocator::bind_command_list(ID3D12GraphicsCommandList
 	{
 		// Do Nothing
 	}
-}
\ No newline at end of file
+}
+
+brx_d3d12_transient_descriptor_allocator::brx_d3d12_transient_descriptor_allocator()
+	: m_descriptor_allocator(NULL),
+	  m_current_cbv_srv_uav_descriptor_region_index(0U),
+	  m_current_cbv_srv_uav_descriptor_region_offset(0U),
+	  m_current_sampler_descriptor_region_index(0U),
+	  m_current_sampler_descriptor_region_offset(0U),
+	  m_descriptor_set_count(0U)
+{
+}
+
+void brx_d3d12_transient_descriptor_allocator::init(brx_d3d12_descriptor_allocator *descriptor_allocator)
+{
+	assert(NULL == this->m_descriptor_allocator);
+	this->m_descriptor_allocator = descriptor_allocator;
+
+	assert(this->m_cbv_srv_uav_descriptor_regions.empty());
+	assert(this->m_sampler_descriptor_regions.empty());
+	assert(this->m_descriptor_sets.empty());
+}
+
+void brx_d3d12_transient_descriptor_allocator::uninit()
+{
+	this->reset();
+
+	for (brx_d3d12_descriptor_set *const delete_descriptor_set : this->m_descriptor_sets)
+	{
+		delete_descriptor_set->~brx_d3d12_descriptor_set();
+		brx_free(delete_descriptor_set);
+	}
+	this->m_descriptor_sets.clear();
+
+	for (brx_d3d12_transient_descriptor_region const &descriptor_region : this->m_cbv_srv_uav_descriptor_regions)
+	{
+		this->m_descriptor_allocator->free_cbv_srv_uav_descriptor(descriptor_region.base_descriptor_heap_index, descriptor_region.alloced_num_descriptors);
+	}
+	this->m_cbv_srv_uav_descriptor_regions.clear();
+
+	for (brx_d3d12_transient_descriptor_region const &descriptor_region : this->m_sampler_descriptor_regions)
+	{
+		this->m_descriptor_allocator->free_sampler_descriptor(descriptor_region.base_descriptor_heap_index, descriptor_region.alloced_num_descriptors);
+	}
+	this->m_sampler_descriptor_regions.clear();
+
+	assert(NULL != this->m_descriptor_allocator);
+	this->m_descriptor_allocator = NULL;
+}
+
+brx_d3d12_transient_descriptor_allocator::~brx_d3d12_transient_descriptor_allocator()
+{
+	assert(NULL == this->m_descriptor_allocator);
+	assert(this->m_cbv_srv_uav_descriptor_regions.empty());
+	assert(this->m_sampler_descriptor_regions.empty());
+	assert(this->m_descriptor_sets.empty());
+}
+
+brx_d3d12_descriptor_set *brx_d3d12_transient_descriptor_allocator::alloc_descriptor_set(brx_descriptor_set_layout const *descriptor_set_layout)
+{
+	// the wrappers are reused across frames, and thus the allocation is merely a pointer bump after the first few frames
+	if (this->m_descriptor_set_count >= this->m_descriptor_sets.size())
+	{
+		void *new_unwrapped_descriptor_set_base = brx_malloc(sizeof(brx_d3d12_descriptor_set), alignof(brx_d3d12_descriptor_set));
+		assert(NULL != new_unwrapped_descriptor_set_base);
+
+		this->m_descriptor_sets.push_back(new (new_unwrapped_descriptor_set_base) brx_d3d12_descriptor_set{});
+	}
+
+	brx_d3d12_descriptor_set *const new_unwrapped_descriptor_set = this->m_descriptor_sets[this->m_descriptor_set_count];
+	++this->m_descriptor_set_count;
+
+	new_unwrapped_descriptor_set->init_transient(this, descriptor_set_layout);
+	return new_unwrapped_descriptor_set;
+}
+
+void brx_d3d12_transient_descriptor_allocator::reset()
+{
+	for (uint32_t descriptor_set_index = 0U; descriptor_set_index < this->m_descriptor_set_count; ++descriptor_set_index)
+	{
+		this->m_descriptor_sets[descriptor_set_index]->uninit_transient();
+	}
+	this->m_descriptor_set_count = 0U;
+
+	// the regions are kept, and the descriptors are overwritten by the "write_descriptor_set" before the descriptor sets are used again
+	this->m_current_cbv_srv_uav_descriptor_region_index = 0U;
+	this->m_current_cbv_srv_uav_descriptor_region_offset = 0U;
+	this->m_current_sampler_descriptor_region_index = 0U;
+	this->m_current_sampler_descriptor_region_offset = 0U;
+}
+
+uint32_t brx_d3d12_transient_descriptor_allocator::alloc_cbv_srv_uav_descriptor(uint32_t num_descriptors)
+{
+	while ((this->m_current_cbv_srv_uav_descriptor_region_index < this->m_cbv_srv_uav_descriptor_regions.size()) && ((this->m_current_cbv_srv_uav_descriptor_region_offset + num_descriptors) > this->m_cbv_srv_uav_descriptor_regions[this->m_current_cbv_srv_uav_descriptor_region_index].alloced_num_descriptors))
+	{
+		++this->m_current_cbv_srv_uav_descriptor_region_index;
+		this->m_current_cbv_srv_uav_descriptor_region_offset = 0U;
+	}
+
+	if (this->m_current_cbv_srv_uav_descriptor_region_index >= this->m_cbv_srv_uav_descriptor_regions.size())
+	{
+		constexpr uint32_t const min_transient_cbv_srv_uav_descriptor_region_num_descriptors = 4096U;
+
+		brx_d3d12_transient_descriptor_region new_descriptor_region;
+		new_descriptor_region.base_descriptor_heap_index = this->m_descriptor_allocator->alloc_cbv_srv_uav_descriptor(std::max(num_descriptors, min_transient_cbv_srv_uav_descriptor_region_num_descriptors), &new_descriptor_region.alloced_num_descriptors);
+		this->m_cbv_srv_uav_descriptor_regions.push_back(new_descriptor_region);
+	}
+
+	uint32_t const base_descriptor_heap_index = this->m_cbv_srv_uav_descriptor_regions[this->m_current_cbv_srv_uav_descriptor_region_index].base_descriptor_heap_index + this->m_current_cbv_srv_uav_descriptor_region_offset;
+	this->m_current_cbv_srv_uav_descriptor_region_offset += num_descriptors;
+	assert(this->m_current_cbv_srv_uav_descriptor_region_offset <= this->m_cbv_srv_uav_descriptor_regions[this->m_current_cbv_srv_uav_descriptor_region_index].alloced_num_descriptors);
+	return base_descriptor_heap_index;
+}
+
+uint32_t brx_d3d12_transient_descriptor_allocator::alloc_sampler_descriptor(uint32_t num_descriptors)
+{
+	while ((this->m_current_sampler_descriptor_region_index < this->m_sampler_descriptor_regions.size()) && ((this->m_current_sampler_descriptor_region_offset + num_descriptors) > this->m_sampler_descriptor_regions[this->m_current_sampler_descriptor_region_index].alloced_num_descriptors))
+	{
+		++this->m_current_sampler_descriptor_region_index;
+		this->m_current_sampler_descriptor_region_offset = 0U;
+	}
+
+	if (this->m_current_sampler_descriptor_region_index >= this->m_sampler_descriptor_regions.size())
+	{
+		// the size of the shader visible sampler descriptor heap is limited to 2048
+		constexpr uint32_t const min_transient_sampler_descriptor_region_num_descriptors = 64U;
+
+		brx_d3d12_transient_descriptor_region new_descriptor_region;
+		new_descriptor_region.base_descriptor_heap_index = this->m_descriptor_allocator->alloc_sampler_descriptor(std::max(num_descriptors, min_transient_sampler_descriptor_region_num_descriptors), &new_descriptor_region.alloced_num_descriptors);
+		this->m_sampler_descriptor_regions.push_back(new_descriptor_region);
+	}
+
+	uint32_t const base_descriptor_heap_index = this->m_sampler_descriptor_regions[this->m_current_sampler_descriptor_region_index].base_descriptor_heap_index + this->m_current_sampler_descriptor_region_offset;
+	this->m_current_sampler_descriptor_region_offset += num_descriptors;
+	assert(this->m_current_sampler_descriptor_region_offset <= this->m_sampler_descriptor_regions[this->m_current_sampler_descriptor_region_index].alloced_num_descriptors);
+	return base_descriptor_heap_index;
+}
@@ -43,6 +43,8 @@ brx_d3d12_device::brx_d3d12_device()
 	  m_device(NULL),
 	  m_graphics_queue(NULL),
 	  m_upload_queue(NULL),
+	  m_compute_queue(NULL),
+	  m_timestamp_period(-1.0),
 	  m_memory_allocator(NULL),
 	  m_uniform_upload_buffer_memory_pool(NULL),
 	  m_staging_upload_buffer_memory_pool(NULL),
@@ -52,12 +54,16 @@ brx_d3d12_device::brx_d3d12_device()
 	  m_asset_index_buffer_memory_pool(NULL),
 	  m_asset_sampled_image_memory_pool(NULL),
 	  m_storage_image_memory_pool(NULL),
+	  m_timestamp_query_buffer_memory_pool(NULL),
 	  m_scratch_buffer_memory_pool(NULL),
 	  m_staging_non_compacted_bottom_level_acceleration_structure_memory_pool(NULL),
 	  m_compacted_bottom_level_acceleration_structure_size_query_buffer_memory_pool(NULL),
 	  m_asset_compacted_bottom_level_acceleration_structure_memory_pool(NULL),
 	  m_top_level_acceleration_structure_instance_upload_buffer_memory_pool(NULL),
-	  m_top_level_acceleration_structure_memory_pool(NULL)
+	  m_top_level_acceleration_structure_memory_pool(NULL),
+	  m_draw_indirect_command_signature(NULL),
+	  m_draw_index_indirect_command_signature(NULL),
+	  m_dispatch_indirect_command_signature(NULL)
 {
 }
 
@@ -203,6 +209,14 @@ void brx_d3d12_device::init(bool support_ray_tracing)
 		assert((!this->m_cache_coherent_uma) || this->m_uma);
 	}
 
+	{
+		D3D12_FEATURE_DATA_D3D12_OPTIONS feature_support_data = {};
+		HRESULT hr_check_feature_support = this->m_device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &feature_support_data, sizeof(feature_support_data));
+		assert(SUCCEEDED(hr_check_feature_support));
+
+		this->m_resource_binding_tier_2 = (feature_support_data.ResourceBindingTier >= D3D12_RESOURCE_BINDING_TIER_2);
+	}
+
 	assert(NULL == this->m_graphics_queue);
 	{
 		D3D12_COMMAND_QUEUE_DESC command_queue_desc = {
@@ -214,6 +228,16 @@ void brx_d3d12_device::init(bool support_ray_tracing)
 		assert(SUCCEEDED(hr_create_command_queue));
 	}
 
+	// the frequency of the upload (namely compute) queue is assumed to be the same
+	{
+		UINT64 timestamp_frequency = 0U;
+		HRESULT hr_get_timestamp_frequency = this->m_graphics_queue->GetTimestampFrequency(&timestamp_frequency);
+		assert(SUCCEEDED(hr_get_timestamp_frequency));
+		assert(timestamp_frequency > 0U);
+
+		this->m_timestamp_period = 1000.0 / static_cast<double>(timestamp_frequency);
+	}
+
 	assert(NULL == this->m_upload_queue);
 	if ((!this->m_uma) || this->m_support_ray_tracing)
 	{
@@ -229,6 +253,18 @@ void brx_d3d12_device::init(bool support_ray_tracing)
 		assert(SUCCEEDED(hr_create_command_queue));
 	}
 
+	// the compute queue is always separated from the graphics queue (namely, the async compute)
+	assert(NULL == this->m_compute_queue);
+	{
+		D3D12_COMMAND_QUEUE_DESC command_queue_desc = {
+			D3D12_COMMAND_LIST_TYPE_COMPUTE,
+			D3D12_COMMAND_QUEUE_PRIORITY_NORMAL,
+			D3D12_COMMAND_QUEUE_FLAG_NONE,
+			0U};
+		HRESULT hr_create_command_queue = this->m_device->CreateCommandQueue(&command_queue_desc, IID_PPV_ARGS(&this->m_compute_queue));
+		assert(SUCCEEDED(hr_create_command_queue));
+	}
+
 	assert(NULL == this->m_memory_allocator);
 	{
 		D3D12MA::ALLOCATOR_DESC allocator_desc = {D3D12MA::ALLOCATOR_FLAG_SINGLETHREADED, this->m_device, 0U, NULL, this->m_adapter};
@@ -391,6 +427,25 @@ void brx_d3d12_device::init(bool support_ray_tracing)
 		assert(SUCCEEDED(hr_create_pool));
 	}
 
+	assert(NULL == this->m_timestamp_query_buffer_memory_pool);
+	{
+		D3D12MA::POOL_DESC const pool_desc = {
+			D3D12MA::POOL_FLAG_NONE,
+			{D3D12_HEAP_TYPE_CUSTOM,
+			 D3D12_CPU_PAGE_PROPERTY_WRITE_BACK,
+			 D3D12_MEMORY_POOL_L0,
+			 0U,
+			 0U},
+			D3D12_HEAP_FLAG_DENY_RT_DS_TEXTURES | D3D12_HEAP_FLAG_DENY_NON_RT_DS_TEXTURES,
+			0U,
+			0U,
+			0U,
+			alignof(uint64_t),
+			NULL};
+		HRESULT const hr_create_pool = this->m_memory_allocator->CreatePool(&pool_desc, &this->m_timestamp_query_buffer_memory_pool);
+		assert(SUCCEEDED(hr_create_pool));
+	}
+
 	if (this->m_support_ray_tracing)
 	{
 		assert(NULL == this->m_scratch_buffer_memory_pool);
@@ -510,6 +565,62 @@ void brx_d3d12_device::init(bool support_ray_tracing)
 	}
 
 	this->m_descriptor_allocator.init(this->m_device);
+
+	assert(NULL == this->m_draw_indirect_command_signature);
+	{
+		static_assert(sizeof(BRX_DRAW_INDIRECT_COMMAND) == sizeof(D3D12_DRAW_ARGUMENTS), "");
+
+		D3D12_INDIRECT_ARGUMENT_DESC const indirect_argument_desc = {
+			.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW};
+
+		D3D12_COMMAND_SIGNATURE_DESC const command_signature_desc = {
+			sizeof(D3D12_DRAW_ARGUMENTS),
+			1U,
+			&indirect_argument_desc,
+			0U};
+
+		HRESULT const hr_create_command_signature = this->m_device->CreateCommandSignature(&command_signature_desc, NULL, IID_PPV_ARGS(&this->m_draw_indirect_command_signature));
+		assert(SUCCEEDED(hr_create_command_signature));
+	}
+
+	assert(NULL == this->m_draw_index_indirect_command_signature);
+	{
+		static_assert(sizeof(BRX_DRAW_INDEX_INDIRECT_COMMAND) == sizeof(D3D12_DRAW_INDEXED_ARGUMENTS), "");
+
+		D3D12_INDIRECT_ARGUMENT_DESC const indirect_argument_desc = {
+			.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED};
+
+		D3D12_COMMAND_SIGNATURE_DESC const command_signature_desc = {
+			sizeof(D3D12_DRAW_INDEXED_ARGUMENTS),
+			1U,
+			&indirect_argument_desc,
+			0U};
+
+		HRESULT const hr_create_command_signature = this->m_device->CreateCommandSignature(&command_signature_desc, NULL, IID_PPV_ARGS(&this->m_draw_index_indirect_command_signature));
+		assert(SUCCEEDED(hr_create_command_signature));
+	}
+
+	assert(NULL == this->m_dispatch_indirect_command_signature);
+	{
+		static_assert(sizeof(BRX_DISPATCH_INDIRECT_COMMAND) == sizeof(D3D12_DISPATCH_ARGUMENTS), "");
+
+		D3D12_INDIRECT_ARGUMENT_DESC const indirect_argument_desc = {
+			.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH};
+
+		D3D12_COMMAND_SIGNATURE_DESC const command_signature_desc = {
+			sizeof(D3D12_DISPATCH_ARGUMENTS),
+			1U,
+			&indirect_argument_desc,
+			0U};
+
+		HRESULT const hr_create_command_signature = this->m_device->CreateCommandSignature(&command_signature_desc, NULL, IID_PPV_ARGS(&this->m_dispatch_indirect_command_signature));
+		assert(SUCCEEDED(hr_create_command_signature));
+	}
+
+	// the "CreateGraphicsPipelineState" and "CreateComputePipelineState" are free-threaded
+	this->m_pipeline_compiler.init(this);
+
+	this->m_staging_upload_ring_manager.init(this);
 }
 
 extern "C" void brx_destroy_d3d12_device(brx_device *wrapped_device)
@@ -525,6 +636,22 @@ extern "C" void brx_destroy_d3d12_device(brx_device *wrapped_device)
 
 void brx_d3d12_device::uninit()
 {
+	this->m_staging_upload_ring_manager.uninit();
+
+	this->m_pipeline_compiler.uninit();
+
+	assert(NULL != this->m_dispatch_indirect_command_signature);
+	this->m_dispatch_indirect_command_signature->Release();
+	this->m_dispatch_indirect_command_signature = NULL;
+
+	assert(NULL != this->m_draw_index_indirect_command_signature);
+	this->m_draw_index_indirect_command_signature->Release();
+	this->m_draw_index_indirect_command_signature = NULL;
+
+	assert(NULL != this->m_draw_indirect_command_signature);
+	this->m_draw_indirect_command_signature->Release();
+	this->m_draw_indirect_command_signature = NULL;
+
 	this->m_descriptor_allocator.uninit();
 
 	assert(NULL != this->m_uniform_upload_buffer_memory_pool);
@@ -559,6 +686,10 @@ void brx_d3d12_device::uninit()
 	this->m_storage_image_memory_pool->Release();
 	this->m_storage_image_memory_pool = NULL;
 
+	assert(NULL != this->m_timestamp_query_buffer_memory_pool);
+	this->m_timestamp_query_buffer_memory_pool->Release();
+	this->m_timestamp_query_buffer_memory_pool = NULL;
+
 	if (this->m_support_ray_tracing)
 	{
 		assert(NULL != this->m_scratch_buffer_memory_pool);
@@ -604,6 +735,10 @@ void brx_d3d12_device::uninit()
 		assert(NULL == this->m_upload_queue);
 	}
 
+	assert(NULL != this->m_compute_queue);
+	this->m_compute_queue->Release();
+	this->m_compute_queue = NULL;
+
 	assert(NULL != this->m_device);
 	this->m_device->Release();
 	this->m_device = NULL;
@@ -694,13 +829,39 @@ void brx_d3d12_device::destroy_upload_queue(brx_upload_queue *wrapped_upload_que
 	brx_free(delete_unwrapped_upload_queue);
 }
 
+bool brx_d3d12_device::is_async_compute_supported() const
+{
+	return true;
+}
+
+brx_compute_queue *brx_d3d12_device::create_compute_queue() const
+{
+	void *new_unwrapped_compute_queue_base = brx_malloc(sizeof(brx_d3d12_compute_queue), alignof(brx_d3d12_compute_queue));
+	assert(NULL != new_unwrapped_compute_queue_base);
+
+	brx_d3d12_compute_queue *new_unwrapped_compute_queue = new (new_unwrapped_compute_queue_base) brx_d3d12_compute_queue{};
+	new_unwrapped_compute_queue->init(this->m_compute_queue);
+	return new_unwrapped_compute_queue;
+}
+
+void brx_d3d12_device::destroy_compute_queue(brx_compute_queue *wrapped_compute_queue) const
+{
+	assert(NULL != wrapped_compute_queue);
+	brx_d3d12_compute_queue *delete_unwrapped_compute_queue = static_cast<brx_d3d12_compute_queue *>(wrapped_compute_queue);
+
+	delete_unwrapped_compute_queue->uninit(this->m_compute_queue);
+
+	delete_unwrapped_compute_queue->~brx_d3d12_compute_queue();
+	brx_free(delete_unwrapped_compute_queue);
+}
+
 brx_graphics_command_buffer *brx_d3d12_device::create_graphics_command_buffer() const
 {
 	void *new_unwrapped_graphics_command_buffer_base = brx_malloc(sizeof(brx_d3d12_graphics_command_buffer), alignof(brx_d3d12_graphics_command_buffer));
 	assert(NULL != new_unwrapped_graphics_command_buffer_base);
 
 	brx_d3d12_graphics_command_buffer *new_unwrapped_graphics_command_buffer = new (new_unwrapped_graphics_command_buffer_base) brx_d3d12_graphics_command_buffer{};
-	new_unwrapped_graphics_command_buffer->init(this->m_device, this->m_uma, this->m_support_ray_tracing, const_cast<brx_d3d12_descriptor_allocator *>(&this->m_descriptor_allocator));
+	new_unwrapped_graphics_command_buffer->init(D3D12_COMMAND_LIST_TYPE_DIRECT, this->m_device, this->m_uma, this->m_support_ray_tracing, const_cast<brx_d3d12_descriptor_allocator *>(&this->m_descriptor_allocator), this->m_draw_indirect_command_signature, this->m_draw_index_indirect_command_signature, this->m_dispatch_indirect_command_signature);
 	return new_unwrapped_graphics_command_buffer;
 }
 
@@ -725,6 +886,37 @@ void brx_d3d12_device::destroy_graphics_command_buffer(brx_graphics_command_buff
 	brx_free(delete_unwrapped_graphics_command_buffer);
 }
 
+brx_secondary_graphics_command_buffer *brx_d3d12_device::create_secondary_graphics_command_buffer() const
+{
+	void *new_unwrapped_secondary_graphics_command_buffer_base = brx_malloc(sizeof(brx_d3d12_secondary_graphics_command_buffer), alignof(brx_d3d12_secondary_graphics_command_buffer));
+	assert(NULL != new_unwrapped_secondary_graphics_command_buffer_base);
+
+	brx_d3d12_secondary_graphics_command_buffer *new_unwrapped_secondary_graphics_command_buffer = new (new_unwrapped_secondary_graphics_command_buffer_base) brx_d3d12_secondary_graphics_command_buffer{};
+	new_unwrapped_secondary_graphics_command_buffer->init(this->m_device, this->m_uma, this->m_support_ray_tracing, const_cast<brx_d3d12_descriptor_allocator *>(&this->m_descriptor_allocator), this->m_draw_indirect_command_signature, this->m_draw_index_indirect_command_signature, this->m_dispatch_indirect_command_signature);
+	return new_unwrapped_secondary_graphics_command_buffer;
+}
+
+void brx_d3d12_device::reset_secondary_graphics_command_buffer(brx_secondary_graphics_command_buffer *secondary_graphics_command_buffer) const
+{
+	assert(NULL != secondary_graphics_command_buffer);
+
+	ID3D12CommandAllocator *command_allocator = static_cast<brx_d3d12_secondary_graphics_command_buffer *>(secondary_graphics_command_buffer)->get_command_allocator();
+
+	HRESULT hr_reset = command_allocator->Reset();
+	assert(SUCCEEDED(hr_reset));
+}
+
+void brx_d3d12_device::destroy_secondary_graphics_command_buffer(brx_secondary_graphics_command_buffer *wrapped_secondary_graphics_command_buffer) const
+{
+	assert(NULL != wrapped_secondary_graphics_command_buffer);
+	brx_d3d12_secondary_graphics_command_buffer *delete_unwrapped_secondary_graphics_command_buffer = static_cast<brx_d3d12_secondary_graphics_command_buffer *>(wrapped_secondary_graphics_command_buffer);
+
+	delete_unwrapped_secondary_graphics_command_buffer->uninit();
+
+	delete_unwrapped_secondary_graphics_command_buffer->~brx_d3d12_secondary_graphics_command_buffer();
+	brx_free(delete_unwrapped_secondary_graphics_command_buffer);
+}
+
 brx_upload_command_buffer *brx_d3d12_device::create_upload_command_buffer() const
 {
 	void *new_unwrapped_upload_command_buffer_base = brx_malloc(sizeof(brx_d3d12_upload_command_buffer), alignof(brx_d3d12_upload_command_buffer));
@@ -763,6 +955,37 @@ void brx_d3d12_device::destroy_upload_command_buffer(brx_upload_command_buffer *
 	brx_free(delete_unwrapped_upload_command_buffer);
 }
 
+brx_compute_command_buffer *brx_d3d12_device::create_compute_command_buffer() const
+{
+	void *new_unwrapped_compute_command_buffer_base = brx_malloc(sizeof(brx_d3d12_compute_command_buffer), alignof(brx_d3d12_compute_command_buffer));
+	assert(NULL != new_unwrapped_compute_command_buffer_base);
+
+	brx_d3d12_compute_command_buffer *new_unwrapped_compute_command_buffer = new (new_unwrapped_compute_command_buffer_base) brx_d3d12_compute_command_buffer{};
+	new_unwrapped_compute_command_buffer->init(this->m_device, const_cast<brx_d3d12_descriptor_allocator *>(&this->m_descriptor_allocator), this->m_dispatch_indirect_command_signature);
+	return new_unwrapped_compute_command_buffer;
+}
+
+void brx_d3d12_device::reset_compute_command_buffer(brx_compute_command_buffer *compute_command_buffer) const
+{
+	assert(NULL != compute_command_buffer);
+
+	ID3D12CommandAllocator *command_allocator = static_cast<brx_d3d12_compute_command_buffer *>(compute_command_buffer)->get_command_allocator();
+
+	HRESULT hr_reset = command_allocator->Reset();
+	assert(SUCCEEDED(hr_reset));
+}
+
+void brx_d3d12_device::destroy_compute_command_buffer(brx_compute_command_buffer *wrapped_compute_command_buffer) const
+{
+	assert(NULL != wrapped_compute_command_buffer);
+	brx_d3d12_compute_command_buffer *delete_unwrapped_compute_command_buffer = static_cast<brx_d3d12_compute_command_buffer *>(wrapped_compute_command_buffer);
+
+	delete_unwrapped_compute_command_buffer->uninit();
+
+	delete_unwrapped_compute_command_buffer->~brx_d3d12_compute_command_buffer();
+	brx_free(delete_unwrapped_compute_command_buffer);
+}
+
 brx_fence *brx_d3d12_device::create_fence(bool signaled) const
 {
 	ID3D12Fence *new_fence = NULL;
@@ -794,6 +1017,9 @@ void brx_d3d12_device::wait_for_fence(brx_fence *brx_fence) const
 	}
 
 	assert(1U == fence->GetCompletedValue());
+
+	// the uploads associated with this fence have been completed
+	const_cast<brx_staging_upload_ring_manager *>(&this->m_staging_upload_ring_manager)->retire_fence(brx_fence);
 }
 
 void brx_d3d12_device::reset_fence(brx_fence *brx_fence) const
@@ -821,13 +1047,168 @@ void brx_d3d12_device::destroy_fence(brx_fence *brx_fence) const
 	stealed_fence->Release();
 }
 
-brx_descriptor_set_layout *brx_d3d12_device::create_descriptor_set_layout(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings) const
+bool brx_d3d12_device::is_timeline_fence_supported() const
+{
+	return true;
+}
+
+brx_timeline_fence *brx_d3d12_device::create_timeline_fence(uint64_t initial_value) const
+{
+	ID3D12Fence *new_fence = NULL;
+	{
+		HRESULT hr_create_fence = this->m_device->CreateFence(initial_value, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&new_fence));
+		assert(SUCCEEDED(hr_create_fence));
+	}
+
+	void *new_brx_timeline_fence_base = brx_malloc(sizeof(brx_d3d12_timeline_fence), alignof(brx_d3d12_timeline_fence));
+	assert(NULL != new_brx_timeline_fence_base);
+
+	brx_d3d12_timeline_fence *new_brx_timeline_fence = new (new_brx_timeline_fence_base) brx_d3d12_timeline_fence{new_fence};
+	return new_brx_timeline_fence;
+}
+
+uint64_t brx_d3d12_device::get_timeline_fence_completed_value(brx_timeline_fence const *brx_timeline_fence) const
+{
+	assert(NULL != brx_timeline_fence);
+	ID3D12Fence *fence = static_cast<brx_d3d12_timeline_fence const *>(brx_timeline_fence)->get_fence();
+
+	return fence->GetCompletedValue();
+}
+
+void brx_d3d12_device::signal_timeline_fence(brx_timeline_fence *brx_timeline_fence, uint64_t value) const
+{
+	assert(NULL != brx_timeline_fence);
+	ID3D12Fence *fence = static_cast<brx_d3d12_timeline_fence *>(brx_timeline_fence)->get_fence();
+
+	HRESULT hr_signal = fence->Signal(value);
+	assert(SUCCEEDED(hr_signal));
+}
+
+bool brx_d3d12_device::wait_for_timeline_fences(uint32_t timeline_fence_count, brx_timeline_fence const *const *brx_timeline_fences, uint64_t const *values, bool wait_all, uint64_t timeout) const
+{
+	assert(timeline_fence_count > 0U);
+	assert(NULL != brx_timeline_fences);
+	assert(NULL != values);
+
+	LARGE_INTEGER performance_frequency;
+	BOOL res_query_performance_frequency = QueryPerformanceFrequency(&performance_frequency);
+	assert(FALSE != res_query_performance_frequency);
+
+	LARGE_INTEGER begin_performance_counter;
+	BOOL res_query_begin_performance_counter = QueryPerformanceCounter(&begin_performance_counter);
+	assert(FALSE != res_query_begin_performance_counter);
+
+	// the same as the "wait_for_fence", the host polls the fences (rather than waits for the event)
+	while (true)
+	{
+		bool satisfied = wait_all;
+		for (uint32_t timeline_fence_index = 0U; timeline_fence_index < timeline_fence_count; ++timeline_fence_index)
+		{
+			assert(NULL != brx_timeline_fences[timeline_fence_index]);
+			ID3D12Fence *fence = static_cast<brx_d3d12_timeline_fence const *>(brx_timeline_fences[timeline_fence_index])->get_fence();
+
+			bool const reached = (fence->GetCompletedValue() >= values[timeline_fence_index]);
+			if (wait_all && (!reached))
+			{
+				satisfied = false;
+				break;
+			}
+			else if ((!wait_all) && reached)
+			{
+				satisfied = true;
+				break;
+			}
+		}
+
+		if (satisfied)
+		{
+			return true;
+		}
+
+		if (UINT64_MAX != timeout)
+		{
+			LARGE_INTEGER current_performance_counter;
+			BOOL res_query_current_performance_counter = QueryPerformanceCounter(&current_performance_counter);
+			assert(FALSE != res_query_current_performance_counter);
+
+			uint64_t const elapsed_ticks = static_cast<uint64_t>(current_performance_counter.QuadPart - begin_performance_counter.QuadPart);
+			double const elapsed_nanoseconds = (static_cast<double>(elapsed_ticks) * 1000000000.0) / static_cast<double>(performance_frequency.QuadPart);
+			if (elapsed_nanoseconds >= static_cast<double>(timeout))
+			{
+				return false;
+			}
+		}
+
+		SwitchToThread();
+	}
+}
+
+void brx_d3d12_device::destroy_timeline_fence(brx_timeline_fence *brx_timeline_fence) const
+{
+	assert(NULL != brx_timeline_fence);
+	brx_d3d12_timeline_fence *delete_timeline_fence = static_cast<brx_d3d12_timeline_fence *>(brx_timeline_fence);
+
+	ID3D12Fence *stealed_fence = NULL;
+	delete_timeline_fence->steal(&stealed_fence);
+
+	delete_timeline_fence->~brx_d3d12_timeline_fence();
+	brx_free(delete_timeline_fence);
+
+	stealed_fence->Release();
+}
+
+brx_upload_scheduler *brx_d3d12_device::create_upload_scheduler(uint32_t batch_count)
+{
+	void *new_upload_scheduler_base = brx_malloc(sizeof(brx_upload_batch_scheduler), alignof(brx_upload_batch_scheduler));
+	assert(NULL != new_upload_scheduler_base);
+
+	brx_upload_batch_scheduler *new_upload_scheduler = new (new_upload_scheduler_base) brx_upload_batch_scheduler{};
+	new_upload_scheduler->init(this, batch_count);
+	return new_upload_scheduler;
+}
+
+brx_upload_command_buffer *brx_d3d12_device::begin_upload_batch(brx_upload_scheduler *upload_scheduler) const
+{
+	assert(NULL != upload_scheduler);
+	return static_cast<brx_upload_batch_scheduler *>(upload_scheduler)->begin_batch(this);
+}
+
+uint64_t brx_d3d12_device::submit_upload_batch(brx_upload_scheduler *upload_scheduler, brx_upload_queue *upload_queue, brx_upload_command_buffer *upload_command_buffer) const
+{
+	assert(NULL != upload_scheduler);
+	return static_cast<brx_upload_batch_scheduler *>(upload_scheduler)->submit_batch(upload_queue, upload_command_buffer);
+}
+
+brx_timeline_fence const *brx_d3d12_device::get_upload_scheduler_timeline_fence(brx_upload_scheduler const *upload_scheduler) const
+{
+	assert(NULL != upload_scheduler);
+	return static_cast<brx_upload_batch_scheduler const *>(upload_scheduler)->get_timeline_fence();
+}
+
+bool brx_d3d12_device::is_upload_batch_completed(brx_upload_scheduler const *upload_scheduler, uint64_t batch_value) const
+{
+	assert(NULL != upload_scheduler);
+	return static_cast<brx_upload_batch_scheduler const *>(upload_scheduler)->is_batch_completed(this, batch_value);
+}
+
+void brx_d3d12_device::destroy_upload_scheduler(brx_upload_scheduler *upload_scheduler)
+{
+	assert(NULL != upload_scheduler);
+	brx_upload_batch_scheduler *delete_upload_scheduler = static_cast<brx_upload_batch_scheduler *>(upload_scheduler);
+
+	delete_upload_scheduler->uninit(this);
+
+	delete_upload_scheduler->~brx_upload_batch_scheduler();
+	brx_free(delete_upload_scheduler);
+}
+
+brx_descriptor_set_layout *brx_d3d12_device::create_descriptor_set_layout(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings, bool descriptor_update_template) const
 {
 	void *new_unwrapped_descriptor_set_layout_base = brx_malloc(sizeof(brx_d3d12_descriptor_set_layout), alignof(brx_d3d12_descriptor_set_layout));
 	assert(NULL != new_unwrapped_descriptor_set_layout_base);
 
 	brx_d3d12_descriptor_set_layout *new_unwrapped_descriptor_set_layout = new (new_unwrapped_descriptor_set_layout_base) brx_d3d12_descriptor_set_layout{};
-	new_unwrapped_descriptor_set_layout->init(descriptor_set_binding_count, descriptor_set_bindings);
+	new_unwrapped_descriptor_set_layout->init(descriptor_set_binding_count, descriptor_set_bindings, descriptor_update_template);
 	return new_unwrapped_descriptor_set_layout;
 }
 
@@ -842,13 +1223,13 @@ void brx_d3d12_device::destroy_descriptor_set_layout(brx_descriptor_set_layout *
 	brx_free(delete_unwrapped_descriptor_set_layout);
 }
 
-brx_pipeline_layout *brx_d3d12_device::create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *descriptor_set_layouts) const
+brx_pipeline_layout *brx_d3d12_device::create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *descriptor_set_layouts, uint32_t push_constant_size) const
 {
 	void *new_unwrapped_pipeline_layout_base = brx_malloc(sizeof(brx_d3d12_pipeline_layout), alignof(brx_d3d12_pipeline_layout));
 	assert(NULL != new_unwrapped_pipeline_layout_base);
 
 	brx_d3d12_pipeline_layout *new_unwrapped_pipeline_layout = new (new_unwrapped_pipeline_layout_base) brx_d3d12_pipeline_layout{};
-	new_unwrapped_pipeline_layout->init(this->m_device, this->m_pfn_d3d12_serialize_root_signature, descriptor_set_layout_count, descriptor_set_layouts);
+	new_unwrapped_pipeline_layout->init(this->m_device, this->m_pfn_d3d12_serialize_root_signature, descriptor_set_layout_count, descriptor_set_layouts, push_constant_size);
 	return new_unwrapped_pipeline_layout;
 }
 
@@ -874,11 +1255,118 @@ brx_descriptor_set *brx_d3d12_device::create_descriptor_set(brx_descriptor_set_l
 }
 
 void brx_d3d12_device::write_descriptor_set(brx_descriptor_set *wrapped_descriptor_set, BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t dst_binding, uint32_t dst_array_element, uint32_t src_descriptor_count, brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_storage_buffer const *const *src_storage_buffers, brx_sampled_image const *const *src_sampled_images, brx_sampler const *const *src_samplers, brx_storage_image const *const *src_storage_images, brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures) const
+{
+	BRX_WRITE_DESCRIPTOR_SET const write_descriptor_set = {
+		wrapped_descriptor_set,
+		descriptor_type,
+		dst_binding,
+		dst_array_element,
+		src_descriptor_count,
+		src_dynamic_uniform_buffers,
+		src_dynamic_uniform_buffer_ranges,
+		src_storage_buffers,
+		src_sampled_images,
+		src_samplers,
+		src_storage_images,
+		src_top_level_acceleration_structures};
+
+	this->write_descriptor_sets(1U, &write_descriptor_set);
+}
+
+void brx_d3d12_device::write_descriptor_sets(uint32_t write_descriptor_set_count, BRX_WRITE_DESCRIPTOR_SET const *write_descriptor_sets) const
+{
+	// the views are created in the non shader visible descriptor heap, and then copied into the shader visible descriptor heap by one "CopyDescriptors" for each descriptor heap type unless the storage is exhausted
+	constexpr uint32_t const max_copy_descriptor_range_count = 64U;
+
+	D3D12_CPU_DESCRIPTOR_HANDLE cbv_srv_uav_dest_descriptor_range_starts[max_copy_descriptor_range_count];
+	D3D12_CPU_DESCRIPTOR_HANDLE cbv_srv_uav_src_descriptor_range_starts[max_copy_descriptor_range_count];
+	UINT cbv_srv_uav_descriptor_range_sizes[max_copy_descriptor_range_count];
+	uint32_t cbv_srv_uav_copy_descriptor_range_count = 0U;
+
+	D3D12_CPU_DESCRIPTOR_HANDLE sampler_dest_descriptor_range_starts[max_copy_descriptor_range_count];
+	D3D12_CPU_DESCRIPTOR_HANDLE sampler_src_descriptor_range_starts[max_copy_descriptor_range_count];
+	UINT sampler_descriptor_range_sizes[max_copy_descriptor_range_count];
+	uint32_t sampler_copy_descriptor_range_count = 0U;
+
+	for (uint32_t write_descriptor_set_index = 0U; write_descriptor_set_index < write_descriptor_set_count; ++write_descriptor_set_index)
+	{
+		BRX_WRITE_DESCRIPTOR_SET const &write_descriptor_set = write_descriptor_sets[write_descriptor_set_index];
+
+		assert(NULL != write_descriptor_set.descriptor_set);
+		brx_d3d12_descriptor_set *const unwrapped_descriptor_set = static_cast<brx_d3d12_descriptor_set *>(write_descriptor_set.descriptor_set);
+
+		uint32_t copy_base_descriptor_heap_index = -1;
+		unwrapped_descriptor_set->write_descriptor(this->m_device, &this->m_descriptor_allocator, write_descriptor_set.descriptor_type, write_descriptor_set.dst_binding, write_descriptor_set.dst_array_element, write_descriptor_set.src_descriptor_count, write_descriptor_set.src_dynamic_uniform_buffers, write_descriptor_set.src_dynamic_uniform_buffer_ranges, write_descriptor_set.src_storage_buffers, write_descriptor_set.src_sampled_images, write_descriptor_set.src_samplers, write_descriptor_set.src_storage_images, write_descriptor_set.src_top_level_acceleration_structures, &copy_base_descriptor_heap_index);
+
+		if (0U == write_descriptor_set.src_descriptor_count)
+		{
+			continue;
+		}
+
+		switch (write_descriptor_set.descriptor_type)
+		{
+		case BRX_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER:
+		{
+			// the root constant buffer view is NOT in the descriptor heap
+			assert(static_cast<uint32_t>(-1) == copy_base_descriptor_heap_index);
+		}
+		break;
+		case BRX_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER:
+		case BRX_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+		case BRX_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+		case BRX_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+		case BRX_DESCRIPTOR_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE:
+		{
+			if (max_copy_descriptor_range_count == cbv_srv_uav_copy_descriptor_range_count)
+			{
+				this->m_device->CopyDescriptors(cbv_srv_uav_copy_descriptor_range_count, cbv_srv_uav_dest_descriptor_range_starts, cbv_srv_uav_descriptor_range_sizes, cbv_srv_uav_copy_descriptor_range_count, cbv_srv_uav_src_descriptor_range_starts, cbv_srv_uav_descriptor_range_sizes, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+				cbv_srv_uav_copy_descriptor_range_count = 0U;
+			}
+
+			cbv_srv_uav_dest_descriptor_range_starts[cbv_srv_uav_copy_descriptor_range_count] = this->m_descriptor_allocator.get_shader_visible_cbv_srv_uav_cpu_descriptor_handle(copy_base_descriptor_heap_index);
+			cbv_srv_uav_src_descriptor_range_starts[cbv_srv_uav_copy_descriptor_range_count] = this->m_descriptor_allocator.get_non_shader_visible_cbv_srv_uav_cpu_descriptor_handle(copy_base_descriptor_heap_index);
+			cbv_srv_uav_descriptor_range_sizes[cbv_srv_uav_copy_descriptor_range_count] = write_descriptor_set.src_descriptor_count;
+			++cbv_srv_uav_copy_descriptor_range_count;
+		}
+		break;
+		case BRX_DESCRIPTOR_TYPE_SAMPLER:
+		{
+			if (max_copy_descriptor_range_count == sampler_copy_descriptor_range_count)
+			{
+				this->m_device->CopyDescriptors(sampler_copy_descriptor_range_count, sampler_dest_descriptor_range_starts, sampler_descriptor_range_sizes, sampler_copy_descriptor_range_count, sampler_src_descriptor_range_starts, sampler_descriptor_range_sizes, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+				sampler_copy_descriptor_range_count = 0U;
+			}
+
+			sampler_dest_descriptor_range_starts[sampler_copy_descriptor_range_count] = this->m_descriptor_allocator.get_shader_visible_sampler_cpu_descriptor_handle(copy_base_descriptor_heap_index);
+			sampler_src_descriptor_range_starts[sampler_copy_descriptor_range_count] = this->m_descriptor_allocator.get_non_shader_visible_sampler_cpu_descriptor_handle(copy_base_descriptor_heap_index);
+			sampler_descriptor_range_sizes[sampler_copy_descriptor_range_count] = write_descriptor_set.src_descriptor_count;
+			++sampler_copy_descriptor_range_count;
+		}
+		break;
+		default:
+		{
+			assert(false);
+		}
+		}
+	}
+
+	if (cbv_srv_uav_copy_descriptor_range_count > 0U)
+	{
+		this->m_device->CopyDescriptors(cbv_srv_uav_copy_descriptor_range_count, cbv_srv_uav_dest_descriptor_range_starts, cbv_srv_uav_descriptor_range_sizes, cbv_srv_uav_copy_descriptor_range_count, cbv_srv_uav_src_descriptor_range_starts, cbv_srv_uav_descriptor_range_sizes, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+	}
+
+	if (sampler_copy_descriptor_range_count > 0U)
+	{
+		this->m_device->CopyDescriptors(sampler_copy_descriptor_range_count, sampler_dest_descriptor_range_starts, sampler_descriptor_range_sizes, sampler_copy_descriptor_range_count, sampler_src_descriptor_range_starts, sampler_descriptor_range_sizes, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+	}
+}
+
+void brx_d3d12_device::write_descriptor_set_with_template(brx_descriptor_set *wrapped_descriptor_set, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges) const
 {
 	assert(NULL != wrapped_descriptor_set);
 	brx_d3d12_descriptor_set *const unwrapped_descriptor_set = static_cast<brx_d3d12_descriptor_set *>(wrapped_descriptor_set);
 
-	unwrapped_descriptor_set->write_descriptor(this->m_device, &this->m_descriptor_allocator, descriptor_type, dst_binding, dst_array_element, src_descriptor_count, src_dynamic_uniform_buffers, src_dynamic_uniform_buffer_ranges, src_storage_buffers, src_sampled_images, src_samplers, src_storage_images, src_top_level_acceleration_structures);
+	unwrapped_descriptor_set->write_descriptor_with_template(this->m_device, &this->m_descriptor_allocator, src_descriptors, src_dynamic_uniform_buffer_ranges);
 }
 
 void brx_d3d12_device::destroy_descriptor_set(brx_descriptor_set *wrapped_descriptor_set)
@@ -892,6 +1380,128 @@ void brx_d3d12_device::destroy_descriptor_set(brx_descriptor_set *wrapped_descri
 	brx_free(delete_unwrapped_descriptor_set);
 }
 
+bool brx_d3d12_device::is_bindless_table_supported() const
+{
+	return this->m_resource_binding_tier_2;
+}
+
+brx_bindless_table *brx_d3d12_device::create_bindless_table(BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t descriptor_count)
+{
+	assert(this->m_resource_binding_tier_2);
+	assert((BRX_DESCRIPTOR_TYPE_SAMPLED_IMAGE == descriptor_type) || (BRX_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER == descriptor_type) || (BRX_DESCRIPTOR_TYPE_SAMPLER == descriptor_type));
+
+	// the size of the shader visible sampler descriptor heap is limited to 2048
+	uint32_t const max_descriptor_count = (BRX_DESCRIPTOR_TYPE_SAMPLER != descriptor_type) ? D3D12_MAX_SHADER_VISIBLE_DESCRIPTOR_HEAP_SIZE_TIER_2 : D3D12_MAX_SHADER_VISIBLE_SAMPLER_HEAP_SIZE;
+
+	if ((!this->m_resource_binding_tier_2) || (descriptor_count > max_descriptor_count))
+	{
+		return NULL;
+	}
+
+	BRX_DESCRIPTOR_SET_LAYOUT_BINDING const descriptor_set_binding = {0U, descriptor_type, descriptor_count};
+
+	void *new_unwrapped_descriptor_set_layout_base = brx_malloc(sizeof(brx_d3d12_descriptor_set_layout), alignof(brx_d3d12_descriptor_set_layout));
+	assert(NULL != new_unwrapped_descriptor_set_layout_base);
+
+	brx_d3d12_descriptor_set_layout *new_unwrapped_descriptor_set_layout = new (new_unwrapped_descriptor_set_layout_base) brx_d3d12_descriptor_set_layout{};
+	new_unwrapped_descriptor_set_layout->init(1U, &descriptor_set_binding, false);
+
+	brx_d3d12_descriptor_set *new_unwrapped_descriptor_set = static_cast<brx_d3d12_descriptor_set *>(this->create_descriptor_set(new_unwrapped_descriptor_set_layout));
+
+	void *new_unwrapped_bindless_table_base = brx_malloc(sizeof(brx_d3d12_bindless_table), alignof(brx_d3d12_bindless_table));
+	assert(NULL != new_unwrapped_bindless_table_base);
+
+	brx_d3d12_bindless_table *new_unwrapped_bindless_table = new (new_unwrapped_bindless_table_base) brx_d3d12_bindless_table{};
+	new_unwrapped_bindless_table->init(descriptor_type, descriptor_count, new_unwrapped_descriptor_set_layout, new_unwrapped_descriptor_set);
+	return new_unwrapped_bindless_table;
+}
+
+brx_descriptor_set_layout const *brx_d3d12_device::get_bindless_table_descriptor_set_layout(brx_bindless_table const *wrapped_bindless_table) const
+{
+	assert(NULL != wrapped_bindless_table);
+	return static_cast<brx_d3d12_bindless_table const *>(wrapped_bindless_table)->get_descriptor_set_layout();
+}
+
+brx_descriptor_set const *brx_d3d12_device::get_bindless_table_descriptor_set(brx_bindless_table const *wrapped_bindless_table) const
+{
+	assert(NULL != wrapped_bindless_table);
+	return static_cast<brx_d3d12_bindless_table const *>(wrapped_bindless_table)->get_descriptor_set();
+}
+
+uint32_t brx_d3d12_device::alloc_bindless_descriptor(brx_bindless_table *wrapped_bindless_table, brx_storage_buffer const *src_storage_buffer, brx_sampled_image const *src_sampled_image, brx_sampler const *src_sampler) const
+{
+	assert(NULL != wrapped_bindless_table);
+	brx_d3d12_bindless_table *const unwrapped_bindless_table = static_cast<brx_d3d12_bindless_table *>(wrapped_bindless_table);
+
+	uint32_t const descriptor_index = unwrapped_bindless_table->alloc_descriptor_index();
+
+	if (static_cast<uint32_t>(-1) != descriptor_index)
+	{
+		// the descriptors are volatile by default in the root signature version 1.0, and thus the descriptor can be written while the descriptor table is set
+		this->write_descriptor_set(unwrapped_bindless_table->get_descriptor_set(), unwrapped_bindless_table->get_descriptor_type(), 0U, descriptor_index, 1U, NULL, NULL, (NULL != src_storage_buffer) ? &src_storage_buffer : NULL, (NULL != src_sampled_image) ? &src_sampled_image : NULL, (NULL != src_sampler) ? &src_sampler : NULL, NULL, NULL);
+	}
+
+	return descriptor_index;
+}
+
+void brx_d3d12_device::free_bindless_descriptor(brx_bindless_table *wrapped_bindless_table, uint32_t descriptor_index) const
+{
+	assert(NULL != wrapped_bindless_table);
+	brx_d3d12_bindless_table *const unwrapped_bindless_table = static_cast<brx_d3d12_bindless_table *>(wrapped_bindless_table);
+
+	unwrapped_bindless_table->free_descriptor_index(descriptor_index);
+}
+
+void brx_d3d12_device::destroy_bindless_table(brx_bindless_table *wrapped_bindless_table)
+{
+	assert(NULL != wrapped_bindless_table);
+	brx_d3d12_bindless_table *delete_unwrapped_bindless_table = static_cast<brx_d3d12_bindless_table *>(wrapped_bindless_table);
+
+	brx_d3d12_descriptor_set_layout *stealed_descriptor_set_layout = NULL;
+	brx_d3d12_descriptor_set *stealed_descriptor_set = NULL;
+	delete_unwrapped_bindless_table->steal(&stealed_descriptor_set_layout, &stealed_descriptor_set);
+
+	delete_unwrapped_bindless_table->~brx_d3d12_bindless_table();
+	brx_free(delete_unwrapped_bindless_table);
+
+	this->destroy_descriptor_set(stealed_descriptor_set);
+
+	this->destroy_descriptor_set_layout(stealed_descriptor_set_layout);
+}
+
+brx_transient_descriptor_allocator *brx_d3d12_device::create_transient_descriptor_allocator()
+{
+	void *new_unwrapped_transient_descriptor_allocator_base = brx_malloc(sizeof(brx_d3d12_transient_descriptor_allocator), alignof(brx_d3d12_transient_descriptor_allocator));
+	assert(NULL != new_unwrapped_transient_descriptor_allocator_base);
+
+	brx_d3d12_transient_descriptor_allocator *new_unwrapped_transient_descriptor_allocator = new (new_unwrapped_transient_descriptor_allocator_base) brx_d3d12_transient_descriptor_allocator{};
+	new_unwrapped_transient_descriptor_allocator->init(&this->m_descriptor_allocator);
+	return new_unwrapped_transient_descriptor_allocator;
+}
+
+brx_descriptor_set *brx_d3d12_device::alloc_transient_descriptor_set(brx_transient_descriptor_allocator *wrapped_transient_descriptor_allocator, brx_descriptor_set_layout const *descriptor_set_layout) const
+{
+	assert(NULL != wrapped_transient_descriptor_allocator);
+	return static_cast<brx_d3d12_transient_descriptor_allocator *>(wrapped_transient_descriptor_allocator)->alloc_descriptor_set(descriptor_set_layout);
+}
+
+void brx_d3d12_device::reset_transient_descriptor_allocator(brx_transient_descriptor_allocator *wrapped_transient_descriptor_allocator) const
+{
+	assert(NULL != wrapped_transient_descriptor_allocator);
+	static_cast<brx_d3d12_transient_descriptor_allocator *>(wrapped_transient_descriptor_allocator)->reset();
+}
+
+void brx_d3d12_device::destroy_transient_descriptor_allocator(brx_transient_descriptor_allocator *wrapped_transient_descriptor_allocator)
+{
+	assert(NULL != wrapped_transient_descriptor_allocator);
+	brx_d3d12_transient_descriptor_allocator *delete_unwrapped_transient_descriptor_allocator = static_cast<brx_d3d12_transient_descriptor_allocator *>(wrapped_transient_descriptor_allocator);
+
+	delete_unwrapped_transient_descriptor_allocator->uninit();
+
+	delete_unwrapped_transient_descriptor_allocator->~brx_d3d12_transient_descriptor_allocator();
+	brx_free(delete_unwrapped_transient_descriptor_allocator);
+}
+
 brx_render_pass *brx_d3d12_device::create_render_pass(uint32_t color_attachment_count, BRX_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment) const
 {
 	brx_vector<BRX_COLOR_ATTACHMENT_IMAGE_FORMAT> new_color_attachment_formats;
@@ -1035,6 +1645,97 @@ void brx_d3d12_device::destroy_compute_pipeline(brx_compute_pipeline *wrapped_co
 	brx_free(delete_unwrapped_compute_pipeline);
 }
 
+brx_graphics_pipeline_compilation *brx_d3d12_device::create_graphics_pipeline_async(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation)
+{
+	return this->m_pipeline_compiler.create_graphics_pipeline_async(render_pass, pipeline_layout, vertex_shader_module_code_size, vertex_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, vertex_binding_count, vertex_bindings, vertex_attribute_count, vertex_attributes, depth_enable, depth_compare_operation);
+}
+
+bool brx_d3d12_device::is_graphics_pipeline_compilation_completed(brx_graphics_pipeline_compilation const *graphics_pipeline_compilation) const
+{
+	return this->m_pipeline_compiler.is_graphics_pipeline_compilation_completed(graphics_pipeline_compilation);
+}
+
+brx_graphics_pipeline *brx_d3d12_device::wait_graphics_pipeline_compilation(brx_graphics_pipeline_compilation *graphics_pipeline_compilation)
+{
+	return this->m_pipeline_compiler.wait_graphics_pipeline_compilation(graphics_pipeline_compilation);
+}
+
+brx_compute_pipeline_compilation *brx_d3d12_device::create_compute_pipeline_async(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code)
+{
+	return this->m_pipeline_compiler.create_compute_pipeline_async(pipeline_layout, compute_shader_module_code_size, compute_shader_module_code);
+}
+
+bool brx_d3d12_device::is_compute_pipeline_compilation_completed(brx_compute_pipeline_compilation const *compute_pipeline_compilation) const
+{
+	return this->m_pipeline_compiler.is_compute_pipeline_compilation_completed(compute_pipeline_compilation);
+}
+
+brx_compute_pipeline *brx_d3d12_device::wait_compute_pipeline_compilation(brx_compute_pipeline_compilation *compute_pipeline_compilation)
+{
+	return this->m_pipeline_compiler.wait_compute_pipeline_compilation(compute_pipeline_compilation);
+}
+
+bool brx_d3d12_device::is_pipeline_specialization_constant_supported() const
+{
+	// the DXIL has no specialization constants, and the values can NOT be patched into the compiled shader
+	return false;
+}
+
+brx_graphics_pipeline *brx_d3d12_device::create_graphics_pipeline_variant(brx_graphics_pipeline const *wrapped_base_graphics_pipeline, brx_render_pass const *wrapped_render_pass, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants) const
+{
+	assert(NULL != wrapped_base_graphics_pipeline);
+	brx_d3d12_graphics_pipeline const *unwrapped_base_graphics_pipeline = static_cast<brx_d3d12_graphics_pipeline const *>(wrapped_base_graphics_pipeline);
+
+	// the variant shares the pipeline state of the base pipeline, and thus the render pass is NOT used
+	assert(NULL != wrapped_render_pass);
+
+	// the specialization constants are NOT supported (see the "is_pipeline_specialization_constant_supported"), and the variant would otherwise silently ignore them
+	if (0U != specialization_constant_count)
+	{
+		assert(false);
+		return NULL;
+	}
+
+	void *new_unwrapped_graphics_pipeline_base = brx_malloc(sizeof(brx_d3d12_graphics_pipeline), alignof(brx_d3d12_graphics_pipeline));
+	assert(NULL != new_unwrapped_graphics_pipeline_base);
+
+	brx_d3d12_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_d3d12_graphics_pipeline{};
+	new_unwrapped_graphics_pipeline->init_variant(unwrapped_base_graphics_pipeline);
+	return new_unwrapped_graphics_pipeline;
+}
+
+brx_compute_pipeline *brx_d3d12_device::create_compute_pipeline_variant(brx_compute_pipeline const *wrapped_base_compute_pipeline, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants) const
+{
+	assert(NULL != wrapped_base_compute_pipeline);
+	brx_d3d12_compute_pipeline const *unwrapped_base_compute_pipeline = static_cast<brx_d3d12_compute_pipeline const *>(wrapped_base_compute_pipeline);
+
+	// the specialization constants are NOT supported (see the "is_pipeline_specialization_constant_supported"), and the variant would otherwise silently ignore them
+	if (0U != specialization_constant_count)
+	{
+		assert(false);
+		return NULL;
+	}
+
+	void *new_unwrapped_compute_pipeline_base = brx_malloc(sizeof(brx_d3d12_compute_pipeline), alignof(brx_d3d12_compute_pipeline));
+	assert(NULL != new_unwrapped_compute_pipeline_base);
+
+	brx_d3d12_compute_pipeline *new_unwrapped_compute_pipeline = new (new_unwrapped_compute_pipeline_base) brx_d3d12_compute_pipeline{};
+	new_unwrapped_compute_pipeline->init_variant(unwrapped_base_compute_pipeline);
+	return new_unwrapped_compute_pipeline;
+}
+
+bool brx_d3d12_device::load_pipeline_cache(size_t pipeline_cache_data_size, void const *pipeline_cache_data)
+{
+	// the D3D12 drivers maintain their own on-disk shader caches, and thus there is no persistent pipeline cache
+	return false;
+}
+
+size_t brx_d3d12_device::store_pipeline_cache(size_t pipeline_cache_data_size, void *pipeline_cache_data) const
+{
+	// the D3D12 drivers maintain their own on-disk shader caches, and thus there is no persistent pipeline cache
+	return 0U;
+}
+
 brx_frame_buffer *brx_d3d12_device::create_frame_buffer(brx_render_pass const *brx_render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_color_attachment_image const *const *color_attachments, brx_depth_stencil_attachment_image const *depth_stencil_attachment) const
 {
 	assert(NULL != brx_render_pass);
@@ -1106,6 +1807,45 @@ void brx_d3d12_device::destroy_uniform_upload_buffer(brx_uniform_upload_buffer *
 	brx_free(delete_unwrapped_uniform_upload_buffer);
 }
 
+brx_uniform_upload_ring *brx_d3d12_device::create_uniform_upload_ring(uint32_t frame_count, uint32_t frame_size)
+{
+	void *new_uniform_upload_ring_base = brx_malloc(sizeof(brx_uniform_upload_ring_allocator), alignof(brx_uniform_upload_ring_allocator));
+	assert(NULL != new_uniform_upload_ring_base);
+
+	brx_uniform_upload_ring_allocator *new_uniform_upload_ring = new (new_uniform_upload_ring_base) brx_uniform_upload_ring_allocator{};
+	new_uniform_upload_ring->init(this, D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT, frame_count, frame_size);
+	return new_uniform_upload_ring;
+}
+
+brx_uniform_upload_buffer const *brx_d3d12_device::get_uniform_upload_ring_buffer(brx_uniform_upload_ring const *uniform_upload_ring) const
+{
+	assert(NULL != uniform_upload_ring);
+	return static_cast<brx_uniform_upload_ring_allocator const *>(uniform_upload_ring)->get_uniform_upload_buffer();
+}
+
+void brx_d3d12_device::begin_uniform_upload_ring_frame(brx_uniform_upload_ring *uniform_upload_ring, uint32_t frame_index) const
+{
+	assert(NULL != uniform_upload_ring);
+	static_cast<brx_uniform_upload_ring_allocator *>(uniform_upload_ring)->begin_frame(frame_index);
+}
+
+void *brx_d3d12_device::alloc_uniform_upload_ring_range(brx_uniform_upload_ring *uniform_upload_ring, uint32_t size, uint32_t *out_dynamic_offset) const
+{
+	assert(NULL != uniform_upload_ring);
+	return static_cast<brx_uniform_upload_ring_allocator *>(uniform_upload_ring)->alloc(size, out_dynamic_offset);
+}
+
+void brx_d3d12_device::destroy_uniform_upload_ring(brx_uniform_upload_ring *uniform_upload_ring)
+{
+	assert(NULL != uniform_upload_ring);
+	brx_uniform_upload_ring_allocator *delete_uniform_upload_ring = static_cast<brx_uniform_upload_ring_allocator *>(uniform_upload_ring);
+
+	delete_uniform_upload_ring->uninit(this);
+
+	delete_uniform_upload_ring->~brx_uniform_upload_ring_allocator();
+	brx_free(delete_uniform_upload_ring);
+}
+
 uint32_t brx_d3d12_device::get_staging_upload_buffer_offset_alignment() const
 {
 	return D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT;
@@ -1137,13 +1877,43 @@ void brx_d3d12_device::destroy_staging_upload_buffer(brx_staging_upload_buffer *
 	brx_free(delete_unwrapped_staging_upload_buffer);
 }
 
-brx_intermediate_storage_buffer *brx_d3d12_device::create_intermediate_storage_buffer(uint32_t size, bool allow_vertex_position, bool allow_vertex_varying) const
+brx_staging_upload_ring *brx_d3d12_device::create_staging_upload_ring(uint32_t initial_size)
+{
+	return this->m_staging_upload_ring_manager.create_staging_upload_ring(initial_size);
+}
+
+void *brx_d3d12_device::alloc_staging_upload_ring_range(brx_staging_upload_ring *staging_upload_ring, uint32_t size, brx_staging_upload_buffer **out_staging_upload_buffer, uint64_t *out_offset)
+{
+	return this->m_staging_upload_ring_manager.alloc_staging_upload_ring_range(staging_upload_ring, size, out_staging_upload_buffer, out_offset);
+}
+
+void brx_d3d12_device::submit_staging_upload_ring(brx_staging_upload_ring *staging_upload_ring, brx_fence const *fence)
+{
+	this->m_staging_upload_ring_manager.submit_staging_upload_ring(staging_upload_ring, fence);
+}
+
+void brx_d3d12_device::submit_staging_upload_ring_timeline_fence(brx_staging_upload_ring *staging_upload_ring, brx_timeline_fence const *timeline_fence, uint64_t value)
+{
+	this->m_staging_upload_ring_manager.submit_staging_upload_ring(staging_upload_ring, timeline_fence, value);
+}
+
+BRX_STAGING_UPLOAD_RING_STATISTICS brx_d3d12_device::get_staging_upload_ring_statistics(brx_staging_upload_ring const *staging_upload_ring)
+{
+	return this->m_staging_upload_ring_manager.get_staging_upload_ring_statistics(staging_upload_ring);
+}
+
+void brx_d3d12_device::destroy_staging_upload_ring(brx_staging_upload_ring *staging_upload_ring)
+{
+	this->m_staging_upload_ring_manager.destroy_staging_upload_ring(staging_upload_ring);
+}
+
+brx_intermediate_storage_buffer *brx_d3d12_device::create_intermediate_storage_buffer(uint32_t size, bool allow_vertex_position, bool allow_vertex_varying, bool allow_indirect_argument) const
 {
 	void *new_unwrapped_intermediate_storage_buffer_base = brx_malloc(sizeof(brx_d3d12_intermediate_storage_buffer), alignof(brx_d3d12_intermediate_storage_buffer));
 	assert(NULL != new_unwrapped_intermediate_storage_buffer_base);
 
 	brx_d3d12_intermediate_storage_buffer *new_unwrapped_intermediate_storage_buffer = new (new_unwrapped_intermediate_storage_buffer_base) brx_d3d12_intermediate_storage_buffer{};
-	new_unwrapped_intermediate_storage_buffer->init(this->m_memory_allocator, this->m_storage_buffer_memory_pool, size, allow_vertex_position, allow_vertex_varying);
+	new_unwrapped_intermediate_storage_buffer->init(this->m_memory_allocator, this->m_storage_buffer_memory_pool, size, allow_vertex_position, allow_vertex_varying, allow_indirect_argument);
 	return new_unwrapped_intermediate_storage_buffer;
 }
 
@@ -1221,6 +1991,39 @@ void brx_d3d12_device::destroy_asset_index_buffer(brx_asset_index_buffer *wrappe
 	brx_free(delete_unwrapped_asset_index_buffer);
 }
 
+brx_asset_buffer_sub_allocator *brx_d3d12_device::create_asset_buffer_sub_allocator(uint64_t size, uint32_t alignment) const
+{
+	void *new_asset_buffer_sub_allocator_base = brx_malloc(sizeof(brx_asset_buffer_sub_allocator_instance), alignof(brx_asset_buffer_sub_allocator_instance));
+	assert(NULL != new_asset_buffer_sub_allocator_base);
+
+	brx_asset_buffer_sub_allocator_instance *new_asset_buffer_sub_allocator = new (new_asset_buffer_sub_allocator_base) brx_asset_buffer_sub_allocator_instance{};
+	new_asset_buffer_sub_allocator->init(size, alignment);
+	return new_asset_buffer_sub_allocator;
+}
+
+bool brx_d3d12_device::alloc_asset_buffer_range(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator, uint32_t size, uint64_t *out_offset) const
+{
+	assert(NULL != asset_buffer_sub_allocator);
+	return static_cast<brx_asset_buffer_sub_allocator_instance *>(asset_buffer_sub_allocator)->alloc(size, out_offset);
+}
+
+void brx_d3d12_device::free_asset_buffer_range(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator, uint64_t offset) const
+{
+	assert(NULL != asset_buffer_sub_allocator);
+	static_cast<brx_asset_buffer_sub_allocator_instance *>(asset_buffer_sub_allocator)->free(offset);
+}
+
+void brx_d3d12_device::destroy_asset_buffer_sub_allocator(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator) const
+{
+	assert(NULL != asset_buffer_sub_allocator);
+	brx_asset_buffer_sub_allocator_instance *delete_asset_buffer_sub_allocator = static_cast<brx_asset_buffer_sub_allocator_instance *>(asset_buffer_sub_allocator);
+
+	delete_asset_buffer_sub_allocator->uninit();
+
+	delete_asset_buffer_sub_allocator->~brx_asset_buffer_sub_allocator_instance();
+	brx_free(delete_asset_buffer_sub_allocator);
+}
+
 BRX_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT brx_d3d12_device::get_depth_attachment_image_format() const
 {
 	return BRX_DEPTH_STENCIL_ATTACHMENT_FORMAT_D32_SFLOAT;
@@ -1321,6 +2124,12 @@ bool brx_d3d12_device::is_asset_sampled_image_compression_astc_supported() const
 	return false;
 }
 
+bool brx_d3d12_device::is_indirect_argument_count_supported() const
+{
+	// the count buffer is always supported by the "ExecuteIndirect"
+	return true;
+}
+
 brx_asset_sampled_image *brx_d3d12_device::create_asset_sampled_image(BRX_ASSET_IMAGE_FORMAT wrapped_asset_sampled_image_format, uint32_t width, uint32_t height, uint32_t mip_levels) const
 {
 	DXGI_FORMAT unwrapped_asset_sampled_image_format;
@@ -1545,6 +2354,81 @@ void brx_d3d12_device::destroy_swap_chain(brx_swap_chain *brx_swap_chain) const
 	stealed_rtv_descriptor_heap->Release();
 }
 
+brx_timestamp_query_pool *brx_d3d12_device::create_timestamp_query_pool(uint32_t query_count) const
+{
+	void *new_unwrapped_timestamp_query_pool_base = brx_malloc(sizeof(brx_d3d12_timestamp_query_pool), alignof(brx_d3d12_timestamp_query_pool));
+	assert(NULL != new_unwrapped_timestamp_query_pool_base);
+
+	brx_d3d12_timestamp_query_pool *new_unwrapped_timestamp_query_pool = new (new_unwrapped_timestamp_query_pool_base) brx_d3d12_timestamp_query_pool{};
+	new_unwrapped_timestamp_query_pool->init(this->m_device, this->m_memory_allocator, this->m_timestamp_query_buffer_memory_pool, query_count);
+	return new_unwrapped_timestamp_query_pool;
+}
+
+double brx_d3d12_device::get_timestamp_period() const
+{
+	return this->m_timestamp_period;
+}
+
+bool brx_d3d12_device::is_upload_command_buffer_timestamp_supported() const
+{
+	// the compute queue always supports the timestamp, and the zero is written when the upload is performed by the CPU
+	return true;
+}
+
+bool brx_d3d12_device::get_timestamp_query_pool_results(brx_timestamp_query_pool const *wrapped_timestamp_query_pool, uint32_t first_query, uint32_t query_count, uint64_t *out_timestamps) const
+{
+	assert(NULL != wrapped_timestamp_query_pool);
+	brx_d3d12_timestamp_query_pool const *const unwrapped_timestamp_query_pool = static_cast<brx_d3d12_timestamp_query_pool const *>(wrapped_timestamp_query_pool);
+
+	assert(first_query <= unwrapped_timestamp_query_pool->get_query_count());
+	assert(query_count <= (unwrapped_timestamp_query_pool->get_query_count() - first_query));
+
+	uint64_t volatile *const query_pool_memory_range_base = unwrapped_timestamp_query_pool->get_host_memory_range_base();
+
+	// the unavailable query still holds the value written by the "reset_timestamp_query_pool"
+	for (uint32_t query_index = 0U; query_index < query_count; ++query_index)
+	{
+		uint64_t const timestamp = query_pool_memory_range_base[first_query + query_index];
+		if (static_cast<uint64_t>(-1) != timestamp)
+		{
+			out_timestamps[query_index] = timestamp;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool brx_d3d12_device::get_timestamp_query_pool_label_timings(brx_timestamp_query_pool *wrapped_timestamp_query_pool, uint32_t *out_label_timing_count, BRX_TIMESTAMP_LABEL_TIMING const **out_label_timings) const
+{
+	assert(NULL != wrapped_timestamp_query_pool);
+	brx_timestamp_query_label_list *const label_list = static_cast<brx_d3d12_timestamp_query_pool *>(wrapped_timestamp_query_pool)->get_label_list();
+
+	if (this->get_timestamp_query_pool_results(wrapped_timestamp_query_pool, 0U, label_list->get_used_query_count(), label_list->get_timestamps()))
+	{
+		label_list->resolve(this->m_timestamp_period, out_label_timing_count, out_label_timings);
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+void brx_d3d12_device::destroy_timestamp_query_pool(brx_timestamp_query_pool *wrapped_timestamp_query_pool) const
+{
+	assert(NULL != wrapped_timestamp_query_pool);
+	brx_d3d12_timestamp_query_pool *delete_unwrapped_timestamp_query_pool = static_cast<brx_d3d12_timestamp_query_pool *>(wrapped_timestamp_query_pool);
+
+	delete_unwrapped_timestamp_query_pool->uninit();
+
+	delete_unwrapped_timestamp_query_pool->~brx_d3d12_timestamp_query_pool();
+	brx_free(delete_unwrapped_timestamp_query_pool);
+}
+
 brx_scratch_buffer *brx_d3d12_device::create_scratch_buffer(uint32_t size) const
 {
 	void *new_unwrapped_scratch_buffer_base = brx_malloc(sizeof(brx_d3d12_scratch_buffer), alignof(brx_d3d12_scratch_buffer));
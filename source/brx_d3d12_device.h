@@ -29,6 +29,14 @@
 #define D3D12MA_D3D12_HEADERS_ALREADY_INCLUDED 1
 #include "../thirdparty/D3D12MemoryAllocator/include/D3D12MemAlloc.h"
 #include "brx_d3d12_descriptor_allocator.h"
+#include "brx_pipeline_compiler.h"
+#include "brx_staging_upload_ring.h"
+#include "brx_uniform_upload_ring.h"
+#include "brx_asset_buffer_sub_allocator.h"
+#include "brx_timestamp_query_label_list.h"
+#include "brx_upload_scheduler.h"
+
+class brx_d3d12_transient_descriptor_allocator;
 
 class brx_d3d12_device : public brx_device
 {
@@ -48,8 +56,15 @@ class brx_d3d12_device : public brx_device
 	bool m_uma;
 	bool m_cache_coherent_uma;
 
+	// the unbounded descriptor tables are limited by the resource binding tier 1
+	bool m_resource_binding_tier_2;
+
 	ID3D12CommandQueue *m_graphics_queue;
 	ID3D12CommandQueue *m_upload_queue;
+	ID3D12CommandQueue *m_compute_queue;
+
+	// the duration (in milliseconds) of one timestamp tick
+	double m_timestamp_period;
 
 	D3D12MA::Allocator *m_memory_allocator;
 	D3D12MA::Pool *m_uniform_upload_buffer_memory_pool;
@@ -60,6 +75,7 @@ class brx_d3d12_device : public brx_device
 	D3D12MA::Pool *m_asset_index_buffer_memory_pool;
 	D3D12MA::Pool *m_asset_sampled_image_memory_pool;
 	D3D12MA::Pool *m_storage_image_memory_pool;
+	D3D12MA::Pool *m_timestamp_query_buffer_memory_pool;
 	D3D12MA::Pool *m_scratch_buffer_memory_pool;
 	D3D12MA::Pool *m_staging_non_compacted_bottom_level_acceleration_structure_memory_pool;
 	D3D12MA::Pool *m_compacted_bottom_level_acceleration_structure_size_query_buffer_memory_pool;
@@ -69,6 +85,14 @@ class brx_d3d12_device : public brx_device
 
 	brx_d3d12_descriptor_allocator m_descriptor_allocator;
 
+	// the command signatures only contain the draw or dispatch arguments, and thus are independent of the root signatures
+	ID3D12CommandSignature *m_draw_indirect_command_signature;
+	ID3D12CommandSignature *m_draw_index_indirect_command_signature;
+	ID3D12CommandSignature *m_dispatch_indirect_command_signature;
+
+	brx_pipeline_compiler m_pipeline_compiler;
+	brx_staging_upload_ring_manager m_staging_upload_ring_manager;
+
 public:
 	brx_d3d12_device();
 	void init(bool support_ray_tracing);
@@ -78,38 +102,94 @@ public:
 	void destroy_graphics_queue(brx_graphics_queue *graphics_queue) const override;
 	brx_upload_queue *create_upload_queue() const override;
 	void destroy_upload_queue(brx_upload_queue *upload_queue) const override;
+	bool is_async_compute_supported() const override;
+	brx_compute_queue *create_compute_queue() const override;
+	void destroy_compute_queue(brx_compute_queue *compute_queue) const override;
 	brx_graphics_command_buffer *create_graphics_command_buffer() const override;
 	void reset_graphics_command_buffer(brx_graphics_command_buffer *graphics_command_buffer) const override;
 	void destroy_graphics_command_buffer(brx_graphics_command_buffer *graphics_command_buffer) const override;
+	brx_secondary_graphics_command_buffer *create_secondary_graphics_command_buffer() const override;
+	void reset_secondary_graphics_command_buffer(brx_secondary_graphics_command_buffer *secondary_graphics_command_buffer) const override;
+	void destroy_secondary_graphics_command_buffer(brx_secondary_graphics_command_buffer *secondary_graphics_command_buffer) const override;
 	brx_upload_command_buffer *create_upload_command_buffer() const override;
 	void reset_upload_command_buffer(brx_upload_command_buffer *upload_command_buffer) const override;
 	void destroy_upload_command_buffer(brx_upload_command_buffer *upload_command_buffer) const override;
+	brx_compute_command_buffer *create_compute_command_buffer() const override;
+	void reset_compute_command_buffer(brx_compute_command_buffer *compute_command_buffer) const override;
+	void destroy_compute_command_buffer(brx_compute_command_buffer *compute_command_buffer) const override;
 	brx_fence *create_fence(bool signaled) const override;
 	void wait_for_fence(brx_fence *fence) const override;
 	void reset_fence(brx_fence *fence) const override;
 	void destroy_fence(brx_fence *fence) const override;
-	brx_descriptor_set_layout *create_descriptor_set_layout(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings) const override;
+	bool is_timeline_fence_supported() const override;
+	brx_timeline_fence *create_timeline_fence(uint64_t initial_value) const override;
+	uint64_t get_timeline_fence_completed_value(brx_timeline_fence const *timeline_fence) const override;
+	void signal_timeline_fence(brx_timeline_fence *timeline_fence, uint64_t value) const override;
+	bool wait_for_timeline_fences(uint32_t timeline_fence_count, brx_timeline_fence const *const *timeline_fences, uint64_t const *values, bool wait_all, uint64_t timeout) const override;
+	void destroy_timeline_fence(brx_timeline_fence *timeline_fence) const override;
+	brx_upload_scheduler *create_upload_scheduler(uint32_t batch_count) override;
+	brx_upload_command_buffer *begin_upload_batch(brx_upload_scheduler *upload_scheduler) const override;
+	uint64_t submit_upload_batch(brx_upload_scheduler *upload_scheduler, brx_upload_queue *upload_queue, brx_upload_command_buffer *upload_command_buffer) const override;
+	brx_timeline_fence const *get_upload_scheduler_timeline_fence(brx_upload_scheduler const *upload_scheduler) const override;
+	bool is_upload_batch_completed(brx_upload_scheduler const *upload_scheduler, uint64_t batch_value) const override;
+	void destroy_upload_scheduler(brx_upload_scheduler *upload_scheduler) override;
+	brx_descriptor_set_layout *create_descriptor_set_layout(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings, bool descriptor_update_template) const override;
 	void destroy_descriptor_set_layout(brx_descriptor_set_layout *descriptor_set_layout) const override;
-	brx_pipeline_layout *create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *descriptor_set_layouts) const override;
+	brx_pipeline_layout *create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *descriptor_set_layouts, uint32_t push_constant_size) const override;
 	void destroy_pipeline_layout(brx_pipeline_layout *pipeline_layout) const override;
 	brx_descriptor_set *create_descriptor_set(brx_descriptor_set_layout const *descriptor_set_layout) override;
 	void write_descriptor_set(brx_descriptor_set *descriptor_set, BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t dst_binding, uint32_t dst_array_element, uint32_t src_descriptor_count, brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_storage_buffer const *const *src_storage_buffers, brx_sampled_image const *const *src_sampled_images, brx_sampler const *const *src_samplers, brx_storage_image const *const *src_storage_images, brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures) const override;
+	void write_descriptor_sets(uint32_t write_descriptor_set_count, BRX_WRITE_DESCRIPTOR_SET const *write_descriptor_sets) const override;
+	void write_descriptor_set_with_template(brx_descriptor_set *descriptor_set, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges) const override;
 	void destroy_descriptor_set(brx_descriptor_set *descriptor_set) override;
+	bool is_bindless_table_supported() const override;
+	brx_bindless_table *create_bindless_table(BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t descriptor_count) override;
+	brx_descriptor_set_layout const *get_bindless_table_descriptor_set_layout(brx_bindless_table const *bindless_table) const override;
+	brx_descriptor_set const *get_bindless_table_descriptor_set(brx_bindless_table const *bindless_table) const override;
+	uint32_t alloc_bindless_descriptor(brx_bindless_table *bindless_table, brx_storage_buffer const *src_storage_buffer, brx_sampled_image const *src_sampled_image, brx_sampler const *src_sampler) const override;
+	void free_bindless_descriptor(brx_bindless_table *bindless_table, uint32_t descriptor_index) const override;
+	void destroy_bindless_table(brx_bindless_table *bindless_table) override;
+	brx_transient_descriptor_allocator *create_transient_descriptor_allocator() override;
+	brx_descriptor_set *alloc_transient_descriptor_set(brx_transient_descriptor_allocator *transient_descriptor_allocator, brx_descriptor_set_layout const *descriptor_set_layout) const override;
+	void reset_transient_descriptor_allocator(brx_transient_descriptor_allocator *transient_descriptor_allocator) const override;
+	void destroy_transient_descriptor_allocator(brx_transient_descriptor_allocator *transient_descriptor_allocator) override;
 	brx_render_pass *create_render_pass(uint32_t color_attachment_count, BRX_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment) const override;
 	void destroy_render_pass(brx_render_pass *render_pass) const override;
 	brx_graphics_pipeline *create_graphics_pipeline(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation) const override;
 	void destroy_graphics_pipeline(brx_graphics_pipeline *graphics_pipeline) const override;
 	brx_compute_pipeline *create_compute_pipeline(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) const override;
 	void destroy_compute_pipeline(brx_compute_pipeline *compute_pipeline) const override;
+	bool is_pipeline_specialization_constant_supported() const override;
+	brx_graphics_pipeline *create_graphics_pipeline_variant(brx_graphics_pipeline const *base_graphics_pipeline, brx_render_pass const *render_pass, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants) const override;
+	brx_compute_pipeline *create_compute_pipeline_variant(brx_compute_pipeline const *base_compute_pipeline, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants) const override;
+	brx_graphics_pipeline_compilation *create_graphics_pipeline_async(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation) override;
+	bool is_graphics_pipeline_compilation_completed(brx_graphics_pipeline_compilation const *graphics_pipeline_compilation) const override;
+	brx_graphics_pipeline *wait_graphics_pipeline_compilation(brx_graphics_pipeline_compilation *graphics_pipeline_compilation) override;
+	brx_compute_pipeline_compilation *create_compute_pipeline_async(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) override;
+	bool is_compute_pipeline_compilation_completed(brx_compute_pipeline_compilation const *compute_pipeline_compilation) const override;
+	brx_compute_pipeline *wait_compute_pipeline_compilation(brx_compute_pipeline_compilation *compute_pipeline_compilation) override;
+	bool load_pipeline_cache(size_t pipeline_cache_data_size, void const *pipeline_cache_data) override;
+	size_t store_pipeline_cache(size_t pipeline_cache_data_size, void *pipeline_cache_data) const override;
 	brx_frame_buffer *create_frame_buffer(brx_render_pass const *render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_color_attachment_image const *const *color_attachments, brx_depth_stencil_attachment_image const *depth_stencil_attachment) const override;
 	void destroy_frame_buffer(brx_frame_buffer *frame_buffer) const override;
 	brx_uniform_upload_buffer *create_uniform_upload_buffer(uint32_t size) const override;
 	void destroy_uniform_upload_buffer(brx_uniform_upload_buffer *uniform_upload_buffer) const override;
+	brx_uniform_upload_ring *create_uniform_upload_ring(uint32_t frame_count, uint32_t frame_size) override;
+	brx_uniform_upload_buffer const *get_uniform_upload_ring_buffer(brx_uniform_upload_ring const *uniform_upload_ring) const override;
+	void begin_uniform_upload_ring_frame(brx_uniform_upload_ring *uniform_upload_ring, uint32_t frame_index) const override;
+	void *alloc_uniform_upload_ring_range(brx_uniform_upload_ring *uniform_upload_ring, uint32_t size, uint32_t *out_dynamic_offset) const override;
+	void destroy_uniform_upload_ring(brx_uniform_upload_ring *uniform_upload_ring) override;
 	uint32_t get_staging_upload_buffer_offset_alignment() const override;
 	uint32_t get_staging_upload_buffer_row_pitch_alignment() const override;
 	brx_staging_upload_buffer *create_staging_upload_buffer(uint32_t size) const override;
 	void destroy_staging_upload_buffer(brx_staging_upload_buffer *staging_upload_buffer) const override;
-	brx_intermediate_storage_buffer *create_intermediate_storage_buffer(uint32_t size, bool allow_vertex_position, bool allow_vertex_varying) const override;
+	brx_staging_upload_ring *create_staging_upload_ring(uint32_t initial_size) override;
+	void *alloc_staging_upload_ring_range(brx_staging_upload_ring *staging_upload_ring, uint32_t size, brx_staging_upload_buffer **out_staging_upload_buffer, uint64_t *out_offset) override;
+	void submit_staging_upload_ring(brx_staging_upload_ring *staging_upload_ring, brx_fence const *fence) override;
+	void submit_staging_upload_ring_timeline_fence(brx_staging_upload_ring *staging_upload_ring, brx_timeline_fence const *timeline_fence, uint64_t value) override;
+	BRX_STAGING_UPLOAD_RING_STATISTICS get_staging_upload_ring_statistics(brx_staging_upload_ring const *staging_upload_ring) override;
+	void destroy_staging_upload_ring(brx_staging_upload_ring *staging_upload_ring) override;
+	brx_intermediate_storage_buffer *create_intermediate_storage_buffer(uint32_t size, bool allow_vertex_position, bool allow_vertex_varying, bool allow_indirect_argument) const override;
 	void destroy_intermediate_storage_buffer(brx_intermediate_storage_buffer *intermediate_storage_buffer) const override;
 	brx_asset_vertex_position_buffer *create_asset_vertex_position_buffer(uint32_t size) const override;
 	void destroy_asset_vertex_position_buffer(brx_asset_vertex_position_buffer *asset_vertex_position_buffer) const override;
@@ -117,6 +197,10 @@ public:
 	void destroy_asset_vertex_varying_buffer(brx_asset_vertex_varying_buffer *asset_vertex_varying_buffer) const override;
 	brx_asset_index_buffer *create_asset_index_buffer(uint32_t size) const override;
 	void destroy_asset_index_buffer(brx_asset_index_buffer *asset_index_buffer) const override;
+	brx_asset_buffer_sub_allocator *create_asset_buffer_sub_allocator(uint64_t size, uint32_t alignment) const override;
+	bool alloc_asset_buffer_range(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator, uint32_t size, uint64_t *out_offset) const override;
+	void free_asset_buffer_range(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator, uint64_t offset) const override;
+	void destroy_asset_buffer_sub_allocator(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator) const override;
 	brx_color_attachment_image *create_color_attachment_image(BRX_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const override;
 	void destroy_color_attachment_image(brx_color_attachment_image *color_attachment_image) const override;
 	BRX_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT get_depth_attachment_image_format() const override;
@@ -127,6 +211,7 @@ public:
 	void destroy_storage_image(brx_storage_image *storage_image) const override;
 	bool is_asset_sampled_image_compression_bc_supported() const override;
 	bool is_asset_sampled_image_compression_astc_supported() const override;
+	bool is_indirect_argument_count_supported() const override;
 	brx_asset_sampled_image *create_asset_sampled_image(BRX_ASSET_IMAGE_FORMAT asset_sampled_image_format, uint32_t width, uint32_t height, uint32_t mip_levels) const override;
 	void destroy_asset_sampled_image(brx_asset_sampled_image *asset_sampled_image) const override;
 	brx_sampler *create_sampler(BRX_SAMPLER_FILTER filter) const override;
@@ -136,6 +221,12 @@ public:
 	brx_swap_chain *create_swap_chain(brx_surface *surface) const override;
 	bool acquire_next_image(brx_graphics_command_buffer *graphics_command_buffer, brx_swap_chain const *swap_chain, uint32_t *out_swap_chain_image_index) const override;
 	void destroy_swap_chain(brx_swap_chain *swap_chain) const override;
+	brx_timestamp_query_pool *create_timestamp_query_pool(uint32_t query_count) const override;
+	double get_timestamp_period() const override;
+	bool is_upload_command_buffer_timestamp_supported() const override;
+	bool get_timestamp_query_pool_results(brx_timestamp_query_pool const *timestamp_query_pool, uint32_t first_query, uint32_t query_count, uint64_t *out_timestamps) const override;
+	bool get_timestamp_query_pool_label_timings(brx_timestamp_query_pool *timestamp_query_pool, uint32_t *out_label_timing_count, BRX_TIMESTAMP_LABEL_TIMING const **out_label_timings) const override;
+	void destroy_timestamp_query_pool(brx_timestamp_query_pool *timestamp_query_pool) const override;
 	brx_scratch_buffer *create_scratch_buffer(uint32_t size) const override;
 	void destroy_scratch_buffer(brx_scratch_buffer *scratch_buffer) const override;
 	void get_staging_non_compacted_bottom_level_acceleration_structure_size(uint32_t bottom_level_acceleration_structure_geometry_count, BRX_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY const *bottom_level_acceleration_structure_geometries, uint32_t *staging_non_compacted_bottom_level_acceleration_structure_size, uint32_t *build_scratch_size) const override;
@@ -164,8 +255,12 @@ public:
 	void init(ID3D12CommandQueue *graphics_queue, bool uma, bool support_ray_tracing);
 	void uninit(ID3D12CommandQueue *graphics_queue);
 	~brx_d3d12_graphics_queue();
-	void wait_and_submit(brx_upload_command_buffer const *upload_command_buffer_to_wait, brx_graphics_command_buffer const *graphics_command_buffer_to_submit, brx_fence *fence_to_signal) const override;
-	bool submit_and_present(brx_graphics_command_buffer *graphics_command_buffer_to_submit, brx_swap_chain *swap_chain_to_present, uint32_t swap_chain_image_index, brx_fence *fence_to_signal) const override;
+	void wait_and_submit(brx_upload_command_buffer const *upload_command_buffer_to_wait, brx_graphics_command_buffer const *graphics_command_buffer_to_submit, brx_fence *fence_to_signal) override;
+	bool submit_and_present(brx_graphics_command_buffer *graphics_command_buffer_to_submit, brx_swap_chain *swap_chain_to_present, uint32_t swap_chain_image_index, brx_fence *fence_to_signal) override;
+	void signal_timeline_fence(brx_timeline_fence *timeline_fence, uint64_t value) override;
+	void wait_timeline_fence(brx_timeline_fence const *timeline_fence, uint64_t value) override;
+	void submit_batch(uint32_t graphics_command_buffer_count, brx_graphics_command_buffer const *const *graphics_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *signal_timeline_fences, uint64_t const *signal_values, brx_fence *fence) override;
+	bool submit_batch_and_present(uint32_t graphics_command_buffer_count, brx_graphics_command_buffer *const *graphics_command_buffers, brx_swap_chain *swap_chain, uint32_t swap_chain_image_index, brx_fence *fence) override;
 };
 
 class brx_d3d12_upload_queue : public brx_upload_queue
@@ -179,27 +274,80 @@ public:
 	void init(ID3D12CommandQueue *upload_queue, bool uma, bool support_ray_tracing);
 	void uninit(ID3D12CommandQueue *upload_queue);
 	~brx_d3d12_upload_queue();
-	void submit_and_signal(brx_upload_command_buffer const *upload_command_buffer_to_submit_and_signal) const override;
+	void submit_and_signal(brx_upload_command_buffer const *upload_command_buffer_to_submit_and_signal) override;
+	void submit_and_signal_timeline_fence(brx_upload_command_buffer const *upload_command_buffer_to_submit, brx_timeline_fence *timeline_fence_to_signal, uint64_t value) override;
+	void signal_timeline_fence(brx_timeline_fence *timeline_fence, uint64_t value) override;
+	void wait_timeline_fence(brx_timeline_fence const *timeline_fence, uint64_t value) override;
+	void submit_batch(uint32_t upload_command_buffer_count, brx_upload_command_buffer const *const *upload_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *signal_timeline_fences, uint64_t const *signal_values) override;
+};
+
+class brx_d3d12_compute_queue : public brx_compute_queue
+{
+	ID3D12CommandQueue *m_compute_queue;
+
+public:
+	brx_d3d12_compute_queue();
+	void init(ID3D12CommandQueue *compute_queue);
+	void uninit(ID3D12CommandQueue *compute_queue);
+	~brx_d3d12_compute_queue();
+	void signal_timeline_fence(brx_timeline_fence *timeline_fence, uint64_t value) override;
+	void wait_timeline_fence(brx_timeline_fence const *timeline_fence, uint64_t value) override;
+	void submit_batch(uint32_t compute_command_buffer_count, brx_compute_command_buffer const *const *compute_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *signal_timeline_fences, uint64_t const *signal_values, brx_fence *fence) override;
+};
+
+static constexpr uint32_t const g_d3d12_max_vertex_buffer_count = 16U;
+static constexpr uint32_t const g_d3d12_max_execute_command_list_count = 32U;
+static constexpr uint32_t const g_d3d12_max_pending_resource_barrier_count = 32U;
+static constexpr uint32_t const g_d3d12_max_inline_bottom_level_acceleration_structure_geometry_count = 16U;
+
+class brx_d3d12_pending_resource_barrier
+{
+	// the barriers are merged into one "ResourceBarrier" which is recorded before the next action command
+	// the pending barriers are flushed when the fixed-capacity array is full
+	uint32_t m_resource_barrier_count;
+	D3D12_RESOURCE_BARRIER m_resource_barriers[g_d3d12_max_pending_resource_barrier_count];
+
+public:
+	brx_d3d12_pending_resource_barrier();
+	void resource_barrier(ID3D12GraphicsCommandList4 *command_list, uint32_t resource_barrier_count, D3D12_RESOURCE_BARRIER const *resource_barriers);
+	void flush(ID3D12GraphicsCommandList4 *command_list);
+	~brx_d3d12_pending_resource_barrier();
 };
 
 class brx_d3d12_graphics_command_buffer : public brx_graphics_command_buffer
 {
 	bool m_uma;
 	bool m_support_ray_tracing;
+	// the bundle is recorded inside the render pass, and can NOT set the view port, the scissor or the resource barriers
+	D3D12_COMMAND_LIST_TYPE m_command_list_type;
 	ID3D12CommandAllocator *m_command_allocator;
 	ID3D12GraphicsCommandList4 *m_command_list;
 	brx_d3d12_descriptor_allocator *m_descriptor_allocator;
+	ID3D12CommandSignature *m_draw_indirect_command_signature;
+	ID3D12CommandSignature *m_draw_index_indirect_command_signature;
+	ID3D12CommandSignature *m_dispatch_indirect_command_signature;
 	class brx_d3d12_render_pass const *m_current_render_pass;
 	class brx_d3d12_frame_buffer const *m_current_frame_buffer;
-	brx_vector<uint32_t> m_current_vertex_buffer_strides;
+	uint32_t m_current_vertex_buffer_count;
+	uint32_t m_current_vertex_buffer_strides[g_d3d12_max_vertex_buffer_count];
+	// the root arguments (including the root constants) are reset when the root signature is changed
+	ID3D12RootSignature *m_current_graphics_root_signature;
+	ID3D12RootSignature *m_current_compute_root_signature;
+	// the label regions are timed only when the pool is set, and the pool is unset by the "begin"
+	class brx_d3d12_timestamp_query_pool *m_debug_utils_label_timestamp_query_pool;
+	BRX_GRAPHICS_COMMAND_BUFFER_STATISTICS m_statistics;
+	brx_d3d12_pending_resource_barrier m_pending_resource_barrier;
+
+	void bind_index_buffer(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type);
 
 public:
 	brx_d3d12_graphics_command_buffer();
-	void init(ID3D12Device *device, bool uma, bool support_ray_tracing, brx_d3d12_descriptor_allocator *descriptor_allocator);
+	void init(D3D12_COMMAND_LIST_TYPE command_list_type, ID3D12Device *device, bool uma, bool support_ray_tracing, brx_d3d12_descriptor_allocator *descriptor_allocator, ID3D12CommandSignature *draw_indirect_command_signature, ID3D12CommandSignature *draw_index_indirect_command_signature, ID3D12CommandSignature *dispatch_indirect_command_signature);
 	void uninit();
 	~brx_d3d12_graphics_command_buffer();
 	ID3D12CommandAllocator *get_command_allocator() const;
 	ID3D12GraphicsCommandList4 *get_command_list() const;
+	void begin_bundle();
 	void begin() override;
 	void acquire_asset_vertex_position_buffer(brx_asset_vertex_position_buffer *asset_vertex_position_buffer) override;
 	void acquire_asset_vertex_varying_buffer(brx_asset_vertex_varying_buffer *asset_vertex_varying_buffer) override;
@@ -208,24 +356,104 @@ public:
 	void acquire_asset_compacted_bottom_level_acceleration_structure(brx_asset_compacted_bottom_level_acceleration_structure *asset_compacted_bottom_level_acceleration_structure) override;
 	void begin_debug_utils_label(char const *label_name) override;
 	void end_debug_utils_label() override;
-	void begin_render_pass(brx_render_pass const *render_pass, brx_frame_buffer const *frame_buffer, uint32_t width, uint32_t height, uint32_t color_clear_value_count, float const (*color_clear_values)[4], float const *depth_clear_value, uint8_t const *stencil_clear_value) override;
+	void reset_timestamp_query_pool(brx_timestamp_query_pool *timestamp_query_pool) override;
+	void write_timestamp(brx_timestamp_query_pool *timestamp_query_pool, uint32_t query_index) override;
+	void set_debug_utils_label_timestamp_query_pool(brx_timestamp_query_pool *timestamp_query_pool) override;
+	void begin_render_pass(brx_render_pass const *render_pass, brx_frame_buffer const *frame_buffer, uint32_t width, uint32_t height, uint32_t color_clear_value_count, float const (*color_clear_values)[4], float const *depth_clear_value, uint8_t const *stencil_clear_value, bool secondary_graphics_command_buffers) override;
+	void execute_secondary_graphics_command_buffers(uint32_t secondary_graphics_command_buffer_count, brx_secondary_graphics_command_buffer const *const *secondary_graphics_command_buffers) override;
 	void bind_graphics_pipeline(brx_graphics_pipeline const *graphics_pipeline) override;
 	void set_view_port(uint32_t width, uint32_t height) override;
 	void set_scissor(uint32_t width, uint32_t height) override;
 	void bind_graphics_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
-	void bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers) override;
-	void draw(uint32_t vertex_count, uint32_t instance_count) override;
-	void draw_index(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, uint32_t index_count, uint32_t instance_count) override;
+	void push_graphics_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values) override;
+	void bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers, uint64_t const *vertex_buffer_offsets) override;
+	void draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance) override;
+	void draw_index(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance) override;
+	void draw_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer, uint64_t count_offset) override;
+	void draw_index_indirect(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer, uint64_t count_offset) override;
 	void end_render_pass() override;
 	void compute_pass_load_storage_image(brx_storage_image const *storage_image, BRX_STORAGE_IMAGE_LOAD_OPERATION load_operation) override;
+	void compute_pass_load_indirect_argument_buffer(brx_indirect_argument_buffer const *indirect_argument_buffer) override;
 	void bind_compute_pipeline(brx_compute_pipeline const *compute_pipeline) override;
 	void bind_compute_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
+	void push_compute_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values) override;
 	void dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) override;
+	void dispatch_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset) override;
 	void compute_pass_store_storage_image(brx_storage_image const *storage_image, BRX_STORAGE_IMAGE_STORE_OPERATION store_operation) override;
+	void compute_pass_store_indirect_argument_buffer(brx_indirect_argument_buffer const *indirect_argument_buffer) override;
+	void release_storage_buffer_to_compute_queue(brx_intermediate_storage_buffer const *storage_buffer) override;
+	void release_storage_image_to_compute_queue(brx_storage_image const *storage_image) override;
+	void acquire_storage_buffer_from_compute_queue(brx_intermediate_storage_buffer const *storage_buffer) override;
+	void acquire_storage_image_from_compute_queue(brx_storage_image const *storage_image) override;
 	void build_top_level_acceleration_structure(brx_top_level_acceleration_structure *top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, brx_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer, brx_scratch_buffer *scratch_buffer) override;
 	void update_top_level_acceleration_structure(brx_top_level_acceleration_structure *top_level_acceleration_structure, brx_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer, brx_scratch_buffer *scratch_buffer) override;
 	void acceleration_structure_pass_store_top_level(brx_top_level_acceleration_structure *top_level_acceleration_structure) override;
 	void end() override;
+	BRX_GRAPHICS_COMMAND_BUFFER_STATISTICS get_statistics() const override;
+};
+
+class brx_d3d12_secondary_graphics_command_buffer : public brx_secondary_graphics_command_buffer
+{
+	// the recording is shared with the primary graphics command buffer
+	brx_d3d12_graphics_command_buffer m_graphics_command_buffer;
+	// the view port and scissor are set by the primary graphics command buffer before the bundle is executed
+	uint32_t m_width;
+	uint32_t m_height;
+
+public:
+	brx_d3d12_secondary_graphics_command_buffer();
+	void init(ID3D12Device *device, bool uma, bool support_ray_tracing, brx_d3d12_descriptor_allocator *descriptor_allocator, ID3D12CommandSignature *draw_indirect_command_signature, ID3D12CommandSignature *draw_index_indirect_command_signature, ID3D12CommandSignature *dispatch_indirect_command_signature);
+	void uninit();
+	~brx_d3d12_secondary_graphics_command_buffer();
+	ID3D12CommandAllocator *get_command_allocator() const;
+	ID3D12GraphicsCommandList4 *get_command_list() const;
+	uint32_t get_width() const;
+	uint32_t get_height() const;
+	void begin(brx_render_pass const *render_pass, brx_frame_buffer const *frame_buffer, uint32_t width, uint32_t height) override;
+	void bind_graphics_pipeline(brx_graphics_pipeline const *graphics_pipeline) override;
+	void bind_graphics_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
+	void push_graphics_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values) override;
+	void bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers, uint64_t const *vertex_buffer_offsets) override;
+	void draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance) override;
+	void draw_index(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance) override;
+	void draw_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer, uint64_t count_offset) override;
+	void draw_index_indirect(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer, uint64_t count_offset) override;
+	void end() override;
+	BRX_GRAPHICS_COMMAND_BUFFER_STATISTICS get_statistics() const override;
+};
+
+class brx_d3d12_compute_command_buffer : public brx_compute_command_buffer
+{
+	ID3D12CommandAllocator *m_command_allocator;
+	ID3D12GraphicsCommandList4 *m_command_list;
+	brx_d3d12_descriptor_allocator *m_descriptor_allocator;
+	ID3D12CommandSignature *m_dispatch_indirect_command_signature;
+	// the root arguments (including the root constants) are reset when the root signature is changed
+	ID3D12RootSignature *m_current_compute_root_signature;
+	brx_d3d12_pending_resource_barrier m_pending_resource_barrier;
+
+public:
+	brx_d3d12_compute_command_buffer();
+	void init(ID3D12Device *device, brx_d3d12_descriptor_allocator *descriptor_allocator, ID3D12CommandSignature *dispatch_indirect_command_signature);
+	void uninit();
+	~brx_d3d12_compute_command_buffer();
+	ID3D12CommandAllocator *get_command_allocator() const;
+	ID3D12GraphicsCommandList4 *get_command_list() const;
+	void begin() override;
+	void acquire_storage_buffer_from_graphics_queue(brx_intermediate_storage_buffer const *storage_buffer) override;
+	void acquire_storage_image_from_graphics_queue(brx_storage_image const *storage_image) override;
+	void compute_pass_load_storage_image(brx_storage_image const *storage_image, BRX_STORAGE_IMAGE_LOAD_OPERATION load_operation) override;
+	void compute_pass_load_indirect_argument_buffer(brx_indirect_argument_buffer const *indirect_argument_buffer) override;
+	void bind_compute_pipeline(brx_compute_pipeline const *compute_pipeline) override;
+	void bind_compute_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
+	void push_compute_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values) override;
+	void dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) override;
+	void dispatch_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset) override;
+	void compute_pass_store_storage_image(brx_storage_image const *storage_image, BRX_STORAGE_IMAGE_STORE_OPERATION store_operation) override;
+	void compute_pass_store_indirect_argument_buffer(brx_indirect_argument_buffer const *indirect_argument_buffer) override;
+	void release_storage_buffer_to_graphics_queue(brx_intermediate_storage_buffer const *storage_buffer) override;
+	void release_storage_image_to_graphics_queue(brx_storage_image const *storage_image) override;
+	void end() override;
 };
 
 class brx_d3d12_upload_command_buffer : public brx_upload_command_buffer
@@ -236,6 +464,12 @@ class brx_d3d12_upload_command_buffer : public brx_upload_command_buffer
 	ID3D12CommandAllocator *m_command_allocator;
 	ID3D12GraphicsCommandList4 *m_command_list;
 	ID3D12Fence *m_upload_queue_submit_fence;
+	brx_d3d12_pending_resource_barrier m_pending_resource_barrier;
+
+	// the geometries of one bottom level acceleration structure can NOT be split into multiple builds
+	// the scratch array is only used (and keeps its capacity) when the inline array is NOT enough
+	D3D12_RAYTRACING_GEOMETRY_DESC m_inline_ray_tracing_geometry_descs[g_d3d12_max_inline_bottom_level_acceleration_structure_geometry_count];
+	brx_vector<D3D12_RAYTRACING_GEOMETRY_DESC> m_scratch_ray_tracing_geometry_descs;
 
 public:
 	brx_d3d12_upload_command_buffer();
@@ -257,6 +491,8 @@ public:
 	void release_asset_index_buffer(brx_asset_index_buffer *asset_index_buffer) override;
 	void release_asset_sampled_image(brx_asset_sampled_image *asset_sampled_image, uint32_t dst_mip_level) override;
 	void release_asset_compacted_bottom_level_acceleration_structure(brx_asset_compacted_bottom_level_acceleration_structure *asset_compacted_bottom_level_acceleration_structure) override;
+	void reset_timestamp_query_pool(brx_timestamp_query_pool *timestamp_query_pool) override;
+	void write_timestamp(brx_timestamp_query_pool *timestamp_query_pool, uint32_t query_index) override;
 	void end() override;
 };
 
@@ -271,6 +507,17 @@ public:
 	~brx_d3d12_fence();
 };
 
+class brx_d3d12_timeline_fence : public brx_timeline_fence
+{
+	ID3D12Fence *m_fence;
+
+public:
+	brx_d3d12_timeline_fence(ID3D12Fence *fence);
+	ID3D12Fence *get_fence() const;
+	void steal(ID3D12Fence **out_fence);
+	~brx_d3d12_timeline_fence();
+};
+
 struct brx_d3d12_descriptor_layout
 {
 	BRX_DESCRIPTOR_TYPE root_parameter_type;
@@ -281,25 +528,36 @@ struct brx_d3d12_descriptor_layout
 class brx_d3d12_descriptor_set_layout : public brx_descriptor_set_layout
 {
 	brx_vector<brx_d3d12_descriptor_layout> m_descriptor_layouts;
+	bool m_descriptor_update_template;
 
 public:
 	brx_d3d12_descriptor_set_layout();
-	void init(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *wrapped_descriptor_set_bindingst);
+	void init(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *wrapped_descriptor_set_bindingst, bool descriptor_update_template);
 	void uninit();
 	uint32_t get_descriptor_layout_count() const;
 	brx_d3d12_descriptor_layout const *get_descriptor_layouts() const;
+	bool has_descriptor_update_template() const;
 };
 
+// the root constants are bound to the dedicated register which is NOT used by any descriptor set, and should be consistent with the "brx_push_constant" of the shader
+static constexpr uint32_t const g_d3d12_push_constant_shader_register = 0U;
+static constexpr uint32_t const g_d3d12_push_constant_register_space = 16U;
+static constexpr uint32_t const g_d3d12_max_push_constant_size = 128U;
+
 class brx_d3d12_pipeline_layout : public brx_pipeline_layout
 {
 	ID3D12RootSignature *m_root_signature;
+	uint32_t m_push_constant_root_parameter_index;
+	uint32_t m_push_constant_size;
 
 public:
 	brx_d3d12_pipeline_layout();
-	void init(ID3D12Device *device, decltype(D3D12SerializeRootSignature) *pfn_d3d12_serialize_root_signature, uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *descriptor_set_layouts);
+	void init(ID3D12Device *device, decltype(D3D12SerializeRootSignature) *pfn_d3d12_serialize_root_signature, uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *descriptor_set_layouts, uint32_t push_constant_size);
 	void uninit();
 	~brx_d3d12_pipeline_layout();
 	ID3D12RootSignature *get_root_signature() const;
+	uint32_t get_push_constant_root_parameter_index() const;
+	uint32_t get_push_constant_size() const;
 };
 
 struct brx_d3d12_descriptor
@@ -321,20 +579,88 @@ struct brx_d3d12_descriptor
 	};
 };
 
+struct brx_d3d12_descriptor_copy_list
+{
+	brx_vector<uint32_t> base_descriptor_heap_indices;
+	brx_vector<D3D12_CPU_DESCRIPTOR_HANDLE> dest_descriptor_range_starts;
+	brx_vector<D3D12_CPU_DESCRIPTOR_HANDLE> src_descriptor_range_starts;
+	brx_vector<UINT> descriptor_range_sizes;
+};
+
 class brx_d3d12_descriptor_set : public brx_descriptor_set
 {
 	brx_vector<brx_d3d12_descriptor> m_descriptors;
+	bool m_descriptor_update_template;
+	brx_d3d12_descriptor_copy_list m_cbv_srv_uav_descriptor_copy_list;
+	brx_d3d12_descriptor_copy_list m_sampler_descriptor_copy_list;
+
+	void init_descriptor_copy_lists(brx_d3d12_descriptor_set_layout const *descriptor_set_layout);
+	void uninit_descriptor_copy_lists();
 
 public:
 	brx_d3d12_descriptor_set();
 	void init(brx_d3d12_descriptor_allocator *descriptor_allocator, brx_descriptor_set_layout const *descriptor_set_layout);
 	void uninit(brx_d3d12_descriptor_allocator *descriptor_allocator);
+	void init_transient(brx_d3d12_transient_descriptor_allocator *transient_descriptor_allocator, brx_descriptor_set_layout const *descriptor_set_layout);
+	void uninit_transient();
 	~brx_d3d12_descriptor_set();
-	void write_descriptor(ID3D12Device *device, brx_d3d12_descriptor_allocator const *descriptor_allocator, BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t dst_binding, uint32_t dst_array_element, uint32_t src_descriptor_count, brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_storage_buffer const *const *src_storage_buffers, brx_sampled_image const *const *src_sampled_images, brx_sampler const *const *src_samplers, brx_storage_image const *const *src_storage_images, brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures);
+	void write_descriptor(ID3D12Device *device, brx_d3d12_descriptor_allocator const *descriptor_allocator, BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t dst_binding, uint32_t dst_array_element, uint32_t src_descriptor_count, brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_storage_buffer const *const *src_storage_buffers, brx_sampled_image const *const *src_sampled_images, brx_sampler const *const *src_samplers, brx_storage_image const *const *src_storage_images, brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures, uint32_t *out_copy_base_descriptor_heap_index);
+	void write_descriptor_with_template(ID3D12Device *device, brx_d3d12_descriptor_allocator const *descriptor_allocator, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges);
 	uint32_t get_descriptor_count() const;
 	brx_d3d12_descriptor const *get_descriptors() const;
 };
 
+class brx_d3d12_bindless_table : public brx_bindless_table
+{
+	BRX_DESCRIPTOR_TYPE m_descriptor_type;
+	brx_d3d12_descriptor_set_layout *m_descriptor_set_layout;
+	brx_d3d12_descriptor_set *m_descriptor_set;
+	brx_vector<uint32_t> m_free_descriptor_indices;
+
+public:
+	brx_d3d12_bindless_table();
+	void init(BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t descriptor_count, brx_d3d12_descriptor_set_layout *descriptor_set_layout, brx_d3d12_descriptor_set *descriptor_set);
+	void steal(brx_d3d12_descriptor_set_layout **out_descriptor_set_layout, brx_d3d12_descriptor_set **out_descriptor_set);
+	~brx_d3d12_bindless_table();
+	BRX_DESCRIPTOR_TYPE get_descriptor_type() const;
+	brx_d3d12_descriptor_set_layout *get_descriptor_set_layout() const;
+	brx_d3d12_descriptor_set *get_descriptor_set() const;
+	uint32_t alloc_descriptor_index();
+	void free_descriptor_index(uint32_t descriptor_index);
+};
+
+struct brx_d3d12_transient_descriptor_region
+{
+	uint32_t base_descriptor_heap_index;
+	uint32_t alloced_num_descriptors;
+};
+
+class brx_d3d12_transient_descriptor_allocator : public brx_transient_descriptor_allocator
+{
+	brx_d3d12_descriptor_allocator *m_descriptor_allocator;
+
+	brx_vector<brx_d3d12_transient_descriptor_region> m_cbv_srv_uav_descriptor_regions;
+	uint32_t m_current_cbv_srv_uav_descriptor_region_index;
+	uint32_t m_current_cbv_srv_uav_descriptor_region_offset;
+
+	brx_vector<brx_d3d12_transient_descriptor_region> m_sampler_descriptor_regions;
+	uint32_t m_current_sampler_descriptor_region_index;
+	uint32_t m_current_sampler_descriptor_region_offset;
+
+	brx_vector<brx_d3d12_descriptor_set *> m_descriptor_sets;
+	uint32_t m_descriptor_set_count;
+
+public:
+	brx_d3d12_transient_descriptor_allocator();
+	void init(brx_d3d12_descriptor_allocator *descriptor_allocator);
+	void uninit();
+	~brx_d3d12_transient_descriptor_allocator();
+	brx_d3d12_descriptor_set *alloc_descriptor_set(brx_descriptor_set_layout const *descriptor_set_layout);
+	void reset();
+	uint32_t alloc_cbv_srv_uav_descriptor(uint32_t num_descriptors);
+	uint32_t alloc_sampler_descriptor(uint32_t num_descriptors);
+};
+
 class brx_d3d12_render_pass : public brx_render_pass
 {
 	brx_vector<BRX_COLOR_ATTACHMENT_IMAGE_FORMAT> m_color_attachment_formats;
@@ -376,6 +702,7 @@ class brx_d3d12_graphics_pipeline : public brx_graphics_pipeline
 public:
 	brx_d3d12_graphics_pipeline();
 	void init(ID3D12Device *device, brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION wrapped_depth_compare_operation);
+	void init_variant(brx_d3d12_graphics_pipeline const *base_graphics_pipeline);
 	void uninit();
 	~brx_d3d12_graphics_pipeline();
 	uint32_t get_vertex_buffer_count() const;
@@ -391,6 +718,7 @@ class brx_d3d12_compute_pipeline : public brx_compute_pipeline
 public:
 	brx_d3d12_compute_pipeline();
 	void init(ID3D12Device *device, brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code);
+	void init_variant(brx_d3d12_compute_pipeline const *base_compute_pipeline);
 	void uninit();
 	~brx_d3d12_compute_pipeline();
 	ID3D12PipelineState *get_pipeline() const;
@@ -474,16 +802,25 @@ public:
 	virtual D3D12_SHADER_RESOURCE_VIEW_DESC const *get_shader_resource_view_desc() const = 0;
 };
 
-class brx_d3d12_intermediate_storage_buffer : public brx_intermediate_storage_buffer, brx_d3d12_storage_buffer, brx_d3d12_vertex_position_buffer, brx_d3d12_vertex_varying_buffer, brx_d3d12_vertex_buffer
+class brx_d3d12_indirect_argument_buffer : public brx_indirect_argument_buffer
+{
+public:
+	virtual ID3D12Resource *get_resource() const = 0;
+	// the state which the indirect commands read from, and which the "compute_pass_load_indirect_argument_buffer" transitions from
+	virtual D3D12_RESOURCE_STATES get_indirect_argument_resource_state() const = 0;
+};
+
+class brx_d3d12_intermediate_storage_buffer : public brx_intermediate_storage_buffer, brx_d3d12_storage_buffer, brx_d3d12_vertex_position_buffer, brx_d3d12_vertex_varying_buffer, brx_d3d12_vertex_buffer, brx_d3d12_indirect_argument_buffer
 {
 	ID3D12Resource *m_resource;
 	D3D12MA::Allocation *m_allocation;
 	D3D12_UNORDERED_ACCESS_VIEW_DESC m_unordered_access_view_desc;
 	D3D12_SHADER_RESOURCE_VIEW_DESC m_shader_resource_view_desc;
+	D3D12_RESOURCE_STATES m_indirect_argument_resource_state;
 
 public:
 	brx_d3d12_intermediate_storage_buffer();
-	void init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *storage_buffer_memory_pool, uint32_t size, bool allow_vertex_position, bool allow_vertex_varying);
+	void init(D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *storage_buffer_memory_pool, uint32_t size, bool allow_vertex_position, bool allow_vertex_varying, bool allow_indirect_argument);
 	void uninit();
 	~brx_d3d12_intermediate_storage_buffer();
 	ID3D12Resource *get_resource() const override;
@@ -493,6 +830,8 @@ public:
 	brx_vertex_position_buffer const *get_vertex_position_buffer() const override;
 	brx_vertex_varying_buffer const *get_vertex_varying_buffer() const override;
 	brx_storage_buffer const *get_storage_buffer() const override;
+	D3D12_RESOURCE_STATES get_indirect_argument_resource_state() const override;
+	brx_indirect_argument_buffer const *get_indirect_argument_buffer() const override;
 };
 
 class brx_d3d12_asset_vertex_position_buffer : public brx_asset_vertex_position_buffer, brx_d3d12_vertex_position_buffer, brx_d3d12_vertex_buffer, brx_d3d12_storage_buffer
@@ -736,6 +1075,28 @@ public:
 	D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC volatile *get_host_memory_range_base() const;
 };
 
+class brx_d3d12_timestamp_query_pool : public brx_timestamp_query_pool
+{
+	ID3D12QueryHeap *m_query_heap;
+	// the timestamps are resolved into the readback buffer by the "ResolveQueryData"
+	ID3D12Resource *m_resource;
+	D3D12MA::Allocation *m_allocation;
+	uint64_t volatile *m_host_memory_range_base;
+	uint32_t m_query_count;
+	brx_timestamp_query_label_list m_label_list;
+
+public:
+	brx_d3d12_timestamp_query_pool();
+	void init(ID3D12Device *device, D3D12MA::Allocator *memory_allocator, D3D12MA::Pool *timestamp_query_buffer_memory_pool, uint32_t query_count);
+	void uninit();
+	~brx_d3d12_timestamp_query_pool();
+	ID3D12QueryHeap *get_query_heap() const;
+	ID3D12Resource *get_resource() const;
+	uint64_t volatile *get_host_memory_range_base() const;
+	uint32_t get_query_count() const;
+	brx_timestamp_query_label_list *get_label_list();
+};
+
 class brx_d3d12_asset_compacted_bottom_level_acceleration_structure : public brx_asset_compacted_bottom_level_acceleration_structure
 {
 	ID3D12Resource *m_resource;
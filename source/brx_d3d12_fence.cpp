@@ -40,3 +40,26 @@ brx_d3d12_fence::~brx_d3d12_fence()
 {
 	assert(NULL == this->m_fence);
 }
+
+brx_d3d12_timeline_fence::brx_d3d12_timeline_fence(ID3D12Fence *fence) : m_fence(fence)
+{
+}
+
+ID3D12Fence *brx_d3d12_timeline_fence::get_fence() const
+{
+	return this->m_fence;
+}
+
+void brx_d3d12_timeline_fence::steal(ID3D12Fence **out_fence)
+{
+	assert(NULL != out_fence);
+
+	(*out_fence) = this->m_fence;
+
+	this->m_fence = NULL;
+}
+
+brx_d3d12_timeline_fence::~brx_d3d12_timeline_fence()
+{
+	assert(NULL == this->m_fence);
+}
@@ -163,6 +163,17 @@ void brx_d3d12_graphics_pipeline::init(ID3D12Device *device, brx_render_pass con
 	assert(SUCCEEDED(hr_create_graphics_pipeline_state));
 }
 
+void brx_d3d12_graphics_pipeline::init_variant(brx_d3d12_graphics_pipeline const *base_graphics_pipeline)
+{
+	// the DXIL does not support the specialization constants, and the pipeline state of the base pipeline is shared
+	this->m_vertex_buffer_strides = base_graphics_pipeline->m_vertex_buffer_strides;
+	this->m_primitive_topology = base_graphics_pipeline->m_primitive_topology;
+
+	assert(NULL == this->m_pipeline_state);
+	this->m_pipeline_state = base_graphics_pipeline->m_pipeline_state;
+	this->m_pipeline_state->AddRef();
+}
+
 void brx_d3d12_graphics_pipeline::uninit()
 {
 	assert(NULL != this->m_pipeline_state);
@@ -229,6 +240,14 @@ void brx_d3d12_compute_pipeline::init(ID3D12Device *device, brx_pipeline_layout
 	assert(SUCCEEDED(hr_create_compute_pipeline_state));
 }
 
+void brx_d3d12_compute_pipeline::init_variant(brx_d3d12_compute_pipeline const *base_compute_pipeline)
+{
+	// the DXIL does not support the specialization constants, and the pipeline state of the base pipeline is shared
+	assert(NULL == this->m_pipeline_state);
+	this->m_pipeline_state = base_compute_pipeline->m_pipeline_state;
+	this->m_pipeline_state->AddRef();
+}
+
 void brx_d3d12_compute_pipeline::uninit()
 {
 	assert(NULL != this->m_pipeline_state);
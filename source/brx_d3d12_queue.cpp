@@ -46,7 +46,7 @@ brx_d3d12_graphics_queue::~brx_d3d12_graphics_queue()
 	assert(NULL == this->m_graphics_queue);
 }
 
-void brx_d3d12_graphics_queue::wait_and_submit(brx_upload_command_buffer const *brx_upload_command_buffer, brx_graphics_command_buffer const *brx_graphics_command_buffer, brx_fence *brx_fence) const
+void brx_d3d12_graphics_queue::wait_and_submit(brx_upload_command_buffer const *brx_upload_command_buffer, brx_graphics_command_buffer const *brx_graphics_command_buffer, brx_fence *brx_fence)
 {
 	assert(NULL != brx_upload_command_buffer);
 	assert(NULL != brx_graphics_command_buffer);
@@ -84,7 +84,7 @@ void brx_d3d12_graphics_queue::wait_and_submit(brx_upload_command_buffer const *
 	}
 }
 
-bool brx_d3d12_graphics_queue::submit_and_present(brx_graphics_command_buffer *brx_graphics_command_buffer, brx_swap_chain *brx_swap_chain, uint32_t swap_chain_image_index, brx_fence *brx_fence) const
+bool brx_d3d12_graphics_queue::submit_and_present(brx_graphics_command_buffer *brx_graphics_command_buffer, brx_swap_chain *brx_swap_chain, uint32_t swap_chain_image_index, brx_fence *brx_fence)
 {
 	assert(NULL != brx_graphics_command_buffer);
 	assert(NULL != brx_swap_chain);
@@ -113,6 +113,88 @@ bool brx_d3d12_graphics_queue::submit_and_present(brx_graphics_command_buffer *b
 	return true;
 }
 
+void brx_d3d12_graphics_queue::signal_timeline_fence(brx_timeline_fence *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_timeline_fence);
+	ID3D12Fence *fence = static_cast<brx_d3d12_timeline_fence const *>(brx_timeline_fence)->get_fence();
+
+	HRESULT hr_signal = this->m_graphics_queue->Signal(fence, value);
+	assert(SUCCEEDED(hr_signal));
+}
+
+void brx_d3d12_graphics_queue::wait_timeline_fence(brx_timeline_fence const *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_timeline_fence);
+	ID3D12Fence *fence = static_cast<brx_d3d12_timeline_fence const *>(brx_timeline_fence)->get_fence();
+
+	HRESULT hr_wait = this->m_graphics_queue->Wait(fence, value);
+	assert(SUCCEEDED(hr_wait));
+}
+
+void brx_d3d12_graphics_queue::submit_batch(uint32_t graphics_command_buffer_count, brx_graphics_command_buffer const *const *brx_graphics_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *brx_wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *brx_signal_timeline_fences, uint64_t const *signal_values, brx_fence *brx_fence)
+{
+	for (uint32_t wait_timeline_fence_index = 0U; wait_timeline_fence_index < wait_timeline_fence_count; ++wait_timeline_fence_index)
+	{
+		assert(NULL != brx_wait_timeline_fences[wait_timeline_fence_index]);
+		HRESULT hr_wait = this->m_graphics_queue->Wait(static_cast<brx_d3d12_timeline_fence const *>(brx_wait_timeline_fences[wait_timeline_fence_index])->get_fence(), wait_values[wait_timeline_fence_index]);
+		assert(SUCCEEDED(hr_wait));
+	}
+
+	if (graphics_command_buffer_count > 0U)
+	{
+		assert(graphics_command_buffer_count <= g_d3d12_max_execute_command_list_count);
+		ID3D12CommandList *command_lists[g_d3d12_max_execute_command_list_count];
+		for (uint32_t graphics_command_buffer_index = 0U; graphics_command_buffer_index < graphics_command_buffer_count; ++graphics_command_buffer_index)
+		{
+			assert(NULL != brx_graphics_command_buffers[graphics_command_buffer_index]);
+			command_lists[graphics_command_buffer_index] = static_cast<brx_d3d12_graphics_command_buffer const *>(brx_graphics_command_buffers[graphics_command_buffer_index])->get_command_list();
+		}
+
+		this->m_graphics_queue->ExecuteCommandLists(graphics_command_buffer_count, command_lists);
+	}
+
+	for (uint32_t signal_timeline_fence_index = 0U; signal_timeline_fence_index < signal_timeline_fence_count; ++signal_timeline_fence_index)
+	{
+		assert(NULL != brx_signal_timeline_fences[signal_timeline_fence_index]);
+		HRESULT hr_signal = this->m_graphics_queue->Signal(static_cast<brx_d3d12_timeline_fence const *>(brx_signal_timeline_fences[signal_timeline_fence_index])->get_fence(), signal_values[signal_timeline_fence_index]);
+		assert(SUCCEEDED(hr_signal));
+	}
+
+	if (NULL != brx_fence)
+	{
+		HRESULT hr_signal = this->m_graphics_queue->Signal(static_cast<brx_d3d12_fence const *>(brx_fence)->get_fence(), 1U);
+		assert(SUCCEEDED(hr_signal));
+	}
+}
+
+bool brx_d3d12_graphics_queue::submit_batch_and_present(uint32_t graphics_command_buffer_count, brx_graphics_command_buffer *const *brx_graphics_command_buffers, brx_swap_chain *brx_swap_chain, uint32_t swap_chain_image_index, brx_fence *brx_fence)
+{
+	assert(graphics_command_buffer_count > 0U);
+	assert(NULL != brx_graphics_command_buffers);
+	assert(NULL != brx_swap_chain);
+	assert(NULL != brx_fence);
+
+	assert(graphics_command_buffer_count <= g_d3d12_max_execute_command_list_count);
+	ID3D12CommandList *command_lists[g_d3d12_max_execute_command_list_count];
+	for (uint32_t graphics_command_buffer_index = 0U; graphics_command_buffer_index < graphics_command_buffer_count; ++graphics_command_buffer_index)
+	{
+		assert(NULL != brx_graphics_command_buffers[graphics_command_buffer_index]);
+		command_lists[graphics_command_buffer_index] = static_cast<brx_d3d12_graphics_command_buffer const *>(brx_graphics_command_buffers[graphics_command_buffer_index])->get_command_list();
+	}
+	IDXGISwapChain3 *swap_chain = static_cast<brx_d3d12_swap_chain const *>(brx_swap_chain)->get_swap_chain();
+	ID3D12Fence *fence = static_cast<brx_d3d12_fence const *>(brx_fence)->get_fence();
+
+	this->m_graphics_queue->ExecuteCommandLists(graphics_command_buffer_count, command_lists);
+
+	HRESULT hr_present = swap_chain->Present(0U, 0U);
+	assert(SUCCEEDED(hr_present));
+
+	HRESULT hr_signal = this->m_graphics_queue->Signal(fence, 1U);
+	assert(SUCCEEDED(hr_signal));
+
+	return true;
+}
+
 brx_d3d12_upload_queue::brx_d3d12_upload_queue() : m_upload_queue(NULL)
 {
 }
@@ -141,7 +223,7 @@ brx_d3d12_upload_queue::~brx_d3d12_upload_queue()
 	assert(NULL == this->m_upload_queue);
 }
 
-void brx_d3d12_upload_queue::submit_and_signal(brx_upload_command_buffer const *brx_upload_command_buffer) const
+void brx_d3d12_upload_queue::submit_and_signal(brx_upload_command_buffer const *brx_upload_command_buffer)
 {
 	assert(NULL != brx_upload_command_buffer);
 	ID3D12CommandList *command_list = static_cast<brx_d3d12_upload_command_buffer const *>(brx_upload_command_buffer)->get_command_list();
@@ -164,3 +246,207 @@ void brx_d3d12_upload_queue::submit_and_signal(brx_upload_command_buffer const *
 		assert(NULL == this->m_upload_queue);
 	}
 }
+
+void brx_d3d12_upload_queue::submit_and_signal_timeline_fence(brx_upload_command_buffer const *brx_upload_command_buffer, brx_timeline_fence *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_upload_command_buffer);
+	assert(NULL != brx_timeline_fence);
+	ID3D12CommandList *command_list = static_cast<brx_d3d12_upload_command_buffer const *>(brx_upload_command_buffer)->get_command_list();
+	ID3D12Fence *fence = static_cast<brx_d3d12_timeline_fence const *>(brx_timeline_fence)->get_fence();
+
+	if ((!this->m_uma) || this->m_support_ray_tracing)
+	{
+		assert(NULL != command_list);
+
+		this->m_upload_queue->ExecuteCommandLists(1U, &command_list);
+
+		HRESULT hr_signal = this->m_upload_queue->Signal(fence, value);
+		assert(SUCCEEDED(hr_signal));
+	}
+	else
+	{
+		// the uploads have been performed by the host
+		assert(NULL == command_list);
+		assert(NULL == this->m_upload_queue);
+
+		HRESULT hr_signal = fence->Signal(value);
+		assert(SUCCEEDED(hr_signal));
+	}
+}
+
+void brx_d3d12_upload_queue::submit_batch(uint32_t upload_command_buffer_count, brx_upload_command_buffer const *const *brx_upload_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *brx_wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *brx_signal_timeline_fences, uint64_t const *signal_values)
+{
+	if ((!this->m_uma) || this->m_support_ray_tracing)
+	{
+		for (uint32_t wait_timeline_fence_index = 0U; wait_timeline_fence_index < wait_timeline_fence_count; ++wait_timeline_fence_index)
+		{
+			assert(NULL != brx_wait_timeline_fences[wait_timeline_fence_index]);
+			HRESULT hr_wait = this->m_upload_queue->Wait(static_cast<brx_d3d12_timeline_fence const *>(brx_wait_timeline_fences[wait_timeline_fence_index])->get_fence(), wait_values[wait_timeline_fence_index]);
+			assert(SUCCEEDED(hr_wait));
+		}
+
+		if (upload_command_buffer_count > 0U)
+		{
+			assert(upload_command_buffer_count <= g_d3d12_max_execute_command_list_count);
+			ID3D12CommandList *command_lists[g_d3d12_max_execute_command_list_count];
+			for (uint32_t upload_command_buffer_index = 0U; upload_command_buffer_index < upload_command_buffer_count; ++upload_command_buffer_index)
+			{
+				assert(NULL != brx_upload_command_buffers[upload_command_buffer_index]);
+				command_lists[upload_command_buffer_index] = static_cast<brx_d3d12_upload_command_buffer const *>(brx_upload_command_buffers[upload_command_buffer_index])->get_command_list();
+				assert(NULL != command_lists[upload_command_buffer_index]);
+			}
+
+			this->m_upload_queue->ExecuteCommandLists(upload_command_buffer_count, command_lists);
+		}
+
+		for (uint32_t signal_timeline_fence_index = 0U; signal_timeline_fence_index < signal_timeline_fence_count; ++signal_timeline_fence_index)
+		{
+			assert(NULL != brx_signal_timeline_fences[signal_timeline_fence_index]);
+			HRESULT hr_signal = this->m_upload_queue->Signal(static_cast<brx_d3d12_timeline_fence const *>(brx_signal_timeline_fences[signal_timeline_fence_index])->get_fence(), signal_values[signal_timeline_fence_index]);
+			assert(SUCCEEDED(hr_signal));
+		}
+	}
+	else
+	{
+		// the uploads have been performed by the host
+		assert(NULL == this->m_upload_queue);
+
+		for (uint32_t wait_timeline_fence_index = 0U; wait_timeline_fence_index < wait_timeline_fence_count; ++wait_timeline_fence_index)
+		{
+			assert(NULL != brx_wait_timeline_fences[wait_timeline_fence_index]);
+			HRESULT hr_set_event_on_completion = static_cast<brx_d3d12_timeline_fence const *>(brx_wait_timeline_fences[wait_timeline_fence_index])->get_fence()->SetEventOnCompletion(wait_values[wait_timeline_fence_index], NULL);
+			assert(SUCCEEDED(hr_set_event_on_completion));
+		}
+
+		for (uint32_t upload_command_buffer_index = 0U; upload_command_buffer_index < upload_command_buffer_count; ++upload_command_buffer_index)
+		{
+			assert(NULL == static_cast<brx_d3d12_upload_command_buffer const *>(brx_upload_command_buffers[upload_command_buffer_index])->get_command_list());
+		}
+
+		for (uint32_t signal_timeline_fence_index = 0U; signal_timeline_fence_index < signal_timeline_fence_count; ++signal_timeline_fence_index)
+		{
+			assert(NULL != brx_signal_timeline_fences[signal_timeline_fence_index]);
+			HRESULT hr_signal = static_cast<brx_d3d12_timeline_fence const *>(brx_signal_timeline_fences[signal_timeline_fence_index])->get_fence()->Signal(signal_values[signal_timeline_fence_index]);
+			assert(SUCCEEDED(hr_signal));
+		}
+	}
+}
+
+void brx_d3d12_upload_queue::signal_timeline_fence(brx_timeline_fence *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_timeline_fence);
+	ID3D12Fence *fence = static_cast<brx_d3d12_timeline_fence const *>(brx_timeline_fence)->get_fence();
+
+	if ((!this->m_uma) || this->m_support_ray_tracing)
+	{
+		HRESULT hr_signal = this->m_upload_queue->Signal(fence, value);
+		assert(SUCCEEDED(hr_signal));
+	}
+	else
+	{
+		// the uploads have been performed by the host
+		assert(NULL == this->m_upload_queue);
+
+		HRESULT hr_signal = fence->Signal(value);
+		assert(SUCCEEDED(hr_signal));
+	}
+}
+
+void brx_d3d12_upload_queue::wait_timeline_fence(brx_timeline_fence const *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_timeline_fence);
+	ID3D12Fence *fence = static_cast<brx_d3d12_timeline_fence const *>(brx_timeline_fence)->get_fence();
+
+	if ((!this->m_uma) || this->m_support_ray_tracing)
+	{
+		HRESULT hr_wait = this->m_upload_queue->Wait(fence, value);
+		assert(SUCCEEDED(hr_wait));
+	}
+	else
+	{
+		// the uploads are performed by the host, and thus the host waits
+		assert(NULL == this->m_upload_queue);
+
+		// the NULL event blocks until the value is reached
+		HRESULT hr_set_event_on_completion = fence->SetEventOnCompletion(value, NULL);
+		assert(SUCCEEDED(hr_set_event_on_completion));
+	}
+}
+
+brx_d3d12_compute_queue::brx_d3d12_compute_queue() : m_compute_queue(NULL)
+{
+}
+
+void brx_d3d12_compute_queue::init(ID3D12CommandQueue *compute_queue)
+{
+	assert(NULL == this->m_compute_queue);
+	this->m_compute_queue = compute_queue;
+}
+
+void brx_d3d12_compute_queue::uninit(ID3D12CommandQueue *compute_queue)
+{
+	assert(NULL != this->m_compute_queue);
+
+	assert(compute_queue == this->m_compute_queue);
+
+	this->m_compute_queue = NULL;
+}
+
+brx_d3d12_compute_queue::~brx_d3d12_compute_queue()
+{
+	assert(NULL == this->m_compute_queue);
+}
+
+void brx_d3d12_compute_queue::signal_timeline_fence(brx_timeline_fence *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_timeline_fence);
+	ID3D12Fence *fence = static_cast<brx_d3d12_timeline_fence const *>(brx_timeline_fence)->get_fence();
+
+	HRESULT hr_signal = this->m_compute_queue->Signal(fence, value);
+	assert(SUCCEEDED(hr_signal));
+}
+
+void brx_d3d12_compute_queue::wait_timeline_fence(brx_timeline_fence const *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_timeline_fence);
+	ID3D12Fence *fence = static_cast<brx_d3d12_timeline_fence const *>(brx_timeline_fence)->get_fence();
+
+	HRESULT hr_wait = this->m_compute_queue->Wait(fence, value);
+	assert(SUCCEEDED(hr_wait));
+}
+
+void brx_d3d12_compute_queue::submit_batch(uint32_t compute_command_buffer_count, brx_compute_command_buffer const *const *brx_compute_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *brx_wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *brx_signal_timeline_fences, uint64_t const *signal_values, brx_fence *brx_fence)
+{
+	for (uint32_t wait_timeline_fence_index = 0U; wait_timeline_fence_index < wait_timeline_fence_count; ++wait_timeline_fence_index)
+	{
+		assert(NULL != brx_wait_timeline_fences[wait_timeline_fence_index]);
+		HRESULT hr_wait = this->m_compute_queue->Wait(static_cast<brx_d3d12_timeline_fence const *>(brx_wait_timeline_fences[wait_timeline_fence_index])->get_fence(), wait_values[wait_timeline_fence_index]);
+		assert(SUCCEEDED(hr_wait));
+	}
+
+	if (compute_command_buffer_count > 0U)
+	{
+		assert(compute_command_buffer_count <= g_d3d12_max_execute_command_list_count);
+		ID3D12CommandList *command_lists[g_d3d12_max_execute_command_list_count];
+		for (uint32_t compute_command_buffer_index = 0U; compute_command_buffer_index < compute_command_buffer_count; ++compute_command_buffer_index)
+		{
+			assert(NULL != brx_compute_command_buffers[compute_command_buffer_index]);
+			command_lists[compute_command_buffer_index] = static_cast<brx_d3d12_compute_command_buffer const *>(brx_compute_command_buffers[compute_command_buffer_index])->get_command_list();
+		}
+
+		this->m_compute_queue->ExecuteCommandLists(compute_command_buffer_count, command_lists);
+	}
+
+	for (uint32_t signal_timeline_fence_index = 0U; signal_timeline_fence_index < signal_timeline_fence_count; ++signal_timeline_fence_index)
+	{
+		assert(NULL != brx_signal_timeline_fences[signal_timeline_fence_index]);
+		HRESULT hr_signal = this->m_compute_queue->Signal(static_cast<brx_d3d12_timeline_fence const *>(brx_signal_timeline_fences[signal_timeline_fence_index])->get_fence(), signal_values[signal_timeline_fence_index]);
+		assert(SUCCEEDED(hr_signal));
+	}
+
+	if (NULL != brx_fence)
+	{
+		HRESULT hr_signal = this->m_compute_queue->Signal(static_cast<brx_d3d12_fence const *>(brx_fence)->get_fence(), 1U);
+		assert(SUCCEEDED(hr_signal));
+	}
+}
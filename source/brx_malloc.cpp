@@ -16,11 +16,26 @@
 //
 
 #include "brx_malloc.h"
+#include "../include/brx_device.h"
 #include <stdlib.h>
 #include <memory.h>
 
+static PFN_brx_malloc_hook g_pfn_malloc_hook = NULL;
+static void *g_malloc_hook_user_data = NULL;
+
+extern "C" void brx_set_malloc_hook(PFN_brx_malloc_hook pfn_malloc_hook, void *user_data)
+{
+	g_pfn_malloc_hook = pfn_malloc_hook;
+	g_malloc_hook_user_data = user_data;
+}
+
 extern void *brx_malloc(size_t size, size_t alignment)
 {
+	if (NULL != g_pfn_malloc_hook)
+	{
+		g_pfn_malloc_hook(size, alignment, g_malloc_hook_user_data);
+	}
+
 #if defined(__GNUC__)
 	return aligned_alloc(alignment, size);
 #elif defined(_MSC_VER)
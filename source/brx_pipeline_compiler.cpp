@@ -0,0 +1,267 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_pipeline_compiler.h"
+#include "brx_malloc.h"
+#include <assert.h>
+#include <new>
+#include <algorithm>
+
+brx_pipeline_compilation_task::brx_pipeline_compilation_task() : m_completed(false)
+{
+}
+
+void brx_pipeline_compilation_task::set_completed()
+{
+	assert(!this->m_completed.load(std::memory_order_relaxed));
+	// the result of the "execute" is visible to the thread which observes the completion
+	this->m_completed.store(true, std::memory_order_release);
+}
+
+bool brx_pipeline_compilation_task::is_completed() const
+{
+	return this->m_completed.load(std::memory_order_acquire);
+}
+
+brx_graphics_pipeline_compilation_task::brx_graphics_pipeline_compilation_task(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation)
+	: m_render_pass(render_pass),
+	  m_pipeline_layout(pipeline_layout),
+	  m_vertex_shader_module_code(static_cast<uint8_t const *>(vertex_shader_module_code), static_cast<uint8_t const *>(vertex_shader_module_code) + vertex_shader_module_code_size),
+	  m_fragment_shader_module_code(static_cast<uint8_t const *>(fragment_shader_module_code), static_cast<uint8_t const *>(fragment_shader_module_code) + fragment_shader_module_code_size),
+	  m_vertex_bindings(vertex_bindings, vertex_bindings + vertex_binding_count),
+	  m_vertex_attributes(vertex_attributes, vertex_attributes + vertex_attribute_count),
+	  m_depth_enable(depth_enable),
+	  m_depth_compare_operation(depth_compare_operation),
+	  m_graphics_pipeline(NULL)
+{
+}
+
+void brx_graphics_pipeline_compilation_task::execute(brx_device const *device)
+{
+	assert(NULL == this->m_graphics_pipeline);
+	this->m_graphics_pipeline = device->create_graphics_pipeline(this->m_render_pass, this->m_pipeline_layout, this->m_vertex_shader_module_code.size(), this->m_vertex_shader_module_code.data(), this->m_fragment_shader_module_code.size(), this->m_fragment_shader_module_code.data(), static_cast<uint32_t>(this->m_vertex_bindings.size()), this->m_vertex_bindings.data(), static_cast<uint32_t>(this->m_vertex_attributes.size()), this->m_vertex_attributes.data(), this->m_depth_enable, this->m_depth_compare_operation);
+	assert(NULL != this->m_graphics_pipeline);
+}
+
+brx_graphics_pipeline *brx_graphics_pipeline_compilation_task::get_graphics_pipeline() const
+{
+	return this->m_graphics_pipeline;
+}
+
+brx_compute_pipeline_compilation_task::brx_compute_pipeline_compilation_task(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code)
+	: m_pipeline_layout(pipeline_layout),
+	  m_compute_shader_module_code(static_cast<uint8_t const *>(compute_shader_module_code), static_cast<uint8_t const *>(compute_shader_module_code) + compute_shader_module_code_size),
+	  m_compute_pipeline(NULL)
+{
+}
+
+void brx_compute_pipeline_compilation_task::execute(brx_device const *device)
+{
+	assert(NULL == this->m_compute_pipeline);
+	this->m_compute_pipeline = device->create_compute_pipeline(this->m_pipeline_layout, this->m_compute_shader_module_code.size(), this->m_compute_shader_module_code.data());
+	assert(NULL != this->m_compute_pipeline);
+}
+
+brx_compute_pipeline *brx_compute_pipeline_compilation_task::get_compute_pipeline() const
+{
+	return this->m_compute_pipeline;
+}
+
+brx_pipeline_compiler::brx_pipeline_compiler() : m_device(NULL), m_quit(false)
+{
+}
+
+void brx_pipeline_compiler::init(brx_device const *device)
+{
+	assert(NULL == this->m_device);
+	this->m_device = device;
+
+	assert(!this->m_quit);
+	assert(this->m_worker_threads.empty());
+}
+
+void brx_pipeline_compiler::uninit()
+{
+	{
+		std::unique_lock<std::mutex> lock(this->m_mutex);
+		// all compilations should have been waited by the caller
+		assert(this->m_pending_tasks.empty());
+		this->m_quit = true;
+	}
+	this->m_pending_condition.notify_all();
+
+	for (std::thread &worker_thread : this->m_worker_threads)
+	{
+		worker_thread.join();
+	}
+	this->m_worker_threads.clear();
+
+	this->m_quit = false;
+
+	assert(NULL != this->m_device);
+	this->m_device = NULL;
+}
+
+brx_pipeline_compiler::~brx_pipeline_compiler()
+{
+	assert(NULL == this->m_device);
+	assert(this->m_pending_tasks.empty());
+	assert(this->m_worker_threads.empty());
+}
+
+void brx_pipeline_compiler::push_task(brx_pipeline_compilation_task *task)
+{
+	{
+		std::unique_lock<std::mutex> lock(this->m_mutex);
+
+		if (this->m_worker_threads.empty())
+		{
+			// one hardware thread is reserved for the caller, which is usually the main thread
+			uint32_t const hardware_concurrency = std::thread::hardware_concurrency();
+			uint32_t const worker_thread_count = (hardware_concurrency > 2U) ? (hardware_concurrency - 1U) : 1U;
+
+			this->m_worker_threads.reserve(worker_thread_count);
+			for (uint32_t worker_thread_index = 0U; worker_thread_index < worker_thread_count; ++worker_thread_index)
+			{
+				this->m_worker_threads.emplace_back(&brx_pipeline_compiler::worker_main, this);
+			}
+		}
+
+		this->m_pending_tasks.push_back(task);
+	}
+	this->m_pending_condition.notify_one();
+}
+
+void brx_pipeline_compiler::wait_task(brx_pipeline_compilation_task *task)
+{
+	std::unique_lock<std::mutex> lock(this->m_mutex);
+
+	brx_vector<brx_pipeline_compilation_task *>::iterator const found = std::find(this->m_pending_tasks.begin(), this->m_pending_tasks.end(), task);
+	if (this->m_pending_tasks.end() != found)
+	{
+		// the task has not been picked by any worker thread, and it is faster to execute it on the waiting thread than to be blocked
+		this->m_pending_tasks.erase(found);
+		lock.unlock();
+
+		task->execute(this->m_device);
+		task->set_completed();
+	}
+	else
+	{
+		this->m_completed_condition.wait(lock, [task]() -> bool
+										 { return task->is_completed(); });
+	}
+}
+
+void brx_pipeline_compiler::worker_main()
+{
+	std::unique_lock<std::mutex> lock(this->m_mutex);
+
+	while (true)
+	{
+		this->m_pending_condition.wait(lock, [this]() -> bool
+									   { return this->m_quit || (!this->m_pending_tasks.empty()); });
+
+		if (this->m_pending_tasks.empty())
+		{
+			assert(this->m_quit);
+			break;
+		}
+
+		// first in first out
+		brx_pipeline_compilation_task *const task = this->m_pending_tasks.front();
+		this->m_pending_tasks.erase(this->m_pending_tasks.begin());
+		lock.unlock();
+
+		task->execute(this->m_device);
+
+		lock.lock();
+		// the completion is set under the lock to avoid the lost wakeup of the "wait_task"
+		task->set_completed();
+		this->m_completed_condition.notify_all();
+	}
+}
+
+brx_graphics_pipeline_compilation *brx_pipeline_compiler::create_graphics_pipeline_async(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation)
+{
+	void *new_graphics_pipeline_compilation_task_base = brx_malloc(sizeof(brx_graphics_pipeline_compilation_task), alignof(brx_graphics_pipeline_compilation_task));
+	assert(NULL != new_graphics_pipeline_compilation_task_base);
+
+	brx_graphics_pipeline_compilation_task *new_graphics_pipeline_compilation_task = new (new_graphics_pipeline_compilation_task_base) brx_graphics_pipeline_compilation_task{render_pass, pipeline_layout, vertex_shader_module_code_size, vertex_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, vertex_binding_count, vertex_bindings, vertex_attribute_count, vertex_attributes, depth_enable, depth_compare_operation};
+
+	this->push_task(new_graphics_pipeline_compilation_task);
+
+	return new_graphics_pipeline_compilation_task;
+}
+
+bool brx_pipeline_compiler::is_graphics_pipeline_compilation_completed(brx_graphics_pipeline_compilation const *wrapped_graphics_pipeline_compilation) const
+{
+	assert(NULL != wrapped_graphics_pipeline_compilation);
+	brx_graphics_pipeline_compilation_task const *unwrapped_graphics_pipeline_compilation_task = static_cast<brx_graphics_pipeline_compilation_task const *>(wrapped_graphics_pipeline_compilation);
+
+	return unwrapped_graphics_pipeline_compilation_task->is_completed();
+}
+
+brx_graphics_pipeline *brx_pipeline_compiler::wait_graphics_pipeline_compilation(brx_graphics_pipeline_compilation *wrapped_graphics_pipeline_compilation)
+{
+	assert(NULL != wrapped_graphics_pipeline_compilation);
+	brx_graphics_pipeline_compilation_task *delete_graphics_pipeline_compilation_task = static_cast<brx_graphics_pipeline_compilation_task *>(wrapped_graphics_pipeline_compilation);
+
+	this->wait_task(delete_graphics_pipeline_compilation_task);
+
+	brx_graphics_pipeline *const graphics_pipeline = delete_graphics_pipeline_compilation_task->get_graphics_pipeline();
+
+	delete_graphics_pipeline_compilation_task->~brx_graphics_pipeline_compilation_task();
+	brx_free(delete_graphics_pipeline_compilation_task);
+
+	return graphics_pipeline;
+}
+
+brx_compute_pipeline_compilation *brx_pipeline_compiler::create_compute_pipeline_async(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code)
+{
+	void *new_compute_pipeline_compilation_task_base = brx_malloc(sizeof(brx_compute_pipeline_compilation_task), alignof(brx_compute_pipeline_compilation_task));
+	assert(NULL != new_compute_pipeline_compilation_task_base);
+
+	brx_compute_pipeline_compilation_task *new_compute_pipeline_compilation_task = new (new_compute_pipeline_compilation_task_base) brx_compute_pipeline_compilation_task{pipeline_layout, compute_shader_module_code_size, compute_shader_module_code};
+
+	this->push_task(new_compute_pipeline_compilation_task);
+
+	return new_compute_pipeline_compilation_task;
+}
+
+bool brx_pipeline_compiler::is_compute_pipeline_compilation_completed(brx_compute_pipeline_compilation const *wrapped_compute_pipeline_compilation) const
+{
+	assert(NULL != wrapped_compute_pipeline_compilation);
+	brx_compute_pipeline_compilation_task const *unwrapped_compute_pipeline_compilation_task = static_cast<brx_compute_pipeline_compilation_task const *>(wrapped_compute_pipeline_compilation);
+
+	return unwrapped_compute_pipeline_compilation_task->is_completed();
+}
+
+brx_compute_pipeline *brx_pipeline_compiler::wait_compute_pipeline_compilation(brx_compute_pipeline_compilation *wrapped_compute_pipeline_compilation)
+{
+	assert(NULL != wrapped_compute_pipeline_compilation);
+	brx_compute_pipeline_compilation_task *delete_compute_pipeline_compilation_task = static_cast<brx_compute_pipeline_compilation_task *>(wrapped_compute_pipeline_compilation);
+
+	this->wait_task(delete_compute_pipeline_compilation_task);
+
+	brx_compute_pipeline *const compute_pipeline = delete_compute_pipeline_compilation_task->get_compute_pipeline();
+
+	delete_compute_pipeline_compilation_task->~brx_compute_pipeline_compilation_task();
+	brx_free(delete_compute_pipeline_compilation_task);
+
+	return compute_pipeline;
+}
@@ -0,0 +1,102 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_PIPELINE_COMPILER_H_
+#define _BRX_PIPELINE_COMPILER_H_ 1
+
+#include "../include/brx_device.h"
+#include "brx_vector.h"
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+class brx_pipeline_compilation_task
+{
+	// written by the worker thread and read by the polling thread without the lock
+	std::atomic<bool> m_completed;
+
+public:
+	brx_pipeline_compilation_task();
+	virtual void execute(brx_device const *device) = 0;
+	void set_completed();
+	bool is_completed() const;
+};
+
+class brx_graphics_pipeline_compilation_task : public brx_graphics_pipeline_compilation, public brx_pipeline_compilation_task
+{
+	// the shader code and the vertex layout are copied since the caller may release them before the compilation is completed
+	brx_render_pass const *m_render_pass;
+	brx_pipeline_layout const *m_pipeline_layout;
+	brx_vector<uint8_t> m_vertex_shader_module_code;
+	brx_vector<uint8_t> m_fragment_shader_module_code;
+	brx_vector<BRX_GRAPHICS_PIPELINE_VERTEX_BINDING> m_vertex_bindings;
+	brx_vector<BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE> m_vertex_attributes;
+	bool m_depth_enable;
+	BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION m_depth_compare_operation;
+	brx_graphics_pipeline *m_graphics_pipeline;
+
+public:
+	brx_graphics_pipeline_compilation_task(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation);
+	void execute(brx_device const *device) override;
+	brx_graphics_pipeline *get_graphics_pipeline() const;
+};
+
+class brx_compute_pipeline_compilation_task : public brx_compute_pipeline_compilation, public brx_pipeline_compilation_task
+{
+	brx_pipeline_layout const *m_pipeline_layout;
+	brx_vector<uint8_t> m_compute_shader_module_code;
+	brx_compute_pipeline *m_compute_pipeline;
+
+public:
+	brx_compute_pipeline_compilation_task(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code);
+	void execute(brx_device const *device) override;
+	brx_compute_pipeline *get_compute_pipeline() const;
+};
+
+// the pipelines are created by the synchronous "create_graphics_pipeline" and "create_compute_pipeline" of the device, which are thread-safe for both Vulkan and D3D12
+class brx_pipeline_compiler
+{
+	brx_device const *m_device;
+
+	std::mutex m_mutex;
+	std::condition_variable m_pending_condition;
+	std::condition_variable m_completed_condition;
+	brx_vector<brx_pipeline_compilation_task *> m_pending_tasks;
+	bool m_quit;
+
+	// the worker threads are not created until the first asynchronous compilation
+	brx_vector<std::thread> m_worker_threads;
+
+	void push_task(brx_pipeline_compilation_task *task);
+	void wait_task(brx_pipeline_compilation_task *task);
+	void worker_main();
+
+public:
+	brx_pipeline_compiler();
+	void init(brx_device const *device);
+	void uninit();
+	~brx_pipeline_compiler();
+	brx_graphics_pipeline_compilation *create_graphics_pipeline_async(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation);
+	bool is_graphics_pipeline_compilation_completed(brx_graphics_pipeline_compilation const *graphics_pipeline_compilation) const;
+	brx_graphics_pipeline *wait_graphics_pipeline_compilation(brx_graphics_pipeline_compilation *graphics_pipeline_compilation);
+	brx_compute_pipeline_compilation *create_compute_pipeline_async(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code);
+	bool is_compute_pipeline_compilation_completed(brx_compute_pipeline_compilation const *compute_pipeline_compilation) const;
+	brx_compute_pipeline *wait_compute_pipeline_compilation(brx_compute_pipeline_compilation *compute_pipeline_compilation);
+};
+
+#endif
@@ -0,0 +1,405 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_staging_upload_ring.h"
+#include "brx_align_up.h"
+#include "brx_malloc.h"
+#include <assert.h>
+#include <new>
+#include <algorithm>
+
+static inline void brx_staging_upload_ring_create_chunk(brx_device const *device, uint32_t size, brx_staging_upload_ring_chunk *out_chunk)
+{
+	// the staging upload buffer is persistently mapped
+	out_chunk->staging_upload_buffer = device->create_staging_upload_buffer(size);
+	assert(NULL != out_chunk->staging_upload_buffer);
+	out_chunk->host_memory_range_base = static_cast<uint8_t *>(out_chunk->staging_upload_buffer->get_host_memory_range_base());
+	out_chunk->size = size;
+	out_chunk->head_offset = 0U;
+	out_chunk->tail_offset = 0U;
+	out_chunk->used_size = 0U;
+	out_chunk->open_batch_size = 0U;
+	assert(out_chunk->in_flight_batches.empty());
+}
+
+static inline void brx_staging_upload_ring_destroy_chunk(brx_device const *device, brx_staging_upload_ring_chunk *chunk)
+{
+	device->destroy_staging_upload_buffer(chunk->staging_upload_buffer);
+	chunk->staging_upload_buffer = NULL;
+	chunk->host_memory_range_base = NULL;
+}
+
+brx_staging_upload_ring_allocator::brx_staging_upload_ring_allocator() : m_offset_alignment(0U), m_high_water_mark(0U)
+{
+}
+
+void brx_staging_upload_ring_allocator::init(brx_device const *device, uint32_t initial_size)
+{
+	// the range may be used as the source of either the buffer or the image
+	this->m_offset_alignment = std::max(device->get_staging_upload_buffer_offset_alignment(), device->get_staging_upload_buffer_row_pitch_alignment());
+	assert(0U == (this->m_offset_alignment & (this->m_offset_alignment - 1U)));
+
+	assert(this->m_chunks.empty());
+	this->m_chunks.emplace_back();
+	brx_staging_upload_ring_create_chunk(device, brx_align_up(std::max(initial_size, 1U), this->m_offset_alignment), &this->m_chunks.back());
+
+	this->m_high_water_mark = 0U;
+}
+
+void brx_staging_upload_ring_allocator::uninit(brx_device const *device)
+{
+	// the ring should NOT be destroyed until the GPU has finished all the uploads from it
+	for (brx_staging_upload_ring_chunk &chunk : this->m_chunks)
+	{
+		brx_staging_upload_ring_destroy_chunk(device, &chunk);
+	}
+	this->m_chunks.clear();
+}
+
+brx_staging_upload_ring_allocator::~brx_staging_upload_ring_allocator()
+{
+	assert(this->m_chunks.empty());
+}
+
+bool brx_staging_upload_ring_allocator::alloc_from_chunk(brx_staging_upload_ring_chunk *chunk, uint32_t size, uint32_t *out_offset)
+{
+	if (0U == chunk->used_size)
+	{
+		chunk->head_offset = 0U;
+		chunk->tail_offset = 0U;
+	}
+
+	uint32_t const aligned_head_offset = brx_align_up(chunk->head_offset, this->m_offset_alignment);
+
+	uint32_t offset;
+	uint32_t consumed_size;
+	if ((0U == chunk->used_size) || (chunk->head_offset > chunk->tail_offset))
+	{
+		if ((aligned_head_offset <= chunk->size) && (size <= (chunk->size - aligned_head_offset)))
+		{
+			offset = aligned_head_offset;
+			consumed_size = (aligned_head_offset + size) - chunk->head_offset;
+		}
+		else if (size <= chunk->tail_offset)
+		{
+			// the end of the chunk is wasted until the batch which wraps around is retired
+			offset = 0U;
+			consumed_size = (chunk->size - chunk->head_offset) + size;
+		}
+		else
+		{
+			return false;
+		}
+	}
+	else
+	{
+		if ((aligned_head_offset <= chunk->tail_offset) && (size <= (chunk->tail_offset - aligned_head_offset)))
+		{
+			offset = aligned_head_offset;
+			consumed_size = (aligned_head_offset + size) - chunk->head_offset;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	chunk->head_offset = offset + size;
+	chunk->used_size += consumed_size;
+	chunk->open_batch_size += consumed_size;
+
+	(*out_offset) = offset;
+	return true;
+}
+
+void *brx_staging_upload_ring_allocator::alloc(brx_device const *device, uint32_t size, brx_staging_upload_buffer **out_staging_upload_buffer, uint64_t *out_offset)
+{
+	assert(size > 0U);
+	assert(!this->m_chunks.empty());
+
+	// the batches of the timeline fences are retired as soon as they are completed, and thus the ring does NOT grow only because the "wait_for_fence" has NOT been called yet
+	this->poll_timeline_fences(device);
+
+	uint32_t offset = 0U;
+	if (!this->alloc_from_chunk(&this->m_chunks.back(), size, &offset))
+	{
+		// grow under pressure instead of waiting for the in flight batches
+		assert(this->m_chunks.back().size <= (UINT32_MAX / 2U));
+		uint32_t const new_chunk_size = std::max(this->m_chunks.back().size * 2U, brx_align_up(size, this->m_offset_alignment));
+
+		if (0U == this->m_chunks.back().used_size)
+		{
+			brx_staging_upload_ring_destroy_chunk(device, &this->m_chunks.back());
+			this->m_chunks.pop_back();
+		}
+
+		this->m_chunks.emplace_back();
+		brx_staging_upload_ring_create_chunk(device, new_chunk_size, &this->m_chunks.back());
+
+		bool const res_alloc_from_chunk = this->alloc_from_chunk(&this->m_chunks.back(), size, &offset);
+		assert(res_alloc_from_chunk);
+		(void)res_alloc_from_chunk;
+	}
+
+	uint64_t used_size = 0U;
+	for (brx_staging_upload_ring_chunk const &chunk : this->m_chunks)
+	{
+		used_size += chunk.used_size;
+	}
+	this->m_high_water_mark = std::max(this->m_high_water_mark, used_size);
+
+	(*out_staging_upload_buffer) = this->m_chunks.back().staging_upload_buffer;
+	(*out_offset) = offset;
+	return this->m_chunks.back().host_memory_range_base + offset;
+}
+
+void brx_staging_upload_ring_allocator::submit_batch(brx_fence const *fence, brx_timeline_fence const *timeline_fence, uint64_t timeline_value)
+{
+	for (brx_staging_upload_ring_chunk &chunk : this->m_chunks)
+	{
+		if (chunk.open_batch_size > 0U)
+		{
+			chunk.in_flight_batches.push_back(brx_staging_upload_ring_batch{fence, timeline_fence, timeline_value, chunk.head_offset, chunk.open_batch_size});
+			chunk.open_batch_size = 0U;
+		}
+	}
+}
+
+void brx_staging_upload_ring_allocator::submit(brx_fence const *fence)
+{
+	assert(NULL != fence);
+	this->submit_batch(fence, NULL, 0U);
+}
+
+void brx_staging_upload_ring_allocator::submit(brx_timeline_fence const *timeline_fence, uint64_t timeline_value)
+{
+	assert(NULL != timeline_fence);
+	this->submit_batch(NULL, timeline_fence, timeline_value);
+}
+
+void brx_staging_upload_ring_allocator::retire(brx_device const *device, brx_fence const *fence)
+{
+	for (brx_staging_upload_ring_chunk &chunk : this->m_chunks)
+	{
+		size_t last_fence_batch_count = 0U;
+		for (size_t batch_index = 0U; batch_index < chunk.in_flight_batches.size(); ++batch_index)
+		{
+			if (fence == chunk.in_flight_batches[batch_index].fence)
+			{
+				last_fence_batch_count = batch_index + 1U;
+			}
+		}
+
+		// the fences are signaled by the graphics queue in the FIFO order, and thus the batches of the other fences before the last batch of this fence are completed as well
+		// the timeline fences may be signaled by the other queues, and thus the retiring stops at the first batch of which the timeline fence has NOT reached the value
+		brx_timeline_fence const *polled_timeline_fence = NULL;
+		uint64_t polled_completed_value = 0U;
+		size_t retired_batch_count = 0U;
+		for (size_t batch_index = 0U; batch_index < last_fence_batch_count; ++batch_index)
+		{
+			brx_staging_upload_ring_batch const &batch = chunk.in_flight_batches[batch_index];
+
+			if (NULL != batch.timeline_fence)
+			{
+				if (polled_timeline_fence != batch.timeline_fence)
+				{
+					polled_timeline_fence = batch.timeline_fence;
+					polled_completed_value = device->get_timeline_fence_completed_value(batch.timeline_fence);
+				}
+
+				if (polled_completed_value < batch.timeline_value)
+				{
+					break;
+				}
+			}
+
+			assert(chunk.used_size >= batch.size);
+			chunk.used_size -= batch.size;
+			chunk.tail_offset = batch.end_offset;
+			++retired_batch_count;
+		}
+
+		chunk.in_flight_batches.erase(chunk.in_flight_batches.begin(), chunk.in_flight_batches.begin() + retired_batch_count);
+	}
+
+	this->destroy_retired_chunks(device);
+}
+
+void brx_staging_upload_ring_allocator::poll_timeline_fences(brx_device const *device)
+{
+	for (brx_staging_upload_ring_chunk &chunk : this->m_chunks)
+	{
+		// the batches are retired in the FIFO order, and thus the polling stops at the first batch which is NOT completed (or which is associated with the fence)
+		brx_timeline_fence const *polled_timeline_fence = NULL;
+		uint64_t polled_completed_value = 0U;
+		size_t retired_batch_count = 0U;
+		for (brx_staging_upload_ring_batch const &batch : chunk.in_flight_batches)
+		{
+			if (NULL == batch.timeline_fence)
+			{
+				break;
+			}
+
+			// the batches of the same timeline fence are usually adjacent, and the completed value is queried only once for them
+			if (polled_timeline_fence != batch.timeline_fence)
+			{
+				polled_timeline_fence = batch.timeline_fence;
+				polled_completed_value = device->get_timeline_fence_completed_value(batch.timeline_fence);
+			}
+
+			if (polled_completed_value < batch.timeline_value)
+			{
+				break;
+			}
+
+			assert(chunk.used_size >= batch.size);
+			chunk.used_size -= batch.size;
+			chunk.tail_offset = batch.end_offset;
+			++retired_batch_count;
+		}
+
+		chunk.in_flight_batches.erase(chunk.in_flight_batches.begin(), chunk.in_flight_batches.begin() + retired_batch_count);
+	}
+
+	this->destroy_retired_chunks(device);
+}
+
+void brx_staging_upload_ring_allocator::destroy_retired_chunks(brx_device const *device)
+{
+	// the last chunk is always kept to allocate from
+	for (size_t chunk_index = this->m_chunks.size() - 1U; chunk_index > 0U; --chunk_index)
+	{
+		if (0U == this->m_chunks[chunk_index - 1U].used_size)
+		{
+			brx_staging_upload_ring_destroy_chunk(device, &this->m_chunks[chunk_index - 1U]);
+			this->m_chunks.erase(this->m_chunks.begin() + (chunk_index - 1U));
+		}
+	}
+}
+
+BRX_STAGING_UPLOAD_RING_STATISTICS brx_staging_upload_ring_allocator::get_statistics() const
+{
+	BRX_STAGING_UPLOAD_RING_STATISTICS statistics = {0U, 0U, this->m_high_water_mark};
+	for (brx_staging_upload_ring_chunk const &chunk : this->m_chunks)
+	{
+		statistics.capacity += chunk.size;
+		statistics.used_size += chunk.used_size;
+	}
+	return statistics;
+}
+
+brx_staging_upload_ring_manager::brx_staging_upload_ring_manager() : m_device(NULL)
+{
+}
+
+void brx_staging_upload_ring_manager::init(brx_device const *device)
+{
+	assert(NULL == this->m_device);
+	this->m_device = device;
+}
+
+void brx_staging_upload_ring_manager::uninit()
+{
+	assert(this->m_rings.empty());
+
+	assert(NULL != this->m_device);
+	this->m_device = NULL;
+}
+
+brx_staging_upload_ring_manager::~brx_staging_upload_ring_manager()
+{
+	assert(NULL == this->m_device);
+}
+
+brx_staging_upload_ring *brx_staging_upload_ring_manager::create_staging_upload_ring(uint32_t initial_size)
+{
+	void *new_ring_base = brx_malloc(sizeof(brx_staging_upload_ring_allocator), alignof(brx_staging_upload_ring_allocator));
+	assert(NULL != new_ring_base);
+
+	brx_staging_upload_ring_allocator *new_ring = new (new_ring_base) brx_staging_upload_ring_allocator{};
+	new_ring->init(this->m_device, initial_size);
+
+	{
+		std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+		this->m_rings.push_back(new_ring);
+	}
+
+	return new_ring;
+}
+
+void *brx_staging_upload_ring_manager::alloc_staging_upload_ring_range(brx_staging_upload_ring *wrapped_staging_upload_ring, uint32_t size, brx_staging_upload_buffer **out_staging_upload_buffer, uint64_t *out_offset)
+{
+	assert(NULL != wrapped_staging_upload_ring);
+	assert(NULL != out_staging_upload_buffer);
+	assert(NULL != out_offset);
+
+	std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+	return static_cast<brx_staging_upload_ring_allocator *>(wrapped_staging_upload_ring)->alloc(this->m_device, size, out_staging_upload_buffer, out_offset);
+}
+
+void brx_staging_upload_ring_manager::submit_staging_upload_ring(brx_staging_upload_ring *wrapped_staging_upload_ring, brx_fence const *fence)
+{
+	assert(NULL != wrapped_staging_upload_ring);
+
+	std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+	static_cast<brx_staging_upload_ring_allocator *>(wrapped_staging_upload_ring)->submit(fence);
+}
+
+void brx_staging_upload_ring_manager::submit_staging_upload_ring(brx_staging_upload_ring *wrapped_staging_upload_ring, brx_timeline_fence const *timeline_fence, uint64_t value)
+{
+	assert(NULL != wrapped_staging_upload_ring);
+
+	std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+	static_cast<brx_staging_upload_ring_allocator *>(wrapped_staging_upload_ring)->submit(timeline_fence, value);
+}
+
+BRX_STAGING_UPLOAD_RING_STATISTICS brx_staging_upload_ring_manager::get_staging_upload_ring_statistics(brx_staging_upload_ring const *wrapped_staging_upload_ring)
+{
+	assert(NULL != wrapped_staging_upload_ring);
+
+	std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+	return static_cast<brx_staging_upload_ring_allocator const *>(wrapped_staging_upload_ring)->get_statistics();
+}
+
+void brx_staging_upload_ring_manager::destroy_staging_upload_ring(brx_staging_upload_ring *wrapped_staging_upload_ring)
+{
+	assert(NULL != wrapped_staging_upload_ring);
+	brx_staging_upload_ring_allocator *delete_ring = static_cast<brx_staging_upload_ring_allocator *>(wrapped_staging_upload_ring);
+
+	{
+		std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+		auto const found_ring = std::find(this->m_rings.begin(), this->m_rings.end(), delete_ring);
+		assert(this->m_rings.end() != found_ring);
+		this->m_rings.erase(found_ring);
+	}
+
+	delete_ring->uninit(this->m_device);
+
+	delete_ring->~brx_staging_upload_ring_allocator();
+	brx_free(delete_ring);
+}
+
+void brx_staging_upload_ring_manager::retire_fence(brx_fence const *fence)
+{
+	assert(NULL != fence);
+
+	std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+	for (brx_staging_upload_ring_allocator *ring : this->m_rings)
+	{
+		ring->retire(this->m_device, fence);
+	}
+}
@@ -0,0 +1,96 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_STAGING_UPLOAD_RING_H_
+#define _BRX_STAGING_UPLOAD_RING_H_ 1
+
+#include "../include/brx_device.h"
+#include "brx_vector.h"
+#include <mutex>
+
+struct brx_staging_upload_ring_batch
+{
+	// the batch is retired either when the fence is waited by the "wait_for_fence", or when the completed value of the timeline fence, which is polled by the allocation, reaches the value
+	// exactly one of the "fence" and the "timeline_fence" is NOT NULL
+	brx_fence const *fence;
+	brx_timeline_fence const *timeline_fence;
+	uint64_t timeline_value;
+	uint32_t end_offset;
+	uint32_t size;
+};
+
+struct brx_staging_upload_ring_chunk
+{
+	brx_staging_upload_buffer *staging_upload_buffer;
+	uint8_t *host_memory_range_base;
+	uint32_t size;
+	// the ranges are allocated at the head and retired from the tail in the FIFO order
+	uint32_t head_offset;
+	uint32_t tail_offset;
+	uint32_t used_size;
+	// the ranges allocated since the last "submit_staging_upload_ring"
+	uint32_t open_batch_size;
+	brx_vector<brx_staging_upload_ring_batch> in_flight_batches;
+};
+
+class brx_staging_upload_ring_allocator : public brx_staging_upload_ring
+{
+	uint32_t m_offset_alignment;
+	// only the last chunk is used to allocate, and the previous chunks are destroyed when all their batches are retired
+	brx_vector<brx_staging_upload_ring_chunk> m_chunks;
+	uint64_t m_high_water_mark;
+
+	bool alloc_from_chunk(brx_staging_upload_ring_chunk *chunk, uint32_t size, uint32_t *out_offset);
+	void submit_batch(brx_fence const *fence, brx_timeline_fence const *timeline_fence, uint64_t timeline_value);
+	void destroy_retired_chunks(brx_device const *device);
+
+public:
+	brx_staging_upload_ring_allocator();
+	void init(brx_device const *device, uint32_t initial_size);
+	void uninit(brx_device const *device);
+	~brx_staging_upload_ring_allocator();
+	void *alloc(brx_device const *device, uint32_t size, brx_staging_upload_buffer **out_staging_upload_buffer, uint64_t *out_offset);
+	void submit(brx_fence const *fence);
+	void submit(brx_timeline_fence const *timeline_fence, uint64_t timeline_value);
+	void retire(brx_device const *device, brx_fence const *fence);
+	void poll_timeline_fences(brx_device const *device);
+	BRX_STAGING_UPLOAD_RING_STATISTICS get_statistics() const;
+};
+
+// the rings are shared by the streaming threads, and are retired by the "wait_for_fence" of the device or by polling the timeline fences when allocating
+class brx_staging_upload_ring_manager
+{
+	brx_device const *m_device;
+
+	std::mutex m_mutex;
+	brx_vector<brx_staging_upload_ring_allocator *> m_rings;
+
+public:
+	brx_staging_upload_ring_manager();
+	void init(brx_device const *device);
+	void uninit();
+	~brx_staging_upload_ring_manager();
+	brx_staging_upload_ring *create_staging_upload_ring(uint32_t initial_size);
+	void *alloc_staging_upload_ring_range(brx_staging_upload_ring *staging_upload_ring, uint32_t size, brx_staging_upload_buffer **out_staging_upload_buffer, uint64_t *out_offset);
+	void submit_staging_upload_ring(brx_staging_upload_ring *staging_upload_ring, brx_fence const *fence);
+	void submit_staging_upload_ring(brx_staging_upload_ring *staging_upload_ring, brx_timeline_fence const *timeline_fence, uint64_t value);
+	BRX_STAGING_UPLOAD_RING_STATISTICS get_staging_upload_ring_statistics(brx_staging_upload_ring const *staging_upload_ring);
+	void destroy_staging_upload_ring(brx_staging_upload_ring *staging_upload_ring);
+	void retire_fence(brx_fence const *fence);
+};
+
+#endif
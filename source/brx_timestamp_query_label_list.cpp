@@ -0,0 +1,149 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_timestamp_query_label_list.h"
+#include <cstring>
+#include <assert.h>
+
+brx_timestamp_query_label_list::brx_timestamp_query_label_list() : m_query_count(0U), m_used_query_count(0U)
+{
+}
+
+void brx_timestamp_query_label_list::init(uint32_t query_count)
+{
+	assert(0U == this->m_query_count);
+	this->m_query_count = query_count;
+	this->m_used_query_count = 0U;
+
+	this->m_timestamps.resize(query_count);
+}
+
+void brx_timestamp_query_label_list::uninit()
+{
+	this->m_query_count = 0U;
+	this->m_used_query_count = 0U;
+
+	this->m_label_names.clear();
+	this->m_labels.clear();
+	this->m_open_label_indices.clear();
+	this->m_timestamps.clear();
+	this->m_label_timings.clear();
+}
+
+brx_timestamp_query_label_list::~brx_timestamp_query_label_list()
+{
+	assert(0U == this->m_query_count);
+}
+
+void brx_timestamp_query_label_list::reset()
+{
+	this->m_used_query_count = 0U;
+
+	this->m_label_names.clear();
+	this->m_labels.clear();
+	this->m_open_label_indices.clear();
+	this->m_label_timings.clear();
+}
+
+bool brx_timestamp_query_label_list::begin_label(char const *label_name, uint32_t *out_query_index)
+{
+	assert(NULL != label_name);
+	assert(NULL != out_query_index);
+
+	// both the begin and the end timestamps are reserved here, and thus the "end_label" never fails for the timed label
+	if ((this->m_query_count - this->m_used_query_count) >= 2U)
+	{
+		uint32_t const name_offset = static_cast<uint32_t>(this->m_label_names.size());
+		size_t const name_length = std::strlen(label_name);
+		this->m_label_names.resize(name_offset + name_length + 1U);
+		std::memcpy(&this->m_label_names[name_offset], label_name, name_length + 1U);
+
+		uint32_t const label_index = static_cast<uint32_t>(this->m_labels.size());
+		this->m_labels.push_back(label{name_offset, static_cast<uint32_t>(this->m_open_label_indices.size()), this->m_used_query_count, static_cast<uint32_t>(-1)});
+		this->m_open_label_indices.push_back(label_index);
+
+		(*out_query_index) = this->m_used_query_count;
+		this->m_used_query_count += 2U;
+		return true;
+	}
+	else
+	{
+		this->m_open_label_indices.push_back(static_cast<uint32_t>(-1));
+		return false;
+	}
+}
+
+bool brx_timestamp_query_label_list::end_label(uint32_t *out_query_index)
+{
+	assert(NULL != out_query_index);
+
+	// the "end_debug_utils_label" should match the "begin_debug_utils_label"
+	assert(this->m_open_label_indices.size() > 0U);
+	uint32_t const label_index = this->m_open_label_indices.back();
+	this->m_open_label_indices.pop_back();
+
+	if (static_cast<uint32_t>(-1) != label_index)
+	{
+		assert(label_index < this->m_labels.size());
+		assert(static_cast<uint32_t>(-1) == this->m_labels[label_index].end_query_index);
+		this->m_labels[label_index].end_query_index = this->m_labels[label_index].begin_query_index + 1U;
+
+		(*out_query_index) = this->m_labels[label_index].end_query_index;
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+uint32_t brx_timestamp_query_label_list::get_used_query_count() const
+{
+	return this->m_used_query_count;
+}
+
+uint64_t *brx_timestamp_query_label_list::get_timestamps()
+{
+	return this->m_timestamps.data();
+}
+
+void brx_timestamp_query_label_list::resolve(double timestamp_period, uint32_t *out_label_timing_count, BRX_TIMESTAMP_LABEL_TIMING const **out_label_timings)
+{
+	assert(NULL != out_label_timing_count);
+	assert(NULL != out_label_timings);
+
+	// the label regions should be closed before the command buffer is submitted
+	assert(0U == this->m_open_label_indices.size());
+
+	this->m_label_timings.resize(this->m_labels.size());
+
+	for (size_t label_index = 0U; label_index < this->m_labels.size(); ++label_index)
+	{
+		label const &timed_label = this->m_labels[label_index];
+		assert(timed_label.end_query_index < this->m_used_query_count);
+
+		uint64_t const begin_timestamp = this->m_timestamps[timed_label.begin_query_index];
+		uint64_t const end_timestamp = this->m_timestamps[timed_label.end_query_index];
+
+		this->m_label_timings[label_index].label_name = &this->m_label_names[timed_label.name_offset];
+		this->m_label_timings[label_index].depth = timed_label.depth;
+		this->m_label_timings[label_index].gpu_milliseconds = (end_timestamp >= begin_timestamp) ? (static_cast<double>(end_timestamp - begin_timestamp) * timestamp_period) : 0.0;
+	}
+
+	(*out_label_timing_count) = static_cast<uint32_t>(this->m_label_timings.size());
+	(*out_label_timings) = this->m_label_timings.data();
+}
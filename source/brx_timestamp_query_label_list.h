@@ -0,0 +1,60 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_TIMESTAMP_QUERY_LABEL_LIST_H_
+#define _BRX_TIMESTAMP_QUERY_LABEL_LIST_H_ 1
+
+#include "../include/brx_device.h"
+#include "brx_vector.h"
+
+// the backend independent bookkeeping of the debug utils label regions timed by the timestamp query pool
+class brx_timestamp_query_label_list
+{
+	struct label
+	{
+		uint32_t name_offset;
+		uint32_t depth;
+		uint32_t begin_query_index;
+		uint32_t end_query_index;
+	};
+
+	uint32_t m_query_count;
+	uint32_t m_used_query_count;
+	// the label names are copied, since the strings passed to the "begin_debug_utils_label" are usually temporary
+	brx_vector<char> m_label_names;
+	brx_vector<label> m_labels;
+	// the index of the label which is NOT timed is "-1"
+	brx_vector<uint32_t> m_open_label_indices;
+	brx_vector<uint64_t> m_timestamps;
+	brx_vector<BRX_TIMESTAMP_LABEL_TIMING> m_label_timings;
+
+public:
+	brx_timestamp_query_label_list();
+	void init(uint32_t query_count);
+	void uninit();
+	~brx_timestamp_query_label_list();
+	void reset();
+	// false is returned when the pool is exhausted, and thus the timestamp should NOT be written
+	bool begin_label(char const *label_name, uint32_t *out_query_index);
+	bool end_label(uint32_t *out_query_index);
+	uint32_t get_used_query_count() const;
+	// the storage of the timestamps of the used queries, which should be filled before the "resolve"
+	uint64_t *get_timestamps();
+	void resolve(double timestamp_period, uint32_t *out_label_timing_count, BRX_TIMESTAMP_LABEL_TIMING const **out_label_timings);
+};
+
+#endif
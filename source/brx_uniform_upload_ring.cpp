@@ -0,0 +1,108 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_uniform_upload_ring.h"
+#include "brx_align_up.h"
+#include <assert.h>
+#include <algorithm>
+
+// the allocations of different render threads never share the same cache line
+static constexpr uint32_t const g_uniform_upload_ring_cache_line_size = 64U;
+
+brx_uniform_upload_ring_allocator::brx_uniform_upload_ring_allocator() : m_uniform_upload_buffer(NULL), m_host_memory_range_base(NULL), m_offset_alignment(0U), m_frame_count(0U), m_frame_size(0U), m_frame_index(0U), m_frame_offset(0U)
+{
+}
+
+void brx_uniform_upload_ring_allocator::init(brx_device const *device, uint32_t min_uniform_buffer_offset_alignment, uint32_t frame_count, uint32_t frame_size)
+{
+	assert(frame_count > 0U);
+	assert(frame_size > 0U);
+
+	this->m_offset_alignment = std::max(min_uniform_buffer_offset_alignment, g_uniform_upload_ring_cache_line_size);
+	assert(0U == (this->m_offset_alignment & (this->m_offset_alignment - 1U)));
+
+	this->m_frame_count = frame_count;
+	this->m_frame_size = brx_align_up(frame_size, this->m_offset_alignment);
+	assert(this->m_frame_size <= (UINT32_MAX / frame_count));
+
+	// each frame in flight owns one slot of the same uniform upload buffer, and thus the same descriptor set can be used by all frames
+	assert(NULL == this->m_uniform_upload_buffer);
+	this->m_uniform_upload_buffer = device->create_uniform_upload_buffer(this->m_frame_size * frame_count);
+	assert(NULL != this->m_uniform_upload_buffer);
+	this->m_host_memory_range_base = static_cast<uint8_t *>(this->m_uniform_upload_buffer->get_host_memory_range_base());
+
+	// the "begin_frame" should be called before the first allocation
+	this->m_frame_index = frame_count - 1U;
+	this->m_frame_offset.store(this->m_frame_size, std::memory_order_relaxed);
+}
+
+void brx_uniform_upload_ring_allocator::uninit(brx_device const *device)
+{
+	assert(NULL != this->m_uniform_upload_buffer);
+	device->destroy_uniform_upload_buffer(this->m_uniform_upload_buffer);
+	this->m_uniform_upload_buffer = NULL;
+	this->m_host_memory_range_base = NULL;
+}
+
+brx_uniform_upload_ring_allocator::~brx_uniform_upload_ring_allocator()
+{
+	assert(NULL == this->m_uniform_upload_buffer);
+}
+
+brx_uniform_upload_buffer const *brx_uniform_upload_ring_allocator::get_uniform_upload_buffer() const
+{
+	return this->m_uniform_upload_buffer;
+}
+
+void brx_uniform_upload_ring_allocator::begin_frame(uint32_t frame_index)
+{
+	// the frames are begun in the round-robin order, and the caller should have waited for the fence of the same slot in the previous cycle
+	assert(frame_index < this->m_frame_count);
+	assert(frame_index == ((this->m_frame_index + 1U) % this->m_frame_count));
+
+	this->m_frame_index = frame_index;
+	this->m_frame_offset.store(0U, std::memory_order_relaxed);
+}
+
+void *brx_uniform_upload_ring_allocator::alloc(uint32_t size, uint32_t *out_dynamic_offset)
+{
+	assert(size > 0U);
+	assert(NULL != out_dynamic_offset);
+
+	if (size > this->m_frame_size)
+	{
+		return NULL;
+	}
+
+	uint32_t const aligned_size = brx_align_up(size, this->m_offset_alignment);
+
+	// the offset is NOT bumped when the frame is full, and thus the failed allocations never wrap the offset around
+	uint32_t frame_offset = this->m_frame_offset.load(std::memory_order_relaxed);
+	do
+	{
+		assert(frame_offset <= this->m_frame_size);
+		if (aligned_size > (this->m_frame_size - frame_offset))
+		{
+			return NULL;
+		}
+	} while (!this->m_frame_offset.compare_exchange_weak(frame_offset, frame_offset + aligned_size, std::memory_order_relaxed));
+
+	uint32_t const dynamic_offset = this->m_frame_size * this->m_frame_index + frame_offset;
+
+	(*out_dynamic_offset) = dynamic_offset;
+	return this->m_host_memory_range_base + dynamic_offset;
+}
@@ -0,0 +1,46 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_UNIFORM_UPLOAD_RING_H_
+#define _BRX_UNIFORM_UPLOAD_RING_H_ 1
+
+#include "../include/brx_device.h"
+#include <atomic>
+
+class brx_uniform_upload_ring_allocator : public brx_uniform_upload_ring
+{
+	brx_uniform_upload_buffer *m_uniform_upload_buffer;
+	uint8_t *m_host_memory_range_base;
+	uint32_t m_offset_alignment;
+	uint32_t m_frame_count;
+	uint32_t m_frame_size;
+	uint32_t m_frame_index;
+	// the offset within the current frame is bumped by the render threads without the lock
+	std::atomic<uint32_t> m_frame_offset;
+
+public:
+	brx_uniform_upload_ring_allocator();
+	void init(brx_device const *device, uint32_t min_uniform_buffer_offset_alignment, uint32_t frame_count, uint32_t frame_size);
+	void uninit(brx_device const *device);
+	~brx_uniform_upload_ring_allocator();
+	brx_uniform_upload_buffer const *get_uniform_upload_buffer() const;
+	void begin_frame(uint32_t frame_index);
+	// NULL is returned when there is NOT enough space left in the current frame
+	void *alloc(uint32_t size, uint32_t *out_dynamic_offset);
+};
+
+#endif
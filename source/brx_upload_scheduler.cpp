@@ -0,0 +1,130 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_upload_scheduler.h"
+#include <assert.h>
+
+brx_upload_batch_scheduler::brx_upload_batch_scheduler() : m_timeline_fence(NULL), m_last_submitted_value(0U)
+{
+}
+
+void brx_upload_batch_scheduler::init(brx_device const *device, uint32_t batch_count)
+{
+	assert(device->is_timeline_fence_supported());
+	assert(batch_count > 0U);
+
+	assert(NULL == this->m_timeline_fence);
+	this->m_timeline_fence = device->create_timeline_fence(0U);
+
+	this->m_last_submitted_value = 0U;
+
+	assert(this->m_batches.empty());
+	this->m_batches.resize(batch_count);
+	for (brx_upload_scheduler_batch &batch : this->m_batches)
+	{
+		batch.upload_command_buffer = device->create_upload_command_buffer();
+		batch.value = 0U;
+		batch.recording = false;
+	}
+}
+
+void brx_upload_batch_scheduler::uninit(brx_device const *device)
+{
+	// the upload command buffers should NOT be destroyed until the GPU has finished all the batches
+	if (this->m_last_submitted_value > 0U)
+	{
+		bool const res_wait_for_timeline_fences = device->wait_for_timeline_fences(1U, &this->m_timeline_fence, &this->m_last_submitted_value, true, UINT64_MAX);
+		assert(res_wait_for_timeline_fences);
+		(void)res_wait_for_timeline_fences;
+	}
+
+	for (brx_upload_scheduler_batch &batch : this->m_batches)
+	{
+		assert(!batch.recording);
+		device->destroy_upload_command_buffer(batch.upload_command_buffer);
+		batch.upload_command_buffer = NULL;
+	}
+	this->m_batches.clear();
+
+	assert(NULL != this->m_timeline_fence);
+	device->destroy_timeline_fence(this->m_timeline_fence);
+	this->m_timeline_fence = NULL;
+}
+
+brx_upload_batch_scheduler::~brx_upload_batch_scheduler()
+{
+	assert(NULL == this->m_timeline_fence);
+	assert(this->m_batches.empty());
+}
+
+brx_upload_command_buffer *brx_upload_batch_scheduler::begin_batch(brx_device const *device)
+{
+	uint64_t const completed_value = device->get_timeline_fence_completed_value(this->m_timeline_fence);
+
+	for (brx_upload_scheduler_batch &batch : this->m_batches)
+	{
+		if ((!batch.recording) && (batch.value <= completed_value))
+		{
+			device->reset_upload_command_buffer(batch.upload_command_buffer);
+			batch.upload_command_buffer->begin();
+			batch.recording = true;
+			return batch.upload_command_buffer;
+		}
+	}
+
+	// all batches are in flight
+	return NULL;
+}
+
+uint64_t brx_upload_batch_scheduler::submit_batch(brx_upload_queue *upload_queue, brx_upload_command_buffer *upload_command_buffer)
+{
+	assert(NULL != upload_queue);
+	assert(NULL != upload_command_buffer);
+
+	for (brx_upload_scheduler_batch &batch : this->m_batches)
+	{
+		if (upload_command_buffer == batch.upload_command_buffer)
+		{
+			assert(batch.recording);
+
+			upload_command_buffer->end();
+
+			// the value is assigned at the submission (rather than the begin) since the values signaled by the queue should be increasing
+			++this->m_last_submitted_value;
+			upload_queue->submit_and_signal_timeline_fence(upload_command_buffer, this->m_timeline_fence, this->m_last_submitted_value);
+
+			batch.value = this->m_last_submitted_value;
+			batch.recording = false;
+			return batch.value;
+		}
+	}
+
+	// the upload command buffer is NOT begun by this scheduler
+	assert(false);
+	return 0U;
+}
+
+brx_timeline_fence const *brx_upload_batch_scheduler::get_timeline_fence() const
+{
+	return this->m_timeline_fence;
+}
+
+bool brx_upload_batch_scheduler::is_batch_completed(brx_device const *device, uint64_t batch_value) const
+{
+	assert(batch_value <= this->m_last_submitted_value);
+	return (device->get_timeline_fence_completed_value(this->m_timeline_fence) >= batch_value);
+}
@@ -0,0 +1,50 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_UPLOAD_SCHEDULER_H_
+#define _BRX_UPLOAD_SCHEDULER_H_ 1
+
+#include "../include/brx_device.h"
+#include "brx_vector.h"
+
+struct brx_upload_scheduler_batch
+{
+	brx_upload_command_buffer *upload_command_buffer;
+	// zero when the batch has never been submitted
+	uint64_t value;
+	bool recording;
+};
+
+// the batches are recycled when the values are reached by the timeline fence, and are NOT retired in the submission order
+class brx_upload_batch_scheduler : public brx_upload_scheduler
+{
+	brx_timeline_fence *m_timeline_fence;
+	uint64_t m_last_submitted_value;
+	brx_vector<brx_upload_scheduler_batch> m_batches;
+
+public:
+	brx_upload_batch_scheduler();
+	void init(brx_device const *device, uint32_t batch_count);
+	void uninit(brx_device const *device);
+	~brx_upload_batch_scheduler();
+	brx_upload_command_buffer *begin_batch(brx_device const *device);
+	uint64_t submit_batch(brx_upload_queue *upload_queue, brx_upload_command_buffer *upload_command_buffer);
+	brx_timeline_fence const *get_timeline_fence() const;
+	bool is_batch_completed(brx_device const *device, uint64_t batch_value) const;
+};
+
+#endif
@@ -151,7 +151,7 @@ brx_vk_intermediate_storage_buffer::brx_vk_intermediate_storage_buffer() : m_buf
 {
 }
 
-void brx_vk_intermediate_storage_buffer::init(bool support_ray_tracing, VkDevice device, PFN_vkGetBufferDeviceAddressKHR pfn_get_buffer_device_address, VmaAllocator memory_allocator, VmaPool storage_buffer_memory_pool, uint32_t size, bool allow_vertex_position, bool allow_vertex_varying)
+void brx_vk_intermediate_storage_buffer::init(bool support_ray_tracing, VkDevice device, PFN_vkGetBufferDeviceAddressKHR pfn_get_buffer_device_address, VmaAllocator memory_allocator, VmaPool storage_buffer_memory_pool, uint32_t size, bool allow_vertex_position, bool allow_vertex_varying, bool allow_indirect_argument)
 {
 	VkBufferUsageFlags usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 	if (allow_vertex_position)
@@ -166,6 +166,10 @@ void brx_vk_intermediate_storage_buffer::init(bool support_ray_tracing, VkDevice
 	{
 		usage |= VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
 	}
+	if (allow_indirect_argument)
+	{
+		usage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+	}
 
 	VkBufferCreateInfo const buffer_create_info = {
 		VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
@@ -258,6 +262,11 @@ brx_storage_buffer const *brx_vk_intermediate_storage_buffer::get_storage_buffer
 	return static_cast<brx_vk_storage_buffer const *>(this);
 }
 
+brx_indirect_argument_buffer const *brx_vk_intermediate_storage_buffer::get_indirect_argument_buffer() const
+{
+	return static_cast<brx_vk_indirect_argument_buffer const *>(this);
+}
+
 brx_vk_asset_vertex_position_buffer::brx_vk_asset_vertex_position_buffer() : m_buffer(VK_NULL_HANDLE), m_allocation(VK_NULL_HANDLE), m_device_memory_range_base(0U), m_size(static_cast<VkDeviceSize>(-1))
 {
 }
@@ -591,9 +600,9 @@ brx_vk_staging_non_compacted_bottom_level_acceleration_structure::brx_vk_staging
 {
 }
 
-void brx_vk_staging_non_compacted_bottom_level_acceleration_structure::init(VmaAllocator memory_allocator, VmaPool staging_non_compacted_bottom_level_acceleration_structure_memory_pool, uint32_t size, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_staging_non_compacted_bottom_level_acceleration_structure::init(VmaAllocator memory_allocator, VmaPool staging_non_compacted_bottom_level_acceleration_structure_memory_pool, uint32_t size, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
-	PFN_vkCreateAccelerationStructureKHR const pfn_create_acceleration_structure = reinterpret_cast<PFN_vkCreateAccelerationStructureKHR>(pfn_get_device_proc_addr(device, "vkCreateAccelerationStructureKHR"));
+	PFN_vkCreateAccelerationStructureKHR const pfn_create_acceleration_structure = dispatch_table->pfn_create_acceleration_structure;
 	assert(NULL != pfn_create_acceleration_structure);
 
 	VkBufferCreateInfo const buffer_create_info = {
@@ -635,9 +644,9 @@ void brx_vk_staging_non_compacted_bottom_level_acceleration_structure::init(VmaA
 	pfn_create_acceleration_structure(device, &acceleration_structure_create_info, allocation_callbacks, &this->m_acceleration_structure);
 }
 
-void brx_vk_staging_non_compacted_bottom_level_acceleration_structure::uninit(VmaAllocator memory_allocator, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_staging_non_compacted_bottom_level_acceleration_structure::uninit(VmaAllocator memory_allocator, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
-	PFN_vkDestroyAccelerationStructureKHR const pfn_destroy_acceleration_structure = reinterpret_cast<PFN_vkDestroyAccelerationStructureKHR>(pfn_get_device_proc_addr(device, "vkDestroyAccelerationStructureKHR"));
+	PFN_vkDestroyAccelerationStructureKHR const pfn_destroy_acceleration_structure = dispatch_table->pfn_destroy_acceleration_structure;
 	assert(NULL != pfn_destroy_acceleration_structure);
 
 	assert(VK_NULL_HANDLE != this->m_acceleration_structure);
@@ -669,9 +678,9 @@ brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool::brx_vk_com
 {
 }
 
-void brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool::init(uint32_t query_count, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool::init(uint32_t query_count, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
-	PFN_vkCreateQueryPool const pfn_create_query_pool = reinterpret_cast<PFN_vkCreateQueryPool>(pfn_get_device_proc_addr(device, "vkCreateQueryPool"));
+	PFN_vkCreateQueryPool const pfn_create_query_pool = dispatch_table->pfn_create_query_pool;
 	assert(NULL != pfn_create_query_pool);
 
 	VkQueryPoolCreateInfo const query_pool_create_info =
@@ -687,9 +696,9 @@ void brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool::init(
 	assert(VK_SUCCESS == res_create_query_pool);
 }
 
-void brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool::uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
-	PFN_vkDestroyQueryPool const pfn_destroy_query_pool = reinterpret_cast<PFN_vkDestroyQueryPool>(pfn_get_device_proc_addr(device, "vkDestroyQueryPool"));
+	PFN_vkDestroyQueryPool const pfn_destroy_query_pool = dispatch_table->pfn_destroy_query_pool;
 	assert(NULL != pfn_destroy_query_pool);
 
 	assert(VK_NULL_HANDLE != this->m_query_pool);
@@ -707,15 +716,73 @@ VkQueryPool brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool
 	return this->m_query_pool;
 }
 
+brx_vk_timestamp_query_pool::brx_vk_timestamp_query_pool() : m_query_pool(VK_NULL_HANDLE), m_query_count(0U)
+{
+}
+
+void brx_vk_timestamp_query_pool::init(uint32_t query_count, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+	PFN_vkCreateQueryPool const pfn_create_query_pool = dispatch_table->pfn_create_query_pool;
+	assert(NULL != pfn_create_query_pool);
+
+	VkQueryPoolCreateInfo const query_pool_create_info =
+		{
+			VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+			NULL,
+			0U,
+			VK_QUERY_TYPE_TIMESTAMP,
+			query_count};
+
+	assert(VK_NULL_HANDLE == this->m_query_pool);
+	VkResult const res_create_query_pool = pfn_create_query_pool(device, &query_pool_create_info, allocation_callbacks, &this->m_query_pool);
+	assert(VK_SUCCESS == res_create_query_pool);
+
+	this->m_query_count = query_count;
+
+	this->m_label_list.init(query_count);
+}
+
+void brx_vk_timestamp_query_pool::uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+	this->m_label_list.uninit();
+
+	PFN_vkDestroyQueryPool const pfn_destroy_query_pool = dispatch_table->pfn_destroy_query_pool;
+	assert(NULL != pfn_destroy_query_pool);
+
+	assert(VK_NULL_HANDLE != this->m_query_pool);
+	pfn_destroy_query_pool(device, this->m_query_pool, allocation_callbacks);
+	this->m_query_pool = VK_NULL_HANDLE;
+}
+
+brx_vk_timestamp_query_pool::~brx_vk_timestamp_query_pool()
+{
+	assert(VK_NULL_HANDLE == this->m_query_pool);
+}
+
+VkQueryPool brx_vk_timestamp_query_pool::get_query_pool() const
+{
+	return this->m_query_pool;
+}
+
+uint32_t brx_vk_timestamp_query_pool::get_query_count() const
+{
+	return this->m_query_count;
+}
+
+brx_timestamp_query_label_list *brx_vk_timestamp_query_pool::get_label_list()
+{
+	return &this->m_label_list;
+}
+
 brx_vk_asset_compacted_bottom_level_acceleration_structure::brx_vk_asset_compacted_bottom_level_acceleration_structure() : m_buffer(VK_NULL_HANDLE), m_allocation(VK_NULL_HANDLE), m_acceleration_structure(VK_NULL_HANDLE), m_device_memory_range_base(0U)
 {
 }
 
-void brx_vk_asset_compacted_bottom_level_acceleration_structure::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool asset_compacted_bottom_level_acceleration_structure_memory_pool, uint32_t size)
+void brx_vk_asset_compacted_bottom_level_acceleration_structure::init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool asset_compacted_bottom_level_acceleration_structure_memory_pool, uint32_t size)
 {
-	PFN_vkCreateAccelerationStructureKHR const pfn_create_acceleration_structure = reinterpret_cast<PFN_vkCreateAccelerationStructureKHR>(pfn_get_device_proc_addr(device, "vkCreateAccelerationStructureKHR"));
+	PFN_vkCreateAccelerationStructureKHR const pfn_create_acceleration_structure = dispatch_table->pfn_create_acceleration_structure;
 	assert(NULL != pfn_create_acceleration_structure);
-	PFN_vkGetAccelerationStructureDeviceAddressKHR const pfn_get_acceleration_structure_device_address = reinterpret_cast<PFN_vkGetAccelerationStructureDeviceAddressKHR>(pfn_get_device_proc_addr(device, "vkGetAccelerationStructureDeviceAddressKHR"));
+	PFN_vkGetAccelerationStructureDeviceAddressKHR const pfn_get_acceleration_structure_device_address = dispatch_table->pfn_get_acceleration_structure_device_address;
 	assert(NULL != pfn_get_acceleration_structure_device_address);
 
 	VkBufferCreateInfo const buffer_create_info = {
@@ -765,9 +832,9 @@ void brx_vk_asset_compacted_bottom_level_acceleration_structure::init(PFN_vkGetD
 	this->m_device_memory_range_base = pfn_get_acceleration_structure_device_address(device, &acceleration_structure_device_address_info);
 }
 
-void brx_vk_asset_compacted_bottom_level_acceleration_structure::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator)
+void brx_vk_asset_compacted_bottom_level_acceleration_structure::uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator)
 {
-	PFN_vkDestroyAccelerationStructureKHR const pfn_destroy_acceleration_structure = reinterpret_cast<PFN_vkDestroyAccelerationStructureKHR>(pfn_get_device_proc_addr(device, "vkDestroyAccelerationStructureKHR"));
+	PFN_vkDestroyAccelerationStructureKHR const pfn_destroy_acceleration_structure = dispatch_table->pfn_destroy_acceleration_structure;
 	assert(NULL != pfn_destroy_acceleration_structure);
 
 	assert(VK_NULL_HANDLE != this->m_acceleration_structure);
@@ -910,11 +977,11 @@ brx_vk_top_level_acceleration_structure::brx_vk_top_level_acceleration_structure
 {
 }
 
-void brx_vk_top_level_acceleration_structure::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool top_level_acceleration_structure_memory_pool, uint32_t size)
+void brx_vk_top_level_acceleration_structure::init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool top_level_acceleration_structure_memory_pool, uint32_t size)
 {
-	PFN_vkCreateAccelerationStructureKHR const pfn_create_acceleration_structure = reinterpret_cast<PFN_vkCreateAccelerationStructureKHR>(pfn_get_device_proc_addr(device, "vkCreateAccelerationStructureKHR"));
+	PFN_vkCreateAccelerationStructureKHR const pfn_create_acceleration_structure = dispatch_table->pfn_create_acceleration_structure;
 	assert(NULL != pfn_create_acceleration_structure);
-	PFN_vkGetAccelerationStructureDeviceAddressKHR const pfn_get_acceleration_structure_device_address = reinterpret_cast<PFN_vkGetAccelerationStructureDeviceAddressKHR>(pfn_get_device_proc_addr(device, "vkGetAccelerationStructureDeviceAddressKHR"));
+	PFN_vkGetAccelerationStructureDeviceAddressKHR const pfn_get_acceleration_structure_device_address = dispatch_table->pfn_get_acceleration_structure_device_address;
 	assert(NULL != pfn_get_acceleration_structure_device_address);
 
 	VkBufferCreateInfo const buffer_create_info = {
@@ -956,9 +1023,9 @@ void brx_vk_top_level_acceleration_structure::init(PFN_vkGetDeviceProcAddr pfn_g
 	pfn_create_acceleration_structure(device, &acceleration_structure_create_info, allocation_callbacks, &this->m_acceleration_structure);
 }
 
-void brx_vk_top_level_acceleration_structure::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator)
+void brx_vk_top_level_acceleration_structure::uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator)
 {
-	PFN_vkDestroyAccelerationStructureKHR const pfn_destroy_acceleration_structure = reinterpret_cast<PFN_vkDestroyAccelerationStructureKHR>(pfn_get_device_proc_addr(device, "vkDestroyAccelerationStructureKHR"));
+	PFN_vkDestroyAccelerationStructureKHR const pfn_destroy_acceleration_structure = dispatch_table->pfn_destroy_acceleration_structure;
 	assert(NULL != pfn_destroy_acceleration_structure);
 
 	assert(VK_NULL_HANDLE != this->m_acceleration_structure);
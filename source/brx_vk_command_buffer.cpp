@@ -18,10 +18,97 @@
 #include "brx_vk_device.h"
 #include "brx_format.h"
 #include "brx_vector.h"
+#include <algorithm>
 #include <assert.h>
 
+// the emitted (true) or elided (false) is returned, and the shadow state is updated
+static inline bool __intermediate_bind_descriptor_sets(PFN_vkCmdBindDescriptorSets pfn_cmd_bind_descriptor_sets, VkCommandBuffer command_buffer, VkPipelineBindPoint pipeline_bind_point, brx_vk_descriptor_set_binding_state *bound_descriptor_sets, brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *wrapped_descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets);
+
+brx_vk_pending_pipeline_barrier::brx_vk_pending_pipeline_barrier() : m_source_stage_mask(0U), m_destination_stage_mask(0U), m_buffer_memory_barrier_count(0U), m_image_memory_barrier_count(0U)
+{
+}
+
+void brx_vk_pending_pipeline_barrier::pipeline_barrier(PFN_vkCmdPipelineBarrier pfn_cmd_pipeline_barrier, VkCommandBuffer command_buffer, VkPipelineStageFlags source_stage_mask, VkPipelineStageFlags destination_stage_mask, uint32_t buffer_memory_barrier_count, VkBufferMemoryBarrier const *buffer_memory_barriers, uint32_t image_memory_barrier_count, VkImageMemoryBarrier const *image_memory_barriers)
+{
+	// the barriers within the same command are NOT ordered, and thus the pending barriers on the same resource should be flushed at first
+	bool same_resource = false;
+
+	for (uint32_t buffer_memory_barrier_index = 0U; (!same_resource) && (buffer_memory_barrier_index < buffer_memory_barrier_count); ++buffer_memory_barrier_index)
+	{
+		for (uint32_t pending_buffer_memory_barrier_index = 0U; (!same_resource) && (pending_buffer_memory_barrier_index < this->m_buffer_memory_barrier_count); ++pending_buffer_memory_barrier_index)
+		{
+			same_resource = (this->m_buffer_memory_barriers[pending_buffer_memory_barrier_index].buffer == buffer_memory_barriers[buffer_memory_barrier_index].buffer);
+		}
+	}
+
+	for (uint32_t image_memory_barrier_index = 0U; (!same_resource) && (image_memory_barrier_index < image_memory_barrier_count); ++image_memory_barrier_index)
+	{
+		for (uint32_t pending_image_memory_barrier_index = 0U; (!same_resource) && (pending_image_memory_barrier_index < this->m_image_memory_barrier_count); ++pending_image_memory_barrier_index)
+		{
+			same_resource = (this->m_image_memory_barriers[pending_image_memory_barrier_index].image == image_memory_barriers[image_memory_barrier_index].image);
+		}
+	}
+
+	if (same_resource)
+	{
+		this->flush(pfn_cmd_pipeline_barrier, command_buffer);
+	}
+
+	// the barriers of one call are NOT ordered either, and thus they can be split into multiple commands when the arrays are full
+	for (uint32_t buffer_memory_barrier_index = 0U; buffer_memory_barrier_index < buffer_memory_barrier_count; ++buffer_memory_barrier_index)
+	{
+		if (this->m_buffer_memory_barrier_count >= g_vk_max_pending_buffer_memory_barrier_count)
+		{
+			this->flush(pfn_cmd_pipeline_barrier, command_buffer);
+		}
+
+		this->m_source_stage_mask |= source_stage_mask;
+		this->m_destination_stage_mask |= destination_stage_mask;
+		this->m_buffer_memory_barriers[this->m_buffer_memory_barrier_count] = buffer_memory_barriers[buffer_memory_barrier_index];
+		++this->m_buffer_memory_barrier_count;
+	}
+
+	for (uint32_t image_memory_barrier_index = 0U; image_memory_barrier_index < image_memory_barrier_count; ++image_memory_barrier_index)
+	{
+		if (this->m_image_memory_barrier_count >= g_vk_max_pending_image_memory_barrier_count)
+		{
+			this->flush(pfn_cmd_pipeline_barrier, command_buffer);
+		}
+
+		this->m_source_stage_mask |= source_stage_mask;
+		this->m_destination_stage_mask |= destination_stage_mask;
+		this->m_image_memory_barriers[this->m_image_memory_barrier_count] = image_memory_barriers[image_memory_barrier_index];
+		++this->m_image_memory_barrier_count;
+	}
+}
+
+void brx_vk_pending_pipeline_barrier::flush(PFN_vkCmdPipelineBarrier pfn_cmd_pipeline_barrier, VkCommandBuffer command_buffer)
+{
+	if ((this->m_buffer_memory_barrier_count > 0U) || (this->m_image_memory_barrier_count > 0U))
+	{
+		pfn_cmd_pipeline_barrier(command_buffer, this->m_source_stage_mask, this->m_destination_stage_mask, 0U, 0U, NULL, this->m_buffer_memory_barrier_count, (this->m_buffer_memory_barrier_count > 0U) ? &this->m_buffer_memory_barriers[0] : NULL, this->m_image_memory_barrier_count, (this->m_image_memory_barrier_count > 0U) ? &this->m_image_memory_barriers[0] : NULL);
+
+		this->m_buffer_memory_barrier_count = 0U;
+		this->m_image_memory_barrier_count = 0U;
+		this->m_source_stage_mask = 0U;
+		this->m_destination_stage_mask = 0U;
+	}
+	else
+	{
+		assert(0U == this->m_source_stage_mask);
+		assert(0U == this->m_destination_stage_mask);
+	}
+}
+
+brx_vk_pending_pipeline_barrier::~brx_vk_pending_pipeline_barrier()
+{
+	assert(0U == this->m_buffer_memory_barrier_count);
+	assert(0U == this->m_image_memory_barrier_count);
+}
+
 brx_vk_graphics_command_buffer::brx_vk_graphics_command_buffer()
-	: m_command_pool(VK_NULL_HANDLE),
+	: m_command_buffer_level(VK_COMMAND_BUFFER_LEVEL_MAX_ENUM),
+	  m_command_pool(VK_NULL_HANDLE),
 	  m_command_buffer(VK_NULL_HANDLE),
 	  m_acquire_next_image_semaphore(VK_NULL_HANDLE),
 	  m_queue_submit_semaphore(VK_NULL_HANDLE),
@@ -36,30 +123,47 @@ brx_vk_graphics_command_buffer::brx_vk_graphics_command_buffer()
 	  m_pfn_cmd_set_view_port(NULL),
 	  m_pfn_cmd_set_scissor(NULL),
 	  m_pfn_cmd_bind_descriptor_sets(NULL),
+	  m_pfn_cmd_push_constants(NULL),
 	  m_pfn_cmd_bind_vertex_buffers(NULL),
 	  m_pfn_cmd_bind_index_buffer(NULL),
 	  m_pfn_cmd_draw(NULL),
 	  m_pfn_cmd_draw_indexed(NULL),
+	  m_pfn_cmd_draw_indirect(NULL),
+	  m_pfn_cmd_draw_indexed_indirect(NULL),
+	  m_pfn_cmd_draw_indirect_count(NULL),
+	  m_pfn_cmd_draw_indexed_indirect_count(NULL),
 	  m_pfn_cmd_end_render_pass(NULL),
+	  m_pfn_cmd_execute_commands(NULL),
 	  m_pfn_cmd_dispatch(NULL),
+	  m_pfn_cmd_dispatch_indirect(NULL),
 	  m_pfn_cmd_build_acceleration_structure(NULL),
-	  m_pfn_end_command_buffer(NULL)
+	  m_pfn_cmd_reset_query_pool(NULL),
+	  m_pfn_cmd_write_timestamp(NULL),
+	  m_pfn_end_command_buffer(NULL),
+	  m_debug_utils_label_query_pool(VK_NULL_HANDLE),
+	  m_debug_utils_label_list(NULL)
 {
+	this->invalidate_shadow_state();
+	this->m_statistics.emitted_state_command_count = 0U;
+	this->m_statistics.elided_state_command_count = 0U;
 }
 
-void brx_vk_graphics_command_buffer::init(bool support_ray_tracing, bool has_dedicated_upload_queue, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, PFN_vkGetInstanceProcAddr pfn_get_instance_proc_addr, VkInstance instance, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_graphics_command_buffer::init(VkCommandBufferLevel command_buffer_level, bool support_ray_tracing, bool support_multi_draw_indirect, bool has_dedicated_upload_queue, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, uint32_t compute_queue_family_index, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
 	this->m_support_ray_tracing = support_ray_tracing;
 
+	this->m_support_multi_draw_indirect = support_multi_draw_indirect;
+
 	this->m_has_dedicated_upload_queue = has_dedicated_upload_queue;
 	this->m_graphics_queue_family_index = graphics_queue_family_index;
 	this->m_upload_queue_family_index = upload_queue_family_index;
+	this->m_compute_queue_family_index = compute_queue_family_index;
 
-	PFN_vkCreateCommandPool const pfn_create_command_pool = reinterpret_cast<PFN_vkCreateCommandPool>(pfn_get_device_proc_addr(device, "vkCreateCommandPool"));
+	PFN_vkCreateCommandPool const pfn_create_command_pool = dispatch_table->pfn_create_command_pool;
 	assert(NULL != pfn_create_command_pool);
-	PFN_vkAllocateCommandBuffers const pfn_allocate_command_buffers = reinterpret_cast<PFN_vkAllocateCommandBuffers>(pfn_get_device_proc_addr(device, "vkAllocateCommandBuffers"));
+	PFN_vkAllocateCommandBuffers const pfn_allocate_command_buffers = dispatch_table->pfn_allocate_command_buffers;
 	assert(NULL != pfn_allocate_command_buffers);
-	PFN_vkCreateSemaphore const pfn_create_semaphore = reinterpret_cast<PFN_vkCreateSemaphore>(pfn_get_device_proc_addr(device, "vkCreateSemaphore"));
+	PFN_vkCreateSemaphore const pfn_create_semaphore = dispatch_table->pfn_create_semaphore;
 	assert(NULL != pfn_create_semaphore);
 
 	assert(VK_NULL_HANDLE == this->m_command_pool);
@@ -71,80 +175,105 @@ void brx_vk_graphics_command_buffer::init(bool support_ray_tracing, bool has_ded
 	VkResult const res_create_command_pool = pfn_create_command_pool(device, &command_pool_create_info, allocation_callbacks, &this->m_command_pool);
 	assert(VK_SUCCESS == res_create_command_pool);
 
+	assert(VK_COMMAND_BUFFER_LEVEL_PRIMARY == command_buffer_level || VK_COMMAND_BUFFER_LEVEL_SECONDARY == command_buffer_level);
+	this->m_command_buffer_level = command_buffer_level;
+
 	assert(VK_NULL_HANDLE == this->m_command_buffer);
 	VkCommandBufferAllocateInfo const command_buffer_allocate_info = {
 		VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
 		NULL,
 		this->m_command_pool,
-		VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		command_buffer_level,
 		1U};
 	VkResult const res_allocate_command_buffers = pfn_allocate_command_buffers(device, &command_buffer_allocate_info, &this->m_command_buffer);
 	assert(VK_SUCCESS == res_allocate_command_buffers);
 
-	assert(VK_NULL_HANDLE == this->m_acquire_next_image_semaphore);
-	VkSemaphoreCreateInfo const acquire_next_image_semaphore_create_info = {
-		VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
-		NULL,
-		0U};
-	VkResult const res_create_acquire_next_image_semaphore = pfn_create_semaphore(device, &acquire_next_image_semaphore_create_info, allocation_callbacks, &this->m_acquire_next_image_semaphore);
-	assert(VK_SUCCESS == res_create_acquire_next_image_semaphore);
+	if (VK_COMMAND_BUFFER_LEVEL_PRIMARY == command_buffer_level)
+	{
+		assert(VK_NULL_HANDLE == this->m_acquire_next_image_semaphore);
+		VkSemaphoreCreateInfo const acquire_next_image_semaphore_create_info = {
+			VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+			NULL,
+			0U};
+		VkResult const res_create_acquire_next_image_semaphore = pfn_create_semaphore(device, &acquire_next_image_semaphore_create_info, allocation_callbacks, &this->m_acquire_next_image_semaphore);
+		assert(VK_SUCCESS == res_create_acquire_next_image_semaphore);
 
-	assert(VK_NULL_HANDLE == this->m_queue_submit_semaphore);
-	VkSemaphoreCreateInfo const queue_submit_semaphore_create_info = {
-		VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
-		NULL,
-		0U};
-	VkResult const res_create_queue_submit_semaphore = pfn_create_semaphore(device, &queue_submit_semaphore_create_info, allocation_callbacks, &this->m_queue_submit_semaphore);
-	assert(VK_SUCCESS == res_create_queue_submit_semaphore);
+		assert(VK_NULL_HANDLE == this->m_queue_submit_semaphore);
+		VkSemaphoreCreateInfo const queue_submit_semaphore_create_info = {
+			VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+			NULL,
+			0U};
+		VkResult const res_create_queue_submit_semaphore = pfn_create_semaphore(device, &queue_submit_semaphore_create_info, allocation_callbacks, &this->m_queue_submit_semaphore);
+		assert(VK_SUCCESS == res_create_queue_submit_semaphore);
+	}
 
 	assert(NULL == this->m_pfn_begin_command_buffer);
-	this->m_pfn_begin_command_buffer = reinterpret_cast<PFN_vkBeginCommandBuffer>(pfn_get_device_proc_addr(device, "vkBeginCommandBuffer"));
+	this->m_pfn_begin_command_buffer = dispatch_table->pfn_begin_command_buffer;
 	assert(NULL == this->m_pfn_cmd_pipeline_barrier);
-	this->m_pfn_cmd_pipeline_barrier = reinterpret_cast<PFN_vkCmdPipelineBarrier>(pfn_get_device_proc_addr(device, "vkCmdPipelineBarrier"));
+	this->m_pfn_cmd_pipeline_barrier = dispatch_table->pfn_cmd_pipeline_barrier;
 #ifndef NDEBUG
 	assert(NULL == this->m_pfn_cmd_begin_debug_utils_label);
-	this->m_pfn_cmd_begin_debug_utils_label = reinterpret_cast<PFN_vkCmdBeginDebugUtilsLabelEXT>(pfn_get_instance_proc_addr(instance, "vkCmdBeginDebugUtilsLabelEXT"));
+	this->m_pfn_cmd_begin_debug_utils_label = dispatch_table->pfn_cmd_begin_debug_utils_label;
 	assert(NULL == this->m_pfn_cmd_end_debug_utils_label);
-	this->m_pfn_cmd_end_debug_utils_label = reinterpret_cast<PFN_vkCmdEndDebugUtilsLabelEXT>(pfn_get_instance_proc_addr(instance, "vkCmdEndDebugUtilsLabelEXT"));
+	this->m_pfn_cmd_end_debug_utils_label = dispatch_table->pfn_cmd_end_debug_utils_label;
 #endif
 	assert(NULL == this->m_pfn_cmd_begin_render_pass);
-	this->m_pfn_cmd_begin_render_pass = reinterpret_cast<PFN_vkCmdBeginRenderPass>(pfn_get_device_proc_addr(device, "vkCmdBeginRenderPass"));
+	this->m_pfn_cmd_begin_render_pass = dispatch_table->pfn_cmd_begin_render_pass;
 	assert(NULL == this->m_pfn_cmd_bind_pipeline);
-	this->m_pfn_cmd_bind_pipeline = reinterpret_cast<PFN_vkCmdBindPipeline>(pfn_get_device_proc_addr(device, "vkCmdBindPipeline"));
+	this->m_pfn_cmd_bind_pipeline = dispatch_table->pfn_cmd_bind_pipeline;
 	assert(NULL == this->m_pfn_cmd_set_view_port);
-	this->m_pfn_cmd_set_view_port = reinterpret_cast<PFN_vkCmdSetViewport>(pfn_get_device_proc_addr(device, "vkCmdSetViewport"));
+	this->m_pfn_cmd_set_view_port = dispatch_table->pfn_cmd_set_view_port;
 	assert(NULL == this->m_pfn_cmd_set_scissor);
-	this->m_pfn_cmd_set_scissor = reinterpret_cast<PFN_vkCmdSetScissor>(pfn_get_device_proc_addr(device, "vkCmdSetScissor"));
+	this->m_pfn_cmd_set_scissor = dispatch_table->pfn_cmd_set_scissor;
 	assert(NULL == this->m_pfn_cmd_bind_descriptor_sets);
-	this->m_pfn_cmd_bind_descriptor_sets = reinterpret_cast<PFN_vkCmdBindDescriptorSets>(pfn_get_device_proc_addr(device, "vkCmdBindDescriptorSets"));
+	this->m_pfn_cmd_bind_descriptor_sets = dispatch_table->pfn_cmd_bind_descriptor_sets;
+	assert(NULL == this->m_pfn_cmd_push_constants);
+	this->m_pfn_cmd_push_constants = dispatch_table->pfn_cmd_push_constants;
 	assert(NULL == this->m_pfn_cmd_bind_vertex_buffers);
-	this->m_pfn_cmd_bind_vertex_buffers = reinterpret_cast<PFN_vkCmdBindVertexBuffers>(pfn_get_device_proc_addr(device, "vkCmdBindVertexBuffers"));
+	this->m_pfn_cmd_bind_vertex_buffers = dispatch_table->pfn_cmd_bind_vertex_buffers;
 	assert(NULL == this->m_pfn_cmd_bind_index_buffer);
-	this->m_pfn_cmd_bind_index_buffer = reinterpret_cast<PFN_vkCmdBindIndexBuffer>(pfn_get_device_proc_addr(device, "vkCmdBindIndexBuffer"));
+	this->m_pfn_cmd_bind_index_buffer = dispatch_table->pfn_cmd_bind_index_buffer;
 	assert(NULL == this->m_pfn_cmd_draw);
-	this->m_pfn_cmd_draw = reinterpret_cast<PFN_vkCmdDraw>(pfn_get_device_proc_addr(device, "vkCmdDraw"));
+	this->m_pfn_cmd_draw = dispatch_table->pfn_cmd_draw;
 	assert(NULL == this->m_pfn_cmd_draw_indexed);
-	this->m_pfn_cmd_draw_indexed = reinterpret_cast<PFN_vkCmdDrawIndexed>(pfn_get_device_proc_addr(device, "vkCmdDrawIndexed"));
+	this->m_pfn_cmd_draw_indexed = dispatch_table->pfn_cmd_draw_indexed;
+	assert(NULL == this->m_pfn_cmd_draw_indirect);
+	this->m_pfn_cmd_draw_indirect = dispatch_table->pfn_cmd_draw_indirect;
+	assert(NULL == this->m_pfn_cmd_draw_indexed_indirect);
+	this->m_pfn_cmd_draw_indexed_indirect = dispatch_table->pfn_cmd_draw_indexed_indirect;
+	// NULL when the "VK_KHR_draw_indirect_count" is NOT supported
+	assert(NULL == this->m_pfn_cmd_draw_indirect_count);
+	this->m_pfn_cmd_draw_indirect_count = dispatch_table->pfn_cmd_draw_indirect_count;
+	assert(NULL == this->m_pfn_cmd_draw_indexed_indirect_count);
+	this->m_pfn_cmd_draw_indexed_indirect_count = dispatch_table->pfn_cmd_draw_indexed_indirect_count;
 	assert(NULL == this->m_pfn_cmd_end_render_pass);
-	this->m_pfn_cmd_end_render_pass = reinterpret_cast<PFN_vkCmdEndRenderPass>(pfn_get_device_proc_addr(device, "vkCmdEndRenderPass"));
+	this->m_pfn_cmd_end_render_pass = dispatch_table->pfn_cmd_end_render_pass;
+	assert(NULL == this->m_pfn_cmd_execute_commands);
+	this->m_pfn_cmd_execute_commands = dispatch_table->pfn_cmd_execute_commands;
 	assert(NULL == this->m_pfn_cmd_dispatch);
-	this->m_pfn_cmd_dispatch = reinterpret_cast<PFN_vkCmdDispatch>(pfn_get_device_proc_addr(device, "vkCmdDispatch"));
+	this->m_pfn_cmd_dispatch = dispatch_table->pfn_cmd_dispatch;
+	assert(NULL == this->m_pfn_cmd_dispatch_indirect);
+	this->m_pfn_cmd_dispatch_indirect = dispatch_table->pfn_cmd_dispatch_indirect;
 	assert(NULL == this->m_pfn_cmd_build_acceleration_structure);
 	if (this->m_support_ray_tracing)
 	{
-		this->m_pfn_cmd_build_acceleration_structure = reinterpret_cast<PFN_vkCmdBuildAccelerationStructuresKHR>(pfn_get_device_proc_addr(device, "vkCmdBuildAccelerationStructuresKHR"));
+		this->m_pfn_cmd_build_acceleration_structure = dispatch_table->pfn_cmd_build_acceleration_structure;
 	}
+	assert(NULL == this->m_pfn_cmd_reset_query_pool);
+	this->m_pfn_cmd_reset_query_pool = dispatch_table->pfn_cmd_reset_query_pool;
+	assert(NULL == this->m_pfn_cmd_write_timestamp);
+	this->m_pfn_cmd_write_timestamp = dispatch_table->pfn_cmd_write_timestamp;
 	assert(NULL == this->m_pfn_end_command_buffer);
-	this->m_pfn_end_command_buffer = reinterpret_cast<PFN_vkEndCommandBuffer>(pfn_get_device_proc_addr(device, "vkEndCommandBuffer"));
+	this->m_pfn_end_command_buffer = dispatch_table->pfn_end_command_buffer;
 }
 
-void brx_vk_graphics_command_buffer::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_graphics_command_buffer::uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
-	PFN_vkDestroyCommandPool const pfn_destroy_command_pool = reinterpret_cast<PFN_vkDestroyCommandPool>(pfn_get_device_proc_addr(device, "vkDestroyCommandPool"));
+	PFN_vkDestroyCommandPool const pfn_destroy_command_pool = dispatch_table->pfn_destroy_command_pool;
 	assert(NULL != pfn_destroy_command_pool);
-	PFN_vkFreeCommandBuffers const pfn_free_command_buffers = reinterpret_cast<PFN_vkFreeCommandBuffers>(pfn_get_device_proc_addr(device, "vkFreeCommandBuffers"));
+	PFN_vkFreeCommandBuffers const pfn_free_command_buffers = dispatch_table->pfn_free_command_buffers;
 	assert(NULL != pfn_free_command_buffers);
-	PFN_vkDestroySemaphore const pfn_destroy_semaphore = reinterpret_cast<PFN_vkDestroySemaphore>(pfn_get_device_proc_addr(device, "vkDestroySemaphore"));
+	PFN_vkDestroySemaphore const pfn_destroy_semaphore = dispatch_table->pfn_destroy_semaphore;
 	assert(NULL != pfn_destroy_semaphore);
 
 	assert(VK_NULL_HANDLE != this->m_command_buffer);
@@ -155,14 +284,22 @@ void brx_vk_graphics_command_buffer::uninit(PFN_vkGetDeviceProcAddr pfn_get_devi
 	pfn_destroy_command_pool(device, this->m_command_pool, allocation_callbacks);
 	this->m_command_pool = VK_NULL_HANDLE;
 
-	assert(VK_NULL_HANDLE != this->m_acquire_next_image_semaphore);
-	pfn_destroy_semaphore(device, this->m_acquire_next_image_semaphore, allocation_callbacks);
-	this->m_acquire_next_image_semaphore = VK_NULL_HANDLE;
+	if (VK_COMMAND_BUFFER_LEVEL_PRIMARY == this->m_command_buffer_level)
+	{
+		assert(VK_NULL_HANDLE != this->m_acquire_next_image_semaphore);
+		pfn_destroy_semaphore(device, this->m_acquire_next_image_semaphore, allocation_callbacks);
+		this->m_acquire_next_image_semaphore = VK_NULL_HANDLE;
 
-	assert(VK_NULL_HANDLE != this->m_queue_submit_semaphore);
+		assert(VK_NULL_HANDLE != this->m_queue_submit_semaphore);
 
-	pfn_destroy_semaphore(device, this->m_queue_submit_semaphore, allocation_callbacks);
-	this->m_queue_submit_semaphore = VK_NULL_HANDLE;
+		pfn_destroy_semaphore(device, this->m_queue_submit_semaphore, allocation_callbacks);
+		this->m_queue_submit_semaphore = VK_NULL_HANDLE;
+	}
+	else
+	{
+		assert(VK_NULL_HANDLE == this->m_acquire_next_image_semaphore);
+		assert(VK_NULL_HANDLE == this->m_queue_submit_semaphore);
+	}
 }
 
 brx_vk_graphics_command_buffer::~brx_vk_graphics_command_buffer()
@@ -193,8 +330,28 @@ VkSemaphore brx_vk_graphics_command_buffer::get_queue_submit_semaphore() const
 	return this->m_queue_submit_semaphore;
 }
 
+void brx_vk_graphics_command_buffer::invalidate_shadow_state()
+{
+	// the state is NOT inherited from the previous recording
+	this->m_bound_graphics_pipeline = VK_NULL_HANDLE;
+	this->m_bound_compute_pipeline = VK_NULL_HANDLE;
+	this->m_bound_view_port_width = static_cast<uint32_t>(-1);
+	this->m_bound_view_port_height = static_cast<uint32_t>(-1);
+	this->m_bound_scissor_width = static_cast<uint32_t>(-1);
+	this->m_bound_scissor_height = static_cast<uint32_t>(-1);
+	this->m_bound_graphics_descriptor_sets.descriptor_set_count = 0U;
+	this->m_bound_graphics_descriptor_sets.push_constant_size = 0U;
+	this->m_bound_compute_descriptor_sets.descriptor_set_count = 0U;
+	this->m_bound_compute_descriptor_sets.push_constant_size = 0U;
+	this->m_bound_vertex_buffer_count = 0U;
+	this->m_bound_index_buffer = VK_NULL_HANDLE;
+	this->m_bound_index_type = static_cast<VkIndexType>(-1);
+}
+
 void brx_vk_graphics_command_buffer::begin()
 {
+	assert(VK_COMMAND_BUFFER_LEVEL_PRIMARY == this->m_command_buffer_level);
+
 	VkCommandBufferBeginInfo command_buffer_begin_info = {
 		VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
 		NULL,
@@ -202,6 +359,52 @@ void brx_vk_graphics_command_buffer::begin()
 		NULL};
 	VkResult res_begin_command_buffer = this->m_pfn_begin_command_buffer(this->m_command_buffer, &command_buffer_begin_info);
 	assert(VK_SUCCESS == res_begin_command_buffer);
+
+	this->invalidate_shadow_state();
+	this->m_statistics.emitted_state_command_count = 0U;
+	this->m_statistics.elided_state_command_count = 0U;
+
+	this->m_debug_utils_label_query_pool = VK_NULL_HANDLE;
+	this->m_debug_utils_label_list = NULL;
+}
+
+void brx_vk_graphics_command_buffer::begin_secondary(brx_render_pass const *brx_render_pass, brx_frame_buffer const *brx_frame_buffer, uint32_t width, uint32_t height)
+{
+	assert(VK_COMMAND_BUFFER_LEVEL_SECONDARY == this->m_command_buffer_level);
+
+	assert(NULL != brx_render_pass);
+	assert(NULL != brx_frame_buffer);
+	VkRenderPass render_pass = static_cast<brx_vk_render_pass const *>(brx_render_pass)->get_render_pass();
+	VkFramebuffer frame_buffer = static_cast<brx_vk_frame_buffer const *>(brx_frame_buffer)->get_frame_buffer();
+
+	VkCommandBufferInheritanceInfo command_buffer_inheritance_info = {
+		VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+		NULL,
+		render_pass,
+		0U,
+		frame_buffer,
+		VK_FALSE,
+		0U,
+		0U};
+
+	VkCommandBufferBeginInfo command_buffer_begin_info = {
+		VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		NULL,
+		VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+		&command_buffer_inheritance_info};
+	VkResult res_begin_command_buffer = this->m_pfn_begin_command_buffer(this->m_command_buffer, &command_buffer_begin_info);
+	assert(VK_SUCCESS == res_begin_command_buffer);
+
+	this->invalidate_shadow_state();
+	this->m_statistics.emitted_state_command_count = 0U;
+	this->m_statistics.elided_state_command_count = 0U;
+
+	this->m_debug_utils_label_query_pool = VK_NULL_HANDLE;
+	this->m_debug_utils_label_list = NULL;
+
+	// the dynamic state is NOT inherited from the primary command buffer
+	this->set_view_port(width, height);
+	this->set_scissor(width, height);
 }
 
 void brx_vk_graphics_command_buffer::acquire_asset_vertex_position_buffer(brx_asset_vertex_position_buffer *wrapped_asset_vertex_position_buffer)
@@ -226,7 +429,7 @@ void brx_vk_graphics_command_buffer::acquire_asset_vertex_position_buffer(brx_as
 				0U,
 				VK_WHOLE_SIZE};
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, (!this->m_support_ray_tracing) ? VK_PIPELINE_STAGE_VERTEX_INPUT_BIT : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | g_graphics_queue_family_all_supported_shader_stages), 0U, 0U, NULL, 1U, &acquire_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, (!this->m_support_ray_tracing) ? VK_PIPELINE_STAGE_VERTEX_INPUT_BIT : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | g_graphics_queue_family_all_supported_shader_stages), 1U, &acquire_barrier, 0U, NULL);
 		}
 		else
 		{
@@ -261,7 +464,7 @@ void brx_vk_graphics_command_buffer::acquire_asset_vertex_varying_buffer(brx_ass
 				0U,
 				VK_WHOLE_SIZE};
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, (!this->m_support_ray_tracing) ? VK_PIPELINE_STAGE_VERTEX_INPUT_BIT : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | g_graphics_queue_family_all_supported_shader_stages), 0U, 0U, NULL, 1U, &acquire_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, (!this->m_support_ray_tracing) ? VK_PIPELINE_STAGE_VERTEX_INPUT_BIT : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | g_graphics_queue_family_all_supported_shader_stages), 1U, &acquire_barrier, 0U, NULL);
 		}
 		else
 		{
@@ -296,7 +499,7 @@ void brx_vk_graphics_command_buffer::acquire_asset_index_buffer(brx_asset_index_
 				0U,
 				VK_WHOLE_SIZE};
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, (!this->m_support_ray_tracing) ? VK_PIPELINE_STAGE_VERTEX_INPUT_BIT : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | g_graphics_queue_family_all_supported_shader_stages), 0U, 0U, NULL, 1U, &acquire_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, (!this->m_support_ray_tracing) ? VK_PIPELINE_STAGE_VERTEX_INPUT_BIT : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | g_graphics_queue_family_all_supported_shader_stages), 1U, &acquire_barrier, 0U, NULL);
 		}
 		else
 		{
@@ -331,7 +534,7 @@ void brx_vk_graphics_command_buffer::acquire_asset_sampled_image(brx_asset_sampl
 				this->m_graphics_queue_family_index,
 				asset_sampled_image,
 				load_subresource_range};
-			this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, g_graphics_queue_family_all_supported_shader_stages, 0U, 0U, NULL, 0U, NULL, 1U, &acquire_barrier);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, g_graphics_queue_family_all_supported_shader_stages, 0U, NULL, 1U, &acquire_barrier);
 		}
 		else
 		{
@@ -363,7 +566,7 @@ void brx_vk_graphics_command_buffer::acquire_asset_compacted_bottom_level_accele
 				asset_buffer,
 				0U,
 				VK_WHOLE_SIZE};
-			this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR, 0U, 0U, NULL, 1U, &acquire_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR, 1U, &acquire_barrier, 0U, NULL);
 		}
 		else
 		{
@@ -382,16 +585,80 @@ void brx_vk_graphics_command_buffer::begin_debug_utils_label(char const *label_n
 	VkDebugUtilsLabelEXT debug_utils_label = {VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT, NULL, label_name, {1.0F, 1.0F, 1.0F, 1.0F}};
 	this->m_pfn_cmd_begin_debug_utils_label(this->m_command_buffer, &debug_utils_label);
 #endif
+
+	// the label regions are timed even if the "NDEBUG" is defined
+	if (NULL != this->m_debug_utils_label_list)
+	{
+		uint32_t query_index;
+		if (this->m_debug_utils_label_list->begin_label(label_name, &query_index))
+		{
+			// the pending barriers belong to the previous commands
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+			this->m_pfn_cmd_write_timestamp(this->m_command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, this->m_debug_utils_label_query_pool, query_index);
+		}
+	}
 }
 
 void brx_vk_graphics_command_buffer::end_debug_utils_label()
 {
+	if (NULL != this->m_debug_utils_label_list)
+	{
+		uint32_t query_index;
+		if (this->m_debug_utils_label_list->end_label(&query_index))
+		{
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+			this->m_pfn_cmd_write_timestamp(this->m_command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, this->m_debug_utils_label_query_pool, query_index);
+		}
+	}
+
 #ifndef NDEBUG
 	this->m_pfn_cmd_end_debug_utils_label(this->m_command_buffer);
 #endif
 }
 
-void brx_vk_graphics_command_buffer::begin_render_pass(brx_render_pass const *brx_render_pass, brx_frame_buffer const *brx_frame_buffer, uint32_t width, uint32_t height, uint32_t color_clear_value_count, float const (*color_clear_values)[4], float const *depth_clear_value, uint8_t const *stencil_clear_value)
+void brx_vk_graphics_command_buffer::reset_timestamp_query_pool(brx_timestamp_query_pool *wrapped_timestamp_query_pool)
+{
+	assert(NULL != wrapped_timestamp_query_pool);
+	brx_vk_timestamp_query_pool *const unwrapped_timestamp_query_pool = static_cast<brx_vk_timestamp_query_pool *>(wrapped_timestamp_query_pool);
+
+	unwrapped_timestamp_query_pool->get_label_list()->reset();
+
+	this->m_pfn_cmd_reset_query_pool(this->m_command_buffer, unwrapped_timestamp_query_pool->get_query_pool(), 0U, unwrapped_timestamp_query_pool->get_query_count());
+}
+
+void brx_vk_graphics_command_buffer::write_timestamp(brx_timestamp_query_pool *wrapped_timestamp_query_pool, uint32_t query_index)
+{
+	assert(NULL != wrapped_timestamp_query_pool);
+	brx_vk_timestamp_query_pool *const unwrapped_timestamp_query_pool = static_cast<brx_vk_timestamp_query_pool *>(wrapped_timestamp_query_pool);
+
+	assert(query_index < unwrapped_timestamp_query_pool->get_query_count());
+
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+	this->m_pfn_cmd_write_timestamp(this->m_command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, unwrapped_timestamp_query_pool->get_query_pool(), query_index);
+}
+
+void brx_vk_graphics_command_buffer::set_debug_utils_label_timestamp_query_pool(brx_timestamp_query_pool *wrapped_timestamp_query_pool)
+{
+	if (NULL != wrapped_timestamp_query_pool)
+	{
+		brx_vk_timestamp_query_pool *const unwrapped_timestamp_query_pool = static_cast<brx_vk_timestamp_query_pool *>(wrapped_timestamp_query_pool);
+
+		this->reset_timestamp_query_pool(unwrapped_timestamp_query_pool);
+
+		this->m_debug_utils_label_query_pool = unwrapped_timestamp_query_pool->get_query_pool();
+		this->m_debug_utils_label_list = unwrapped_timestamp_query_pool->get_label_list();
+	}
+	else
+	{
+		this->m_debug_utils_label_query_pool = VK_NULL_HANDLE;
+		this->m_debug_utils_label_list = NULL;
+	}
+}
+
+void brx_vk_graphics_command_buffer::begin_render_pass(brx_render_pass const *brx_render_pass, brx_frame_buffer const *brx_frame_buffer, uint32_t width, uint32_t height, uint32_t color_clear_value_count, float const (*color_clear_values)[4], float const *depth_clear_value, uint8_t const *stencil_clear_value, bool secondary_graphics_command_buffers)
 {
 	assert(NULL != brx_render_pass);
 	assert(NULL != brx_frame_buffer);
@@ -430,7 +697,33 @@ void brx_vk_graphics_command_buffer::begin_render_pass(brx_render_pass const *br
 		clear_values,
 	};
 
-	this->m_pfn_cmd_begin_render_pass(this->m_command_buffer, &render_pass_begin_info, VK_SUBPASS_CONTENTS_INLINE);
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+	this->m_pfn_cmd_begin_render_pass(this->m_command_buffer, &render_pass_begin_info, secondary_graphics_command_buffers ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
+}
+
+void brx_vk_graphics_command_buffer::execute_secondary_graphics_command_buffers(uint32_t secondary_graphics_command_buffer_count, brx_secondary_graphics_command_buffer const *const *wrapped_secondary_graphics_command_buffers)
+{
+	assert(VK_COMMAND_BUFFER_LEVEL_PRIMARY == this->m_command_buffer_level);
+	assert(NULL != wrapped_secondary_graphics_command_buffers);
+
+	// the command buffers are executed in the chunks to avoid the heap allocations when recording
+	constexpr uint32_t const max_chunk_command_buffer_count = 32U;
+	VkCommandBuffer command_buffers[max_chunk_command_buffer_count];
+	for (uint32_t chunk_base = 0U; chunk_base < secondary_graphics_command_buffer_count; chunk_base += max_chunk_command_buffer_count)
+	{
+		uint32_t const chunk_command_buffer_count = std::min(secondary_graphics_command_buffer_count - chunk_base, max_chunk_command_buffer_count);
+		for (uint32_t chunk_command_buffer_index = 0U; chunk_command_buffer_index < chunk_command_buffer_count; ++chunk_command_buffer_index)
+		{
+			assert(NULL != wrapped_secondary_graphics_command_buffers[chunk_base + chunk_command_buffer_index]);
+			command_buffers[chunk_command_buffer_index] = static_cast<brx_vk_secondary_graphics_command_buffer const *>(wrapped_secondary_graphics_command_buffers[chunk_base + chunk_command_buffer_index])->get_command_buffer();
+		}
+
+		this->m_pfn_cmd_execute_commands(this->m_command_buffer, chunk_command_buffer_count, command_buffers);
+	}
+
+	// the state of the primary command buffer is undefined after the secondary command buffers are executed
+	this->invalidate_shadow_state();
 }
 
 void brx_vk_graphics_command_buffer::bind_graphics_pipeline(brx_graphics_pipeline const *wrapped_graphics_pipeline)
@@ -438,67 +731,126 @@ void brx_vk_graphics_command_buffer::bind_graphics_pipeline(brx_graphics_pipelin
 	assert(NULL != wrapped_graphics_pipeline);
 	VkPipeline const graphics_pipeline = static_cast<brx_vk_graphics_pipeline const *>(wrapped_graphics_pipeline)->get_pipeline();
 
-	this->m_pfn_cmd_bind_pipeline(this->m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphics_pipeline);
+	if (this->m_bound_graphics_pipeline != graphics_pipeline)
+	{
+		this->m_pfn_cmd_bind_pipeline(this->m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphics_pipeline);
+		this->m_bound_graphics_pipeline = graphics_pipeline;
+		++this->m_statistics.emitted_state_command_count;
+	}
+	else
+	{
+		++this->m_statistics.elided_state_command_count;
+	}
 }
 
 void brx_vk_graphics_command_buffer::set_view_port(uint32_t width, uint32_t height)
 {
-	// Vulkan Flip Y
-	float const view_port_y = static_cast<float>(height);
-	float const view_port_height = -static_cast<float>(height);
-
-	VkViewport view_port = {0.0F, view_port_y, static_cast<float>(width), view_port_height, 0.0F, 1.0F};
-	this->m_pfn_cmd_set_view_port(this->m_command_buffer, 0U, 1U, &view_port);
+	if ((this->m_bound_view_port_width != width) || (this->m_bound_view_port_height != height))
+	{
+		// Vulkan Flip Y
+		float const view_port_y = static_cast<float>(height);
+		float const view_port_height = -static_cast<float>(height);
+
+		VkViewport view_port = {0.0F, view_port_y, static_cast<float>(width), view_port_height, 0.0F, 1.0F};
+		this->m_pfn_cmd_set_view_port(this->m_command_buffer, 0U, 1U, &view_port);
+		this->m_bound_view_port_width = width;
+		this->m_bound_view_port_height = height;
+		++this->m_statistics.emitted_state_command_count;
+	}
+	else
+	{
+		++this->m_statistics.elided_state_command_count;
+	}
 }
 
 void brx_vk_graphics_command_buffer::set_scissor(uint32_t width, uint32_t height)
 {
-	VkRect2D scissor = {{0, 0}, {width, height}};
-	this->m_pfn_cmd_set_scissor(this->m_command_buffer, 0U, 1U, &scissor);
+	if ((this->m_bound_scissor_width != width) || (this->m_bound_scissor_height != height))
+	{
+		VkRect2D scissor = {{0, 0}, {width, height}};
+		this->m_pfn_cmd_set_scissor(this->m_command_buffer, 0U, 1U, &scissor);
+		this->m_bound_scissor_width = width;
+		this->m_bound_scissor_height = height;
+		++this->m_statistics.emitted_state_command_count;
+	}
+	else
+	{
+		++this->m_statistics.elided_state_command_count;
+	}
 }
 
 void brx_vk_graphics_command_buffer::bind_graphics_descriptor_sets(brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *wrapped_descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets)
 {
-	assert(NULL != wrapped_pipeline_layout);
-	assert(NULL != wrapped_descriptor_sets);
-	VkPipelineLayout const pipeline_layout = static_cast<brx_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
-
-	brx_vector<VkDescriptorSet> descriptor_sets(static_cast<size_t>(descriptor_set_count));
-	for (uint32_t descriptor_set_index = 0U; descriptor_set_index < descriptor_set_count; ++descriptor_set_index)
+	if (__intermediate_bind_descriptor_sets(this->m_pfn_cmd_bind_descriptor_sets, this->m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, &this->m_bound_graphics_descriptor_sets, wrapped_pipeline_layout, descriptor_set_count, wrapped_descriptor_sets, dynamic_offet_count, dynamic_offsets))
 	{
-		assert(NULL != wrapped_descriptor_sets[descriptor_set_index]);
-		descriptor_sets[descriptor_set_index] = static_cast<brx_vk_descriptor_set const *>(wrapped_descriptor_sets[descriptor_set_index])->get_descriptor_set();
+		++this->m_statistics.emitted_state_command_count;
 	}
+	else
+	{
+		++this->m_statistics.elided_state_command_count;
+	}
+}
+
+void brx_vk_graphics_command_buffer::push_graphics_constants(brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t offset, uint32_t size, void const *values)
+{
+	assert(NULL != wrapped_pipeline_layout);
+	assert(NULL != values);
+	brx_vk_pipeline_layout const *const unwrapped_pipeline_layout = static_cast<brx_vk_pipeline_layout const *>(wrapped_pipeline_layout);
+
+	assert(0U == (offset & 3U));
+	assert(0U == (size & 3U));
+	assert((offset + size) <= unwrapped_pipeline_layout->get_push_constant_size());
 
-	this->m_pfn_cmd_bind_descriptor_sets(this->m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0U, descriptor_set_count, &descriptor_sets[0], dynamic_offet_count, dynamic_offsets);
+	// the push constants are shared by the graphics and compute pipelines in Vulkan
+	this->m_pfn_cmd_push_constants(this->m_command_buffer, unwrapped_pipeline_layout->get_pipeline_layout(), VK_SHADER_STAGE_ALL, offset, size, values);
 }
 
-void brx_vk_graphics_command_buffer::bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers)
+void brx_vk_graphics_command_buffer::bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers, uint64_t const *vertex_buffer_offsets)
 {
 	assert(NULL != vertex_buffers);
 
-	constexpr uint32_t const max_vertex_buffer_count = 16U;
-	assert(vertex_buffer_count < max_vertex_buffer_count);
+	constexpr uint32_t const max_vertex_buffer_count = g_vk_max_vertex_buffer_count;
+	assert(vertex_buffer_count <= max_vertex_buffer_count);
 	vertex_buffer_count = (vertex_buffer_count < max_vertex_buffer_count) ? vertex_buffer_count : max_vertex_buffer_count;
 
+	// the vertex buffers of the higher binding numbers are NOT used by the pipeline, and thus are NOT compared
+	bool unchanged = (this->m_bound_vertex_buffer_count >= vertex_buffer_count);
+
 	VkBuffer buffers[max_vertex_buffer_count];
 	VkDeviceSize offsets[max_vertex_buffer_count];
 	for (uint32_t vertex_buffer_index = 0U; vertex_buffer_index < vertex_buffer_count; ++vertex_buffer_index)
 	{
 		assert(NULL != vertex_buffers[vertex_buffer_index]);
 		buffers[vertex_buffer_index] = static_cast<brx_vk_vertex_buffer const *>(vertex_buffers[vertex_buffer_index])->get_buffer();
-		offsets[vertex_buffer_index] = 0U;
+		offsets[vertex_buffer_index] = (NULL != vertex_buffer_offsets) ? vertex_buffer_offsets[vertex_buffer_index] : 0U;
+		unchanged = unchanged && (this->m_bound_vertex_buffers[vertex_buffer_index] == buffers[vertex_buffer_index]) && (this->m_bound_vertex_buffer_offsets[vertex_buffer_index] == offsets[vertex_buffer_index]);
 	}
 
-	this->m_pfn_cmd_bind_vertex_buffers(this->m_command_buffer, 0U, vertex_buffer_count, buffers, offsets);
+	if (!unchanged)
+	{
+		this->m_pfn_cmd_bind_vertex_buffers(this->m_command_buffer, 0U, vertex_buffer_count, buffers, offsets);
+		for (uint32_t vertex_buffer_index = 0U; vertex_buffer_index < vertex_buffer_count; ++vertex_buffer_index)
+		{
+			this->m_bound_vertex_buffers[vertex_buffer_index] = buffers[vertex_buffer_index];
+			this->m_bound_vertex_buffer_offsets[vertex_buffer_index] = offsets[vertex_buffer_index];
+		}
+		this->m_bound_vertex_buffer_count = std::max(this->m_bound_vertex_buffer_count, vertex_buffer_count);
+		++this->m_statistics.emitted_state_command_count;
+	}
+	else
+	{
+		++this->m_statistics.elided_state_command_count;
+	}
 }
 
-void brx_vk_graphics_command_buffer::draw(uint32_t vertex_count, uint32_t instance_count)
+void brx_vk_graphics_command_buffer::draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance)
 {
-	this->m_pfn_cmd_draw(this->m_command_buffer, vertex_count, instance_count, 0U, 0U);
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+	this->m_pfn_cmd_draw(this->m_command_buffer, vertex_count, instance_count, first_vertex, first_instance);
 }
 
-void brx_vk_graphics_command_buffer::draw_index(brx_index_buffer const *wrapped_index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE wrapped_index_type, uint32_t index_count, uint32_t instance_count)
+void brx_vk_graphics_command_buffer::bind_index_buffer(brx_index_buffer const *wrapped_index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE wrapped_index_type)
 {
 	assert(NULL != wrapped_index_buffer);
 	VkBuffer const index_buffer = static_cast<brx_vk_index_buffer const *>(wrapped_index_buffer)->get_buffer();
@@ -517,9 +869,92 @@ void brx_vk_graphics_command_buffer::draw_index(brx_index_buffer const *wrapped_
 		index_type = static_cast<VkIndexType>(-1);
 	}
 
-	this->m_pfn_cmd_bind_index_buffer(this->m_command_buffer, index_buffer, 0U, index_type);
+	if ((this->m_bound_index_buffer != index_buffer) || (this->m_bound_index_type != index_type))
+	{
+		this->m_pfn_cmd_bind_index_buffer(this->m_command_buffer, index_buffer, 0U, index_type);
+		this->m_bound_index_buffer = index_buffer;
+		this->m_bound_index_type = index_type;
+		++this->m_statistics.emitted_state_command_count;
+	}
+	else
+	{
+		++this->m_statistics.elided_state_command_count;
+	}
+}
+
+void brx_vk_graphics_command_buffer::draw_index(brx_index_buffer const *wrapped_index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE wrapped_index_type, uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance)
+{
+	this->bind_index_buffer(wrapped_index_buffer, wrapped_index_type);
+
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+	this->m_pfn_cmd_draw_indexed(this->m_command_buffer, index_count, instance_count, first_index, vertex_offset, first_instance);
+}
+
+void brx_vk_graphics_command_buffer::draw_indirect(brx_indirect_argument_buffer const *wrapped_argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *wrapped_count_buffer, uint64_t count_offset)
+{
+	static_assert(sizeof(BRX_DRAW_INDIRECT_COMMAND) == sizeof(VkDrawIndirectCommand), "");
+	constexpr uint32_t const stride = sizeof(VkDrawIndirectCommand);
+
+	assert(NULL != wrapped_argument_buffer);
+	VkBuffer const argument_buffer = static_cast<brx_vk_indirect_argument_buffer const *>(wrapped_argument_buffer)->get_buffer();
+	assert(0U == (argument_offset & 3U));
+
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+	if (NULL != wrapped_count_buffer)
+	{
+		VkBuffer const count_buffer = static_cast<brx_vk_indirect_argument_buffer const *>(wrapped_count_buffer)->get_buffer();
+		assert(0U == (count_offset & 3U));
+
+		assert(NULL != this->m_pfn_cmd_draw_indirect_count);
+		this->m_pfn_cmd_draw_indirect_count(this->m_command_buffer, argument_buffer, argument_offset, count_buffer, count_offset, max_draw_count, stride);
+	}
+	else if (this->m_support_multi_draw_indirect || (max_draw_count <= 1U))
+	{
+		this->m_pfn_cmd_draw_indirect(this->m_command_buffer, argument_buffer, argument_offset, max_draw_count, stride);
+	}
+	else
+	{
+		for (uint32_t draw_index = 0U; draw_index < max_draw_count; ++draw_index)
+		{
+			this->m_pfn_cmd_draw_indirect(this->m_command_buffer, argument_buffer, argument_offset + static_cast<uint64_t>(stride) * draw_index, 1U, stride);
+		}
+	}
+}
+
+void brx_vk_graphics_command_buffer::draw_index_indirect(brx_index_buffer const *wrapped_index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE wrapped_index_type, brx_indirect_argument_buffer const *wrapped_argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *wrapped_count_buffer, uint64_t count_offset)
+{
+	static_assert(sizeof(BRX_DRAW_INDEX_INDIRECT_COMMAND) == sizeof(VkDrawIndexedIndirectCommand), "");
+	constexpr uint32_t const stride = sizeof(VkDrawIndexedIndirectCommand);
+
+	this->bind_index_buffer(wrapped_index_buffer, wrapped_index_type);
+
+	assert(NULL != wrapped_argument_buffer);
+	VkBuffer const argument_buffer = static_cast<brx_vk_indirect_argument_buffer const *>(wrapped_argument_buffer)->get_buffer();
+	assert(0U == (argument_offset & 3U));
 
-	this->m_pfn_cmd_draw_indexed(this->m_command_buffer, index_count, instance_count, 0U, 0U, 0U);
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+	if (NULL != wrapped_count_buffer)
+	{
+		VkBuffer const count_buffer = static_cast<brx_vk_indirect_argument_buffer const *>(wrapped_count_buffer)->get_buffer();
+		assert(0U == (count_offset & 3U));
+
+		assert(NULL != this->m_pfn_cmd_draw_indexed_indirect_count);
+		this->m_pfn_cmd_draw_indexed_indirect_count(this->m_command_buffer, argument_buffer, argument_offset, count_buffer, count_offset, max_draw_count, stride);
+	}
+	else if (this->m_support_multi_draw_indirect || (max_draw_count <= 1U))
+	{
+		this->m_pfn_cmd_draw_indexed_indirect(this->m_command_buffer, argument_buffer, argument_offset, max_draw_count, stride);
+	}
+	else
+	{
+		for (uint32_t draw_index = 0U; draw_index < max_draw_count; ++draw_index)
+		{
+			this->m_pfn_cmd_draw_indexed_indirect(this->m_command_buffer, argument_buffer, argument_offset + static_cast<uint64_t>(stride) * draw_index, 1U, stride);
+		}
+	}
 }
 
 void brx_vk_graphics_command_buffer::end_render_pass()
@@ -545,7 +980,27 @@ void brx_vk_graphics_command_buffer::compute_pass_load_storage_image(brx_storage
 		VK_QUEUE_FAMILY_IGNORED,
 		load_image,
 		load_subresource_range};
-	this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0U, 0U, NULL, 0U, NULL, 1U, &load_barrier);
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0U, NULL, 1U, &load_barrier);
+}
+
+void brx_vk_graphics_command_buffer::compute_pass_load_indirect_argument_buffer(brx_indirect_argument_buffer const *wrapped_indirect_argument_buffer)
+{
+	assert(NULL != wrapped_indirect_argument_buffer);
+
+	// load operation
+	// the previous indirect commands should have completed reading before the compute shader writes (write after read)
+	VkBuffer const load_buffer = static_cast<brx_vk_indirect_argument_buffer const *>(wrapped_indirect_argument_buffer)->get_buffer();
+	VkBufferMemoryBarrier const load_barrier = {
+		VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		NULL,
+		0U,
+		VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+		VK_QUEUE_FAMILY_IGNORED,
+		VK_QUEUE_FAMILY_IGNORED,
+		load_buffer,
+		0U,
+		VK_WHOLE_SIZE};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 1U, &load_barrier, 0U, NULL);
 }
 
 void brx_vk_graphics_command_buffer::bind_compute_pipeline(brx_compute_pipeline const *wrapped_compute_pipeline)
@@ -553,35 +1008,687 @@ void brx_vk_graphics_command_buffer::bind_compute_pipeline(brx_compute_pipeline
 	assert(NULL != wrapped_compute_pipeline);
 	VkPipeline const compute_pipeline = static_cast<brx_vk_compute_pipeline const *>(wrapped_compute_pipeline)->get_pipeline();
 
-	this->m_pfn_cmd_bind_pipeline(this->m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, compute_pipeline);
+	if (this->m_bound_compute_pipeline != compute_pipeline)
+	{
+		this->m_pfn_cmd_bind_pipeline(this->m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, compute_pipeline);
+		this->m_bound_compute_pipeline = compute_pipeline;
+		++this->m_statistics.emitted_state_command_count;
+	}
+	else
+	{
+		++this->m_statistics.elided_state_command_count;
+	}
 }
 
 void brx_vk_graphics_command_buffer::bind_compute_descriptor_sets(brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *wrapped_descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets)
 {
-	assert(NULL != wrapped_pipeline_layout);
-	assert(NULL != wrapped_descriptor_sets);
-	VkPipelineLayout const pipeline_layout = static_cast<brx_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
-
-	brx_vector<VkDescriptorSet> descriptor_sets(static_cast<size_t>(descriptor_set_count));
-	for (uint32_t descriptor_set_index = 0U; descriptor_set_index < descriptor_set_count; ++descriptor_set_index)
+	if (__intermediate_bind_descriptor_sets(this->m_pfn_cmd_bind_descriptor_sets, this->m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, &this->m_bound_compute_descriptor_sets, wrapped_pipeline_layout, descriptor_set_count, wrapped_descriptor_sets, dynamic_offet_count, dynamic_offsets))
 	{
-		assert(NULL != wrapped_descriptor_sets[descriptor_set_index]);
-		descriptor_sets[descriptor_set_index] = static_cast<brx_vk_descriptor_set const *>(wrapped_descriptor_sets[descriptor_set_index])->get_descriptor_set();
+		++this->m_statistics.emitted_state_command_count;
 	}
+	else
+	{
+		++this->m_statistics.elided_state_command_count;
+	}
+}
+
+void brx_vk_graphics_command_buffer::push_compute_constants(brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t offset, uint32_t size, void const *values)
+{
+	assert(NULL != wrapped_pipeline_layout);
+	assert(NULL != values);
+	brx_vk_pipeline_layout const *const unwrapped_pipeline_layout = static_cast<brx_vk_pipeline_layout const *>(wrapped_pipeline_layout);
+
+	assert(0U == (offset & 3U));
+	assert(0U == (size & 3U));
+	assert((offset + size) <= unwrapped_pipeline_layout->get_push_constant_size());
+
+	this->m_pfn_cmd_push_constants(this->m_command_buffer, unwrapped_pipeline_layout->get_pipeline_layout(), VK_SHADER_STAGE_ALL, offset, size, values);
+}
+
+void brx_vk_graphics_command_buffer::dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z)
+{
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+	this->m_pfn_cmd_dispatch(this->m_command_buffer, group_count_x, group_count_y, group_count_z);
+}
+
+void brx_vk_graphics_command_buffer::dispatch_indirect(brx_indirect_argument_buffer const *wrapped_argument_buffer, uint64_t argument_offset)
+{
+	static_assert(sizeof(BRX_DISPATCH_INDIRECT_COMMAND) == sizeof(VkDispatchIndirectCommand), "");
+
+	assert(NULL != wrapped_argument_buffer);
+	VkBuffer const argument_buffer = static_cast<brx_vk_indirect_argument_buffer const *>(wrapped_argument_buffer)->get_buffer();
+	assert(0U == (argument_offset & 3U));
+
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+	this->m_pfn_cmd_dispatch_indirect(this->m_command_buffer, argument_buffer, argument_offset);
+}
+
+void brx_vk_graphics_command_buffer::compute_pass_store_storage_image(brx_storage_image const *wrapped_storage_image, BRX_STORAGE_IMAGE_STORE_OPERATION store_operation)
+{
+	assert(BRX_STORAGE_IMAGE_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE == store_operation);
+
+	// store operation
+	VkImage const store_image = static_cast<brx_vk_storage_image const *>(wrapped_storage_image)->get_image();
+	VkImageSubresourceRange const store_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
+	VkImageMemoryBarrier const store_barrier = {
+		VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+		NULL,
+		VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+		VK_ACCESS_SHADER_READ_BIT,
+		VK_IMAGE_LAYOUT_GENERAL,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_QUEUE_FAMILY_IGNORED,
+		VK_QUEUE_FAMILY_IGNORED,
+		store_image,
+		store_subresource_range};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, g_graphics_queue_family_all_supported_shader_stages, 0U, NULL, 1U, &store_barrier);
+}
+
+void brx_vk_graphics_command_buffer::compute_pass_store_indirect_argument_buffer(brx_indirect_argument_buffer const *wrapped_indirect_argument_buffer)
+{
+	assert(NULL != wrapped_indirect_argument_buffer);
+
+	// store operation
+	VkBuffer const store_buffer = static_cast<brx_vk_indirect_argument_buffer const *>(wrapped_indirect_argument_buffer)->get_buffer();
+	VkBufferMemoryBarrier const store_barrier = {
+		VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		NULL,
+		VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+		VK_ACCESS_INDIRECT_COMMAND_READ_BIT,
+		VK_QUEUE_FAMILY_IGNORED,
+		VK_QUEUE_FAMILY_IGNORED,
+		store_buffer,
+		0U,
+		VK_WHOLE_SIZE};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, 1U, &store_barrier, 0U, NULL);
+}
+
+void brx_vk_graphics_command_buffer::release_storage_buffer_to_compute_queue(brx_intermediate_storage_buffer const *wrapped_storage_buffer)
+{
+	assert(NULL != wrapped_storage_buffer);
+
+	// the queue family ownership transfer is NOT required when the compute queue family is the same as the graphics queue family, and the timeline fence is sufficient
+	if (this->m_compute_queue_family_index == this->m_graphics_queue_family_index)
+	{
+		return;
+	}
+
+	VkBuffer const storage_buffer = static_cast<brx_vk_intermediate_storage_buffer const *>(wrapped_storage_buffer)->get_buffer();
+	VkBufferMemoryBarrier const release_barrier = {
+		VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		NULL,
+		VK_ACCESS_SHADER_WRITE_BIT,
+		0U,
+		this->m_graphics_queue_family_index,
+		this->m_compute_queue_family_index,
+		storage_buffer,
+		0U,
+		VK_WHOLE_SIZE};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | g_graphics_queue_family_all_supported_shader_stages), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 1U, &release_barrier, 0U, NULL);
+}
+
+void brx_vk_graphics_command_buffer::release_storage_image_to_compute_queue(brx_storage_image const *wrapped_storage_image)
+{
+	assert(NULL != wrapped_storage_image);
+
+	if (this->m_compute_queue_family_index == this->m_graphics_queue_family_index)
+	{
+		return;
+	}
+
+	// the layout is NOT changed, since the image has already been transitioned by the "compute_pass_store_storage_image"
+	VkImage const storage_image = static_cast<brx_vk_storage_image const *>(wrapped_storage_image)->get_image();
+	VkImageSubresourceRange const release_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
+	VkImageMemoryBarrier const release_barrier = {
+		VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+		NULL,
+		0U,
+		0U,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		this->m_graphics_queue_family_index,
+		this->m_compute_queue_family_index,
+		storage_image,
+		release_subresource_range};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, g_graphics_queue_family_all_supported_shader_stages, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0U, NULL, 1U, &release_barrier);
+}
+
+void brx_vk_graphics_command_buffer::acquire_storage_buffer_from_compute_queue(brx_intermediate_storage_buffer const *wrapped_storage_buffer)
+{
+	assert(NULL != wrapped_storage_buffer);
+
+	if (this->m_compute_queue_family_index == this->m_graphics_queue_family_index)
+	{
+		return;
+	}
+
+	VkBuffer const storage_buffer = static_cast<brx_vk_intermediate_storage_buffer const *>(wrapped_storage_buffer)->get_buffer();
+	VkBufferMemoryBarrier const acquire_barrier = {
+		VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		NULL,
+		0U,
+		VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT,
+		this->m_compute_queue_family_index,
+		this->m_graphics_queue_family_index,
+		storage_buffer,
+		0U,
+		VK_WHOLE_SIZE};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | g_graphics_queue_family_all_supported_shader_stages), 1U, &acquire_barrier, 0U, NULL);
+}
+
+void brx_vk_graphics_command_buffer::acquire_storage_image_from_compute_queue(brx_storage_image const *wrapped_storage_image)
+{
+	assert(NULL != wrapped_storage_image);
+
+	if (this->m_compute_queue_family_index == this->m_graphics_queue_family_index)
+	{
+		return;
+	}
+
+	VkImage const storage_image = static_cast<brx_vk_storage_image const *>(wrapped_storage_image)->get_image();
+	VkImageSubresourceRange const acquire_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
+	VkImageMemoryBarrier const acquire_barrier = {
+		VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+		NULL,
+		0U,
+		VK_ACCESS_SHADER_READ_BIT,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		this->m_compute_queue_family_index,
+		this->m_graphics_queue_family_index,
+		storage_image,
+		acquire_subresource_range};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, g_graphics_queue_family_all_supported_shader_stages, 0U, NULL, 1U, &acquire_barrier);
+}
+
+void brx_vk_graphics_command_buffer::build_top_level_acceleration_structure(brx_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, brx_top_level_acceleration_structure_instance_upload_buffer *wrapped_top_level_acceleration_structure_instance_upload_buffer, brx_scratch_buffer *wrapped_scratch_buffer)
+{
+	assert(NULL != wrapped_top_level_acceleration_structure);
+	VkAccelerationStructureKHR const destination_acceleration_structure = static_cast<brx_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_acceleration_structure();
+	VkBuffer const destination_buffer = static_cast<brx_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_buffer();
+
+	assert(NULL != wrapped_top_level_acceleration_structure_instance_upload_buffer);
+	VkDeviceAddress const top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base = static_cast<brx_vk_top_level_acceleration_structure_instance_upload_buffer *>(wrapped_top_level_acceleration_structure_instance_upload_buffer)->get_device_memory_range_base();
+
+	assert(NULL != wrapped_scratch_buffer);
+	VkDeviceAddress const scratch_buffer_device_memory_range_base = static_cast<brx_vk_scratch_buffer *>(wrapped_scratch_buffer)->get_device_memory_range_base();
+
+	VkAccelerationStructureGeometryKHR const acceleration_structure_geometry = {
+		VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR,
+		NULL,
+		VK_GEOMETRY_TYPE_INSTANCES_KHR,
+		{.instances =
+			 {
+				 VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR,
+				 NULL,
+				 VK_FALSE,
+				 top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base,
+			 }}};
+
+	VkAccelerationStructureBuildGeometryInfoKHR const acceleration_structure_build_geometry_info = {
+		VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR,
+		NULL,
+		VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR,
+		VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_BUILD_BIT_KHR,
+		VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR,
+		VK_NULL_HANDLE,
+		destination_acceleration_structure,
+		1U,
+		&acceleration_structure_geometry,
+		NULL,
+		{.deviceAddress = scratch_buffer_device_memory_range_base}};
+
+	VkAccelerationStructureBuildRangeInfoKHR const acceleration_structure_build_range_info = {
+		top_level_acceleration_structure_instance_count,
+		0U,
+		0U,
+		0U};
+
+	VkAccelerationStructureBuildRangeInfoKHR const *const p_build_range_infos = &acceleration_structure_build_range_info;
+
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+	this->m_pfn_cmd_build_acceleration_structure(this->m_command_buffer, 1U, &acceleration_structure_build_geometry_info, &p_build_range_infos);
+
+	static_cast<brx_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->set_instance_count(top_level_acceleration_structure_instance_count);
+
+	VkBufferMemoryBarrier const release_barrier = {
+		VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		NULL,
+		VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
+		VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
+		VK_QUEUE_FAMILY_IGNORED,
+		VK_QUEUE_FAMILY_IGNORED,
+		destination_buffer,
+		0U,
+		VK_WHOLE_SIZE};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR | VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, 1U, &release_barrier, 0U, NULL);
+}
+
+void brx_vk_graphics_command_buffer::update_top_level_acceleration_structure(brx_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, brx_top_level_acceleration_structure_instance_upload_buffer *wrapped_top_level_acceleration_structure_instance_upload_buffer, brx_scratch_buffer *wrapped_scratch_buffer)
+{
+	assert(NULL != wrapped_top_level_acceleration_structure);
+	VkAccelerationStructureKHR const destination_acceleration_structure = static_cast<brx_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_acceleration_structure();
+
+	uint32_t const top_level_acceleration_structure_instance_count = static_cast<brx_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_instance_count();
+
+	assert(NULL != wrapped_top_level_acceleration_structure_instance_upload_buffer);
+	VkDeviceAddress const top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base = static_cast<brx_vk_top_level_acceleration_structure_instance_upload_buffer *>(wrapped_top_level_acceleration_structure_instance_upload_buffer)->get_device_memory_range_base();
+
+	VkAccelerationStructureGeometryKHR const acceleration_structure_geometry = {
+		VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR,
+		NULL,
+		VK_GEOMETRY_TYPE_INSTANCES_KHR,
+		{.instances =
+			 {
+				 VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR,
+				 NULL,
+				 VK_FALSE,
+				 top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base,
+			 }}};
+
+	assert(NULL != wrapped_scratch_buffer);
+	VkDeviceAddress const scratch_buffer_device_memory_range_base = static_cast<brx_vk_scratch_buffer *>(wrapped_scratch_buffer)->get_device_memory_range_base();
+
+	VkAccelerationStructureBuildGeometryInfoKHR const acceleration_structure_build_geometry_info = {
+		VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR,
+		NULL,
+		VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR,
+		VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_BUILD_BIT_KHR,
+		VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR,
+		destination_acceleration_structure,
+		destination_acceleration_structure,
+		1U,
+		&acceleration_structure_geometry,
+		NULL,
+		{.deviceAddress = scratch_buffer_device_memory_range_base}};
+
+	VkAccelerationStructureBuildRangeInfoKHR const acceleration_structure_build_range_info = {
+		top_level_acceleration_structure_instance_count,
+		0U,
+		0U,
+		0U};
+
+	VkAccelerationStructureBuildRangeInfoKHR const *const p_build_range_infos = &acceleration_structure_build_range_info;
+
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+	this->m_pfn_cmd_build_acceleration_structure(this->m_command_buffer, 1U, &acceleration_structure_build_geometry_info, &p_build_range_infos);
+}
+
+void brx_vk_graphics_command_buffer::acceleration_structure_pass_store_top_level(brx_top_level_acceleration_structure *wrapped_top_level_acceleration_structure)
+{
+	assert(NULL != wrapped_top_level_acceleration_structure);
+	VkBuffer const destination_buffer = static_cast<brx_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_buffer();
+
+	VkBufferMemoryBarrier const release_barrier = {
+		VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		NULL,
+		VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
+		VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
+		VK_QUEUE_FAMILY_IGNORED,
+		VK_QUEUE_FAMILY_IGNORED,
+		destination_buffer,
+		0U,
+		VK_WHOLE_SIZE};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR | VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, 1U, &release_barrier, 0U, NULL);
+}
+
+void brx_vk_graphics_command_buffer::end()
+{
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+	VkResult res_end_command_buffer = this->m_pfn_end_command_buffer(this->m_command_buffer);
+	assert(VK_SUCCESS == res_end_command_buffer);
+}
+
+BRX_GRAPHICS_COMMAND_BUFFER_STATISTICS brx_vk_graphics_command_buffer::get_statistics() const
+{
+	return this->m_statistics;
+}
+
+brx_vk_secondary_graphics_command_buffer::brx_vk_secondary_graphics_command_buffer()
+{
+}
+
+void brx_vk_secondary_graphics_command_buffer::init(bool support_ray_tracing, bool support_multi_draw_indirect, bool has_dedicated_upload_queue, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, uint32_t compute_queue_family_index, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+	this->m_graphics_command_buffer.init(VK_COMMAND_BUFFER_LEVEL_SECONDARY, support_ray_tracing, support_multi_draw_indirect, has_dedicated_upload_queue, graphics_queue_family_index, upload_queue_family_index, compute_queue_family_index, dispatch_table, device, allocation_callbacks);
+}
+
+void brx_vk_secondary_graphics_command_buffer::uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+	this->m_graphics_command_buffer.uninit(dispatch_table, device, allocation_callbacks);
+}
+
+brx_vk_secondary_graphics_command_buffer::~brx_vk_secondary_graphics_command_buffer()
+{
+}
+
+VkCommandPool brx_vk_secondary_graphics_command_buffer::get_command_pool() const
+{
+	return this->m_graphics_command_buffer.get_command_pool();
+}
+
+VkCommandBuffer brx_vk_secondary_graphics_command_buffer::get_command_buffer() const
+{
+	return this->m_graphics_command_buffer.get_command_buffer();
+}
+
+void brx_vk_secondary_graphics_command_buffer::begin(brx_render_pass const *render_pass, brx_frame_buffer const *frame_buffer, uint32_t width, uint32_t height)
+{
+	this->m_graphics_command_buffer.begin_secondary(render_pass, frame_buffer, width, height);
+}
+
+void brx_vk_secondary_graphics_command_buffer::bind_graphics_pipeline(brx_graphics_pipeline const *graphics_pipeline)
+{
+	this->m_graphics_command_buffer.bind_graphics_pipeline(graphics_pipeline);
+}
+
+void brx_vk_secondary_graphics_command_buffer::bind_graphics_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets)
+{
+	this->m_graphics_command_buffer.bind_graphics_descriptor_sets(pipeline_layout, descriptor_set_count, descriptor_sets, dynamic_offet_count, dynamic_offsets);
+}
+
+void brx_vk_secondary_graphics_command_buffer::push_graphics_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values)
+{
+	this->m_graphics_command_buffer.push_graphics_constants(pipeline_layout, offset, size, values);
+}
+
+void brx_vk_secondary_graphics_command_buffer::bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers, uint64_t const *vertex_buffer_offsets)
+{
+	this->m_graphics_command_buffer.bind_vertex_buffers(vertex_buffer_count, vertex_buffers, vertex_buffer_offsets);
+}
+
+void brx_vk_secondary_graphics_command_buffer::draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance)
+{
+	this->m_graphics_command_buffer.draw(vertex_count, instance_count, first_vertex, first_instance);
+}
+
+void brx_vk_secondary_graphics_command_buffer::draw_index(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance)
+{
+	this->m_graphics_command_buffer.draw_index(index_buffer, index_type, index_count, instance_count, first_index, vertex_offset, first_instance);
+}
+
+void brx_vk_secondary_graphics_command_buffer::draw_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer, uint64_t count_offset)
+{
+	this->m_graphics_command_buffer.draw_indirect(argument_buffer, argument_offset, max_draw_count, count_buffer, count_offset);
+}
+
+void brx_vk_secondary_graphics_command_buffer::draw_index_indirect(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer, uint64_t count_offset)
+{
+	this->m_graphics_command_buffer.draw_index_indirect(index_buffer, index_type, argument_buffer, argument_offset, max_draw_count, count_buffer, count_offset);
+}
+
+void brx_vk_secondary_graphics_command_buffer::end()
+{
+	this->m_graphics_command_buffer.end();
+}
+
+BRX_GRAPHICS_COMMAND_BUFFER_STATISTICS brx_vk_secondary_graphics_command_buffer::get_statistics() const
+{
+	return this->m_graphics_command_buffer.get_statistics();
+}
+
+brx_vk_compute_command_buffer::brx_vk_compute_command_buffer()
+	: m_graphics_queue_family_index(VK_QUEUE_FAMILY_IGNORED),
+	  m_compute_queue_family_index(VK_QUEUE_FAMILY_IGNORED),
+	  m_command_pool(VK_NULL_HANDLE),
+	  m_command_buffer(VK_NULL_HANDLE),
+	  m_pfn_begin_command_buffer(NULL),
+	  m_pfn_cmd_pipeline_barrier(NULL),
+	  m_pfn_cmd_bind_pipeline(NULL),
+	  m_pfn_cmd_bind_descriptor_sets(NULL),
+	  m_pfn_cmd_push_constants(NULL),
+	  m_pfn_cmd_dispatch(NULL),
+	  m_pfn_cmd_dispatch_indirect(NULL),
+	  m_pfn_end_command_buffer(NULL),
+	  m_bound_compute_pipeline(VK_NULL_HANDLE)
+{
+	this->m_bound_compute_descriptor_sets.descriptor_set_count = 0U;
+	this->m_bound_compute_descriptor_sets.push_constant_size = 0U;
+}
+
+void brx_vk_compute_command_buffer::init(uint32_t graphics_queue_family_index, uint32_t compute_queue_family_index, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+	this->m_graphics_queue_family_index = graphics_queue_family_index;
+	this->m_compute_queue_family_index = compute_queue_family_index;
+
+	PFN_vkCreateCommandPool const pfn_create_command_pool = dispatch_table->pfn_create_command_pool;
+	assert(NULL != pfn_create_command_pool);
+	PFN_vkAllocateCommandBuffers const pfn_allocate_command_buffers = dispatch_table->pfn_allocate_command_buffers;
+	assert(NULL != pfn_allocate_command_buffers);
+
+	assert(VK_NULL_HANDLE == this->m_command_pool);
+	VkCommandPoolCreateInfo const command_pool_create_info = {
+		VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		NULL,
+		0U,
+		compute_queue_family_index};
+	VkResult const res_create_command_pool = pfn_create_command_pool(device, &command_pool_create_info, allocation_callbacks, &this->m_command_pool);
+	assert(VK_SUCCESS == res_create_command_pool);
+
+	assert(VK_NULL_HANDLE == this->m_command_buffer);
+	VkCommandBufferAllocateInfo const command_buffer_allocate_info = {
+		VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+		NULL,
+		this->m_command_pool,
+		VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		1U};
+	VkResult const res_allocate_command_buffers = pfn_allocate_command_buffers(device, &command_buffer_allocate_info, &this->m_command_buffer);
+	assert(VK_SUCCESS == res_allocate_command_buffers);
+
+	assert(NULL == this->m_pfn_begin_command_buffer);
+	this->m_pfn_begin_command_buffer = dispatch_table->pfn_begin_command_buffer;
+	assert(NULL == this->m_pfn_cmd_pipeline_barrier);
+	this->m_pfn_cmd_pipeline_barrier = dispatch_table->pfn_cmd_pipeline_barrier;
+	assert(NULL == this->m_pfn_cmd_bind_pipeline);
+	this->m_pfn_cmd_bind_pipeline = dispatch_table->pfn_cmd_bind_pipeline;
+	assert(NULL == this->m_pfn_cmd_bind_descriptor_sets);
+	this->m_pfn_cmd_bind_descriptor_sets = dispatch_table->pfn_cmd_bind_descriptor_sets;
+	assert(NULL == this->m_pfn_cmd_push_constants);
+	this->m_pfn_cmd_push_constants = dispatch_table->pfn_cmd_push_constants;
+	assert(NULL == this->m_pfn_cmd_dispatch);
+	this->m_pfn_cmd_dispatch = dispatch_table->pfn_cmd_dispatch;
+	assert(NULL == this->m_pfn_cmd_dispatch_indirect);
+	this->m_pfn_cmd_dispatch_indirect = dispatch_table->pfn_cmd_dispatch_indirect;
+	assert(NULL == this->m_pfn_end_command_buffer);
+	this->m_pfn_end_command_buffer = dispatch_table->pfn_end_command_buffer;
+}
+
+void brx_vk_compute_command_buffer::uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+	PFN_vkDestroyCommandPool const pfn_destroy_command_pool = dispatch_table->pfn_destroy_command_pool;
+	assert(NULL != pfn_destroy_command_pool);
+	PFN_vkFreeCommandBuffers const pfn_free_command_buffers = dispatch_table->pfn_free_command_buffers;
+	assert(NULL != pfn_free_command_buffers);
+
+	assert(VK_NULL_HANDLE != this->m_command_buffer);
+	pfn_free_command_buffers(device, this->m_command_pool, 1U, &this->m_command_buffer);
+	this->m_command_buffer = VK_NULL_HANDLE;
+
+	assert(VK_NULL_HANDLE != this->m_command_pool);
+	pfn_destroy_command_pool(device, this->m_command_pool, allocation_callbacks);
+	this->m_command_pool = VK_NULL_HANDLE;
+}
+
+brx_vk_compute_command_buffer::~brx_vk_compute_command_buffer()
+{
+	assert(VK_NULL_HANDLE == this->m_command_pool);
+	assert(VK_NULL_HANDLE == this->m_command_buffer);
+}
+
+VkCommandPool brx_vk_compute_command_buffer::get_command_pool() const
+{
+	return this->m_command_pool;
+}
+
+VkCommandBuffer brx_vk_compute_command_buffer::get_command_buffer() const
+{
+	return this->m_command_buffer;
+}
+
+void brx_vk_compute_command_buffer::begin()
+{
+	VkCommandBufferBeginInfo command_buffer_begin_info = {
+		VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		NULL,
+		VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+		NULL};
+	VkResult res_begin_command_buffer = this->m_pfn_begin_command_buffer(this->m_command_buffer, &command_buffer_begin_info);
+	assert(VK_SUCCESS == res_begin_command_buffer);
+
+	// the state is NOT inherited from the previous recording
+	this->m_bound_compute_pipeline = VK_NULL_HANDLE;
+	this->m_bound_compute_descriptor_sets.descriptor_set_count = 0U;
+	this->m_bound_compute_descriptor_sets.push_constant_size = 0U;
+}
+
+void brx_vk_compute_command_buffer::acquire_storage_buffer_from_graphics_queue(brx_intermediate_storage_buffer const *wrapped_storage_buffer)
+{
+	assert(NULL != wrapped_storage_buffer);
+
+	// the queue family ownership transfer is NOT required when the compute queue family is the same as the graphics queue family, and the timeline fence is sufficient
+	if (this->m_compute_queue_family_index == this->m_graphics_queue_family_index)
+	{
+		return;
+	}
+
+	VkBuffer const storage_buffer = static_cast<brx_vk_intermediate_storage_buffer const *>(wrapped_storage_buffer)->get_buffer();
+	VkBufferMemoryBarrier const acquire_barrier = {
+		VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		NULL,
+		0U,
+		VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT,
+		this->m_graphics_queue_family_index,
+		this->m_compute_queue_family_index,
+		storage_buffer,
+		0U,
+		VK_WHOLE_SIZE};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT), 1U, &acquire_barrier, 0U, NULL);
+}
+
+void brx_vk_compute_command_buffer::acquire_storage_image_from_graphics_queue(brx_storage_image const *wrapped_storage_image)
+{
+	assert(NULL != wrapped_storage_image);
+
+	if (this->m_compute_queue_family_index == this->m_graphics_queue_family_index)
+	{
+		return;
+	}
+
+	VkImage const storage_image = static_cast<brx_vk_storage_image const *>(wrapped_storage_image)->get_image();
+	VkImageSubresourceRange const acquire_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
+	VkImageMemoryBarrier const acquire_barrier = {
+		VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+		NULL,
+		0U,
+		VK_ACCESS_SHADER_READ_BIT,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		this->m_graphics_queue_family_index,
+		this->m_compute_queue_family_index,
+		storage_image,
+		acquire_subresource_range};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0U, NULL, 1U, &acquire_barrier);
+}
+
+void brx_vk_compute_command_buffer::compute_pass_load_storage_image(brx_storage_image const *wrapped_storage_image, BRX_STORAGE_IMAGE_LOAD_OPERATION load_operation)
+{
+	assert(BRX_STORAGE_IMAGE_LOAD_OPERATION_DONT_CARE == load_operation);
+
+	// load operation
+	VkImage const load_image = static_cast<brx_vk_storage_image const *>(wrapped_storage_image)->get_image();
+	VkImageSubresourceRange const load_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
+	VkImageMemoryBarrier const load_barrier = {
+		VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+		NULL,
+		0,
+		VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+		VK_IMAGE_LAYOUT_UNDEFINED,
+		VK_IMAGE_LAYOUT_GENERAL,
+		VK_QUEUE_FAMILY_IGNORED,
+		VK_QUEUE_FAMILY_IGNORED,
+		load_image,
+		load_subresource_range};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0U, NULL, 1U, &load_barrier);
+}
+
+void brx_vk_compute_command_buffer::compute_pass_load_indirect_argument_buffer(brx_indirect_argument_buffer const *wrapped_indirect_argument_buffer)
+{
+	assert(NULL != wrapped_indirect_argument_buffer);
+
+	// load operation
+	VkBuffer const load_buffer = static_cast<brx_vk_indirect_argument_buffer const *>(wrapped_indirect_argument_buffer)->get_buffer();
+	VkBufferMemoryBarrier const load_barrier = {
+		VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		NULL,
+		0U,
+		VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+		VK_QUEUE_FAMILY_IGNORED,
+		VK_QUEUE_FAMILY_IGNORED,
+		load_buffer,
+		0U,
+		VK_WHOLE_SIZE};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 1U, &load_barrier, 0U, NULL);
+}
+
+void brx_vk_compute_command_buffer::bind_compute_pipeline(brx_compute_pipeline const *wrapped_compute_pipeline)
+{
+	assert(NULL != wrapped_compute_pipeline);
+	VkPipeline const compute_pipeline = static_cast<brx_vk_compute_pipeline const *>(wrapped_compute_pipeline)->get_pipeline();
+
+	if (this->m_bound_compute_pipeline != compute_pipeline)
+	{
+		this->m_pfn_cmd_bind_pipeline(this->m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, compute_pipeline);
+		this->m_bound_compute_pipeline = compute_pipeline;
+	}
+}
+
+void brx_vk_compute_command_buffer::bind_compute_descriptor_sets(brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *wrapped_descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets)
+{
+	__intermediate_bind_descriptor_sets(this->m_pfn_cmd_bind_descriptor_sets, this->m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, &this->m_bound_compute_descriptor_sets, wrapped_pipeline_layout, descriptor_set_count, wrapped_descriptor_sets, dynamic_offet_count, dynamic_offsets);
+}
+
+void brx_vk_compute_command_buffer::push_compute_constants(brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t offset, uint32_t size, void const *values)
+{
+	assert(NULL != wrapped_pipeline_layout);
+	assert(NULL != values);
+	brx_vk_pipeline_layout const *const unwrapped_pipeline_layout = static_cast<brx_vk_pipeline_layout const *>(wrapped_pipeline_layout);
+
+	assert(0U == (offset & 3U));
+	assert(0U == (size & 3U));
+	assert((offset + size) <= unwrapped_pipeline_layout->get_push_constant_size());
 
-	this->m_pfn_cmd_bind_descriptor_sets(this->m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0U, descriptor_set_count, &descriptor_sets[0], dynamic_offet_count, dynamic_offsets);
+	this->m_pfn_cmd_push_constants(this->m_command_buffer, unwrapped_pipeline_layout->get_pipeline_layout(), VK_SHADER_STAGE_ALL, offset, size, values);
 }
 
-void brx_vk_graphics_command_buffer::dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z)
+void brx_vk_compute_command_buffer::dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z)
 {
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
 	this->m_pfn_cmd_dispatch(this->m_command_buffer, group_count_x, group_count_y, group_count_z);
 }
 
-void brx_vk_graphics_command_buffer::compute_pass_store_storage_image(brx_storage_image const *wrapped_storage_image, BRX_STORAGE_IMAGE_STORE_OPERATION store_operation)
+void brx_vk_compute_command_buffer::dispatch_indirect(brx_indirect_argument_buffer const *wrapped_argument_buffer, uint64_t argument_offset)
+{
+	assert(NULL != wrapped_argument_buffer);
+	VkBuffer const argument_buffer = static_cast<brx_vk_indirect_argument_buffer const *>(wrapped_argument_buffer)->get_buffer();
+	assert(0U == (argument_offset & 3U));
+
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
+	this->m_pfn_cmd_dispatch_indirect(this->m_command_buffer, argument_buffer, argument_offset);
+}
+
+void brx_vk_compute_command_buffer::compute_pass_store_storage_image(brx_storage_image const *wrapped_storage_image, BRX_STORAGE_IMAGE_STORE_OPERATION store_operation)
 {
 	assert(BRX_STORAGE_IMAGE_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE == store_operation);
 
 	// store operation
+	// the graphics shader stages are NOT supported by the compute queue, and the following graphics passes are synchronized by the timeline fence
 	VkImage const store_image = static_cast<brx_vk_storage_image const *>(wrapped_storage_image)->get_image();
 	VkImageSubresourceRange const store_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
 	VkImageMemoryBarrier const store_barrier = {
@@ -595,140 +1702,80 @@ void brx_vk_graphics_command_buffer::compute_pass_store_storage_image(brx_storag
 		VK_QUEUE_FAMILY_IGNORED,
 		store_image,
 		store_subresource_range};
-	this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, g_graphics_queue_family_all_supported_shader_stages, 0U, 0U, NULL, 0U, NULL, 1U, &store_barrier);
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0U, NULL, 1U, &store_barrier);
 }
 
-void brx_vk_graphics_command_buffer::build_top_level_acceleration_structure(brx_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, brx_top_level_acceleration_structure_instance_upload_buffer *wrapped_top_level_acceleration_structure_instance_upload_buffer, brx_scratch_buffer *wrapped_scratch_buffer)
+void brx_vk_compute_command_buffer::compute_pass_store_indirect_argument_buffer(brx_indirect_argument_buffer const *wrapped_indirect_argument_buffer)
 {
-	assert(NULL != wrapped_top_level_acceleration_structure);
-	VkAccelerationStructureKHR const destination_acceleration_structure = static_cast<brx_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_acceleration_structure();
-	VkBuffer const destination_buffer = static_cast<brx_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_buffer();
-
-	assert(NULL != wrapped_top_level_acceleration_structure_instance_upload_buffer);
-	VkDeviceAddress const top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base = static_cast<brx_vk_top_level_acceleration_structure_instance_upload_buffer *>(wrapped_top_level_acceleration_structure_instance_upload_buffer)->get_device_memory_range_base();
-
-	assert(NULL != wrapped_scratch_buffer);
-	VkDeviceAddress const scratch_buffer_device_memory_range_base = static_cast<brx_vk_scratch_buffer *>(wrapped_scratch_buffer)->get_device_memory_range_base();
-
-	VkAccelerationStructureGeometryKHR const acceleration_structure_geometry = {
-		VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR,
-		NULL,
-		VK_GEOMETRY_TYPE_INSTANCES_KHR,
-		{.instances =
-			 {
-				 VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR,
-				 NULL,
-				 VK_FALSE,
-				 top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base,
-			 }}};
-
-	VkAccelerationStructureBuildGeometryInfoKHR const acceleration_structure_build_geometry_info = {
-		VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR,
-		NULL,
-		VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR,
-		VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_BUILD_BIT_KHR,
-		VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR,
-		VK_NULL_HANDLE,
-		destination_acceleration_structure,
-		1U,
-		&acceleration_structure_geometry,
-		NULL,
-		{.deviceAddress = scratch_buffer_device_memory_range_base}};
-
-	VkAccelerationStructureBuildRangeInfoKHR const acceleration_structure_build_range_info = {
-		top_level_acceleration_structure_instance_count,
-		0U,
-		0U,
-		0U};
-
-	VkAccelerationStructureBuildRangeInfoKHR const *const p_build_range_infos = &acceleration_structure_build_range_info;
-
-	this->m_pfn_cmd_build_acceleration_structure(this->m_command_buffer, 1U, &acceleration_structure_build_geometry_info, &p_build_range_infos);
-
-	static_cast<brx_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->set_instance_count(top_level_acceleration_structure_instance_count);
+	assert(NULL != wrapped_indirect_argument_buffer);
 
-	VkBufferMemoryBarrier const release_barrier = {
+	// store operation
+	VkBuffer const store_buffer = static_cast<brx_vk_indirect_argument_buffer const *>(wrapped_indirect_argument_buffer)->get_buffer();
+	VkBufferMemoryBarrier const store_barrier = {
 		VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
 		NULL,
-		VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
-		VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
+		VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+		VK_ACCESS_INDIRECT_COMMAND_READ_BIT,
 		VK_QUEUE_FAMILY_IGNORED,
 		VK_QUEUE_FAMILY_IGNORED,
-		destination_buffer,
+		store_buffer,
 		0U,
 		VK_WHOLE_SIZE};
-	this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR | VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, 0U, 0U, NULL, 1U, &release_barrier, 0U, NULL);
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, 1U, &store_barrier, 0U, NULL);
 }
 
-void brx_vk_graphics_command_buffer::update_top_level_acceleration_structure(brx_top_level_acceleration_structure *wrapped_top_level_acceleration_structure, brx_top_level_acceleration_structure_instance_upload_buffer *wrapped_top_level_acceleration_structure_instance_upload_buffer, brx_scratch_buffer *wrapped_scratch_buffer)
+void brx_vk_compute_command_buffer::release_storage_buffer_to_graphics_queue(brx_intermediate_storage_buffer const *wrapped_storage_buffer)
 {
-	assert(NULL != wrapped_top_level_acceleration_structure);
-	VkAccelerationStructureKHR const destination_acceleration_structure = static_cast<brx_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_acceleration_structure();
-
-	uint32_t const top_level_acceleration_structure_instance_count = static_cast<brx_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_instance_count();
-
-	assert(NULL != wrapped_top_level_acceleration_structure_instance_upload_buffer);
-	VkDeviceAddress const top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base = static_cast<brx_vk_top_level_acceleration_structure_instance_upload_buffer *>(wrapped_top_level_acceleration_structure_instance_upload_buffer)->get_device_memory_range_base();
-
-	VkAccelerationStructureGeometryKHR const acceleration_structure_geometry = {
-		VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR,
-		NULL,
-		VK_GEOMETRY_TYPE_INSTANCES_KHR,
-		{.instances =
-			 {
-				 VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR,
-				 NULL,
-				 VK_FALSE,
-				 top_level_acceleration_structure_instance_upload_buffer_device_memory_range_base,
-			 }}};
+	assert(NULL != wrapped_storage_buffer);
 
-	assert(NULL != wrapped_scratch_buffer);
-	VkDeviceAddress const scratch_buffer_device_memory_range_base = static_cast<brx_vk_scratch_buffer *>(wrapped_scratch_buffer)->get_device_memory_range_base();
+	if (this->m_compute_queue_family_index == this->m_graphics_queue_family_index)
+	{
+		return;
+	}
 
-	VkAccelerationStructureBuildGeometryInfoKHR const acceleration_structure_build_geometry_info = {
-		VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR,
-		NULL,
-		VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR,
-		VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR | VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_BUILD_BIT_KHR,
-		VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR,
-		destination_acceleration_structure,
-		destination_acceleration_structure,
-		1U,
-		&acceleration_structure_geometry,
+	VkBuffer const storage_buffer = static_cast<brx_vk_intermediate_storage_buffer const *>(wrapped_storage_buffer)->get_buffer();
+	VkBufferMemoryBarrier const release_barrier = {
+		VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
 		NULL,
-		{.deviceAddress = scratch_buffer_device_memory_range_base}};
-
-	VkAccelerationStructureBuildRangeInfoKHR const acceleration_structure_build_range_info = {
-		top_level_acceleration_structure_instance_count,
+		VK_ACCESS_SHADER_WRITE_BIT,
 		0U,
+		this->m_compute_queue_family_index,
+		this->m_graphics_queue_family_index,
+		storage_buffer,
 		0U,
-		0U};
-
-	VkAccelerationStructureBuildRangeInfoKHR const *const p_build_range_infos = &acceleration_structure_build_range_info;
-
-	this->m_pfn_cmd_build_acceleration_structure(this->m_command_buffer, 1U, &acceleration_structure_build_geometry_info, &p_build_range_infos);
+		VK_WHOLE_SIZE};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 1U, &release_barrier, 0U, NULL);
 }
 
-void brx_vk_graphics_command_buffer::acceleration_structure_pass_store_top_level(brx_top_level_acceleration_structure *wrapped_top_level_acceleration_structure)
+void brx_vk_compute_command_buffer::release_storage_image_to_graphics_queue(brx_storage_image const *wrapped_storage_image)
 {
-	assert(NULL != wrapped_top_level_acceleration_structure);
-	VkBuffer const destination_buffer = static_cast<brx_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure)->get_buffer();
+	assert(NULL != wrapped_storage_image);
 
-	VkBufferMemoryBarrier const release_barrier = {
-		VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+	if (this->m_compute_queue_family_index == this->m_graphics_queue_family_index)
+	{
+		return;
+	}
+
+	VkImage const storage_image = static_cast<brx_vk_storage_image const *>(wrapped_storage_image)->get_image();
+	VkImageSubresourceRange const release_subresource_range = {VK_IMAGE_ASPECT_COLOR_BIT, 0U, 1U, 0U, 1U};
+	VkImageMemoryBarrier const release_barrier = {
+		VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
 		NULL,
-		VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
-		VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
-		VK_QUEUE_FAMILY_IGNORED,
-		VK_QUEUE_FAMILY_IGNORED,
-		destination_buffer,
 		0U,
-		VK_WHOLE_SIZE};
-	this->m_pfn_cmd_pipeline_barrier(this->m_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR | VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, 0U, 0U, NULL, 1U, &release_barrier, 0U, NULL);
+		0U,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		this->m_compute_queue_family_index,
+		this->m_graphics_queue_family_index,
+		storage_image,
+		release_subresource_range};
+	this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0U, NULL, 1U, &release_barrier);
 }
 
-void brx_vk_graphics_command_buffer::end()
+void brx_vk_compute_command_buffer::end()
 {
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_command_buffer);
+
 	VkResult res_end_command_buffer = this->m_pfn_end_command_buffer(this->m_command_buffer);
 	assert(VK_SUCCESS == res_end_command_buffer);
 }
@@ -747,28 +1794,31 @@ brx_vk_upload_command_buffer::brx_vk_upload_command_buffer()
 	  m_pfn_cmd_reset_query_pool(NULL),
 	  m_pfn_cmd_write_acceleration_structures_properties(NULL),
 	  m_pfn_cmd_copy_acceleration_structure(NULL),
+	  m_pfn_cmd_write_timestamp(NULL),
 	  m_pfn_end_command_buffer(NULL)
 {
 }
 
-void brx_vk_upload_command_buffer::init(bool support_ray_tracing, bool has_dedicated_upload_queue, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, PFN_vkGetInstanceProcAddr pfn_get_instance_proc_addr, VkInstance instance, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_upload_command_buffer::init(bool support_ray_tracing, bool has_dedicated_upload_queue, bool support_timestamp, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
 	this->m_support_ray_tracing = support_ray_tracing;
 	this->m_has_dedicated_upload_queue = has_dedicated_upload_queue;
 	this->m_graphics_queue_family_index = graphics_queue_family_index;
 	this->m_upload_queue_family_index = upload_queue_family_index;
 
+	this->m_support_timestamp = support_timestamp;
+
 	assert(VK_NULL_HANDLE == this->m_upload_command_pool);
 	assert(VK_NULL_HANDLE == this->m_upload_command_buffer);
 	assert(VK_NULL_HANDLE == this->m_graphics_command_pool);
 	assert(VK_NULL_HANDLE == this->m_graphics_command_buffer);
 	assert(VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
 
-	PFN_vkCreateCommandPool const pfn_create_command_pool = reinterpret_cast<PFN_vkCreateCommandPool>(pfn_get_device_proc_addr(device, "vkCreateCommandPool"));
+	PFN_vkCreateCommandPool const pfn_create_command_pool = dispatch_table->pfn_create_command_pool;
 	assert(NULL != pfn_create_command_pool);
-	PFN_vkAllocateCommandBuffers const pfn_allocate_command_buffers = reinterpret_cast<PFN_vkAllocateCommandBuffers>(pfn_get_device_proc_addr(device, "vkAllocateCommandBuffers"));
+	PFN_vkAllocateCommandBuffers const pfn_allocate_command_buffers = dispatch_table->pfn_allocate_command_buffers;
 	assert(NULL != pfn_allocate_command_buffers);
-	PFN_vkCreateSemaphore const pfn_create_semaphore = reinterpret_cast<PFN_vkCreateSemaphore>(pfn_get_device_proc_addr(device, "vkCreateSemaphore"));
+	PFN_vkCreateSemaphore const pfn_create_semaphore = dispatch_table->pfn_create_semaphore;
 	assert(NULL != pfn_create_semaphore);
 
 	if (this->m_has_dedicated_upload_queue)
@@ -847,35 +1897,37 @@ void brx_vk_upload_command_buffer::init(bool support_ray_tracing, bool has_dedic
 	}
 
 	assert(NULL == this->m_pfn_begin_command_buffer);
-	this->m_pfn_begin_command_buffer = reinterpret_cast<PFN_vkBeginCommandBuffer>(pfn_get_device_proc_addr(device, "vkBeginCommandBuffer"));
+	this->m_pfn_begin_command_buffer = dispatch_table->pfn_begin_command_buffer;
 	assert(NULL == this->m_pfn_cmd_pipeline_barrier);
-	this->m_pfn_cmd_pipeline_barrier = reinterpret_cast<PFN_vkCmdPipelineBarrier>(pfn_get_device_proc_addr(device, "vkCmdPipelineBarrier"));
+	this->m_pfn_cmd_pipeline_barrier = dispatch_table->pfn_cmd_pipeline_barrier;
 	assert(NULL == this->m_pfn_cmd_copy_buffer);
-	this->m_pfn_cmd_copy_buffer = reinterpret_cast<PFN_vkCmdCopyBuffer>(pfn_get_device_proc_addr(device, "vkCmdCopyBuffer"));
+	this->m_pfn_cmd_copy_buffer = dispatch_table->pfn_cmd_copy_buffer;
 	assert(NULL == this->m_pfn_cmd_copy_buffer_to_image);
-	this->m_pfn_cmd_copy_buffer_to_image = reinterpret_cast<PFN_vkCmdCopyBufferToImage>(pfn_get_device_proc_addr(device, "vkCmdCopyBufferToImage"));
-	assert(NULL == this->m_pfn_cmd_build_acceleration_structure);
+	this->m_pfn_cmd_copy_buffer_to_image = dispatch_table->pfn_cmd_copy_buffer_to_image;
 	assert(NULL == this->m_pfn_cmd_reset_query_pool);
+	this->m_pfn_cmd_reset_query_pool = dispatch_table->pfn_cmd_reset_query_pool;
+	assert(NULL == this->m_pfn_cmd_build_acceleration_structure);
 	assert(NULL == this->m_pfn_cmd_write_acceleration_structures_properties);
 	assert(NULL == this->m_pfn_cmd_copy_acceleration_structure);
 	if (this->m_support_ray_tracing)
 	{
-		this->m_pfn_cmd_build_acceleration_structure = reinterpret_cast<PFN_vkCmdBuildAccelerationStructuresKHR>(pfn_get_device_proc_addr(device, "vkCmdBuildAccelerationStructuresKHR"));
-		this->m_pfn_cmd_reset_query_pool = reinterpret_cast<PFN_vkCmdResetQueryPool>(pfn_get_device_proc_addr(device, "vkCmdResetQueryPool"));
-		this->m_pfn_cmd_write_acceleration_structures_properties = reinterpret_cast<PFN_vkCmdWriteAccelerationStructuresPropertiesKHR>(pfn_get_device_proc_addr(device, "vkCmdWriteAccelerationStructuresPropertiesKHR"));
-		this->m_pfn_cmd_copy_acceleration_structure = reinterpret_cast<PFN_vkCmdCopyAccelerationStructureKHR>(pfn_get_device_proc_addr(device, "vkCmdCopyAccelerationStructureKHR"));
+		this->m_pfn_cmd_build_acceleration_structure = dispatch_table->pfn_cmd_build_acceleration_structure;
+		this->m_pfn_cmd_write_acceleration_structures_properties = dispatch_table->pfn_cmd_write_acceleration_structures_properties;
+		this->m_pfn_cmd_copy_acceleration_structure = dispatch_table->pfn_cmd_copy_acceleration_structure;
 	}
+	assert(NULL == this->m_pfn_cmd_write_timestamp);
+	this->m_pfn_cmd_write_timestamp = dispatch_table->pfn_cmd_write_timestamp;
 	assert(NULL == this->m_pfn_end_command_buffer);
-	this->m_pfn_end_command_buffer = reinterpret_cast<PFN_vkEndCommandBuffer>(pfn_get_device_proc_addr(device, "vkEndCommandBuffer"));
+	this->m_pfn_end_command_buffer = dispatch_table->pfn_end_command_buffer;
 }
 
-void brx_vk_upload_command_buffer::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_upload_command_buffer::uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
-	PFN_vkDestroyCommandPool const pfn_destroy_command_pool = reinterpret_cast<PFN_vkDestroyCommandPool>(pfn_get_device_proc_addr(device, "vkDestroyCommandPool"));
+	PFN_vkDestroyCommandPool const pfn_destroy_command_pool = dispatch_table->pfn_destroy_command_pool;
 	assert(NULL != pfn_destroy_command_pool);
-	PFN_vkFreeCommandBuffers const pfn_free_command_buffers = reinterpret_cast<PFN_vkFreeCommandBuffers>(pfn_get_device_proc_addr(device, "vkFreeCommandBuffers"));
+	PFN_vkFreeCommandBuffers const pfn_free_command_buffers = dispatch_table->pfn_free_command_buffers;
 	assert(NULL != pfn_free_command_buffers);
-	PFN_vkDestroySemaphore const pfn_destroy_semaphore = reinterpret_cast<PFN_vkDestroySemaphore>(pfn_get_device_proc_addr(device, "vkDestroySemaphore"));
+	PFN_vkDestroySemaphore const pfn_destroy_semaphore = dispatch_table->pfn_destroy_semaphore;
 	assert(NULL != pfn_destroy_semaphore);
 
 	if (this->m_has_dedicated_upload_queue)
@@ -1044,26 +2096,32 @@ void brx_vk_upload_command_buffer::upload_from_staging_upload_buffer_to_asset_ve
 		{
 			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
 
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer);
+
 			this->m_pfn_cmd_copy_buffer(this->m_upload_command_buffer, staging_upload_buffer, asset_buffer, 1U, &region);
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, upload_queue_family_store_source_stage, upload_queue_family_store_destination_stage, 0U, 0U, NULL, 1U, &upload_queue_family_store_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, upload_queue_family_store_source_stage, upload_queue_family_store_destination_stage, 1U, &upload_queue_family_store_barrier, 0U, NULL);
 		}
 		else
 		{
 			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
 
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer);
+
 			this->m_pfn_cmd_copy_buffer(this->m_upload_command_buffer, staging_upload_buffer, asset_buffer, 1U, &region);
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, graphics_queue_family_store_source_stage, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, 1U, &graphics_queue_family_store_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, graphics_queue_family_store_source_stage, graphics_queue_family_store_destination_stage, 1U, &graphics_queue_family_store_barrier, 0U, NULL);
 		}
 	}
 	else
 	{
 		assert(VK_NULL_HANDLE == this->m_upload_command_pool && VK_NULL_HANDLE == this->m_upload_command_buffer && VK_NULL_HANDLE != this->m_graphics_command_pool && VK_NULL_HANDLE != this->m_graphics_command_buffer && VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
 
+		this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_graphics_command_buffer);
+
 		this->m_pfn_cmd_copy_buffer(this->m_graphics_command_buffer, staging_upload_buffer, asset_buffer, 1U, &region);
 
-		this->m_pfn_cmd_pipeline_barrier(this->m_graphics_command_buffer, graphics_queue_family_store_source_stage, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, 1U, &graphics_queue_family_store_barrier, 0U, NULL);
+		this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_graphics_command_buffer, graphics_queue_family_store_source_stage, graphics_queue_family_store_destination_stage, 1U, &graphics_queue_family_store_barrier, 0U, NULL);
 	}
 }
 
@@ -1109,26 +2167,32 @@ void brx_vk_upload_command_buffer::upload_from_staging_upload_buffer_to_asset_ve
 		{
 			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
 
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer);
+
 			this->m_pfn_cmd_copy_buffer(this->m_upload_command_buffer, staging_upload_buffer, asset_buffer, 1U, &region);
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, upload_queue_family_store_source_stage, upload_queue_family_store_destination_stage, 0U, 0U, NULL, 1U, &upload_queue_family_store_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, upload_queue_family_store_source_stage, upload_queue_family_store_destination_stage, 1U, &upload_queue_family_store_barrier, 0U, NULL);
 		}
 		else
 		{
 			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
 
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer);
+
 			this->m_pfn_cmd_copy_buffer(this->m_upload_command_buffer, staging_upload_buffer, asset_buffer, 1U, &region);
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, graphics_queue_family_store_source_stage, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, 1U, &graphics_queue_family_store_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, graphics_queue_family_store_source_stage, graphics_queue_family_store_destination_stage, 1U, &graphics_queue_family_store_barrier, 0U, NULL);
 		}
 	}
 	else
 	{
 		assert(VK_NULL_HANDLE == this->m_upload_command_pool && VK_NULL_HANDLE == this->m_upload_command_buffer && VK_NULL_HANDLE != this->m_graphics_command_pool && VK_NULL_HANDLE != this->m_graphics_command_buffer && VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
 
+		this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_graphics_command_buffer);
+
 		this->m_pfn_cmd_copy_buffer(this->m_graphics_command_buffer, staging_upload_buffer, asset_buffer, 1U, &region);
 
-		this->m_pfn_cmd_pipeline_barrier(this->m_graphics_command_buffer, graphics_queue_family_store_source_stage, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, 1U, &graphics_queue_family_store_barrier, 0U, NULL);
+		this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_graphics_command_buffer, graphics_queue_family_store_source_stage, graphics_queue_family_store_destination_stage, 1U, &graphics_queue_family_store_barrier, 0U, NULL);
 	}
 }
 
@@ -1175,26 +2239,32 @@ void brx_vk_upload_command_buffer::upload_from_staging_upload_buffer_to_asset_in
 		{
 			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
 
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer);
+
 			this->m_pfn_cmd_copy_buffer(this->m_upload_command_buffer, staging_upload_buffer, asset_buffer, 1U, &region);
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, upload_queue_family_store_source_stage, upload_queue_family_store_destination_stage, 0U, 0U, NULL, 1U, &upload_queue_family_store_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, upload_queue_family_store_source_stage, upload_queue_family_store_destination_stage, 1U, &upload_queue_family_store_barrier, 0U, NULL);
 		}
 		else
 		{
 			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
 
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer);
+
 			this->m_pfn_cmd_copy_buffer(this->m_upload_command_buffer, staging_upload_buffer, asset_buffer, 1U, &region);
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, graphics_queue_family_store_source_stage, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, 1U, &graphics_queue_family_store_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, graphics_queue_family_store_source_stage, graphics_queue_family_store_destination_stage, 1U, &graphics_queue_family_store_barrier, 0U, NULL);
 		}
 	}
 	else
 	{
 		assert(VK_NULL_HANDLE == this->m_upload_command_pool && VK_NULL_HANDLE == this->m_upload_command_buffer && VK_NULL_HANDLE != this->m_graphics_command_pool && VK_NULL_HANDLE != this->m_graphics_command_buffer && VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
 
+		this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_graphics_command_buffer);
+
 		this->m_pfn_cmd_copy_buffer(this->m_graphics_command_buffer, staging_upload_buffer, asset_buffer, 1U, &region);
 
-		this->m_pfn_cmd_pipeline_barrier(this->m_graphics_command_buffer, graphics_queue_family_store_source_stage, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, 1U, &graphics_queue_family_store_barrier, 0U, NULL);
+		this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_graphics_command_buffer, graphics_queue_family_store_source_stage, graphics_queue_family_store_destination_stage, 1U, &graphics_queue_family_store_barrier, 0U, NULL);
 	}
 }
 
@@ -1272,32 +2342,38 @@ void brx_vk_upload_command_buffer::upload_from_staging_upload_buffer_to_asset_sa
 		{
 			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, load_source_stage, load_destination_stage, 0U, 0U, NULL, 0U, NULL, 1U, &load_barrier);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, load_source_stage, load_destination_stage, 0U, NULL, 1U, &load_barrier);
+
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer);
 
 			this->m_pfn_cmd_copy_buffer_to_image(this->m_upload_command_buffer, staging_upload_buffer, asset_sampled_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1U, &region);
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, upload_queue_family_source_stage, upload_queue_family_store_destination_stage, 0U, 0U, NULL, 0U, NULL, 1U, &upload_queue_family_store_barrier);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, upload_queue_family_source_stage, upload_queue_family_store_destination_stage, 0U, NULL, 1U, &upload_queue_family_store_barrier);
 		}
 		else
 		{
 			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, load_source_stage, load_destination_stage, 0U, 0U, NULL, 0U, NULL, 1U, &load_barrier);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, load_source_stage, load_destination_stage, 0U, NULL, 1U, &load_barrier);
+
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer);
 
 			this->m_pfn_cmd_copy_buffer_to_image(this->m_upload_command_buffer, staging_upload_buffer, asset_sampled_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1U, &region);
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, graphics_queue_family_source_stage, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, 0U, NULL, 1U, &graphics_queue_family_store_barrier);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, graphics_queue_family_source_stage, graphics_queue_family_store_destination_stage, 0U, NULL, 1U, &graphics_queue_family_store_barrier);
 		}
 	}
 	else
 	{
 		assert(VK_NULL_HANDLE == this->m_upload_command_pool && VK_NULL_HANDLE == this->m_upload_command_buffer && VK_NULL_HANDLE != this->m_graphics_command_pool && VK_NULL_HANDLE != this->m_graphics_command_buffer && VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
 
-		this->m_pfn_cmd_pipeline_barrier(this->m_graphics_command_buffer, load_source_stage, load_destination_stage, 0U, 0U, NULL, 0U, NULL, 1U, &load_barrier);
+		this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_graphics_command_buffer, load_source_stage, load_destination_stage, 0U, NULL, 1U, &load_barrier);
+
+		this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_graphics_command_buffer);
 
 		this->m_pfn_cmd_copy_buffer_to_image(this->m_graphics_command_buffer, staging_upload_buffer, asset_sampled_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1U, &region);
 
-		this->m_pfn_cmd_pipeline_barrier(this->m_graphics_command_buffer, graphics_queue_family_source_stage, graphics_queue_family_store_destination_stage, 0U, 0U, NULL, 0U, NULL, 1U, &graphics_queue_family_store_barrier);
+		this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_graphics_command_buffer, graphics_queue_family_source_stage, graphics_queue_family_store_destination_stage, 0U, NULL, 1U, &graphics_queue_family_store_barrier);
 	}
 }
 
@@ -1306,16 +2382,34 @@ void brx_vk_upload_command_buffer::build_staging_non_compacted_bottom_level_acce
 	assert(NULL != wrapped_staging_non_compacted_bottom_level_acceleration_structure);
 	VkAccelerationStructureKHR const destination_acceleration_structure = static_cast<brx_vk_staging_non_compacted_bottom_level_acceleration_structure *>(wrapped_staging_non_compacted_bottom_level_acceleration_structure)->get_acceleration_structure();
 
+	if (this->m_has_dedicated_upload_queue)
+	{
+		assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
+	}
+	else
+	{
+		assert(VK_NULL_HANDLE == this->m_upload_command_pool && VK_NULL_HANDLE == this->m_upload_command_buffer && VK_NULL_HANDLE != this->m_graphics_command_pool && VK_NULL_HANDLE != this->m_graphics_command_buffer && VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
+	}
+	VkCommandBuffer const command_buffer = this->m_has_dedicated_upload_queue ? this->m_upload_command_buffer : this->m_graphics_command_buffer;
+
 	assert(NULL != wrapped_bottom_level_acceleration_structure_geometries);
-	brx_vector<VkBufferMemoryBarrier> vertex_position_buffer_load_barriers;
-	brx_vector<VkBufferMemoryBarrier> index_buffer_load_barriers;
 	VkPipelineStageFlags const vertex_index_buffer_load_source_stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
 	VkPipelineStageFlags const vertex_index_buffer_load_destination_stage = VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR;
 	// we do not need to care "store" barriers since we do not write the buffers and there is no "layout" transitions for the buffers
-	brx_vector<VkAccelerationStructureGeometryKHR> acceleration_structure_geometries;
-	brx_vector<VkAccelerationStructureBuildRangeInfoKHR> acceleration_structure_build_range_infos;
-	acceleration_structure_geometries.reserve(bottom_level_acceleration_structure_geometry_count);
-	acceleration_structure_build_range_infos.reserve(bottom_level_acceleration_structure_geometry_count);
+	VkAccelerationStructureGeometryKHR *acceleration_structure_geometries;
+	VkAccelerationStructureBuildRangeInfoKHR *acceleration_structure_build_range_infos;
+	if (bottom_level_acceleration_structure_geometry_count <= g_vk_max_inline_bottom_level_acceleration_structure_geometry_count)
+	{
+		acceleration_structure_geometries = this->m_inline_acceleration_structure_geometries;
+		acceleration_structure_build_range_infos = this->m_inline_acceleration_structure_build_range_infos;
+	}
+	else
+	{
+		this->m_scratch_acceleration_structure_geometries.resize(bottom_level_acceleration_structure_geometry_count);
+		this->m_scratch_acceleration_structure_build_range_infos.resize(bottom_level_acceleration_structure_geometry_count);
+		acceleration_structure_geometries = &this->m_scratch_acceleration_structure_geometries[0];
+		acceleration_structure_build_range_infos = &this->m_scratch_acceleration_structure_build_range_infos[0];
+	}
 	for (uint32_t bottom_level_acceleration_structure_geometry_index = 0U; bottom_level_acceleration_structure_geometry_index < bottom_level_acceleration_structure_geometry_count; ++bottom_level_acceleration_structure_geometry_index)
 	{
 		BRX_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY const &wrapped_bottom_level_acceleration_structure_geometry = wrapped_bottom_level_acceleration_structure_geometries[bottom_level_acceleration_structure_geometry_index];
@@ -1332,7 +2426,7 @@ void brx_vk_upload_command_buffer::build_staging_non_compacted_bottom_level_acce
 			unwrapped_vertex_position_buffer->get_buffer(),
 			0U,
 			VK_WHOLE_SIZE};
-		vertex_position_buffer_load_barriers.push_back(vertex_position_buffer_load_barrier);
+		this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, command_buffer, vertex_index_buffer_load_source_stage, vertex_index_buffer_load_destination_stage, 1U, &vertex_position_buffer_load_barrier, 0U, NULL);
 
 		brx_vk_index_buffer const *const unwrapped_index_buffer = (BRX_GRAPHICS_PIPELINE_INDEX_TYPE_NONE != wrapped_bottom_level_acceleration_structure_geometry.index_type) ? static_cast<brx_vk_index_buffer const *>(wrapped_bottom_level_acceleration_structure_geometry.index_buffer) : NULL;
 
@@ -1348,7 +2442,7 @@ void brx_vk_upload_command_buffer::build_staging_non_compacted_bottom_level_acce
 				unwrapped_index_buffer->get_buffer(),
 				0U,
 				VK_WHOLE_SIZE};
-			index_buffer_load_barriers.push_back(index_buffer_load_barrier);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, command_buffer, vertex_index_buffer_load_source_stage, vertex_index_buffer_load_destination_stage, 1U, &index_buffer_load_barrier, 0U, NULL);
 		}
 
 		VkFormat vertex_position_attribute_format;
@@ -1401,7 +2495,7 @@ void brx_vk_upload_command_buffer::build_staging_non_compacted_bottom_level_acce
 				  {.deviceAddress = 0U}}},
 			wrapped_bottom_level_acceleration_structure_geometry.force_closest_hit ? VK_GEOMETRY_OPAQUE_BIT_KHR : 0U};
 
-		acceleration_structure_geometries.push_back(acceleration_structure_geometry);
+		acceleration_structure_geometries[bottom_level_acceleration_structure_geometry_index] = acceleration_structure_geometry;
 
 		assert(0U == ((VK_INDEX_TYPE_NONE_KHR != index_type) ? (wrapped_bottom_level_acceleration_structure_geometry.index_count % 3U) : (wrapped_bottom_level_acceleration_structure_geometry.vertex_count % 3U)));
 		uint32_t const primitive_count = (VK_INDEX_TYPE_NONE_KHR == index_type) ? (wrapped_bottom_level_acceleration_structure_geometry.vertex_count / 3U) : (wrapped_bottom_level_acceleration_structure_geometry.index_count / 3U);
@@ -1412,10 +2506,8 @@ void brx_vk_upload_command_buffer::build_staging_non_compacted_bottom_level_acce
 			0U,
 			0U};
 
-		acceleration_structure_build_range_infos.push_back(acceleration_structure_build_range_info);
+		acceleration_structure_build_range_infos[bottom_level_acceleration_structure_geometry_index] = acceleration_structure_build_range_info;
 	}
-	assert(bottom_level_acceleration_structure_geometry_count == acceleration_structure_geometries.size());
-	assert(bottom_level_acceleration_structure_geometry_count == acceleration_structure_build_range_infos.size());
 
 	assert(NULL != wrapped_scratch_buffer);
 	VkDeviceAddress const scratch_buffer_device_memory_range_base = static_cast<brx_vk_scratch_buffer *>(wrapped_scratch_buffer)->get_device_memory_range_base();
@@ -1431,69 +2523,20 @@ void brx_vk_upload_command_buffer::build_staging_non_compacted_bottom_level_acce
 		VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR,
 		VK_NULL_HANDLE,
 		destination_acceleration_structure,
-		static_cast<uint32_t>(acceleration_structure_geometries.size()),
-		&acceleration_structure_geometries[0],
+		bottom_level_acceleration_structure_geometry_count,
+		acceleration_structure_geometries,
 		NULL,
 		{.deviceAddress = scratch_buffer_device_memory_range_base}};
 
-	VkAccelerationStructureBuildRangeInfoKHR const *const p_build_range_infos = &acceleration_structure_build_range_infos[0];
-
-	assert(bottom_level_acceleration_structure_geometry_count == vertex_position_buffer_load_barriers.size());
-	assert(bottom_level_acceleration_structure_geometry_count >= index_buffer_load_barriers.size());
-	if (this->m_has_dedicated_upload_queue)
-	{
-		if (this->m_upload_queue_family_index != this->m_graphics_queue_family_index)
-		{
-			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
-
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, vertex_index_buffer_load_source_stage, vertex_index_buffer_load_destination_stage, 0U, 0U, NULL, bottom_level_acceleration_structure_geometry_count, &vertex_position_buffer_load_barriers[0], 0U, NULL);
-
-			if (index_buffer_load_barriers.size() > 0U)
-			{
-				this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, vertex_index_buffer_load_source_stage, vertex_index_buffer_load_destination_stage, 0U, 0U, NULL, static_cast<uint32_t>(index_buffer_load_barriers.size()), &index_buffer_load_barriers[0], 0U, NULL);
-			}
-
-			this->m_pfn_cmd_build_acceleration_structure(this->m_upload_command_buffer, 1U, &acceleration_structure_build_geometry_info, &p_build_range_infos);
-
-			this->m_pfn_cmd_reset_query_pool(this->m_upload_command_buffer, query_pool, query_index, 1U);
-
-			this->m_pfn_cmd_write_acceleration_structures_properties(this->m_upload_command_buffer, 1U, &destination_acceleration_structure, VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, query_pool, query_index);
-		}
-		else
-		{
-			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
-
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, vertex_index_buffer_load_source_stage, vertex_index_buffer_load_destination_stage, 0U, 0U, NULL, bottom_level_acceleration_structure_geometry_count, &vertex_position_buffer_load_barriers[0], 0U, NULL);
-
-			if (index_buffer_load_barriers.size() > 0U)
-			{
-				this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, vertex_index_buffer_load_source_stage, vertex_index_buffer_load_destination_stage, 0U, 0U, NULL, static_cast<uint32_t>(index_buffer_load_barriers.size()), &index_buffer_load_barriers[0], 0U, NULL);
-			}
-
-			this->m_pfn_cmd_build_acceleration_structure(this->m_upload_command_buffer, 1U, &acceleration_structure_build_geometry_info, &p_build_range_infos);
-
-			this->m_pfn_cmd_reset_query_pool(this->m_upload_command_buffer, query_pool, query_index, 1U);
-
-			this->m_pfn_cmd_write_acceleration_structures_properties(this->m_upload_command_buffer, 1U, &destination_acceleration_structure, VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, query_pool, query_index);
-		}
-	}
-	else
-	{
-		assert(VK_NULL_HANDLE == this->m_upload_command_pool && VK_NULL_HANDLE == this->m_upload_command_buffer && VK_NULL_HANDLE != this->m_graphics_command_pool && VK_NULL_HANDLE != this->m_graphics_command_buffer && VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
-
-		this->m_pfn_cmd_pipeline_barrier(this->m_graphics_command_buffer, vertex_index_buffer_load_source_stage, vertex_index_buffer_load_destination_stage, 0U, 0U, NULL, bottom_level_acceleration_structure_geometry_count, &vertex_position_buffer_load_barriers[0], 0U, NULL);
+	VkAccelerationStructureBuildRangeInfoKHR const *const p_build_range_infos = acceleration_structure_build_range_infos;
 
-		if (index_buffer_load_barriers.size() > 0U)
-		{
-			this->m_pfn_cmd_pipeline_barrier(this->m_graphics_command_buffer, vertex_index_buffer_load_source_stage, vertex_index_buffer_load_destination_stage, 0U, 0U, NULL, static_cast<uint32_t>(index_buffer_load_barriers.size()), &index_buffer_load_barriers[0], 0U, NULL);
-		}
+	this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, command_buffer);
 
-		this->m_pfn_cmd_build_acceleration_structure(this->m_graphics_command_buffer, 1U, &acceleration_structure_build_geometry_info, &p_build_range_infos);
+	this->m_pfn_cmd_build_acceleration_structure(command_buffer, 1U, &acceleration_structure_build_geometry_info, &p_build_range_infos);
 
-		this->m_pfn_cmd_reset_query_pool(this->m_graphics_command_buffer, query_pool, query_index, 1U);
+	this->m_pfn_cmd_reset_query_pool(command_buffer, query_pool, query_index, 1U);
 
-		this->m_pfn_cmd_write_acceleration_structures_properties(this->m_graphics_command_buffer, 1U, &destination_acceleration_structure, VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, query_pool, query_index);
-	}
+	this->m_pfn_cmd_write_acceleration_structures_properties(command_buffer, 1U, &destination_acceleration_structure, VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, query_pool, query_index);
 }
 
 void brx_vk_upload_command_buffer::compact_bottom_level_acceleration_structure(brx_asset_compacted_bottom_level_acceleration_structure *wrapped_destination_asset_compacted_bottom_level_acceleration_structure, brx_staging_non_compacted_bottom_level_acceleration_structure *wrapped_source_staging_non_compacted_bottom_level_acceleration_structure)
@@ -1535,26 +2578,32 @@ void brx_vk_upload_command_buffer::compact_bottom_level_acceleration_structure(b
 		{
 			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
 
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer);
+
 			this->m_pfn_cmd_copy_acceleration_structure(this->m_upload_command_buffer, &copy_acceleration_structure_info);
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, store_source_stage, store_destination_stage, 0U, 0U, NULL, 1U, &store_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, store_source_stage, store_destination_stage, 1U, &store_barrier, 0U, NULL);
 		}
 		else
 		{
 			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
 
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer);
+
 			this->m_pfn_cmd_copy_acceleration_structure(this->m_upload_command_buffer, &copy_acceleration_structure_info);
 
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, store_source_stage, store_destination_stage, 0U, 0U, NULL, 1U, &store_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, store_source_stage, store_destination_stage, 1U, &store_barrier, 0U, NULL);
 		}
 	}
 	else
 	{
 		assert(VK_NULL_HANDLE == this->m_upload_command_pool && VK_NULL_HANDLE == this->m_upload_command_buffer && VK_NULL_HANDLE != this->m_graphics_command_pool && VK_NULL_HANDLE != this->m_graphics_command_buffer && VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
 
+		this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_graphics_command_buffer);
+
 		this->m_pfn_cmd_copy_acceleration_structure(this->m_graphics_command_buffer, &copy_acceleration_structure_info);
 
-		this->m_pfn_cmd_pipeline_barrier(this->m_graphics_command_buffer, store_source_stage, store_destination_stage, 0U, 0U, NULL, 1U, &store_barrier, 0U, NULL);
+		this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_graphics_command_buffer, store_source_stage, store_destination_stage, 1U, &store_barrier, 0U, NULL);
 	}
 }
 
@@ -1580,7 +2629,7 @@ void brx_vk_upload_command_buffer::release_asset_vertex_position_buffer(brx_asse
 					asset_buffer,
 					0U,
 					VK_WHOLE_SIZE};
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0U, 0U, NULL, 1U, &release_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 1U, &release_barrier, 0U, NULL);
 		}
 		else
 		{
@@ -1619,7 +2668,7 @@ void brx_vk_upload_command_buffer::release_asset_vertex_varying_buffer(brx_asset
 					asset_buffer,
 					0U,
 					VK_WHOLE_SIZE};
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0U, 0U, NULL, 1U, &release_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 1U, &release_barrier, 0U, NULL);
 		}
 		else
 		{
@@ -1658,7 +2707,7 @@ void brx_vk_upload_command_buffer::release_asset_index_buffer(brx_asset_index_bu
 					asset_buffer,
 					0U,
 					VK_WHOLE_SIZE};
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0U, 0U, NULL, 1U, &release_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 1U, &release_barrier, 0U, NULL);
 		}
 		else
 		{
@@ -1699,7 +2748,7 @@ void brx_vk_upload_command_buffer::release_asset_sampled_image(brx_asset_sampled
 				this->m_graphics_queue_family_index,
 				asset_sampled_image,
 				asset_sampled_image_subresource_range};
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0U, 0U, NULL, 0U, NULL, 1U, &release_barrier);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0U, NULL, 1U, &release_barrier);
 		}
 		else
 		{
@@ -1738,7 +2787,7 @@ void brx_vk_upload_command_buffer::release_asset_compacted_bottom_level_accelera
 					asset_buffer,
 					0U,
 					VK_WHOLE_SIZE};
-			this->m_pfn_cmd_pipeline_barrier(this->m_upload_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0U, 0U, NULL, 1U, &release_barrier, 0U, NULL);
+			this->m_pending_pipeline_barrier.pipeline_barrier(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer, VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 1U, &release_barrier, 0U, NULL);
 		}
 		else
 		{
@@ -1755,6 +2804,60 @@ void brx_vk_upload_command_buffer::release_asset_compacted_bottom_level_accelera
 	}
 }
 
+void brx_vk_upload_command_buffer::reset_timestamp_query_pool(brx_timestamp_query_pool *wrapped_timestamp_query_pool)
+{
+	assert(NULL != wrapped_timestamp_query_pool);
+	brx_vk_timestamp_query_pool *const unwrapped_timestamp_query_pool = static_cast<brx_vk_timestamp_query_pool *>(wrapped_timestamp_query_pool);
+
+	unwrapped_timestamp_query_pool->get_label_list()->reset();
+
+	if (!this->m_support_timestamp)
+	{
+		// do nothing
+	}
+	else if (this->m_has_dedicated_upload_queue)
+	{
+		assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
+
+		this->m_pfn_cmd_reset_query_pool(this->m_upload_command_buffer, unwrapped_timestamp_query_pool->get_query_pool(), 0U, unwrapped_timestamp_query_pool->get_query_count());
+	}
+	else
+	{
+		assert(VK_NULL_HANDLE == this->m_upload_command_pool && VK_NULL_HANDLE == this->m_upload_command_buffer && VK_NULL_HANDLE != this->m_graphics_command_pool && VK_NULL_HANDLE != this->m_graphics_command_buffer && VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
+
+		this->m_pfn_cmd_reset_query_pool(this->m_graphics_command_buffer, unwrapped_timestamp_query_pool->get_query_pool(), 0U, unwrapped_timestamp_query_pool->get_query_count());
+	}
+}
+
+void brx_vk_upload_command_buffer::write_timestamp(brx_timestamp_query_pool *wrapped_timestamp_query_pool, uint32_t query_index)
+{
+	assert(NULL != wrapped_timestamp_query_pool);
+	brx_vk_timestamp_query_pool *const unwrapped_timestamp_query_pool = static_cast<brx_vk_timestamp_query_pool *>(wrapped_timestamp_query_pool);
+
+	assert(query_index < unwrapped_timestamp_query_pool->get_query_count());
+
+	if (!this->m_support_timestamp)
+	{
+		// do nothing
+	}
+	else if (this->m_has_dedicated_upload_queue)
+	{
+		assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
+
+		this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer);
+
+		this->m_pfn_cmd_write_timestamp(this->m_upload_command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, unwrapped_timestamp_query_pool->get_query_pool(), query_index);
+	}
+	else
+	{
+		assert(VK_NULL_HANDLE == this->m_upload_command_pool && VK_NULL_HANDLE == this->m_upload_command_buffer && VK_NULL_HANDLE != this->m_graphics_command_pool && VK_NULL_HANDLE != this->m_graphics_command_buffer && VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
+
+		this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_graphics_command_buffer);
+
+		this->m_pfn_cmd_write_timestamp(this->m_graphics_command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, unwrapped_timestamp_query_pool->get_query_pool(), query_index);
+	}
+}
+
 void brx_vk_upload_command_buffer::end()
 {
 	if (this->m_has_dedicated_upload_queue)
@@ -1763,6 +2866,8 @@ void brx_vk_upload_command_buffer::end()
 		{
 			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
 
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer);
+
 			VkResult res_end_upload_command_buffer = this->m_pfn_end_command_buffer(this->m_upload_command_buffer);
 			assert(VK_SUCCESS == res_end_upload_command_buffer);
 		}
@@ -1770,6 +2875,8 @@ void brx_vk_upload_command_buffer::end()
 		{
 			assert(VK_NULL_HANDLE != this->m_upload_command_pool && VK_NULL_HANDLE != this->m_upload_command_buffer && VK_NULL_HANDLE == this->m_graphics_command_pool && VK_NULL_HANDLE == this->m_graphics_command_buffer && VK_NULL_HANDLE != this->m_upload_queue_submit_semaphore);
 
+			this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_upload_command_buffer);
+
 			VkResult res_end_upload_command_buffer = this->m_pfn_end_command_buffer(this->m_upload_command_buffer);
 			assert(VK_SUCCESS == res_end_upload_command_buffer);
 		}
@@ -1778,7 +2885,79 @@ void brx_vk_upload_command_buffer::end()
 	{
 		assert(VK_NULL_HANDLE == this->m_upload_command_pool && VK_NULL_HANDLE == this->m_upload_command_buffer && VK_NULL_HANDLE != this->m_graphics_command_pool && VK_NULL_HANDLE != this->m_graphics_command_buffer && VK_NULL_HANDLE == this->m_upload_queue_submit_semaphore);
 
+		this->m_pending_pipeline_barrier.flush(this->m_pfn_cmd_pipeline_barrier, this->m_graphics_command_buffer);
+
 		VkResult res_end_graphics_command_buffer = this->m_pfn_end_command_buffer(this->m_graphics_command_buffer);
 		assert(VK_SUCCESS == res_end_graphics_command_buffer);
 	}
 }
+
+static inline bool __intermediate_bind_descriptor_sets(PFN_vkCmdBindDescriptorSets pfn_cmd_bind_descriptor_sets, VkCommandBuffer command_buffer, VkPipelineBindPoint pipeline_bind_point, brx_vk_descriptor_set_binding_state *bound_descriptor_sets, brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *wrapped_descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets)
+{
+	assert(NULL != wrapped_pipeline_layout);
+	assert(NULL != wrapped_descriptor_sets);
+	brx_vk_pipeline_layout const *const unwrapped_pipeline_layout = static_cast<brx_vk_pipeline_layout const *>(wrapped_pipeline_layout);
+	VkPipelineLayout const pipeline_layout = unwrapped_pipeline_layout->get_pipeline_layout();
+	VkDescriptorSetLayout const *const descriptor_set_layouts = unwrapped_pipeline_layout->get_descriptor_set_layouts();
+
+	assert(descriptor_set_count <= unwrapped_pipeline_layout->get_descriptor_set_layout_count());
+	assert(dynamic_offet_count <= g_vk_max_dynamic_offset_count);
+
+	// only the descriptor sets after the longest unchanged prefix are bound
+	// the prefix is unchanged only if the pipeline layouts are compatible for these set numbers, and the descriptor sets and the dynamic offsets are identical
+	uint32_t first_set = 0U;
+	uint32_t first_dynamic_offset_index = 0U;
+	// the push constant range is visible to all shader stages, and thus the ranges are identical when the sizes are identical
+	bool unchanged_prefix = (bound_descriptor_sets->push_constant_size == unwrapped_pipeline_layout->get_push_constant_size());
+
+	VkDescriptorSet descriptor_sets[g_vk_max_descriptor_set_layout_count];
+	uint32_t dynamic_offset_index = 0U;
+	for (uint32_t set_index = 0U; set_index < descriptor_set_count; ++set_index)
+	{
+		assert(NULL != wrapped_descriptor_sets[set_index]);
+		brx_vk_descriptor_set const *const unwrapped_descriptor_set = static_cast<brx_vk_descriptor_set const *>(wrapped_descriptor_sets[set_index]);
+		descriptor_sets[set_index] = unwrapped_descriptor_set->get_descriptor_set();
+		uint32_t const set_dynamic_offset_count = unwrapped_descriptor_set->get_dynamic_uniform_buffer_descriptor_count();
+		assert((dynamic_offset_index + set_dynamic_offset_count) <= dynamic_offet_count);
+
+		if (unchanged_prefix)
+		{
+			unchanged_prefix = (set_index < bound_descriptor_sets->descriptor_set_count) && (bound_descriptor_sets->descriptor_set_layouts[set_index] == descriptor_set_layouts[set_index]) && (bound_descriptor_sets->descriptor_sets[set_index] == descriptor_sets[set_index]);
+
+			for (uint32_t set_dynamic_offset_index = 0U; unchanged_prefix && (set_dynamic_offset_index < set_dynamic_offset_count); ++set_dynamic_offset_index)
+			{
+				unchanged_prefix = (bound_descriptor_sets->dynamic_offsets[dynamic_offset_index + set_dynamic_offset_index] == dynamic_offsets[dynamic_offset_index + set_dynamic_offset_index]);
+			}
+
+			if (unchanged_prefix)
+			{
+				first_set = set_index + 1U;
+				first_dynamic_offset_index = dynamic_offset_index + set_dynamic_offset_count;
+			}
+		}
+
+		bound_descriptor_sets->descriptor_set_layouts[set_index] = descriptor_set_layouts[set_index];
+		bound_descriptor_sets->descriptor_sets[set_index] = descriptor_sets[set_index];
+		for (uint32_t set_dynamic_offset_index = 0U; set_dynamic_offset_index < set_dynamic_offset_count; ++set_dynamic_offset_index)
+		{
+			bound_descriptor_sets->dynamic_offsets[dynamic_offset_index + set_dynamic_offset_index] = dynamic_offsets[dynamic_offset_index + set_dynamic_offset_index];
+		}
+
+		dynamic_offset_index += set_dynamic_offset_count;
+	}
+	assert(dynamic_offset_index == dynamic_offet_count);
+
+	// the descriptor sets of the higher set numbers may be disturbed, and thus are conservatively treated as unbound
+	bound_descriptor_sets->descriptor_set_count = descriptor_set_count;
+	bound_descriptor_sets->push_constant_size = unwrapped_pipeline_layout->get_push_constant_size();
+
+	if (first_set < descriptor_set_count)
+	{
+		pfn_cmd_bind_descriptor_sets(command_buffer, pipeline_bind_point, pipeline_layout, first_set, descriptor_set_count - first_set, &descriptor_sets[first_set], dynamic_offet_count - first_dynamic_offset_index, (dynamic_offet_count > first_dynamic_offset_index) ? &dynamic_offsets[first_dynamic_offset_index] : NULL);
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
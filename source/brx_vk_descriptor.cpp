@@ -21,6 +21,8 @@
 
 brx_vk_descriptor_set_layout::brx_vk_descriptor_set_layout()
     : m_descriptor_set_layout(VK_NULL_HANDLE),
+      m_update_after_bind(false),
+      m_descriptor_update_template(VK_NULL_HANDLE),
       m_dynamic_uniform_buffer_descriptor_count(0U),
       m_storage_buffer_descriptor_count(0U),
       m_sampled_image_descriptor_count(0U),
@@ -30,9 +32,9 @@ brx_vk_descriptor_set_layout::brx_vk_descriptor_set_layout()
 {
 }
 
-void brx_vk_descriptor_set_layout::init(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *wrapped_descriptor_set_bindings, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_descriptor_set_layout::init(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *wrapped_descriptor_set_bindings, bool descriptor_update_template, bool update_after_bind, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
-    PFN_vkCreateDescriptorSetLayout const pfn_create_descriptor_set_layout = reinterpret_cast<PFN_vkCreateDescriptorSetLayout>(pfn_get_device_proc_addr(device, "vkCreateDescriptorSetLayout"));
+    PFN_vkCreateDescriptorSetLayout const pfn_create_descriptor_set_layout = dispatch_table->pfn_create_descriptor_set_layout;
     assert(NULL != pfn_create_descriptor_set_layout);
 
     brx_vector<VkDescriptorSetLayoutBinding> descriptor_set_bindings(static_cast<size_t>(descriptor_set_binding_count));
@@ -97,25 +99,87 @@ void brx_vk_descriptor_set_layout::init(uint32_t descriptor_set_binding_count, B
         descriptor_set_bindings[binding_index].pImmutableSamplers = NULL;
     }
 
+    // the bindless table is partially bound, and the descriptors can be written while the descriptor set is bound by the command buffers in flight
+    this->m_update_after_bind = update_after_bind;
+
+    brx_vector<VkDescriptorBindingFlagsEXT> descriptor_set_binding_flags(static_cast<size_t>(descriptor_set_binding_count), (!update_after_bind) ? 0U : (VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT));
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT const descriptor_set_layout_binding_flags_create_info = {
+        VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT,
+        NULL,
+        descriptor_set_binding_count,
+        &descriptor_set_binding_flags[0]};
+
     VkDescriptorSetLayoutCreateInfo const descriptor_set_layout_create_info = {
         VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
-        NULL,
-        0U,
+        (!update_after_bind) ? NULL : &descriptor_set_layout_binding_flags_create_info,
+        (!update_after_bind) ? 0U : VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT,
         descriptor_set_binding_count,
         &descriptor_set_bindings[0]};
 
     assert(VK_NULL_HANDLE == this->m_descriptor_set_layout);
     VkResult const res_create_global_descriptor_set_layout = pfn_create_descriptor_set_layout(device, &descriptor_set_layout_create_info, allocation_callbacks, &this->m_descriptor_set_layout);
     assert(VK_SUCCESS == res_create_global_descriptor_set_layout);
+
+    assert(VK_NULL_HANDLE == this->m_descriptor_update_template);
+    assert(this->m_descriptor_update_template_descriptor_types.empty());
+    if (descriptor_update_template)
+    {
+        PFN_vkCreateDescriptorUpdateTemplate const pfn_create_descriptor_update_template = dispatch_table->pfn_create_descriptor_update_template;
+        assert(NULL != pfn_create_descriptor_update_template);
+
+        // all descriptors are packed in the order of the bindings, and the "write_descriptor_with_template" only translates the handles without constructing the "VkWriteDescriptorSet"
+        brx_vector<VkDescriptorUpdateTemplateEntry> descriptor_update_template_entries(static_cast<size_t>(descriptor_set_binding_count));
+        for (uint32_t binding_index = 0U; binding_index < descriptor_set_binding_count; ++binding_index)
+        {
+            descriptor_update_template_entries[binding_index].dstBinding = descriptor_set_bindings[binding_index].binding;
+            descriptor_update_template_entries[binding_index].dstArrayElement = 0U;
+            descriptor_update_template_entries[binding_index].descriptorCount = descriptor_set_bindings[binding_index].descriptorCount;
+            descriptor_update_template_entries[binding_index].descriptorType = descriptor_set_bindings[binding_index].descriptorType;
+            descriptor_update_template_entries[binding_index].offset = sizeof(brx_vk_descriptor_update_template_data) * this->m_descriptor_update_template_descriptor_types.size();
+            descriptor_update_template_entries[binding_index].stride = sizeof(brx_vk_descriptor_update_template_data);
+
+            for (uint32_t descriptor_index = 0U; descriptor_index < wrapped_descriptor_set_bindings[binding_index].descriptor_count; ++descriptor_index)
+            {
+                this->m_descriptor_update_template_descriptor_types.push_back(wrapped_descriptor_set_bindings[binding_index].descriptor_type);
+            }
+        }
+
+        VkDescriptorUpdateTemplateCreateInfo const descriptor_update_template_create_info = {
+            VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO,
+            NULL,
+            0U,
+            descriptor_set_binding_count,
+            &descriptor_update_template_entries[0],
+            VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET,
+            this->m_descriptor_set_layout,
+            VK_PIPELINE_BIND_POINT_GRAPHICS,
+            VK_NULL_HANDLE,
+            0U};
+
+        VkResult const res_create_descriptor_update_template = pfn_create_descriptor_update_template(device, &descriptor_update_template_create_info, allocation_callbacks, &this->m_descriptor_update_template);
+        assert(VK_SUCCESS == res_create_descriptor_update_template);
+    }
 }
 
-void brx_vk_descriptor_set_layout::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_descriptor_set_layout::uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
-    PFN_vkDestroyDescriptorSetLayout const pfn_destroy_descriptor_set_layout = reinterpret_cast<PFN_vkDestroyDescriptorSetLayout>(pfn_get_device_proc_addr(device, "vkDestroyDescriptorSetLayout"));
+    PFN_vkDestroyDescriptorSetLayout const pfn_destroy_descriptor_set_layout = dispatch_table->pfn_destroy_descriptor_set_layout;
     assert(NULL != pfn_destroy_descriptor_set_layout);
 
     assert(VK_NULL_HANDLE != this->m_descriptor_set_layout);
 
+    if (VK_NULL_HANDLE != this->m_descriptor_update_template)
+    {
+        PFN_vkDestroyDescriptorUpdateTemplate const pfn_destroy_descriptor_update_template = dispatch_table->pfn_destroy_descriptor_update_template;
+        assert(NULL != pfn_destroy_descriptor_update_template);
+
+        pfn_destroy_descriptor_update_template(device, this->m_descriptor_update_template, allocation_callbacks);
+
+        this->m_descriptor_update_template = VK_NULL_HANDLE;
+        this->m_descriptor_update_template_descriptor_types.clear();
+    }
+
     pfn_destroy_descriptor_set_layout(device, this->m_descriptor_set_layout, allocation_callbacks);
 
     this->m_descriptor_set_layout = VK_NULL_HANDLE;
@@ -124,6 +188,7 @@ void brx_vk_descriptor_set_layout::uninit(PFN_vkGetDeviceProcAddr pfn_get_device
 brx_vk_descriptor_set_layout::~brx_vk_descriptor_set_layout()
 {
     assert(VK_NULL_HANDLE == this->m_descriptor_set_layout);
+    assert(VK_NULL_HANDLE == this->m_descriptor_update_template);
 }
 
 VkDescriptorSetLayout brx_vk_descriptor_set_layout::get_descriptor_set_layout() const
@@ -131,6 +196,11 @@ VkDescriptorSetLayout brx_vk_descriptor_set_layout::get_descriptor_set_layout()
     return this->m_descriptor_set_layout;
 }
 
+bool brx_vk_descriptor_set_layout::get_update_after_bind() const
+{
+    return this->m_update_after_bind;
+}
+
 uint32_t brx_vk_descriptor_set_layout::get_dynamic_uniform_buffer_descriptor_count() const
 {
     return this->m_dynamic_uniform_buffer_descriptor_count;
@@ -161,8 +231,29 @@ uint32_t brx_vk_descriptor_set_layout::get_top_level_acceleration_structure_desc
     return this->m_top_level_acceleration_structure_descriptor_count;
 }
 
-brx_vk_pipeline_layout::brx_vk_pipeline_layout(VkPipelineLayout pipeline_layout) : m_pipeline_layout(pipeline_layout)
+VkDescriptorUpdateTemplate brx_vk_descriptor_set_layout::get_descriptor_update_template() const
+{
+    return this->m_descriptor_update_template;
+}
+
+uint32_t brx_vk_descriptor_set_layout::get_descriptor_update_template_descriptor_count() const
+{
+    return static_cast<uint32_t>(this->m_descriptor_update_template_descriptor_types.size());
+}
+
+BRX_DESCRIPTOR_TYPE const *brx_vk_descriptor_set_layout::get_descriptor_update_template_descriptor_types() const
+{
+    return this->m_descriptor_update_template_descriptor_types.data();
+}
+
+brx_vk_pipeline_layout::brx_vk_pipeline_layout(VkPipelineLayout pipeline_layout, uint32_t descriptor_set_layout_count, VkDescriptorSetLayout const *descriptor_set_layouts, uint32_t push_constant_size) : m_pipeline_layout(pipeline_layout), m_descriptor_set_layout_count(descriptor_set_layout_count), m_push_constant_size(push_constant_size)
 {
+    // the descriptor set layouts are used by the command buffer to check whether the pipeline layouts are compatible
+    assert(descriptor_set_layout_count <= g_vk_max_descriptor_set_layout_count);
+    for (uint32_t set_index = 0U; set_index < descriptor_set_layout_count; ++set_index)
+    {
+        this->m_descriptor_set_layouts[set_index] = descriptor_set_layouts[set_index];
+    }
 }
 
 VkPipelineLayout brx_vk_pipeline_layout::get_pipeline_layout() const
@@ -170,6 +261,21 @@ VkPipelineLayout brx_vk_pipeline_layout::get_pipeline_layout() const
     return this->m_pipeline_layout;
 }
 
+uint32_t brx_vk_pipeline_layout::get_descriptor_set_layout_count() const
+{
+    return this->m_descriptor_set_layout_count;
+}
+
+VkDescriptorSetLayout const *brx_vk_pipeline_layout::get_descriptor_set_layouts() const
+{
+    return this->m_descriptor_set_layouts;
+}
+
+uint32_t brx_vk_pipeline_layout::get_push_constant_size() const
+{
+    return this->m_push_constant_size;
+}
+
 void brx_vk_pipeline_layout::steal(VkPipelineLayout *out_pipeline_layout)
 {
     assert(NULL != out_pipeline_layout);
@@ -184,92 +290,56 @@ brx_vk_pipeline_layout::~brx_vk_pipeline_layout()
     assert(VK_NULL_HANDLE == this->m_pipeline_layout);
 }
 
-brx_vk_descriptor_set::brx_vk_descriptor_set() : m_descriptor_pool(VK_NULL_HANDLE), m_descriptor_set(VK_NULL_HANDLE)
+brx_vk_descriptor_set::brx_vk_descriptor_set() : m_descriptor_set_layout(NULL), m_descriptor_set(VK_NULL_HANDLE)
 {
 }
 
-void brx_vk_descriptor_set::init(brx_descriptor_set_layout const *wrapped_descriptor_set_layout, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_descriptor_set::init(brx_vk_descriptor_allocator *descriptor_allocator, brx_descriptor_set_layout const *wrapped_descriptor_set_layout)
 {
     // According to SRT(Shader Resource Table) in PS5, "descriptor set" is essentially a block of GPU-readable memory.
 
-    // In Vulkan, there is no limit for the descriptor pool, and we can use one descriptor pool for each descriptor set.
+    // The descriptor sets of the same descriptor set layout are carved out of the shared descriptor pools, and are recycled when destroyed.
 
     assert(NULL != wrapped_descriptor_set_layout);
     brx_vk_descriptor_set_layout const *unwrapped_descriptor_set_layout = static_cast<brx_vk_descriptor_set_layout const *>(wrapped_descriptor_set_layout);
-    VkDescriptorSetLayout const descriptor_set_layout = unwrapped_descriptor_set_layout->get_descriptor_set_layout();
-    uint32_t const dynamic_uniform_buffer_descriptor_count = unwrapped_descriptor_set_layout->get_dynamic_uniform_buffer_descriptor_count();
-    uint32_t const storage_buffer_descriptor_count = unwrapped_descriptor_set_layout->get_storage_buffer_descriptor_count();
-    uint32_t const sampled_image_descriptor_count = unwrapped_descriptor_set_layout->get_sampled_image_descriptor_count();
-    uint32_t const sampler_descriptor_count = unwrapped_descriptor_set_layout->get_sampler_descriptor_count();
-    uint32_t const storage_image_descriptor_count = unwrapped_descriptor_set_layout->get_storage_image_descriptor_count();
-    uint32_t const top_level_acceleration_structure_descriptor_count = unwrapped_descriptor_set_layout->get_top_level_acceleration_structure_descriptor_count();
-
-    PFN_vkCreateDescriptorPool const pfn_create_descriptor_pool = reinterpret_cast<PFN_vkCreateDescriptorPool>(pfn_get_device_proc_addr(device, "vkCreateDescriptorPool"));
-    assert(NULL != pfn_create_descriptor_pool);
-
-    brx_vector<VkDescriptorPoolSize> descriptor_pool_sizes;
-    if (0U < dynamic_uniform_buffer_descriptor_count)
-    {
-        descriptor_pool_sizes.push_back({VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, dynamic_uniform_buffer_descriptor_count});
-    }
-    if (0U < storage_buffer_descriptor_count)
-    {
-        descriptor_pool_sizes.push_back({VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, storage_buffer_descriptor_count});
-    }
-    if (0U < sampled_image_descriptor_count)
-    {
-        descriptor_pool_sizes.push_back({VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, sampled_image_descriptor_count});
-    }
-    if (0U < sampler_descriptor_count)
-    {
-        descriptor_pool_sizes.push_back({VK_DESCRIPTOR_TYPE_SAMPLER, sampler_descriptor_count});
-    }
-    if (0U < storage_image_descriptor_count)
-    {
-        descriptor_pool_sizes.push_back({VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, storage_image_descriptor_count});
-    }
-    if (0U < top_level_acceleration_structure_descriptor_count)
-    {
-        descriptor_pool_sizes.push_back({VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, top_level_acceleration_structure_descriptor_count});
-    }
-
-    VkDescriptorPoolCreateInfo const descriptor_pool_create_info = {
-        VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
-        NULL,
-        0U,
-        1U,
-        static_cast<uint32_t>(descriptor_pool_sizes.size()),
-        &descriptor_pool_sizes[0]};
 
-    assert(VK_NULL_HANDLE == this->m_descriptor_pool);
-    VkResult const res_create_descriptor_pool = pfn_create_descriptor_pool(device, &descriptor_pool_create_info, allocation_callbacks, &this->m_descriptor_pool);
-    assert(VK_SUCCESS == res_create_descriptor_pool);
-
-    PFN_vkAllocateDescriptorSets const pfn_allocate_descriptor_sets = reinterpret_cast<PFN_vkAllocateDescriptorSets>(pfn_get_device_proc_addr(device, "vkAllocateDescriptorSets"));
-    assert(NULL != pfn_create_descriptor_pool);
-
-    VkDescriptorSetLayout const descriptor_set_layouts[1] = {descriptor_set_layout};
-
-    VkDescriptorSetAllocateInfo const descriptor_set_allocate_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO, NULL, this->m_descriptor_pool, sizeof(descriptor_set_layouts) / sizeof(descriptor_set_layouts[0]), descriptor_set_layouts};
+    // the descriptor set layout should be destroyed after the descriptor sets
+    assert(NULL == this->m_descriptor_set_layout);
+    this->m_descriptor_set_layout = unwrapped_descriptor_set_layout;
 
     assert(VK_NULL_HANDLE == this->m_descriptor_set);
-    VkResult const res_allocate_descriptor_sets = pfn_allocate_descriptor_sets(device, &descriptor_set_allocate_info, &this->m_descriptor_set);
-    assert(VK_SUCCESS == res_allocate_descriptor_sets);
+    this->m_descriptor_set = descriptor_allocator->alloc_descriptor_set(unwrapped_descriptor_set_layout);
+    assert(VK_NULL_HANDLE != this->m_descriptor_set);
 }
 
-void brx_vk_descriptor_set::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_descriptor_set::uninit(brx_vk_descriptor_allocator *descriptor_allocator)
 {
+    assert(NULL != this->m_descriptor_set_layout);
     assert(VK_NULL_HANDLE != this->m_descriptor_set);
+
+    descriptor_allocator->free_descriptor_set(this->m_descriptor_set_layout->get_descriptor_set_layout(), this->m_descriptor_set);
+
     this->m_descriptor_set = VK_NULL_HANDLE;
+    this->m_descriptor_set_layout = NULL;
+}
 
-    assert(VK_NULL_HANDLE != this->m_descriptor_pool);
+void brx_vk_descriptor_set::init_transient(brx_vk_descriptor_set_layout const *descriptor_set_layout, VkDescriptorSet descriptor_set)
+{
+    // the transient descriptor set is owned by the transient descriptor allocator, and is implicitly freed when the descriptor pool is reset
+    assert(NULL == this->m_descriptor_set_layout);
+    this->m_descriptor_set_layout = descriptor_set_layout;
 
-    PFN_vkDestroyDescriptorPool const pfn_destroy_descriptor_pool = reinterpret_cast<PFN_vkDestroyDescriptorPool>(pfn_get_device_proc_addr(device, "vkDestroyDescriptorPool"));
-    assert(NULL != pfn_destroy_descriptor_pool);
+    assert(VK_NULL_HANDLE == this->m_descriptor_set);
+    this->m_descriptor_set = descriptor_set;
+}
 
-    pfn_destroy_descriptor_pool(device, this->m_descriptor_pool, allocation_callbacks);
+void brx_vk_descriptor_set::uninit_transient()
+{
+    assert(NULL != this->m_descriptor_set_layout);
+    assert(VK_NULL_HANDLE != this->m_descriptor_set);
 
-    this->m_descriptor_pool = VK_NULL_HANDLE;
+    this->m_descriptor_set = VK_NULL_HANDLE;
+    this->m_descriptor_set_layout = NULL;
 }
 
 brx_vk_descriptor_set::~brx_vk_descriptor_set()
@@ -277,26 +347,20 @@ brx_vk_descriptor_set::~brx_vk_descriptor_set()
     assert(VK_NULL_HANDLE == this->m_descriptor_set);
 }
 
-void brx_vk_descriptor_set::write_descriptor(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, BRX_DESCRIPTOR_TYPE wrapped_descriptor_type, uint32_t dst_binding, uint32_t dst_array_element, uint32_t src_descriptor_count, brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_storage_buffer const *const *src_storage_buffers, brx_sampled_image const *const *src_sampled_images, brx_sampler const *const *src_samplers, brx_storage_image const *const *src_storage_images, brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures)
+void brx_vk_descriptor_set::fill_descriptor_write(BRX_DESCRIPTOR_TYPE wrapped_descriptor_type, uint32_t dst_binding, uint32_t dst_array_element, uint32_t src_descriptor_count, brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_storage_buffer const *const *src_storage_buffers, brx_sampled_image const *const *src_sampled_images, brx_sampler const *const *src_samplers, brx_storage_image const *const *src_storage_images, brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures, VkWriteDescriptorSet *out_descriptor_write, VkDescriptorBufferInfo *out_buffer_infos, VkDescriptorImageInfo *out_image_infos, VkWriteDescriptorSetAccelerationStructureKHR *out_descriptor_write_acceleration_structure, VkAccelerationStructureKHR *out_acceleration_structures) const
 {
-    PFN_vkUpdateDescriptorSets const pfn_update_descriptor_sets = reinterpret_cast<PFN_vkUpdateDescriptorSets>(pfn_get_device_proc_addr(device, "vkUpdateDescriptorSets"));
-    assert(NULL != pfn_update_descriptor_sets);
+    // the info arrays are provided by the caller, and the "vkUpdateDescriptorSets" is called by the caller as well
+    out_descriptor_write->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    out_descriptor_write->dstSet = this->m_descriptor_set;
+    out_descriptor_write->dstBinding = dst_binding;
+    out_descriptor_write->dstArrayElement = dst_array_element;
+    out_descriptor_write->descriptorCount = src_descriptor_count;
 
-    VkWriteDescriptorSet descriptor_write;
-    descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    descriptor_write.dstSet = this->m_descriptor_set;
-    descriptor_write.dstBinding = dst_binding;
-    descriptor_write.dstArrayElement = dst_array_element;
-    descriptor_write.descriptorCount = src_descriptor_count;
-
-    brx_vector<VkDescriptorBufferInfo> buffer_info(static_cast<size_t>(src_descriptor_count));
-    brx_vector<VkDescriptorImageInfo> image_info(static_cast<size_t>(src_descriptor_count));
-    brx_vector<VkAccelerationStructureKHR> acceleration_structure_info(static_cast<size_t>(src_descriptor_count));
     switch (wrapped_descriptor_type)
     {
     case BRX_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER:
     {
-        descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        out_descriptor_write->descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
 
         assert(NULL != src_dynamic_uniform_buffers);
         assert(NULL != src_dynamic_uniform_buffer_ranges);
@@ -305,24 +369,24 @@ void brx_vk_descriptor_set::write_descriptor(PFN_vkGetDeviceProcAddr pfn_get_dev
         assert(NULL == src_samplers);
         assert(NULL == src_storage_images);
         assert(NULL == src_top_level_acceleration_structures);
-        descriptor_write.pNext = NULL;
-        descriptor_write.pImageInfo = NULL;
-        descriptor_write.pBufferInfo = &buffer_info[0];
-        descriptor_write.pTexelBufferView = NULL;
+        out_descriptor_write->pNext = NULL;
+        out_descriptor_write->pImageInfo = NULL;
+        out_descriptor_write->pBufferInfo = out_buffer_infos;
+        out_descriptor_write->pTexelBufferView = NULL;
 
         for (uint32_t descriptor_index = 0U; descriptor_index < src_descriptor_count; ++descriptor_index)
         {
             assert(NULL != src_dynamic_uniform_buffers[descriptor_index]);
-            buffer_info[descriptor_index].buffer = static_cast<brx_vk_uniform_upload_buffer const *>(src_dynamic_uniform_buffers[descriptor_index])->get_buffer();
-            buffer_info[descriptor_index].offset = 0U;
-            buffer_info[descriptor_index].range = src_dynamic_uniform_buffer_ranges[descriptor_index];
+            out_buffer_infos[descriptor_index].buffer = static_cast<brx_vk_uniform_upload_buffer const *>(src_dynamic_uniform_buffers[descriptor_index])->get_buffer();
+            out_buffer_infos[descriptor_index].offset = 0U;
+            out_buffer_infos[descriptor_index].range = src_dynamic_uniform_buffer_ranges[descriptor_index];
         }
     }
     break;
     case BRX_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER:
     case BRX_DESCRIPTOR_TYPE_STORAGE_BUFFER:
     {
-        descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        out_descriptor_write->descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
 
         assert(NULL == src_dynamic_uniform_buffers);
         assert(NULL == src_dynamic_uniform_buffer_ranges);
@@ -331,23 +395,23 @@ void brx_vk_descriptor_set::write_descriptor(PFN_vkGetDeviceProcAddr pfn_get_dev
         assert(NULL == src_samplers);
         assert(NULL == src_storage_images);
         assert(NULL == src_top_level_acceleration_structures);
-        descriptor_write.pNext = NULL;
-        descriptor_write.pImageInfo = NULL;
-        descriptor_write.pBufferInfo = &buffer_info[0];
-        descriptor_write.pTexelBufferView = NULL;
+        out_descriptor_write->pNext = NULL;
+        out_descriptor_write->pImageInfo = NULL;
+        out_descriptor_write->pBufferInfo = out_buffer_infos;
+        out_descriptor_write->pTexelBufferView = NULL;
 
         for (uint32_t descriptor_index = 0U; descriptor_index < src_descriptor_count; ++descriptor_index)
         {
             assert(NULL != src_storage_buffers[descriptor_index]);
-            buffer_info[descriptor_index].buffer = static_cast<brx_vk_storage_buffer const *>(src_storage_buffers[descriptor_index])->get_buffer();
-            buffer_info[descriptor_index].offset = 0U;
-            buffer_info[descriptor_index].range = static_cast<brx_vk_storage_buffer const *>(src_storage_buffers[descriptor_index])->get_size();
+            out_buffer_infos[descriptor_index].buffer = static_cast<brx_vk_storage_buffer const *>(src_storage_buffers[descriptor_index])->get_buffer();
+            out_buffer_infos[descriptor_index].offset = 0U;
+            out_buffer_infos[descriptor_index].range = static_cast<brx_vk_storage_buffer const *>(src_storage_buffers[descriptor_index])->get_size();
         }
     }
     break;
     case BRX_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
     {
-        descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+        out_descriptor_write->descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
 
         assert(NULL == src_dynamic_uniform_buffers);
         assert(NULL == src_dynamic_uniform_buffer_ranges);
@@ -356,23 +420,23 @@ void brx_vk_descriptor_set::write_descriptor(PFN_vkGetDeviceProcAddr pfn_get_dev
         assert(NULL == src_samplers);
         assert(NULL == src_storage_images);
         assert(NULL == src_top_level_acceleration_structures);
-        descriptor_write.pNext = NULL;
-        descriptor_write.pImageInfo = &image_info[0];
-        descriptor_write.pBufferInfo = NULL;
-        descriptor_write.pTexelBufferView = NULL;
+        out_descriptor_write->pNext = NULL;
+        out_descriptor_write->pImageInfo = out_image_infos;
+        out_descriptor_write->pBufferInfo = NULL;
+        out_descriptor_write->pTexelBufferView = NULL;
 
         for (uint32_t descriptor_index = 0U; descriptor_index < src_descriptor_count; ++descriptor_index)
         {
             assert(NULL != src_sampled_images[descriptor_index]);
-            image_info[descriptor_index].sampler = VK_NULL_HANDLE;
-            image_info[descriptor_index].imageView = static_cast<brx_vk_sampled_image const *>(src_sampled_images[descriptor_index])->get_image_view();
-            image_info[descriptor_index].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            out_image_infos[descriptor_index].sampler = VK_NULL_HANDLE;
+            out_image_infos[descriptor_index].imageView = static_cast<brx_vk_sampled_image const *>(src_sampled_images[descriptor_index])->get_image_view();
+            out_image_infos[descriptor_index].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
         }
     }
     break;
     case BRX_DESCRIPTOR_TYPE_SAMPLER:
     {
-        descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+        out_descriptor_write->descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
 
         assert(NULL == src_dynamic_uniform_buffers);
         assert(NULL == src_dynamic_uniform_buffer_ranges);
@@ -381,23 +445,23 @@ void brx_vk_descriptor_set::write_descriptor(PFN_vkGetDeviceProcAddr pfn_get_dev
         assert(NULL != src_samplers);
         assert(NULL == src_storage_images);
         assert(NULL == src_top_level_acceleration_structures);
-        descriptor_write.pNext = NULL;
-        descriptor_write.pImageInfo = &image_info[0];
-        descriptor_write.pBufferInfo = NULL;
-        descriptor_write.pTexelBufferView = NULL;
+        out_descriptor_write->pNext = NULL;
+        out_descriptor_write->pImageInfo = out_image_infos;
+        out_descriptor_write->pBufferInfo = NULL;
+        out_descriptor_write->pTexelBufferView = NULL;
 
         for (uint32_t descriptor_index = 0U; descriptor_index < src_descriptor_count; ++descriptor_index)
         {
             assert(NULL != src_samplers[descriptor_index]);
-            image_info[descriptor_index].sampler = static_cast<brx_vk_sampler const *>(src_samplers[descriptor_index])->get_sampler();
-            image_info[descriptor_index].imageView = VK_NULL_HANDLE;
-            image_info[descriptor_index].imageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            out_image_infos[descriptor_index].sampler = static_cast<brx_vk_sampler const *>(src_samplers[descriptor_index])->get_sampler();
+            out_image_infos[descriptor_index].imageView = VK_NULL_HANDLE;
+            out_image_infos[descriptor_index].imageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
         }
     }
     break;
     case BRX_DESCRIPTOR_TYPE_STORAGE_IMAGE:
     {
-        descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        out_descriptor_write->descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
 
         assert(NULL == src_dynamic_uniform_buffers);
         assert(NULL == src_dynamic_uniform_buffer_ranges);
@@ -406,29 +470,28 @@ void brx_vk_descriptor_set::write_descriptor(PFN_vkGetDeviceProcAddr pfn_get_dev
         assert(NULL == src_samplers);
         assert(NULL != src_storage_images);
         assert(NULL == src_top_level_acceleration_structures);
-        descriptor_write.pNext = NULL;
-        descriptor_write.pImageInfo = &image_info[0];
-        descriptor_write.pBufferInfo = NULL;
-        descriptor_write.pTexelBufferView = NULL;
+        out_descriptor_write->pNext = NULL;
+        out_descriptor_write->pImageInfo = out_image_infos;
+        out_descriptor_write->pBufferInfo = NULL;
+        out_descriptor_write->pTexelBufferView = NULL;
 
         for (uint32_t descriptor_index = 0U; descriptor_index < src_descriptor_count; ++descriptor_index)
         {
             assert(NULL != src_storage_images[descriptor_index]);
-            image_info[descriptor_index].sampler = VK_NULL_HANDLE;
-            image_info[descriptor_index].imageView = static_cast<brx_vk_storage_image const *>(src_storage_images[descriptor_index])->get_image_view();
-            image_info[descriptor_index].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+            out_image_infos[descriptor_index].sampler = VK_NULL_HANDLE;
+            out_image_infos[descriptor_index].imageView = static_cast<brx_vk_storage_image const *>(src_storage_images[descriptor_index])->get_image_view();
+            out_image_infos[descriptor_index].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
         }
     }
     break;
     case BRX_DESCRIPTOR_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE:
     {
-        descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
+        out_descriptor_write->descriptorType = VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
 
-        VkWriteDescriptorSetAccelerationStructureKHR const descriptor_write_acceleration_structure = {
-            VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR,
-            NULL,
-            src_descriptor_count,
-            &acceleration_structure_info[0]};
+        out_descriptor_write_acceleration_structure->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
+        out_descriptor_write_acceleration_structure->pNext = NULL;
+        out_descriptor_write_acceleration_structure->accelerationStructureCount = src_descriptor_count;
+        out_descriptor_write_acceleration_structure->pAccelerationStructures = out_acceleration_structures;
 
         assert(NULL == src_dynamic_uniform_buffers);
         assert(NULL == src_dynamic_uniform_buffer_ranges);
@@ -436,32 +499,203 @@ void brx_vk_descriptor_set::write_descriptor(PFN_vkGetDeviceProcAddr pfn_get_dev
         assert(NULL == src_sampled_images);
         assert(NULL == src_samplers);
         assert(NULL != src_top_level_acceleration_structures);
-        descriptor_write.pNext = &descriptor_write_acceleration_structure;
-        descriptor_write.pImageInfo = NULL;
-        descriptor_write.pBufferInfo = NULL;
-        descriptor_write.pTexelBufferView = NULL;
+        out_descriptor_write->pNext = out_descriptor_write_acceleration_structure;
+        out_descriptor_write->pImageInfo = NULL;
+        out_descriptor_write->pBufferInfo = NULL;
+        out_descriptor_write->pTexelBufferView = NULL;
 
         for (uint32_t descriptor_index = 0U; descriptor_index < src_descriptor_count; ++descriptor_index)
         {
             assert(NULL != src_top_level_acceleration_structures[descriptor_index]);
-            acceleration_structure_info[descriptor_index] = static_cast<brx_vk_top_level_acceleration_structure const *>(src_top_level_acceleration_structures[descriptor_index])->get_acceleration_structure();
+            out_acceleration_structures[descriptor_index] = static_cast<brx_vk_top_level_acceleration_structure const *>(src_top_level_acceleration_structures[descriptor_index])->get_acceleration_structure();
         }
     }
     break;
     default:
     {
         assert(false);
-        descriptor_write.descriptorType = static_cast<VkDescriptorType>(-1);
-        descriptor_write.pImageInfo = NULL;
-        descriptor_write.pBufferInfo = NULL;
-        descriptor_write.pTexelBufferView = NULL;
+        out_descriptor_write->descriptorType = static_cast<VkDescriptorType>(-1);
+        out_descriptor_write->pImageInfo = NULL;
+        out_descriptor_write->pBufferInfo = NULL;
+        out_descriptor_write->pTexelBufferView = NULL;
+    }
+    }
+}
+
+void brx_vk_descriptor_set::write_descriptor_with_template(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges) const
+{
+    PFN_vkUpdateDescriptorSetWithTemplate const pfn_update_descriptor_set_with_template = dispatch_table->pfn_update_descriptor_set_with_template;
+    assert(NULL != pfn_update_descriptor_set_with_template);
+
+    VkDescriptorUpdateTemplate const descriptor_update_template = this->m_descriptor_set_layout->get_descriptor_update_template();
+    assert(VK_NULL_HANDLE != descriptor_update_template);
+
+    uint32_t const descriptor_count = this->m_descriptor_set_layout->get_descriptor_update_template_descriptor_count();
+    BRX_DESCRIPTOR_TYPE const *const descriptor_types = this->m_descriptor_set_layout->get_descriptor_update_template_descriptor_types();
+
+    // the per-frame descriptor sets are usually small enough to avoid the heap allocation
+    constexpr uint32_t const max_stack_descriptor_count = 64U;
+    brx_vk_descriptor_update_template_data stack_descriptor_update_template_data[max_stack_descriptor_count];
+    brx_vector<brx_vk_descriptor_update_template_data> heap_descriptor_update_template_data;
+
+    brx_vk_descriptor_update_template_data *descriptor_update_template_data;
+    if (descriptor_count <= max_stack_descriptor_count)
+    {
+        descriptor_update_template_data = stack_descriptor_update_template_data;
     }
+    else
+    {
+        heap_descriptor_update_template_data.resize(static_cast<size_t>(descriptor_count));
+        descriptor_update_template_data = &heap_descriptor_update_template_data[0];
     }
 
-    pfn_update_descriptor_sets(device, 1U, &descriptor_write, 0U, NULL);
+    uint32_t dynamic_uniform_buffer_index = 0U;
+    for (uint32_t descriptor_index = 0U; descriptor_index < descriptor_count; ++descriptor_index)
+    {
+        assert(NULL != src_descriptors[descriptor_index]);
+
+        switch (descriptor_types[descriptor_index])
+        {
+        case BRX_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER:
+        {
+            assert(NULL != src_dynamic_uniform_buffer_ranges);
+            descriptor_update_template_data[descriptor_index].buffer_info.buffer = static_cast<brx_vk_uniform_upload_buffer const *>(static_cast<brx_uniform_upload_buffer const *>(src_descriptors[descriptor_index]))->get_buffer();
+            descriptor_update_template_data[descriptor_index].buffer_info.offset = 0U;
+            descriptor_update_template_data[descriptor_index].buffer_info.range = src_dynamic_uniform_buffer_ranges[dynamic_uniform_buffer_index];
+            ++dynamic_uniform_buffer_index;
+        }
+        break;
+        case BRX_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER:
+        case BRX_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        {
+            brx_vk_storage_buffer const *const storage_buffer = static_cast<brx_vk_storage_buffer const *>(static_cast<brx_storage_buffer const *>(src_descriptors[descriptor_index]));
+            descriptor_update_template_data[descriptor_index].buffer_info.buffer = storage_buffer->get_buffer();
+            descriptor_update_template_data[descriptor_index].buffer_info.offset = 0U;
+            descriptor_update_template_data[descriptor_index].buffer_info.range = storage_buffer->get_size();
+        }
+        break;
+        case BRX_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        {
+            descriptor_update_template_data[descriptor_index].image_info.sampler = VK_NULL_HANDLE;
+            descriptor_update_template_data[descriptor_index].image_info.imageView = static_cast<brx_vk_sampled_image const *>(static_cast<brx_sampled_image const *>(src_descriptors[descriptor_index]))->get_image_view();
+            descriptor_update_template_data[descriptor_index].image_info.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        }
+        break;
+        case BRX_DESCRIPTOR_TYPE_SAMPLER:
+        {
+            descriptor_update_template_data[descriptor_index].image_info.sampler = static_cast<brx_vk_sampler const *>(static_cast<brx_sampler const *>(src_descriptors[descriptor_index]))->get_sampler();
+            descriptor_update_template_data[descriptor_index].image_info.imageView = VK_NULL_HANDLE;
+            descriptor_update_template_data[descriptor_index].image_info.imageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        }
+        break;
+        case BRX_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        {
+            descriptor_update_template_data[descriptor_index].image_info.sampler = VK_NULL_HANDLE;
+            descriptor_update_template_data[descriptor_index].image_info.imageView = static_cast<brx_vk_storage_image const *>(static_cast<brx_storage_image const *>(src_descriptors[descriptor_index]))->get_image_view();
+            descriptor_update_template_data[descriptor_index].image_info.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+        }
+        break;
+        case BRX_DESCRIPTOR_TYPE_TOP_LEVEL_ACCELERATION_STRUCTURE:
+        {
+            descriptor_update_template_data[descriptor_index].acceleration_structure = static_cast<brx_vk_top_level_acceleration_structure const *>(static_cast<brx_top_level_acceleration_structure const *>(src_descriptors[descriptor_index]))->get_acceleration_structure();
+        }
+        break;
+        default:
+        {
+            assert(false);
+        }
+        }
+    }
+
+    pfn_update_descriptor_set_with_template(device, this->m_descriptor_set, descriptor_update_template, descriptor_update_template_data);
 }
 
 VkDescriptorSet brx_vk_descriptor_set::get_descriptor_set() const
 {
     return this->m_descriptor_set;
 }
+
+uint32_t brx_vk_descriptor_set::get_dynamic_uniform_buffer_descriptor_count() const
+{
+    return this->m_descriptor_set_layout->get_dynamic_uniform_buffer_descriptor_count();
+}
+
+brx_vk_bindless_table::brx_vk_bindless_table() : m_descriptor_type(static_cast<BRX_DESCRIPTOR_TYPE>(-1)), m_descriptor_set_layout(NULL), m_descriptor_set(NULL)
+{
+}
+
+void brx_vk_bindless_table::init(BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t descriptor_count, brx_vk_descriptor_set_layout *descriptor_set_layout, brx_vk_descriptor_set *descriptor_set)
+{
+    this->m_descriptor_type = descriptor_type;
+
+    assert(NULL == this->m_descriptor_set_layout);
+    this->m_descriptor_set_layout = descriptor_set_layout;
+
+    assert(NULL == this->m_descriptor_set);
+    this->m_descriptor_set = descriptor_set;
+
+    // the free list is used as a stack, and the lower descriptor indices are allocated first
+    assert(this->m_free_descriptor_indices.empty());
+    this->m_free_descriptor_indices.resize(static_cast<size_t>(descriptor_count));
+    for (uint32_t descriptor_index = 0U; descriptor_index < descriptor_count; ++descriptor_index)
+    {
+        this->m_free_descriptor_indices[descriptor_index] = (descriptor_count - 1U) - descriptor_index;
+    }
+}
+
+void brx_vk_bindless_table::steal(brx_vk_descriptor_set_layout **out_descriptor_set_layout, brx_vk_descriptor_set **out_descriptor_set)
+{
+    assert(NULL != out_descriptor_set_layout);
+    assert(NULL != out_descriptor_set);
+
+    (*out_descriptor_set_layout) = this->m_descriptor_set_layout;
+    (*out_descriptor_set) = this->m_descriptor_set;
+
+    this->m_descriptor_set_layout = NULL;
+    this->m_descriptor_set = NULL;
+    this->m_free_descriptor_indices.clear();
+}
+
+brx_vk_bindless_table::~brx_vk_bindless_table()
+{
+    assert(NULL == this->m_descriptor_set_layout);
+    assert(NULL == this->m_descriptor_set);
+}
+
+BRX_DESCRIPTOR_TYPE brx_vk_bindless_table::get_descriptor_type() const
+{
+    return this->m_descriptor_type;
+}
+
+brx_vk_descriptor_set_layout *brx_vk_bindless_table::get_descriptor_set_layout() const
+{
+    return this->m_descriptor_set_layout;
+}
+
+brx_vk_descriptor_set *brx_vk_bindless_table::get_descriptor_set() const
+{
+    return this->m_descriptor_set;
+}
+
+uint32_t brx_vk_bindless_table::alloc_descriptor_index()
+{
+    uint32_t descriptor_index;
+    if (!this->m_free_descriptor_indices.empty())
+    {
+        descriptor_index = this->m_free_descriptor_indices.back();
+        this->m_free_descriptor_indices.pop_back();
+    }
+    else
+    {
+        assert(false);
+        descriptor_index = static_cast<uint32_t>(-1);
+    }
+
+    return descriptor_index;
+}
+
+void brx_vk_bindless_table::free_descriptor_index(uint32_t descriptor_index)
+{
+    // the stale descriptor is NOT accessed since the descriptor binding is partially bound
+    this->m_free_descriptor_indices.push_back(descriptor_index);
+}
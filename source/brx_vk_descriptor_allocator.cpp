@@ -0,0 +1,365 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_vk_device.h"
+#include "brx_malloc.h"
+#include <algorithm>
+#include <assert.h>
+#include <new>
+
+brx_vk_descriptor_allocator::brx_vk_descriptor_allocator()
+	: m_dispatch_table(NULL),
+	  m_device(VK_NULL_HANDLE),
+	  m_allocation_callbacks(NULL)
+{
+}
+
+void brx_vk_descriptor_allocator::init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+{
+	assert(NULL == this->m_dispatch_table);
+	this->m_dispatch_table = dispatch_table;
+
+	assert(VK_NULL_HANDLE == this->m_device);
+	this->m_device = device;
+
+	assert(NULL == this->m_allocation_callbacks);
+	this->m_allocation_callbacks = allocation_callbacks;
+
+	assert(this->m_descriptor_set_pools.empty());
+}
+
+void brx_vk_descriptor_allocator::uninit()
+{
+	// the descriptor set pools are released when the descriptor set layouts are destroyed
+	assert(this->m_descriptor_set_pools.empty());
+
+	this->m_allocation_callbacks = NULL;
+
+	assert(VK_NULL_HANDLE != this->m_device);
+	this->m_device = VK_NULL_HANDLE;
+
+	assert(NULL != this->m_dispatch_table);
+	this->m_dispatch_table = NULL;
+}
+
+brx_vk_descriptor_allocator::~brx_vk_descriptor_allocator()
+{
+	assert(NULL == this->m_dispatch_table);
+	assert(VK_NULL_HANDLE == this->m_device);
+	assert(this->m_descriptor_set_pools.empty());
+}
+
+VkDescriptorSet brx_vk_descriptor_allocator::alloc_descriptor_set(brx_vk_descriptor_set_layout const *descriptor_set_layout)
+{
+	assert(NULL != descriptor_set_layout);
+
+	std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+
+	// value-initialized when the descriptor set layout is used for the first time
+	brx_vk_descriptor_set_pool &descriptor_set_pool = this->m_descriptor_set_pools[descriptor_set_layout->get_descriptor_set_layout()];
+
+	if (descriptor_set_pool.free_descriptor_sets.empty())
+	{
+		// the pools grow geometrically to keep the number of the driver objects low under heavy churn
+		// the bindless tables are huge and long-lived, and thus each of them is allocated from its own pool
+		constexpr uint32_t const min_descriptor_pool_max_set_count = 16U;
+		constexpr uint32_t const max_descriptor_pool_max_set_count = 1024U;
+		bool const update_after_bind = descriptor_set_layout->get_update_after_bind();
+		uint32_t const new_descriptor_pool_max_set_count = (!update_after_bind) ? std::min(std::max(2U * descriptor_set_pool.last_descriptor_pool_max_set_count, min_descriptor_pool_max_set_count), max_descriptor_pool_max_set_count) : 1U;
+
+		uint32_t const dynamic_uniform_buffer_descriptor_count = descriptor_set_layout->get_dynamic_uniform_buffer_descriptor_count();
+		uint32_t const storage_buffer_descriptor_count = descriptor_set_layout->get_storage_buffer_descriptor_count();
+		uint32_t const sampled_image_descriptor_count = descriptor_set_layout->get_sampled_image_descriptor_count();
+		uint32_t const sampler_descriptor_count = descriptor_set_layout->get_sampler_descriptor_count();
+		uint32_t const storage_image_descriptor_count = descriptor_set_layout->get_storage_image_descriptor_count();
+		uint32_t const top_level_acceleration_structure_descriptor_count = descriptor_set_layout->get_top_level_acceleration_structure_descriptor_count();
+
+		VkDescriptorPoolSize descriptor_pool_sizes[6];
+		uint32_t descriptor_pool_size_count = 0U;
+		if (0U < dynamic_uniform_buffer_descriptor_count)
+		{
+			descriptor_pool_sizes[descriptor_pool_size_count] = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, dynamic_uniform_buffer_descriptor_count * new_descriptor_pool_max_set_count};
+			++descriptor_pool_size_count;
+		}
+		if (0U < storage_buffer_descriptor_count)
+		{
+			descriptor_pool_sizes[descriptor_pool_size_count] = {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, storage_buffer_descriptor_count * new_descriptor_pool_max_set_count};
+			++descriptor_pool_size_count;
+		}
+		if (0U < sampled_image_descriptor_count)
+		{
+			descriptor_pool_sizes[descriptor_pool_size_count] = {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, sampled_image_descriptor_count * new_descriptor_pool_max_set_count};
+			++descriptor_pool_size_count;
+		}
+		if (0U < sampler_descriptor_count)
+		{
+			descriptor_pool_sizes[descriptor_pool_size_count] = {VK_DESCRIPTOR_TYPE_SAMPLER, sampler_descriptor_count * new_descriptor_pool_max_set_count};
+			++descriptor_pool_size_count;
+		}
+		if (0U < storage_image_descriptor_count)
+		{
+			descriptor_pool_sizes[descriptor_pool_size_count] = {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, storage_image_descriptor_count * new_descriptor_pool_max_set_count};
+			++descriptor_pool_size_count;
+		}
+		if (0U < top_level_acceleration_structure_descriptor_count)
+		{
+			descriptor_pool_sizes[descriptor_pool_size_count] = {VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, top_level_acceleration_structure_descriptor_count * new_descriptor_pool_max_set_count};
+			++descriptor_pool_size_count;
+		}
+
+		// the descriptor sets are never freed individually, and thus the VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT is NOT required
+		VkDescriptorPoolCreateInfo const descriptor_pool_create_info = {
+			VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+			NULL,
+			(!update_after_bind) ? 0U : VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT,
+			new_descriptor_pool_max_set_count,
+			descriptor_pool_size_count,
+			(descriptor_pool_size_count > 0U) ? descriptor_pool_sizes : NULL};
+
+		VkDescriptorPool new_descriptor_pool = VK_NULL_HANDLE;
+		VkResult const res_create_descriptor_pool = this->m_dispatch_table->pfn_create_descriptor_pool(this->m_device, &descriptor_pool_create_info, this->m_allocation_callbacks, &new_descriptor_pool);
+		assert(VK_SUCCESS == res_create_descriptor_pool);
+
+		descriptor_set_pool.descriptor_pools.push_back(new_descriptor_pool);
+		descriptor_set_pool.last_descriptor_pool_max_set_count = new_descriptor_pool_max_set_count;
+
+		// carve all descriptor sets out of the new pool at once
+		brx_vector<VkDescriptorSetLayout> descriptor_set_layouts(static_cast<size_t>(new_descriptor_pool_max_set_count), descriptor_set_layout->get_descriptor_set_layout());
+
+		VkDescriptorSetAllocateInfo const descriptor_set_allocate_info = {
+			VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+			NULL,
+			new_descriptor_pool,
+			new_descriptor_pool_max_set_count,
+			&descriptor_set_layouts[0]};
+
+		size_t const free_descriptor_set_count = descriptor_set_pool.free_descriptor_sets.size();
+		descriptor_set_pool.free_descriptor_sets.resize(free_descriptor_set_count + new_descriptor_pool_max_set_count);
+
+		VkResult const res_allocate_descriptor_sets = this->m_dispatch_table->pfn_allocate_descriptor_sets(this->m_device, &descriptor_set_allocate_info, &descriptor_set_pool.free_descriptor_sets[free_descriptor_set_count]);
+		assert(VK_SUCCESS == res_allocate_descriptor_sets);
+	}
+
+	assert(!descriptor_set_pool.free_descriptor_sets.empty());
+	VkDescriptorSet const descriptor_set = descriptor_set_pool.free_descriptor_sets.back();
+	descriptor_set_pool.free_descriptor_sets.pop_back();
+	++descriptor_set_pool.busy_descriptor_set_count;
+
+	return descriptor_set;
+}
+
+void brx_vk_descriptor_allocator::free_descriptor_set(VkDescriptorSetLayout descriptor_set_layout, VkDescriptorSet descriptor_set)
+{
+	std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+
+	brx_map<VkDescriptorSetLayout, brx_vk_descriptor_set_pool>::iterator const found = this->m_descriptor_set_pools.find(descriptor_set_layout);
+	assert(this->m_descriptor_set_pools.end() != found);
+
+	assert(found->second.busy_descriptor_set_count > 0U);
+	--found->second.busy_descriptor_set_count;
+
+	// the stale descriptors will be overwritten by the "write_descriptor_set" before the descriptor set is used again
+	found->second.free_descriptor_sets.push_back(descriptor_set);
+}
+
+void brx_vk_descriptor_allocator::release_descriptor_set_layout(VkDescriptorSetLayout descriptor_set_layout)
+{
+	std::lock_guard<std::mutex> lock_guard(this->m_mutex);
+
+	brx_map<VkDescriptorSetLayout, brx_vk_descriptor_set_pool>::iterator const found = this->m_descriptor_set_pools.find(descriptor_set_layout);
+	if (this->m_descriptor_set_pools.end() != found)
+	{
+		// the descriptor sets should be destroyed before the descriptor set layout
+		assert(0U == found->second.busy_descriptor_set_count);
+
+		// the descriptor sets are implicitly freed when the descriptor pool is destroyed
+		for (VkDescriptorPool const descriptor_pool : found->second.descriptor_pools)
+		{
+			this->m_dispatch_table->pfn_destroy_descriptor_pool(this->m_device, descriptor_pool, this->m_allocation_callbacks);
+		}
+
+		this->m_descriptor_set_pools.erase(found);
+	}
+}
+
+brx_vk_transient_descriptor_allocator::brx_vk_transient_descriptor_allocator()
+	: m_dispatch_table(NULL),
+	  m_device(VK_NULL_HANDLE),
+	  m_allocation_callbacks(NULL),
+	  m_support_ray_tracing(false),
+	  m_current_descriptor_pool_index(0U),
+	  m_descriptor_set_count(0U)
+{
+}
+
+void brx_vk_transient_descriptor_allocator::init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, bool support_ray_tracing)
+{
+	assert(NULL == this->m_dispatch_table);
+	this->m_dispatch_table = dispatch_table;
+
+	assert(VK_NULL_HANDLE == this->m_device);
+	this->m_device = device;
+
+	assert(NULL == this->m_allocation_callbacks);
+	this->m_allocation_callbacks = allocation_callbacks;
+
+	this->m_support_ray_tracing = support_ray_tracing;
+
+	assert(this->m_descriptor_pools.empty());
+	assert(0U == this->m_current_descriptor_pool_index);
+
+	assert(this->m_descriptor_sets.empty());
+	assert(0U == this->m_descriptor_set_count);
+}
+
+void brx_vk_transient_descriptor_allocator::uninit()
+{
+	this->reset();
+
+	for (brx_vk_descriptor_set *const delete_descriptor_set : this->m_descriptor_sets)
+	{
+		delete_descriptor_set->~brx_vk_descriptor_set();
+		brx_free(delete_descriptor_set);
+	}
+	this->m_descriptor_sets.clear();
+
+	// the descriptor sets are implicitly freed when the descriptor pool is destroyed
+	for (VkDescriptorPool const descriptor_pool : this->m_descriptor_pools)
+	{
+		this->m_dispatch_table->pfn_destroy_descriptor_pool(this->m_device, descriptor_pool, this->m_allocation_callbacks);
+	}
+	this->m_descriptor_pools.clear();
+
+	this->m_allocation_callbacks = NULL;
+
+	assert(VK_NULL_HANDLE != this->m_device);
+	this->m_device = VK_NULL_HANDLE;
+
+	assert(NULL != this->m_dispatch_table);
+	this->m_dispatch_table = NULL;
+}
+
+brx_vk_transient_descriptor_allocator::~brx_vk_transient_descriptor_allocator()
+{
+	assert(NULL == this->m_dispatch_table);
+	assert(VK_NULL_HANDLE == this->m_device);
+	assert(this->m_descriptor_pools.empty());
+	assert(this->m_descriptor_sets.empty());
+}
+
+brx_vk_descriptor_set *brx_vk_transient_descriptor_allocator::alloc_descriptor_set(brx_descriptor_set_layout const *wrapped_descriptor_set_layout)
+{
+	assert(NULL != wrapped_descriptor_set_layout);
+	brx_vk_descriptor_set_layout const *const unwrapped_descriptor_set_layout = static_cast<brx_vk_descriptor_set_layout const *>(wrapped_descriptor_set_layout);
+
+	// the bindless tables are NOT transient
+	assert(!unwrapped_descriptor_set_layout->get_update_after_bind());
+
+	VkDescriptorSetLayout const descriptor_set_layout = unwrapped_descriptor_set_layout->get_descriptor_set_layout();
+
+	VkDescriptorSet new_descriptor_set = VK_NULL_HANDLE;
+	while (VK_NULL_HANDLE == new_descriptor_set)
+	{
+		bool const create_descriptor_pool = (this->m_current_descriptor_pool_index >= this->m_descriptor_pools.size());
+		if (create_descriptor_pool)
+		{
+			// the descriptor pools of different frames are NOT shared, and thus the pools are simply chained when the current one is exhausted
+			constexpr uint32_t const transient_descriptor_pool_max_set_count = 256U;
+			constexpr uint32_t const transient_descriptor_pool_descriptor_count = 1024U;
+
+			// the new descriptor pool is at least as large as the descriptor set layout, and thus the allocation from the new descriptor pool always succeeds
+			VkDescriptorPoolSize const descriptor_pool_sizes[] = {
+				{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, std::max(transient_descriptor_pool_descriptor_count, unwrapped_descriptor_set_layout->get_dynamic_uniform_buffer_descriptor_count())},
+				{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, std::max(transient_descriptor_pool_descriptor_count, unwrapped_descriptor_set_layout->get_storage_buffer_descriptor_count())},
+				{VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, std::max(transient_descriptor_pool_descriptor_count, unwrapped_descriptor_set_layout->get_sampled_image_descriptor_count())},
+				{VK_DESCRIPTOR_TYPE_SAMPLER, std::max(transient_descriptor_pool_descriptor_count, unwrapped_descriptor_set_layout->get_sampler_descriptor_count())},
+				{VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, std::max(transient_descriptor_pool_descriptor_count, unwrapped_descriptor_set_layout->get_storage_image_descriptor_count())},
+				{VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, std::max(transient_descriptor_pool_max_set_count, unwrapped_descriptor_set_layout->get_top_level_acceleration_structure_descriptor_count())}};
+
+			// the descriptor sets are never freed individually, and thus the VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT is NOT required
+			VkDescriptorPoolCreateInfo const descriptor_pool_create_info = {
+				VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+				NULL,
+				0U,
+				transient_descriptor_pool_max_set_count,
+				this->m_support_ray_tracing ? static_cast<uint32_t>(sizeof(descriptor_pool_sizes) / sizeof(descriptor_pool_sizes[0])) : (static_cast<uint32_t>(sizeof(descriptor_pool_sizes) / sizeof(descriptor_pool_sizes[0])) - 1U),
+				descriptor_pool_sizes};
+
+			VkDescriptorPool new_descriptor_pool = VK_NULL_HANDLE;
+			VkResult const res_create_descriptor_pool = this->m_dispatch_table->pfn_create_descriptor_pool(this->m_device, &descriptor_pool_create_info, this->m_allocation_callbacks, &new_descriptor_pool);
+			assert(VK_SUCCESS == res_create_descriptor_pool);
+
+			this->m_descriptor_pools.push_back(new_descriptor_pool);
+		}
+
+		VkDescriptorSetAllocateInfo const descriptor_set_allocate_info = {
+			VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+			NULL,
+			this->m_descriptor_pools[this->m_current_descriptor_pool_index],
+			1U,
+			&descriptor_set_layout};
+
+		VkResult const res_allocate_descriptor_sets = this->m_dispatch_table->pfn_allocate_descriptor_sets(this->m_device, &descriptor_set_allocate_info, &new_descriptor_set);
+		if (VK_SUCCESS != res_allocate_descriptor_sets)
+		{
+			assert((VK_ERROR_OUT_OF_POOL_MEMORY == res_allocate_descriptor_sets) || (VK_ERROR_FRAGMENTED_POOL == res_allocate_descriptor_sets));
+			new_descriptor_set = VK_NULL_HANDLE;
+
+			// the new descriptor pool is sized from the descriptor set layout, and thus the failure is NOT caused by the exhaustion and retrying the next descriptor pool will never succeed
+			if (create_descriptor_pool)
+			{
+				assert(false);
+				return NULL;
+			}
+
+			++this->m_current_descriptor_pool_index;
+		}
+	}
+
+	// the wrappers are reused across frames, and thus the allocation is merely a pointer bump after the first few frames
+	if (this->m_descriptor_set_count >= this->m_descriptor_sets.size())
+	{
+		void *new_unwrapped_descriptor_set_base = brx_malloc(sizeof(brx_vk_descriptor_set), alignof(brx_vk_descriptor_set));
+		assert(NULL != new_unwrapped_descriptor_set_base);
+
+		this->m_descriptor_sets.push_back(new (new_unwrapped_descriptor_set_base) brx_vk_descriptor_set{});
+	}
+
+	brx_vk_descriptor_set *const new_unwrapped_descriptor_set = this->m_descriptor_sets[this->m_descriptor_set_count];
+	++this->m_descriptor_set_count;
+
+	new_unwrapped_descriptor_set->init_transient(unwrapped_descriptor_set_layout, new_descriptor_set);
+	return new_unwrapped_descriptor_set;
+}
+
+void brx_vk_transient_descriptor_allocator::reset()
+{
+	for (uint32_t descriptor_set_index = 0U; descriptor_set_index < this->m_descriptor_set_count; ++descriptor_set_index)
+	{
+		this->m_descriptor_sets[descriptor_set_index]->uninit_transient();
+	}
+	this->m_descriptor_set_count = 0U;
+
+	// only the descriptor pools which have been used are reset
+	uint32_t const used_descriptor_pool_count = std::min(this->m_current_descriptor_pool_index + 1U, static_cast<uint32_t>(this->m_descriptor_pools.size()));
+	for (uint32_t descriptor_pool_index = 0U; descriptor_pool_index < used_descriptor_pool_count; ++descriptor_pool_index)
+	{
+		VkResult const res_reset_descriptor_pool = this->m_dispatch_table->pfn_reset_descriptor_pool(this->m_device, this->m_descriptor_pools[descriptor_pool_index], 0U);
+		assert(VK_SUCCESS == res_reset_descriptor_pool);
+	}
+	this->m_current_descriptor_pool_index = 0U;
+}
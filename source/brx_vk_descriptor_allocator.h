@@ -0,0 +1,57 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_VK_DESCRIPTOR_ALLOCATOR_H_
+#define _BRX_VK_DESCRIPTOR_ALLOCATOR_H_ 1
+
+#include "brx_vector.h"
+#include "brx_map.h"
+#include <mutex>
+
+struct brx_vk_device_dispatch_table;
+class brx_vk_descriptor_set_layout;
+
+struct brx_vk_descriptor_set_pool
+{
+	// all descriptor pools are sized for the same descriptor set layout, and thus any descriptor set can be recycled without fragmentation
+	brx_vector<VkDescriptorPool> descriptor_pools;
+	uint32_t last_descriptor_pool_max_set_count;
+	brx_vector<VkDescriptorSet> free_descriptor_sets;
+	uint32_t busy_descriptor_set_count;
+};
+
+class brx_vk_descriptor_allocator
+{
+	brx_vk_device_dispatch_table const *m_dispatch_table;
+	VkDevice m_device;
+	VkAllocationCallbacks const *m_allocation_callbacks;
+
+	// the descriptor sets of the same layout are shared by all threads, and both the map and the descriptor pools should be externally synchronized
+	std::mutex m_mutex;
+	brx_map<VkDescriptorSetLayout, brx_vk_descriptor_set_pool> m_descriptor_set_pools;
+
+public:
+	brx_vk_descriptor_allocator();
+	void init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void uninit();
+	~brx_vk_descriptor_allocator();
+	VkDescriptorSet alloc_descriptor_set(brx_vk_descriptor_set_layout const *descriptor_set_layout);
+	void free_descriptor_set(VkDescriptorSetLayout descriptor_set_layout, VkDescriptorSet descriptor_set);
+	void release_descriptor_set_layout(VkDescriptorSetLayout descriptor_set_layout);
+};
+
+#endif
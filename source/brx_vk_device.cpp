@@ -19,7 +19,9 @@
 #include "brx_malloc.h"
 #include "brx_vector.h"
 #include "brx_pause.h"
+#include <algorithm>
 #include <assert.h>
+#include <cstring>
 #include <new>
 
 #if defined(__GNUC__)
@@ -28,6 +30,11 @@
 #ifndef NDEBUG
 #include <android/log.h>
 #endif
+#elif defined(__linux__)
+#include <dlfcn.h>
+#ifndef NDEBUG
+#include <stdio.h>
+#endif
 #else
 #error Unknown Platform
 #endif
@@ -51,6 +58,8 @@ static inline uint32_t __intermediate_find_lowest_memory_type_index(struct VkPhy
 
 static inline uint32_t __intermediate_find_lowest_memory_type_index(struct VkPhysicalDeviceMemoryProperties const *physical_device_memory_properties, VkDeviceSize memory_requirements_size, uint32_t memory_requirements_memory_type_bits, VkMemoryPropertyFlags required_property_flags, VkMemoryPropertyFlags preferred_property_flags);
 
+static inline VkSemaphore __intermediate_create_timeline_semaphore(PFN_vkCreateSemaphore pfn_create_semaphore, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, uint64_t initial_value);
+
 extern "C" brx_device *brx_init_vk_device(bool support_ray_tracing)
 {
 	void *new_unwrapped_device_base = brx_malloc(sizeof(brx_vk_device), alignof(brx_vk_device));
@@ -71,19 +80,36 @@ brx_vk_device::brx_vk_device()
 	  m_messenge(VK_NULL_HANDLE),
 #endif
 	  m_physical_device(VK_NULL_HANDLE),
+	  m_physical_device_vendor_id(static_cast<uint32_t>(-1)),
+	  m_physical_device_device_id(static_cast<uint32_t>(-1)),
 	  m_min_uniform_buffer_offset_alignment(static_cast<uint32_t>(-1)),
 	  m_min_storage_buffer_offset_alignment(static_cast<uint32_t>(-1)),
 	  m_optimal_buffer_copy_offset_alignment(static_cast<uint32_t>(-1)),
 	  m_optimal_buffer_copy_row_pitch_alignment(static_cast<uint32_t>(-1)),
+	  m_timestamp_period(-1.0),
 	  m_has_dedicated_upload_queue(false),
 	  m_graphics_queue_family_index(VK_QUEUE_FAMILY_IGNORED),
 	  m_upload_queue_family_index(VK_QUEUE_FAMILY_IGNORED),
+	  m_upload_queue_family_support_timestamp(false),
+	  m_has_dedicated_compute_queue(false),
+	  m_compute_queue_family_index(VK_QUEUE_FAMILY_IGNORED),
 	  m_pfn_get_device_proc_addr(NULL),
 	  m_physical_device_feature_texture_compression_BC(false),
 	  m_physical_device_feature_texture_compression_ASTC_LDR(false),
+	  m_physical_device_feature_multi_draw_indirect(false),
+	  m_physical_device_extension_draw_indirect_count(false),
+	  m_physical_device_extension_timeline_semaphore(false),
+	  m_physical_device_feature_bindless_table(false),
+	  m_max_bindless_table_sampled_image_descriptor_count(0U),
+	  m_max_bindless_table_storage_buffer_descriptor_count(0U),
+	  m_max_bindless_table_sampler_descriptor_count(0U),
 	  m_device(VK_NULL_HANDLE),
 	  m_graphics_queue(VK_NULL_HANDLE),
 	  m_upload_queue(VK_NULL_HANDLE),
+	  m_compute_queue(VK_NULL_HANDLE),
+	  m_graphics_queue_mutex(),
+	  m_upload_queue_mutex(),
+	  m_compute_queue_mutex(),
 	  m_depth_attachment_image_format(VK_FORMAT_UNDEFINED),
 	  m_depth_stencil_attachment_image_format(VK_FORMAT_UNDEFINED),
 	  m_depth_attachment_image_format_support_sampled_image(false),
@@ -108,14 +134,12 @@ brx_vk_device::brx_vk_device()
 	  m_asset_compacted_bottom_level_acceleration_structure_memory_pool(VK_NULL_HANDLE),
 	  m_top_level_acceleration_structure_instance_upload_buffer_memory_pool(VK_NULL_HANDLE),
 	  m_top_level_acceleration_structure_memory_pool(VK_NULL_HANDLE),
-	  m_pfn_wait_for_fences(NULL),
-	  m_pfn_reset_fences(NULL),
-	  m_pfn_reset_command_pool(NULL),
-	  m_pfn_acquire_next_image(NULL),
-	  m_pfn_create_image_view(NULL),
-	  m_pfn_destroy_image_view(NULL),
-	  m_pfn_get_buffer_device_address(NULL),
-	  m_pfn_get_query_pool_results(NULL) {
+	  m_dispatch_table(),
+	  m_descriptor_allocator(),
+	  m_pipeline_cache(VK_NULL_HANDLE),
+	  m_pipeline_state_cache(),
+	  m_pipeline_compiler(),
+	  m_staging_upload_ring_manager() {
 
 	  };
 
@@ -128,6 +152,13 @@ void brx_vk_device::init(bool support_ray_tracing)
 	this->m_dynamic_library_vulkan = dlopen("libvulkan.so", RTLD_NOW | RTLD_LOCAL);
 	assert(NULL != this->m_dynamic_library_vulkan);
 
+	this->m_pfn_get_instance_proc_addr = reinterpret_cast<PFN_vkGetInstanceProcAddr>(dlsym(this->m_dynamic_library_vulkan, "vkGetInstanceProcAddr"));
+	assert(NULL != this->m_pfn_get_instance_proc_addr);
+#elif defined(__linux__)
+	// the "libvulkan.so" is only provided by the development package on desktop Linux
+	this->m_dynamic_library_vulkan = dlopen("libvulkan.so.1", RTLD_NOW | RTLD_LOCAL);
+	assert(NULL != this->m_dynamic_library_vulkan);
+
 	this->m_pfn_get_instance_proc_addr = reinterpret_cast<PFN_vkGetInstanceProcAddr>(dlsym(this->m_dynamic_library_vulkan, "vkGetInstanceProcAddr"));
 	assert(NULL != this->m_pfn_get_instance_proc_addr);
 #else
@@ -169,26 +200,29 @@ void brx_vk_device::init(bool support_ray_tracing)
 			"VK_LAYER_KHRONOS_validation"};
 #endif
 
-		char const *const enabled_extension_names[] = {
+		char const *enabled_extension_names[3];
+		uint32_t enabled_extension_count = 0U;
 #ifndef NDEBUG
-			VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
+		enabled_extension_names[enabled_extension_count++] = VK_EXT_DEBUG_UTILS_EXTENSION_NAME;
 #endif
-			VK_KHR_SURFACE_EXTENSION_NAME,
 #if defined(__GNUC__)
 
 #if defined(__linux__) && defined(__ANDROID__)
-			VK_KHR_ANDROID_SURFACE_EXTENSION_NAME,
+		enabled_extension_names[enabled_extension_count++] = VK_KHR_SURFACE_EXTENSION_NAME;
+		enabled_extension_names[enabled_extension_count++] = VK_KHR_ANDROID_SURFACE_EXTENSION_NAME;
+#elif defined(__linux__)
+		// headless
 #else
 #error Unknown Platform
 #endif
 
 #elif defined(_MSC_VER)
-
-			VK_KHR_WIN32_SURFACE_EXTENSION_NAME
+		enabled_extension_names[enabled_extension_count++] = VK_KHR_SURFACE_EXTENSION_NAME;
+		enabled_extension_names[enabled_extension_count++] = VK_KHR_WIN32_SURFACE_EXTENSION_NAME;
 #else
 #error Unknown Compiler
 #endif
-		};
+		assert((sizeof(enabled_extension_names) / sizeof(enabled_extension_names[0])) >= enabled_extension_count);
 
 		VkInstanceCreateInfo const instance_create_info = {
 			VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
@@ -202,8 +236,8 @@ void brx_vk_device::init(bool support_ray_tracing)
 			0U,
 			NULL,
 #endif
-			sizeof(enabled_extension_names) / sizeof(enabled_extension_names[0]),
-			enabled_extension_names};
+			enabled_extension_count,
+			(enabled_extension_count > 0U) ? enabled_extension_names : NULL};
 
 		// TODO: validation layer will crash on Android
 		VkResult const res_create_instance = pfn_vk_create_instance(&instance_create_info, this->m_allocation_callbacks, &this->m_instance);
@@ -261,6 +295,7 @@ void brx_vk_device::init(bool support_ray_tracing)
 		VkDeviceSize first_discrete_gpu_optimal_buffer_copy_offset_alignment = static_cast<VkDeviceSize>(-1);
 		VkDeviceSize first_discrete_gpu_optimal_buffer_copy_row_pitch_alignment = static_cast<VkDeviceSize>(-1);
 		uint32_t first_non_discrete_gpu_physical_device_index = static_cast<uint32_t>(-1);
+		VkPhysicalDeviceType first_non_discrete_gpu_physical_device_type = VK_PHYSICAL_DEVICE_TYPE_OTHER;
 		VkDeviceSize first_non_discrete_gpu_min_uniform_buffer_offset_alignment = static_cast<VkDeviceSize>(-1);
 		VkDeviceSize first_non_discrete_gpu_min_storage_buffer_offset_alignment = static_cast<VkDeviceSize>(-1);
 		VkDeviceSize first_non_discrete_gpu_optimal_buffer_copy_offset_alignment = static_cast<VkDeviceSize>(-1);
@@ -282,14 +317,17 @@ void brx_vk_device::init(bool support_ray_tracing)
 			else
 			{
 				// usually this case is the integrated GPU
-				assert(VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU == physical_device_properties.deviceType);
+				// the virtual GPU (e.g. virtio-gpu) and the CPU (e.g. lavapipe, SwiftShader) are also accepted on the headless servers
+				assert(VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU == physical_device_properties.deviceType || VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU == physical_device_properties.deviceType || VK_PHYSICAL_DEVICE_TYPE_CPU == physical_device_properties.deviceType || VK_PHYSICAL_DEVICE_TYPE_OTHER == physical_device_properties.deviceType);
 
 				// we should already "break" and exit the loop
 				assert(static_cast<uint32_t>(-1) == first_discrete_gpu_physical_device_index);
 
-				if (static_cast<uint32_t>(-1) == first_non_discrete_gpu_physical_device_index)
+				// the CPU is used only if there is no GPU at all
+				if ((static_cast<uint32_t>(-1) == first_non_discrete_gpu_physical_device_index) || ((VK_PHYSICAL_DEVICE_TYPE_CPU == first_non_discrete_gpu_physical_device_type) && (VK_PHYSICAL_DEVICE_TYPE_CPU != physical_device_properties.deviceType)))
 				{
 					first_non_discrete_gpu_physical_device_index = physical_device_index;
+					first_non_discrete_gpu_physical_device_type = physical_device_properties.deviceType;
 					first_non_discrete_gpu_min_uniform_buffer_offset_alignment = physical_device_properties.limits.minUniformBufferOffsetAlignment;
 					first_non_discrete_gpu_min_storage_buffer_offset_alignment = physical_device_properties.limits.minStorageBufferOffsetAlignment;
 					first_non_discrete_gpu_optimal_buffer_copy_offset_alignment = physical_device_properties.limits.optimalBufferCopyOffsetAlignment;
@@ -319,6 +357,17 @@ void brx_vk_device::init(bool support_ray_tracing)
 		{
 			assert(false);
 		}
+
+		// the header of the pipeline cache data is validated against these properties
+		VkPhysicalDeviceProperties physical_device_properties;
+		pfn_get_physical_device_properties(this->m_physical_device, &physical_device_properties);
+		this->m_physical_device_vendor_id = physical_device_properties.vendorID;
+		this->m_physical_device_device_id = physical_device_properties.deviceID;
+		std::memcpy(this->m_physical_device_pipeline_cache_uuid, physical_device_properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+		// the "timestampPeriod" is in nanoseconds
+		assert(physical_device_properties.limits.timestampPeriod > 0.0F);
+		this->m_timestamp_period = static_cast<double>(physical_device_properties.limits.timestampPeriod) / 1000000.0;
 	}
 
 	// https://github.com/ValveSoftware/dxvk
@@ -332,8 +381,11 @@ void brx_vk_device::init(bool support_ray_tracing)
 	// m_upload_queue
 	assert(VK_QUEUE_FAMILY_IGNORED == this->m_graphics_queue_family_index);
 	assert(VK_QUEUE_FAMILY_IGNORED == this->m_upload_queue_family_index);
+	assert(false == this->m_has_dedicated_compute_queue);
+	assert(VK_QUEUE_FAMILY_IGNORED == this->m_compute_queue_family_index);
 	uint32_t new_graphics_queue_queue_index = static_cast<uint32_t>(-1);
 	uint32_t new_upload_queue_queue_index = static_cast<uint32_t>(-1);
+	uint32_t new_compute_queue_queue_index = static_cast<uint32_t>(-1);
 	{
 		PFN_vkGetPhysicalDeviceQueueFamilyProperties const pfn_vk_get_physical_device_queue_family_properties = reinterpret_cast<PFN_vkGetPhysicalDeviceQueueFamilyProperties>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceQueueFamilyProperties"));
 		assert(NULL != pfn_vk_get_physical_device_queue_family_properties);
@@ -342,6 +394,8 @@ void brx_vk_device::init(bool support_ray_tracing)
 
 #if defined(__linux__) && defined(__ANDROID__)
 		// Android always supported
+#elif defined(__linux__)
+		// headless
 #else
 #error Unknown Platform
 #endif
@@ -372,7 +426,7 @@ void brx_vk_device::init(bool support_ray_tracing)
 
 #if defined(__GNUC__)
 
-#if defined(__linux__) && defined(__ANDROID__)
+#if defined(__linux__)
 			if ((queue_family_property.queueFlags & VK_QUEUE_GRAPHICS_BIT))
 #else
 #error Unknown Platform
@@ -491,66 +545,123 @@ void brx_vk_device::init(bool support_ray_tracing)
 		}
 
 		assert(!this->m_has_dedicated_upload_queue || (VK_QUEUE_FAMILY_IGNORED != this->m_upload_queue_family_index && static_cast<uint32_t>(-1) != new_upload_queue_queue_index));
-	}
 
-	assert(false == this->m_physical_device_feature_texture_compression_BC);
-	assert(false == this->m_physical_device_feature_texture_compression_ASTC_LDR);
-	assert(VK_NULL_HANDLE == this->m_device);
-	{
-		float const graphics_queue_priority = 1.0F;
-		float const upload_queue_priority = 1.0F;
-		float const graphics_upload_queue_priorities[2] = {graphics_queue_priority, upload_queue_priority};
-		VkDeviceQueueCreateInfo device_queue_create_infos[2];
-		uint32_t device_queue_create_info_count = static_cast<uint32_t>(-1);
-		if (this->m_has_dedicated_upload_queue)
+		// the "timestampValidBits" of the transfer only queue family may be zero, and the "vkCmdResetQueryPool" is NOT supported by the transfer only queue family
+		assert(queue_family_properties[this->m_graphics_queue_family_index].timestampValidBits > 0U);
+		this->m_upload_queue_family_support_timestamp = (!this->m_has_dedicated_upload_queue) || ((queue_family_properties[this->m_upload_queue_family_index].timestampValidBits > 0U) && (0U != (queue_family_properties[this->m_upload_queue_family_index].queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT))));
+
+		// Find compute queue
+		// the queues of the compute only queue family (namely, the async compute) run concurrently with the graphics queue on most GPUs
+		// the upload queue may have already used the first queue of the same queue family
+		assert(0U != (queue_family_properties[this->m_graphics_queue_family_index].queueFlags & VK_QUEUE_COMPUTE_BIT));
+		for (uint32_t queue_family_index = 0U; queue_family_index < queue_family_property_count; ++queue_family_index)
+		{
+			if (VK_QUEUE_COMPUTE_BIT == (queue_family_properties[queue_family_index].queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)))
+			{
+				uint32_t const used_queue_count = (this->m_has_dedicated_upload_queue && (this->m_upload_queue_family_index == queue_family_index)) ? (new_upload_queue_queue_index + 1U) : 0U;
+				if (used_queue_count < queue_family_properties[queue_family_index].queueCount)
+				{
+					this->m_compute_queue_family_index = queue_family_index;
+					new_compute_queue_queue_index = used_queue_count;
+					this->m_has_dedicated_compute_queue = true;
+					break;
+				}
+			}
+		}
+
+		// Try the same queue family
+		if (VK_QUEUE_FAMILY_IGNORED == this->m_compute_queue_family_index)
 		{
-			if (this->m_graphics_queue_family_index != this->m_upload_queue_family_index)
+			uint32_t const used_queue_count = (this->m_has_dedicated_upload_queue && (this->m_upload_queue_family_index == this->m_graphics_queue_family_index)) ? (new_upload_queue_queue_index + 1U) : (new_graphics_queue_queue_index + 1U);
+			if (used_queue_count < queue_family_properties[this->m_graphics_queue_family_index].queueCount)
 			{
-				device_queue_create_infos[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-				device_queue_create_infos[0].pNext = NULL;
-				device_queue_create_infos[0].flags = 0U;
-				device_queue_create_infos[0].queueFamilyIndex = this->m_graphics_queue_family_index;
-				assert(0U == new_graphics_queue_queue_index);
-				device_queue_create_infos[0].queueCount = 1U;
-				device_queue_create_infos[0].pQueuePriorities = &graphics_queue_priority;
-
-				device_queue_create_infos[1].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-				device_queue_create_infos[1].pNext = NULL;
-				device_queue_create_infos[1].flags = 0U;
-				device_queue_create_infos[1].queueFamilyIndex = this->m_upload_queue_family_index;
-				assert(0U == new_upload_queue_queue_index);
-				device_queue_create_infos[1].queueCount = 1U;
-				device_queue_create_infos[1].pQueuePriorities = &upload_queue_priority;
-
-				device_queue_create_info_count = 2U;
+				this->m_compute_queue_family_index = this->m_graphics_queue_family_index;
+				new_compute_queue_queue_index = used_queue_count;
+				this->m_has_dedicated_compute_queue = true;
 			}
 			else
 			{
-				device_queue_create_infos[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-				device_queue_create_infos[0].pNext = NULL;
-				device_queue_create_infos[0].flags = 0U;
-				device_queue_create_infos[0].queueFamilyIndex = this->m_graphics_queue_family_index;
-				assert(0U == new_graphics_queue_queue_index);
-				assert(1U == new_upload_queue_queue_index);
-				device_queue_create_infos[0].queueCount = 2U;
-				device_queue_create_infos[0].pQueuePriorities = graphics_upload_queue_priorities;
-				device_queue_create_info_count = 1U;
+				// Fallback to the graphics queue
+				this->m_compute_queue_family_index = this->m_graphics_queue_family_index;
+				new_compute_queue_queue_index = new_graphics_queue_queue_index;
+				this->m_has_dedicated_compute_queue = false;
 			}
 		}
-		else
+
+		assert(VK_QUEUE_FAMILY_IGNORED != this->m_compute_queue_family_index && static_cast<uint32_t>(-1) != new_compute_queue_queue_index);
+	}
+
+	assert(false == this->m_physical_device_feature_texture_compression_BC);
+	assert(false == this->m_physical_device_feature_texture_compression_ASTC_LDR);
+	assert(false == this->m_physical_device_feature_multi_draw_indirect);
+	assert(false == this->m_physical_device_extension_draw_indirect_count);
+	assert(false == this->m_physical_device_extension_timeline_semaphore);
+	assert(false == this->m_physical_device_feature_bindless_table);
+	assert(VK_NULL_HANDLE == this->m_device);
+	{
+		// the queues of the same queue family are merged into one create info, and the queue indices of the same queue family are contiguous
+		float const queue_priorities[3] = {1.0F, 1.0F, 1.0F};
+		uint32_t const queue_family_indices[3] = {
+			this->m_graphics_queue_family_index,
+			this->m_has_dedicated_upload_queue ? this->m_upload_queue_family_index : VK_QUEUE_FAMILY_IGNORED,
+			this->m_has_dedicated_compute_queue ? this->m_compute_queue_family_index : VK_QUEUE_FAMILY_IGNORED};
+		uint32_t const queue_indices[3] = {
+			new_graphics_queue_queue_index,
+			new_upload_queue_queue_index,
+			new_compute_queue_queue_index};
+		assert(0U == new_graphics_queue_queue_index);
+
+		VkDeviceQueueCreateInfo device_queue_create_infos[3];
+		uint32_t device_queue_create_info_count = 0U;
+		for (uint32_t queue_index = 0U; queue_index < (sizeof(queue_family_indices) / sizeof(queue_family_indices[0])); ++queue_index)
 		{
-			device_queue_create_infos[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-			device_queue_create_infos[0].pNext = NULL;
-			device_queue_create_infos[0].flags = 0U;
-			device_queue_create_infos[0].queueFamilyIndex = this->m_graphics_queue_family_index;
-			assert(0U == new_graphics_queue_queue_index);
-			device_queue_create_infos[0].queueCount = 1U;
-			device_queue_create_infos[0].pQueuePriorities = &graphics_queue_priority;
-			device_queue_create_info_count = 1U;
+			if (VK_QUEUE_FAMILY_IGNORED != queue_family_indices[queue_index])
+			{
+				uint32_t device_queue_create_info_index = 0U;
+				while ((device_queue_create_info_index < device_queue_create_info_count) && (device_queue_create_infos[device_queue_create_info_index].queueFamilyIndex != queue_family_indices[queue_index]))
+				{
+					++device_queue_create_info_index;
+				}
+
+				if (device_queue_create_info_index < device_queue_create_info_count)
+				{
+					uint32_t const queue_count = device_queue_create_infos[device_queue_create_info_index].queueCount;
+					device_queue_create_infos[device_queue_create_info_index].queueCount = (queue_count > (queue_indices[queue_index] + 1U)) ? queue_count : (queue_indices[queue_index] + 1U);
+				}
+				else
+				{
+					device_queue_create_infos[device_queue_create_info_count].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+					device_queue_create_infos[device_queue_create_info_count].pNext = NULL;
+					device_queue_create_infos[device_queue_create_info_count].flags = 0U;
+					device_queue_create_infos[device_queue_create_info_count].queueFamilyIndex = queue_family_indices[queue_index];
+					device_queue_create_infos[device_queue_create_info_count].queueCount = queue_indices[queue_index] + 1U;
+					device_queue_create_infos[device_queue_create_info_count].pQueuePriorities = queue_priorities;
+					++device_queue_create_info_count;
+				}
+			}
 		}
+		assert(device_queue_create_info_count >= 1U && device_queue_create_info_count <= (sizeof(device_queue_create_infos) / sizeof(device_queue_create_infos[0])));
 
 		// TODO: VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME
 
+#if defined(__GNUC__)
+
+#if defined(__linux__) && defined(__ANDROID__)
+		uint32_t const enabled_swap_chain_extension_count = 1U;
+#elif defined(__linux__)
+		// headless
+		uint32_t const enabled_swap_chain_extension_count = 0U;
+#else
+#error Unknown Platform
+#endif
+
+#elif defined(_MSC_VER)
+		uint32_t const enabled_swap_chain_extension_count = 1U;
+#else
+#error Unknown Compiler
+#endif
+
+		// the swapchain extension is always the first one
 		char const *const enabled_extension_names[] = {
 			VK_KHR_SWAPCHAIN_EXTENSION_NAME,
 			VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME,
@@ -561,7 +672,54 @@ void brx_vk_device::init(bool support_ray_tracing)
 			VK_KHR_SPIRV_1_4_EXTENSION_NAME,
 			VK_KHR_SHADER_FLOAT_CONTROLS_EXTENSION_NAME};
 
-		uint32_t const enabled_extension_count = !this->m_support_ray_tracing ? 1U : (sizeof(enabled_extension_names) / sizeof(enabled_extension_names[0]));
+		uint32_t const mandatory_enabled_extension_count = (!this->m_support_ray_tracing ? 1U : (sizeof(enabled_extension_names) / sizeof(enabled_extension_names[0]))) - (1U - enabled_swap_chain_extension_count);
+		char const *const *const mandatory_enabled_extension_names = &enabled_extension_names[1U - enabled_swap_chain_extension_count];
+
+		// the "vkCmdDrawIndirectCount" and the timeline semaphore are NOT core until Vulkan 1.2
+		{
+			PFN_vkEnumerateDeviceExtensionProperties const pfn_enumerate_device_extension_properties = reinterpret_cast<PFN_vkEnumerateDeviceExtensionProperties>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkEnumerateDeviceExtensionProperties"));
+			assert(NULL != pfn_enumerate_device_extension_properties);
+
+			uint32_t device_extension_property_count = static_cast<uint32_t>(-1);
+			VkResult const res_enumerate_device_extension_properties_count = pfn_enumerate_device_extension_properties(this->m_physical_device, NULL, &device_extension_property_count, NULL);
+			assert(VK_SUCCESS == res_enumerate_device_extension_properties_count);
+
+			if (device_extension_property_count > 0U)
+			{
+				brx_vector<VkExtensionProperties> device_extension_properties(static_cast<size_t>(device_extension_property_count));
+
+				VkResult const res_enumerate_device_extension_properties = pfn_enumerate_device_extension_properties(this->m_physical_device, NULL, &device_extension_property_count, &device_extension_properties[0]);
+				assert(VK_SUCCESS == res_enumerate_device_extension_properties);
+
+				for (uint32_t device_extension_property_index = 0U; device_extension_property_index < device_extension_property_count; ++device_extension_property_index)
+				{
+					if (0 == strcmp(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME, device_extension_properties[device_extension_property_index].extensionName))
+					{
+						this->m_physical_device_extension_draw_indirect_count = true;
+					}
+					else if (0 == strcmp(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME, device_extension_properties[device_extension_property_index].extensionName))
+					{
+						this->m_physical_device_extension_timeline_semaphore = true;
+					}
+				}
+			}
+		}
+
+		// the optional extensions are appended after the mandatory extensions
+		char const *enabled_extension_names_base[(sizeof(enabled_extension_names) / sizeof(enabled_extension_names[0])) + 2U];
+		uint32_t enabled_extension_count = 0U;
+		for (uint32_t mandatory_enabled_extension_index = 0U; mandatory_enabled_extension_index < mandatory_enabled_extension_count; ++mandatory_enabled_extension_index)
+		{
+			enabled_extension_names_base[enabled_extension_count++] = mandatory_enabled_extension_names[mandatory_enabled_extension_index];
+		}
+		if (this->m_physical_device_extension_draw_indirect_count)
+		{
+			enabled_extension_names_base[enabled_extension_count++] = VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME;
+		}
+		if (this->m_physical_device_extension_timeline_semaphore)
+		{
+			enabled_extension_names_base[enabled_extension_count++] = VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME;
+		}
 
 		PFN_vkGetPhysicalDeviceFeatures const pfn_get_physical_device_features = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceFeatures"));
 		assert(NULL != pfn_get_physical_device_features);
@@ -577,6 +735,8 @@ void brx_vk_device::init(bool support_ray_tracing)
 		// we do not need both at the same time
 		assert(!(this->m_physical_device_feature_texture_compression_BC && this->m_physical_device_feature_texture_compression_ASTC_LDR));
 
+		this->m_physical_device_feature_multi_draw_indirect = (VK_FALSE != physical_device_supported_features.multiDrawIndirect) ? true : false;
+
 		VkPhysicalDeviceFeatures const physical_device_enabled_features = {
 			VK_FALSE,
 			VK_FALSE,
@@ -587,8 +747,10 @@ void brx_vk_device::init(bool support_ray_tracing)
 			VK_FALSE,
 			VK_FALSE,
 			VK_FALSE,
-			VK_FALSE,
-			VK_FALSE,
+			// multiDrawIndirect
+			((this->m_physical_device_feature_multi_draw_indirect) ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE)),
+			// drawIndirectFirstInstance (the "first_instance" of the indirect commands should be zero when NOT supported)
+			physical_device_supported_features.drawIndirectFirstInstance,
 			VK_FALSE,
 			VK_FALSE,
 			VK_FALSE,
@@ -636,6 +798,47 @@ void brx_vk_device::init(bool support_ray_tracing)
 			VK_FALSE,
 		};
 
+		// the descriptor indexing extension is only enabled in the ray tracing mode, and the update after bind features, which are required by the bindless table, are optional
+		if (this->m_support_ray_tracing)
+		{
+			PFN_vkGetPhysicalDeviceFeatures2 const pfn_get_physical_device_features2 = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceFeatures2"));
+			assert(NULL != pfn_get_physical_device_features2);
+
+			VkPhysicalDeviceDescriptorIndexingFeaturesEXT physical_device_supported_descriptor_indexing_features = {
+				VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT,
+				NULL};
+
+			VkPhysicalDeviceFeatures2 physical_device_supported_features2 = {
+				VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+				&physical_device_supported_descriptor_indexing_features};
+
+			pfn_get_physical_device_features2(this->m_physical_device, &physical_device_supported_features2);
+
+			this->m_physical_device_feature_bindless_table = (VK_FALSE != physical_device_supported_descriptor_indexing_features.descriptorBindingSampledImageUpdateAfterBind) && (VK_FALSE != physical_device_supported_descriptor_indexing_features.descriptorBindingStorageBufferUpdateAfterBind) && (VK_FALSE != physical_device_supported_descriptor_indexing_features.descriptorBindingUpdateUnusedWhilePending) && (VK_FALSE != physical_device_supported_descriptor_indexing_features.descriptorBindingPartiallyBound);
+
+			if (this->m_physical_device_feature_bindless_table)
+			{
+				PFN_vkGetPhysicalDeviceProperties2 const pfn_get_physical_device_properties2 = reinterpret_cast<PFN_vkGetPhysicalDeviceProperties2>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceProperties2"));
+				assert(NULL != pfn_get_physical_device_properties2);
+
+				VkPhysicalDeviceDescriptorIndexingPropertiesEXT physical_device_descriptor_indexing_properties = {
+					VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT,
+					NULL};
+
+				VkPhysicalDeviceProperties2 physical_device_properties2 = {
+					VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2,
+					&physical_device_descriptor_indexing_properties};
+
+				pfn_get_physical_device_properties2(this->m_physical_device, &physical_device_properties2);
+
+				// the bindless table is the only update after bind descriptor set of the pipeline layout, and the sampler is counted by both the per stage limit and the per set limit
+				uint32_t const max_update_after_bind_descriptor_count = physical_device_descriptor_indexing_properties.maxUpdateAfterBindDescriptorsInAllPools;
+				this->m_max_bindless_table_sampled_image_descriptor_count = std::min(std::min(physical_device_descriptor_indexing_properties.maxPerStageDescriptorUpdateAfterBindSampledImages, physical_device_descriptor_indexing_properties.maxDescriptorSetUpdateAfterBindSampledImages), max_update_after_bind_descriptor_count);
+				this->m_max_bindless_table_storage_buffer_descriptor_count = std::min(std::min(physical_device_descriptor_indexing_properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers, physical_device_descriptor_indexing_properties.maxDescriptorSetUpdateAfterBindStorageBuffers), max_update_after_bind_descriptor_count);
+				this->m_max_bindless_table_sampler_descriptor_count = std::min(std::min(physical_device_descriptor_indexing_properties.maxPerStageDescriptorUpdateAfterBindSamplers, physical_device_descriptor_indexing_properties.maxDescriptorSetUpdateAfterBindSamplers), max_update_after_bind_descriptor_count);
+			}
+		}
+
 		// TODO: VkPhysicalDeviceRayTracingPipelineFeaturesKHR
 
 		VkPhysicalDeviceRayQueryFeaturesKHR const physical_device_ray_query_features =
@@ -674,17 +877,29 @@ void brx_vk_device::init(bool support_ray_tracing)
 			VK_FALSE,
 			VK_FALSE,
 			VK_FALSE,
+			// descriptorBindingSampledImageUpdateAfterBind
+			((this->m_physical_device_feature_bindless_table) ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE)),
 			VK_FALSE,
+			// descriptorBindingStorageBufferUpdateAfterBind
+			((this->m_physical_device_feature_bindless_table) ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE)),
 			VK_FALSE,
 			VK_FALSE,
-			VK_FALSE,
-			VK_FALSE,
-			VK_FALSE,
-			VK_FALSE,
+			// descriptorBindingUpdateUnusedWhilePending
+			((this->m_physical_device_feature_bindless_table) ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE)),
+			// descriptorBindingPartiallyBound
+			((this->m_physical_device_feature_bindless_table) ? static_cast<VkBool32>(VK_TRUE) : static_cast<VkBool32>(VK_FALSE)),
 			VK_FALSE,
 			VK_FALSE};
 
-		void const *const device_create_info_next = (!this->m_support_ray_tracing) ? NULL : &physical_device_descriptor_indexing_features;
+		void const *const ray_tracing_features_next = (!this->m_support_ray_tracing) ? NULL : &physical_device_descriptor_indexing_features;
+
+		// the "timelineSemaphore" feature is mandatory when the extension is supported
+		VkPhysicalDeviceTimelineSemaphoreFeaturesKHR const physical_device_timeline_semaphore_features = {
+			VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR,
+			const_cast<void *>(ray_tracing_features_next),
+			VK_TRUE};
+
+		void const *const device_create_info_next = (!this->m_physical_device_extension_timeline_semaphore) ? ray_tracing_features_next : &physical_device_timeline_semaphore_features;
 
 		VkDeviceCreateInfo const device_create_info = {
 			VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
@@ -695,7 +910,7 @@ void brx_vk_device::init(bool support_ray_tracing)
 			0U,
 			NULL,
 			enabled_extension_count,
-			enabled_extension_names,
+			(enabled_extension_count > 0U) ? enabled_extension_names_base : NULL,
 			&physical_device_enabled_features};
 		VkResult const res_create_device = pfn_create_device(this->m_physical_device, &device_create_info, this->m_allocation_callbacks, &this->m_device);
 		assert(VK_SUCCESS == res_create_device);
@@ -707,10 +922,441 @@ void brx_vk_device::init(bool support_ray_tracing)
 	this->m_pfn_get_device_proc_addr = reinterpret_cast<PFN_vkGetDeviceProcAddr>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetDeviceProcAddr"));
 	assert(NULL != this->m_pfn_get_device_proc_addr);
 
+	assert(NULL == this->m_dispatch_table.pfn_get_device_queue);
+	this->m_dispatch_table.pfn_get_device_queue = reinterpret_cast<PFN_vkGetDeviceQueue>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetDeviceQueue"));
+	assert(NULL != this->m_dispatch_table.pfn_get_device_queue);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_device);
+	this->m_dispatch_table.pfn_destroy_device = reinterpret_cast<PFN_vkDestroyDevice>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyDevice"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_device);
+
+	assert(NULL == this->m_dispatch_table.pfn_queue_submit);
+	this->m_dispatch_table.pfn_queue_submit = reinterpret_cast<PFN_vkQueueSubmit>(this->m_pfn_get_device_proc_addr(this->m_device, "vkQueueSubmit"));
+	assert(NULL != this->m_dispatch_table.pfn_queue_submit);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_fence);
+	this->m_dispatch_table.pfn_create_fence = reinterpret_cast<PFN_vkCreateFence>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateFence"));
+	assert(NULL != this->m_dispatch_table.pfn_create_fence);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_fence);
+	this->m_dispatch_table.pfn_destroy_fence = reinterpret_cast<PFN_vkDestroyFence>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyFence"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_fence);
+
+	assert(NULL == this->m_dispatch_table.pfn_wait_for_fences);
+	this->m_dispatch_table.pfn_wait_for_fences = reinterpret_cast<PFN_vkWaitForFences>(this->m_pfn_get_device_proc_addr(this->m_device, "vkWaitForFences"));
+	assert(NULL != this->m_dispatch_table.pfn_wait_for_fences);
+
+	assert(NULL == this->m_dispatch_table.pfn_reset_fences);
+	this->m_dispatch_table.pfn_reset_fences = reinterpret_cast<PFN_vkResetFences>(this->m_pfn_get_device_proc_addr(this->m_device, "vkResetFences"));
+	assert(NULL != this->m_dispatch_table.pfn_reset_fences);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_semaphore);
+	this->m_dispatch_table.pfn_create_semaphore = reinterpret_cast<PFN_vkCreateSemaphore>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateSemaphore"));
+	assert(NULL != this->m_dispatch_table.pfn_create_semaphore);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_semaphore);
+	this->m_dispatch_table.pfn_destroy_semaphore = reinterpret_cast<PFN_vkDestroySemaphore>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroySemaphore"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_semaphore);
+
+	if (this->m_physical_device_extension_timeline_semaphore)
+	{
+		assert(NULL == this->m_dispatch_table.pfn_get_semaphore_counter_value);
+		this->m_dispatch_table.pfn_get_semaphore_counter_value = reinterpret_cast<PFN_vkGetSemaphoreCounterValueKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetSemaphoreCounterValueKHR"));
+		assert(NULL != this->m_dispatch_table.pfn_get_semaphore_counter_value);
+
+		assert(NULL == this->m_dispatch_table.pfn_wait_semaphores);
+		this->m_dispatch_table.pfn_wait_semaphores = reinterpret_cast<PFN_vkWaitSemaphoresKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkWaitSemaphoresKHR"));
+		assert(NULL != this->m_dispatch_table.pfn_wait_semaphores);
+
+		assert(NULL == this->m_dispatch_table.pfn_signal_semaphore);
+		this->m_dispatch_table.pfn_signal_semaphore = reinterpret_cast<PFN_vkSignalSemaphoreKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkSignalSemaphoreKHR"));
+		assert(NULL != this->m_dispatch_table.pfn_signal_semaphore);
+	}
+
+	assert(NULL == this->m_dispatch_table.pfn_create_command_pool);
+	this->m_dispatch_table.pfn_create_command_pool = reinterpret_cast<PFN_vkCreateCommandPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateCommandPool"));
+	assert(NULL != this->m_dispatch_table.pfn_create_command_pool);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_command_pool);
+	this->m_dispatch_table.pfn_destroy_command_pool = reinterpret_cast<PFN_vkDestroyCommandPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyCommandPool"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_command_pool);
+
+	assert(NULL == this->m_dispatch_table.pfn_reset_command_pool);
+	this->m_dispatch_table.pfn_reset_command_pool = reinterpret_cast<PFN_vkResetCommandPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkResetCommandPool"));
+	assert(NULL != this->m_dispatch_table.pfn_reset_command_pool);
+
+	assert(NULL == this->m_dispatch_table.pfn_allocate_command_buffers);
+	this->m_dispatch_table.pfn_allocate_command_buffers = reinterpret_cast<PFN_vkAllocateCommandBuffers>(this->m_pfn_get_device_proc_addr(this->m_device, "vkAllocateCommandBuffers"));
+	assert(NULL != this->m_dispatch_table.pfn_allocate_command_buffers);
+
+	assert(NULL == this->m_dispatch_table.pfn_free_command_buffers);
+	this->m_dispatch_table.pfn_free_command_buffers = reinterpret_cast<PFN_vkFreeCommandBuffers>(this->m_pfn_get_device_proc_addr(this->m_device, "vkFreeCommandBuffers"));
+	assert(NULL != this->m_dispatch_table.pfn_free_command_buffers);
+
+	assert(NULL == this->m_dispatch_table.pfn_begin_command_buffer);
+	this->m_dispatch_table.pfn_begin_command_buffer = reinterpret_cast<PFN_vkBeginCommandBuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkBeginCommandBuffer"));
+	assert(NULL != this->m_dispatch_table.pfn_begin_command_buffer);
+
+	assert(NULL == this->m_dispatch_table.pfn_end_command_buffer);
+	this->m_dispatch_table.pfn_end_command_buffer = reinterpret_cast<PFN_vkEndCommandBuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkEndCommandBuffer"));
+	assert(NULL != this->m_dispatch_table.pfn_end_command_buffer);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_buffer);
+	this->m_dispatch_table.pfn_create_buffer = reinterpret_cast<PFN_vkCreateBuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateBuffer"));
+	assert(NULL != this->m_dispatch_table.pfn_create_buffer);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_buffer);
+	this->m_dispatch_table.pfn_destroy_buffer = reinterpret_cast<PFN_vkDestroyBuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyBuffer"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_buffer);
+
+	assert(NULL == this->m_dispatch_table.pfn_get_buffer_memory_requirements);
+	this->m_dispatch_table.pfn_get_buffer_memory_requirements = reinterpret_cast<PFN_vkGetBufferMemoryRequirements>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetBufferMemoryRequirements"));
+	assert(NULL != this->m_dispatch_table.pfn_get_buffer_memory_requirements);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_image);
+	this->m_dispatch_table.pfn_create_image = reinterpret_cast<PFN_vkCreateImage>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateImage"));
+	assert(NULL != this->m_dispatch_table.pfn_create_image);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_image);
+	this->m_dispatch_table.pfn_destroy_image = reinterpret_cast<PFN_vkDestroyImage>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyImage"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_image);
+
+	assert(NULL == this->m_dispatch_table.pfn_get_image_memory_requirements);
+	this->m_dispatch_table.pfn_get_image_memory_requirements = reinterpret_cast<PFN_vkGetImageMemoryRequirements>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetImageMemoryRequirements"));
+	assert(NULL != this->m_dispatch_table.pfn_get_image_memory_requirements);
+
+	assert(NULL == this->m_dispatch_table.pfn_allocate_memory);
+	this->m_dispatch_table.pfn_allocate_memory = reinterpret_cast<PFN_vkAllocateMemory>(this->m_pfn_get_device_proc_addr(this->m_device, "vkAllocateMemory"));
+	assert(NULL != this->m_dispatch_table.pfn_allocate_memory);
+
+	assert(NULL == this->m_dispatch_table.pfn_free_memory);
+	this->m_dispatch_table.pfn_free_memory = reinterpret_cast<PFN_vkFreeMemory>(this->m_pfn_get_device_proc_addr(this->m_device, "vkFreeMemory"));
+	assert(NULL != this->m_dispatch_table.pfn_free_memory);
+
+	assert(NULL == this->m_dispatch_table.pfn_bind_image_memory);
+	this->m_dispatch_table.pfn_bind_image_memory = reinterpret_cast<PFN_vkBindImageMemory>(this->m_pfn_get_device_proc_addr(this->m_device, "vkBindImageMemory"));
+	assert(NULL != this->m_dispatch_table.pfn_bind_image_memory);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_image_view);
+	this->m_dispatch_table.pfn_create_image_view = reinterpret_cast<PFN_vkCreateImageView>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateImageView"));
+	assert(NULL != this->m_dispatch_table.pfn_create_image_view);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_image_view);
+	this->m_dispatch_table.pfn_destroy_image_view = reinterpret_cast<PFN_vkDestroyImageView>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyImageView"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_image_view);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_sampler);
+	this->m_dispatch_table.pfn_create_sampler = reinterpret_cast<PFN_vkCreateSampler>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateSampler"));
+	assert(NULL != this->m_dispatch_table.pfn_create_sampler);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_sampler);
+	this->m_dispatch_table.pfn_destroy_sampler = reinterpret_cast<PFN_vkDestroySampler>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroySampler"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_sampler);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_render_pass);
+	this->m_dispatch_table.pfn_create_render_pass = reinterpret_cast<PFN_vkCreateRenderPass>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateRenderPass"));
+	assert(NULL != this->m_dispatch_table.pfn_create_render_pass);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_render_pass);
+	this->m_dispatch_table.pfn_destroy_render_pass = reinterpret_cast<PFN_vkDestroyRenderPass>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyRenderPass"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_render_pass);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_frame_buffer);
+	this->m_dispatch_table.pfn_create_frame_buffer = reinterpret_cast<PFN_vkCreateFramebuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateFramebuffer"));
+	assert(NULL != this->m_dispatch_table.pfn_create_frame_buffer);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_frame_buffer);
+	this->m_dispatch_table.pfn_destroy_frame_buffer = reinterpret_cast<PFN_vkDestroyFramebuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyFramebuffer"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_frame_buffer);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_descriptor_set_layout);
+	this->m_dispatch_table.pfn_create_descriptor_set_layout = reinterpret_cast<PFN_vkCreateDescriptorSetLayout>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateDescriptorSetLayout"));
+	assert(NULL != this->m_dispatch_table.pfn_create_descriptor_set_layout);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_descriptor_set_layout);
+	this->m_dispatch_table.pfn_destroy_descriptor_set_layout = reinterpret_cast<PFN_vkDestroyDescriptorSetLayout>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyDescriptorSetLayout"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_descriptor_set_layout);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_pipeline_layout);
+	this->m_dispatch_table.pfn_create_pipeline_layout = reinterpret_cast<PFN_vkCreatePipelineLayout>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreatePipelineLayout"));
+	assert(NULL != this->m_dispatch_table.pfn_create_pipeline_layout);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_pipeline_layout);
+	this->m_dispatch_table.pfn_destroy_pipeline_layout = reinterpret_cast<PFN_vkDestroyPipelineLayout>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyPipelineLayout"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_pipeline_layout);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_descriptor_pool);
+	this->m_dispatch_table.pfn_create_descriptor_pool = reinterpret_cast<PFN_vkCreateDescriptorPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateDescriptorPool"));
+	assert(NULL != this->m_dispatch_table.pfn_create_descriptor_pool);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_descriptor_pool);
+	this->m_dispatch_table.pfn_destroy_descriptor_pool = reinterpret_cast<PFN_vkDestroyDescriptorPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyDescriptorPool"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_descriptor_pool);
+
+	assert(NULL == this->m_dispatch_table.pfn_reset_descriptor_pool);
+	this->m_dispatch_table.pfn_reset_descriptor_pool = reinterpret_cast<PFN_vkResetDescriptorPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkResetDescriptorPool"));
+	assert(NULL != this->m_dispatch_table.pfn_reset_descriptor_pool);
+
+	assert(NULL == this->m_dispatch_table.pfn_allocate_descriptor_sets);
+	this->m_dispatch_table.pfn_allocate_descriptor_sets = reinterpret_cast<PFN_vkAllocateDescriptorSets>(this->m_pfn_get_device_proc_addr(this->m_device, "vkAllocateDescriptorSets"));
+	assert(NULL != this->m_dispatch_table.pfn_allocate_descriptor_sets);
+
+	assert(NULL == this->m_dispatch_table.pfn_update_descriptor_sets);
+	this->m_dispatch_table.pfn_update_descriptor_sets = reinterpret_cast<PFN_vkUpdateDescriptorSets>(this->m_pfn_get_device_proc_addr(this->m_device, "vkUpdateDescriptorSets"));
+	assert(NULL != this->m_dispatch_table.pfn_update_descriptor_sets);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_descriptor_update_template);
+	this->m_dispatch_table.pfn_create_descriptor_update_template = reinterpret_cast<PFN_vkCreateDescriptorUpdateTemplate>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateDescriptorUpdateTemplate"));
+	assert(NULL != this->m_dispatch_table.pfn_create_descriptor_update_template);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_descriptor_update_template);
+	this->m_dispatch_table.pfn_destroy_descriptor_update_template = reinterpret_cast<PFN_vkDestroyDescriptorUpdateTemplate>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyDescriptorUpdateTemplate"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_descriptor_update_template);
+
+	assert(NULL == this->m_dispatch_table.pfn_update_descriptor_set_with_template);
+	this->m_dispatch_table.pfn_update_descriptor_set_with_template = reinterpret_cast<PFN_vkUpdateDescriptorSetWithTemplate>(this->m_pfn_get_device_proc_addr(this->m_device, "vkUpdateDescriptorSetWithTemplate"));
+	assert(NULL != this->m_dispatch_table.pfn_update_descriptor_set_with_template);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_shader_module);
+	this->m_dispatch_table.pfn_create_shader_module = reinterpret_cast<PFN_vkCreateShaderModule>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateShaderModule"));
+	assert(NULL != this->m_dispatch_table.pfn_create_shader_module);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_shader_module);
+	this->m_dispatch_table.pfn_destroy_shader_module = reinterpret_cast<PFN_vkDestroyShaderModule>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyShaderModule"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_shader_module);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_graphics_pipelines);
+	this->m_dispatch_table.pfn_create_graphics_pipelines = reinterpret_cast<PFN_vkCreateGraphicsPipelines>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateGraphicsPipelines"));
+	assert(NULL != this->m_dispatch_table.pfn_create_graphics_pipelines);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_compute_pipelines);
+	this->m_dispatch_table.pfn_create_compute_pipelines = reinterpret_cast<PFN_vkCreateComputePipelines>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateComputePipelines"));
+	assert(NULL != this->m_dispatch_table.pfn_create_compute_pipelines);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_pipeline);
+	this->m_dispatch_table.pfn_destroy_pipeline = reinterpret_cast<PFN_vkDestroyPipeline>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyPipeline"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_pipeline);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_pipeline_cache);
+	this->m_dispatch_table.pfn_create_pipeline_cache = reinterpret_cast<PFN_vkCreatePipelineCache>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreatePipelineCache"));
+	assert(NULL != this->m_dispatch_table.pfn_create_pipeline_cache);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_pipeline_cache);
+	this->m_dispatch_table.pfn_destroy_pipeline_cache = reinterpret_cast<PFN_vkDestroyPipelineCache>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyPipelineCache"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_pipeline_cache);
+
+	assert(NULL == this->m_dispatch_table.pfn_get_pipeline_cache_data);
+	this->m_dispatch_table.pfn_get_pipeline_cache_data = reinterpret_cast<PFN_vkGetPipelineCacheData>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetPipelineCacheData"));
+	assert(NULL != this->m_dispatch_table.pfn_get_pipeline_cache_data);
+
+	assert(NULL == this->m_dispatch_table.pfn_merge_pipeline_caches);
+	this->m_dispatch_table.pfn_merge_pipeline_caches = reinterpret_cast<PFN_vkMergePipelineCaches>(this->m_pfn_get_device_proc_addr(this->m_device, "vkMergePipelineCaches"));
+	assert(NULL != this->m_dispatch_table.pfn_merge_pipeline_caches);
+
+	assert(NULL == this->m_dispatch_table.pfn_create_query_pool);
+	this->m_dispatch_table.pfn_create_query_pool = reinterpret_cast<PFN_vkCreateQueryPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateQueryPool"));
+	assert(NULL != this->m_dispatch_table.pfn_create_query_pool);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_query_pool);
+	this->m_dispatch_table.pfn_destroy_query_pool = reinterpret_cast<PFN_vkDestroyQueryPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyQueryPool"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_query_pool);
+
+	assert(NULL == this->m_dispatch_table.pfn_get_query_pool_results);
+	this->m_dispatch_table.pfn_get_query_pool_results = reinterpret_cast<PFN_vkGetQueryPoolResults>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetQueryPoolResults"));
+	assert(NULL != this->m_dispatch_table.pfn_get_query_pool_results);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_pipeline_barrier);
+	this->m_dispatch_table.pfn_cmd_pipeline_barrier = reinterpret_cast<PFN_vkCmdPipelineBarrier>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdPipelineBarrier"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_pipeline_barrier);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_begin_render_pass);
+	this->m_dispatch_table.pfn_cmd_begin_render_pass = reinterpret_cast<PFN_vkCmdBeginRenderPass>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdBeginRenderPass"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_begin_render_pass);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_end_render_pass);
+	this->m_dispatch_table.pfn_cmd_end_render_pass = reinterpret_cast<PFN_vkCmdEndRenderPass>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdEndRenderPass"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_end_render_pass);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_execute_commands);
+	this->m_dispatch_table.pfn_cmd_execute_commands = reinterpret_cast<PFN_vkCmdExecuteCommands>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdExecuteCommands"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_execute_commands);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_bind_pipeline);
+	this->m_dispatch_table.pfn_cmd_bind_pipeline = reinterpret_cast<PFN_vkCmdBindPipeline>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdBindPipeline"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_bind_pipeline);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_set_view_port);
+	this->m_dispatch_table.pfn_cmd_set_view_port = reinterpret_cast<PFN_vkCmdSetViewport>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdSetViewport"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_set_view_port);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_set_scissor);
+	this->m_dispatch_table.pfn_cmd_set_scissor = reinterpret_cast<PFN_vkCmdSetScissor>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdSetScissor"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_set_scissor);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_bind_descriptor_sets);
+	this->m_dispatch_table.pfn_cmd_bind_descriptor_sets = reinterpret_cast<PFN_vkCmdBindDescriptorSets>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdBindDescriptorSets"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_bind_descriptor_sets);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_push_constants);
+	this->m_dispatch_table.pfn_cmd_push_constants = reinterpret_cast<PFN_vkCmdPushConstants>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdPushConstants"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_push_constants);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_bind_vertex_buffers);
+	this->m_dispatch_table.pfn_cmd_bind_vertex_buffers = reinterpret_cast<PFN_vkCmdBindVertexBuffers>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdBindVertexBuffers"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_bind_vertex_buffers);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_bind_index_buffer);
+	this->m_dispatch_table.pfn_cmd_bind_index_buffer = reinterpret_cast<PFN_vkCmdBindIndexBuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdBindIndexBuffer"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_bind_index_buffer);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_draw);
+	this->m_dispatch_table.pfn_cmd_draw = reinterpret_cast<PFN_vkCmdDraw>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdDraw"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_draw);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_draw_indexed);
+	this->m_dispatch_table.pfn_cmd_draw_indexed = reinterpret_cast<PFN_vkCmdDrawIndexed>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdDrawIndexed"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_draw_indexed);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_draw_indirect);
+	this->m_dispatch_table.pfn_cmd_draw_indirect = reinterpret_cast<PFN_vkCmdDrawIndirect>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdDrawIndirect"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_draw_indirect);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_draw_indexed_indirect);
+	this->m_dispatch_table.pfn_cmd_draw_indexed_indirect = reinterpret_cast<PFN_vkCmdDrawIndexedIndirect>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdDrawIndexedIndirect"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_draw_indexed_indirect);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_dispatch);
+	this->m_dispatch_table.pfn_cmd_dispatch = reinterpret_cast<PFN_vkCmdDispatch>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdDispatch"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_dispatch);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_dispatch_indirect);
+	this->m_dispatch_table.pfn_cmd_dispatch_indirect = reinterpret_cast<PFN_vkCmdDispatchIndirect>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdDispatchIndirect"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_dispatch_indirect);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_copy_buffer);
+	this->m_dispatch_table.pfn_cmd_copy_buffer = reinterpret_cast<PFN_vkCmdCopyBuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdCopyBuffer"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_copy_buffer);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_copy_buffer_to_image);
+	this->m_dispatch_table.pfn_cmd_copy_buffer_to_image = reinterpret_cast<PFN_vkCmdCopyBufferToImage>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdCopyBufferToImage"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_copy_buffer_to_image);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_reset_query_pool);
+	this->m_dispatch_table.pfn_cmd_reset_query_pool = reinterpret_cast<PFN_vkCmdResetQueryPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdResetQueryPool"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_reset_query_pool);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_write_timestamp);
+	this->m_dispatch_table.pfn_cmd_write_timestamp = reinterpret_cast<PFN_vkCmdWriteTimestamp>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdWriteTimestamp"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_write_timestamp);
+
+#ifndef NDEBUG
+	assert(NULL == this->m_dispatch_table.pfn_cmd_begin_debug_utils_label);
+	this->m_dispatch_table.pfn_cmd_begin_debug_utils_label = reinterpret_cast<PFN_vkCmdBeginDebugUtilsLabelEXT>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkCmdBeginDebugUtilsLabelEXT"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_begin_debug_utils_label);
+
+	assert(NULL == this->m_dispatch_table.pfn_cmd_end_debug_utils_label);
+	this->m_dispatch_table.pfn_cmd_end_debug_utils_label = reinterpret_cast<PFN_vkCmdEndDebugUtilsLabelEXT>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkCmdEndDebugUtilsLabelEXT"));
+	assert(NULL != this->m_dispatch_table.pfn_cmd_end_debug_utils_label);
+
+#endif
+
+	if (this->m_physical_device_extension_draw_indirect_count)
+	{
+		assert(NULL == this->m_dispatch_table.pfn_cmd_draw_indirect_count);
+		this->m_dispatch_table.pfn_cmd_draw_indirect_count = reinterpret_cast<PFN_vkCmdDrawIndirectCountKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdDrawIndirectCountKHR"));
+		assert(NULL != this->m_dispatch_table.pfn_cmd_draw_indirect_count);
+
+		assert(NULL == this->m_dispatch_table.pfn_cmd_draw_indexed_indirect_count);
+		this->m_dispatch_table.pfn_cmd_draw_indexed_indirect_count = reinterpret_cast<PFN_vkCmdDrawIndexedIndirectCountKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdDrawIndexedIndirectCountKHR"));
+		assert(NULL != this->m_dispatch_table.pfn_cmd_draw_indexed_indirect_count);
+	}
+
+	if (this->m_support_ray_tracing)
+	{
+		assert(NULL == this->m_dispatch_table.pfn_create_acceleration_structure);
+		this->m_dispatch_table.pfn_create_acceleration_structure = reinterpret_cast<PFN_vkCreateAccelerationStructureKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateAccelerationStructureKHR"));
+		assert(NULL != this->m_dispatch_table.pfn_create_acceleration_structure);
+
+		assert(NULL == this->m_dispatch_table.pfn_destroy_acceleration_structure);
+		this->m_dispatch_table.pfn_destroy_acceleration_structure = reinterpret_cast<PFN_vkDestroyAccelerationStructureKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyAccelerationStructureKHR"));
+		assert(NULL != this->m_dispatch_table.pfn_destroy_acceleration_structure);
+
+		assert(NULL == this->m_dispatch_table.pfn_get_acceleration_structure_build_sizes);
+		this->m_dispatch_table.pfn_get_acceleration_structure_build_sizes = reinterpret_cast<PFN_vkGetAccelerationStructureBuildSizesKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetAccelerationStructureBuildSizesKHR"));
+		assert(NULL != this->m_dispatch_table.pfn_get_acceleration_structure_build_sizes);
+
+		assert(NULL == this->m_dispatch_table.pfn_get_acceleration_structure_device_address);
+		this->m_dispatch_table.pfn_get_acceleration_structure_device_address = reinterpret_cast<PFN_vkGetAccelerationStructureDeviceAddressKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetAccelerationStructureDeviceAddressKHR"));
+		assert(NULL != this->m_dispatch_table.pfn_get_acceleration_structure_device_address);
+
+		assert(NULL == this->m_dispatch_table.pfn_get_buffer_device_address);
+		this->m_dispatch_table.pfn_get_buffer_device_address = reinterpret_cast<PFN_vkGetBufferDeviceAddressKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetBufferDeviceAddressKHR"));
+		assert(NULL != this->m_dispatch_table.pfn_get_buffer_device_address);
+
+		assert(NULL == this->m_dispatch_table.pfn_cmd_build_acceleration_structure);
+		this->m_dispatch_table.pfn_cmd_build_acceleration_structure = reinterpret_cast<PFN_vkCmdBuildAccelerationStructuresKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdBuildAccelerationStructuresKHR"));
+		assert(NULL != this->m_dispatch_table.pfn_cmd_build_acceleration_structure);
+
+		assert(NULL == this->m_dispatch_table.pfn_cmd_write_acceleration_structures_properties);
+		this->m_dispatch_table.pfn_cmd_write_acceleration_structures_properties = reinterpret_cast<PFN_vkCmdWriteAccelerationStructuresPropertiesKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdWriteAccelerationStructuresPropertiesKHR"));
+		assert(NULL != this->m_dispatch_table.pfn_cmd_write_acceleration_structures_properties);
+
+		assert(NULL == this->m_dispatch_table.pfn_cmd_copy_acceleration_structure);
+		this->m_dispatch_table.pfn_cmd_copy_acceleration_structure = reinterpret_cast<PFN_vkCmdCopyAccelerationStructureKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCmdCopyAccelerationStructureKHR"));
+		assert(NULL != this->m_dispatch_table.pfn_cmd_copy_acceleration_structure);
+	}
+
+#if defined(__GNUC__) && defined(__linux__) && !defined(__ANDROID__)
+	// headless
+#else
+	assert(NULL == this->m_dispatch_table.pfn_create_swap_chain);
+	this->m_dispatch_table.pfn_create_swap_chain = reinterpret_cast<PFN_vkCreateSwapchainKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateSwapchainKHR"));
+	assert(NULL != this->m_dispatch_table.pfn_create_swap_chain);
+
+	assert(NULL == this->m_dispatch_table.pfn_destroy_swap_chain);
+	this->m_dispatch_table.pfn_destroy_swap_chain = reinterpret_cast<PFN_vkDestroySwapchainKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroySwapchainKHR"));
+	assert(NULL != this->m_dispatch_table.pfn_destroy_swap_chain);
+
+	assert(NULL == this->m_dispatch_table.pfn_get_swap_chain_images);
+	this->m_dispatch_table.pfn_get_swap_chain_images = reinterpret_cast<PFN_vkGetSwapchainImagesKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetSwapchainImagesKHR"));
+	assert(NULL != this->m_dispatch_table.pfn_get_swap_chain_images);
+
+	assert(NULL == this->m_dispatch_table.pfn_acquire_next_image);
+	this->m_dispatch_table.pfn_acquire_next_image = reinterpret_cast<PFN_vkAcquireNextImageKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkAcquireNextImageKHR"));
+	assert(NULL != this->m_dispatch_table.pfn_acquire_next_image);
+
+	assert(NULL == this->m_dispatch_table.pfn_queue_present);
+	this->m_dispatch_table.pfn_queue_present = reinterpret_cast<PFN_vkQueuePresentKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkQueuePresentKHR"));
+	assert(NULL != this->m_dispatch_table.pfn_queue_present);
+#endif
+
+	this->m_descriptor_allocator.init(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
+
+	// the pipeline cache is empty until the "load_pipeline_cache"
+	assert(VK_NULL_HANDLE == this->m_pipeline_cache);
+	{
+		VkPipelineCacheCreateInfo const pipeline_cache_create_info = {
+			VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+			NULL,
+			0U,
+			0U,
+			NULL};
+		VkResult const res_create_pipeline_cache = this->m_dispatch_table.pfn_create_pipeline_cache(this->m_device, &pipeline_cache_create_info, this->m_allocation_callbacks, &this->m_pipeline_cache);
+		assert(VK_SUCCESS == res_create_pipeline_cache);
+	}
+
+	this->m_pipeline_state_cache.init(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks, this->m_pipeline_cache);
+
+	// the "vkCreateGraphicsPipelines" and "vkCreateComputePipelines" are free-threaded, and the access to the pipeline cache is internally synchronized
+	this->m_pipeline_compiler.init(this);
+
+	this->m_staging_upload_ring_manager.init(this);
+
 	this->m_graphics_queue = VK_NULL_HANDLE;
 	this->m_upload_queue = VK_NULL_HANDLE;
+	this->m_compute_queue = VK_NULL_HANDLE;
 	{
-		PFN_vkGetDeviceQueue const pfn_get_device_queue = reinterpret_cast<PFN_vkGetDeviceQueue>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetDeviceQueue"));
+		PFN_vkGetDeviceQueue const pfn_get_device_queue = this->m_dispatch_table.pfn_get_device_queue;
 		assert(NULL != pfn_get_device_queue);
 
 		pfn_get_device_queue(this->m_device, this->m_graphics_queue_family_index, new_graphics_queue_queue_index, &this->m_graphics_queue);
@@ -721,9 +1367,20 @@ void brx_vk_device::init(bool support_ray_tracing)
 			assert(static_cast<uint32_t>(-1) != new_upload_queue_queue_index);
 			pfn_get_device_queue(this->m_device, this->m_upload_queue_family_index, new_upload_queue_queue_index, &this->m_upload_queue);
 		}
+
+		if (this->m_has_dedicated_compute_queue)
+		{
+			assert(static_cast<uint32_t>(-1) != new_compute_queue_queue_index);
+			pfn_get_device_queue(this->m_device, this->m_compute_queue_family_index, new_compute_queue_queue_index, &this->m_compute_queue);
+		}
+		else
+		{
+			this->m_compute_queue = this->m_graphics_queue;
+		}
 	}
 	assert(VK_NULL_HANDLE != this->m_graphics_queue);
 	assert(!this->m_has_dedicated_upload_queue || VK_NULL_HANDLE != this->m_upload_queue);
+	assert(VK_NULL_HANDLE != this->m_compute_queue);
 
 	// https://registry.khronos.org/vulkan/specs/1.0/html/chap33.html#features-required-format-support
 	// VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT feature must be supported for at least one of
@@ -821,13 +1478,13 @@ void brx_vk_device::init(bool support_ray_tracing)
 	assert(VK_NULL_HANDLE == this->m_top_level_acceleration_structure_memory_pool);
 	{
 		PFN_vkGetPhysicalDeviceMemoryProperties const pfn_get_physical_device_memory_properties = reinterpret_cast<PFN_vkGetPhysicalDeviceMemoryProperties>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceMemoryProperties"));
-		PFN_vkCreateBuffer const pfn_create_buffer = reinterpret_cast<PFN_vkCreateBuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateBuffer"));
-		PFN_vkGetBufferMemoryRequirements const pfn_get_buffer_memory_requirements = reinterpret_cast<PFN_vkGetBufferMemoryRequirements>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetBufferMemoryRequirements"));
-		PFN_vkDestroyBuffer const pfn_destroy_buffer = reinterpret_cast<PFN_vkDestroyBuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyBuffer"));
+		PFN_vkCreateBuffer const pfn_create_buffer = this->m_dispatch_table.pfn_create_buffer;
+		PFN_vkGetBufferMemoryRequirements const pfn_get_buffer_memory_requirements = this->m_dispatch_table.pfn_get_buffer_memory_requirements;
+		PFN_vkDestroyBuffer const pfn_destroy_buffer = this->m_dispatch_table.pfn_destroy_buffer;
 		PFN_vkGetPhysicalDeviceFormatProperties const pfn_get_physical_device_format_properties = reinterpret_cast<PFN_vkGetPhysicalDeviceFormatProperties>(this->m_pfn_get_instance_proc_addr(this->m_instance, "vkGetPhysicalDeviceFormatProperties"));
-		PFN_vkCreateImage const pfn_create_image = reinterpret_cast<PFN_vkCreateImage>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateImage"));
-		PFN_vkGetImageMemoryRequirements const pfn_get_image_memory_requirements = reinterpret_cast<PFN_vkGetImageMemoryRequirements>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetImageMemoryRequirements"));
-		PFN_vkDestroyImage const pfn_destroy_image = reinterpret_cast<PFN_vkDestroyImage>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyImage"));
+		PFN_vkCreateImage const pfn_create_image = this->m_dispatch_table.pfn_create_image;
+		PFN_vkGetImageMemoryRequirements const pfn_get_image_memory_requirements = this->m_dispatch_table.pfn_get_image_memory_requirements;
+		PFN_vkDestroyImage const pfn_destroy_image = this->m_dispatch_table.pfn_destroy_image;
 
 		VkPhysicalDeviceMemoryProperties physical_device_memory_properties;
 		pfn_get_physical_device_memory_properties(this->m_physical_device, &physical_device_memory_properties);
@@ -1785,41 +2442,6 @@ void brx_vk_device::init(bool support_ray_tracing)
 			}
 		}
 	}
-
-	assert(NULL == this->m_pfn_wait_for_fences);
-	this->m_pfn_wait_for_fences = reinterpret_cast<PFN_vkWaitForFences>(this->m_pfn_get_device_proc_addr(this->m_device, "vkWaitForFences"));
-	assert(NULL != this->m_pfn_wait_for_fences);
-
-	assert(NULL == this->m_pfn_reset_fences);
-	this->m_pfn_reset_fences = reinterpret_cast<PFN_vkResetFences>(this->m_pfn_get_device_proc_addr(this->m_device, "vkResetFences"));
-	assert(NULL != this->m_pfn_reset_fences);
-
-	assert(NULL == this->m_pfn_reset_command_pool);
-	this->m_pfn_reset_command_pool = reinterpret_cast<PFN_vkResetCommandPool>(this->m_pfn_get_device_proc_addr(this->m_device, "vkResetCommandPool"));
-	assert(NULL != this->m_pfn_reset_command_pool);
-
-	assert(NULL == this->m_pfn_acquire_next_image);
-	this->m_pfn_acquire_next_image = reinterpret_cast<PFN_vkAcquireNextImageKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkAcquireNextImageKHR"));
-	assert(NULL != this->m_pfn_acquire_next_image);
-
-	assert(NULL == this->m_pfn_create_image_view);
-	this->m_pfn_create_image_view = reinterpret_cast<PFN_vkCreateImageView>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateImageView"));
-	assert(NULL != this->m_pfn_create_image_view);
-
-	assert(NULL == this->m_pfn_destroy_image_view);
-	this->m_pfn_destroy_image_view = reinterpret_cast<PFN_vkDestroyImageView>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyImageView"));
-	assert(NULL != this->m_pfn_destroy_image_view);
-
-	if (this->m_support_ray_tracing)
-	{
-		assert(NULL == this->m_pfn_get_buffer_device_address);
-		this->m_pfn_get_buffer_device_address = reinterpret_cast<PFN_vkGetBufferDeviceAddress>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetBufferDeviceAddressKHR"));
-		assert(NULL != this->m_pfn_get_buffer_device_address);
-
-		assert(NULL == this->m_pfn_get_query_pool_results);
-		this->m_pfn_get_query_pool_results = reinterpret_cast<PFN_vkGetQueryPoolResults>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetQueryPoolResults"));
-		assert(NULL != this->m_pfn_get_query_pool_results);
-	}
 }
 
 extern "C" void brx_destroy_vk_device(brx_device *wrapped_device)
@@ -1857,6 +2479,12 @@ void brx_vk_device::uninit()
 	assert(VK_NULL_HANDLE != this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool);
 	assert(VK_NULL_HANDLE != this->m_top_level_acceleration_structure_memory_pool);
 
+	this->m_staging_upload_ring_manager.uninit();
+
+	this->m_pipeline_compiler.uninit();
+
+	this->m_pipeline_state_cache.uninit();
+
 	vmaDestroyPool(this->m_memory_allocator, this->m_uniform_upload_buffer_memory_pool);
 	this->m_uniform_upload_buffer_memory_pool = VK_NULL_HANDLE;
 
@@ -1899,11 +2527,19 @@ void brx_vk_device::uninit()
 	vmaDestroyAllocator(this->m_memory_allocator);
 	this->m_memory_allocator = VK_NULL_HANDLE;
 
-	PFN_vkDestroyDevice const pfn_destroy_device = reinterpret_cast<PFN_vkDestroyDevice>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyDevice"));
+	this->m_descriptor_allocator.uninit();
+
+	assert(VK_NULL_HANDLE != this->m_pipeline_cache);
+	this->m_dispatch_table.pfn_destroy_pipeline_cache(this->m_device, this->m_pipeline_cache, this->m_allocation_callbacks);
+	this->m_pipeline_cache = VK_NULL_HANDLE;
+
+	PFN_vkDestroyDevice const pfn_destroy_device = this->m_dispatch_table.pfn_destroy_device;
 	assert(NULL != pfn_destroy_device);
 	pfn_destroy_device(this->m_device, this->m_allocation_callbacks);
 	this->m_device = VK_NULL_HANDLE;
 
+	this->m_dispatch_table = brx_vk_device_dispatch_table();
+
 	this->m_pfn_get_device_proc_addr = NULL;
 
 #ifndef NDEBUG
@@ -1919,7 +2555,7 @@ void brx_vk_device::uninit()
 	this->m_instance = VK_NULL_HANDLE;
 
 #if defined(__GNUC__)
-#if defined(__linux__) && defined(__ANDROID__)
+#if defined(__linux__)
 	int result_dl_close = dlclose(this->m_dynamic_library_vulkan);
 	assert(0 == result_dl_close);
 	this->m_dynamic_library_vulkan = NULL;
@@ -1963,15 +2599,18 @@ brx_vk_device::~brx_vk_device()
 
 brx_graphics_queue *brx_vk_device::create_graphics_queue() const
 {
-	PFN_vkQueueSubmit pfn_queue_submit = reinterpret_cast<PFN_vkQueueSubmit>(this->m_pfn_get_device_proc_addr(this->m_device, "vkQueueSubmit"));
+	PFN_vkQueueSubmit pfn_queue_submit = this->m_dispatch_table.pfn_queue_submit;
 	assert(NULL != pfn_queue_submit);
-	PFN_vkQueuePresentKHR pfn_queue_present = reinterpret_cast<PFN_vkQueuePresentKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkQueuePresentKHR"));
-	assert(NULL != pfn_queue_present);
+	// NULL on the headless platform
+	PFN_vkQueuePresentKHR pfn_queue_present = this->m_dispatch_table.pfn_queue_present;
+
+	// the pending waits of the timeline fences are flushed by signaling this timeline semaphore when they are full
+	VkSemaphore flush_timeline_semaphore = this->m_physical_device_extension_timeline_semaphore ? __intermediate_create_timeline_semaphore(this->m_dispatch_table.pfn_create_semaphore, this->m_device, this->m_allocation_callbacks, 0U) : VK_NULL_HANDLE;
 
 	void *new_brx_graphics_queue_base = brx_malloc(sizeof(brx_vk_graphics_queue), alignof(brx_vk_graphics_queue));
 	assert(NULL != new_brx_graphics_queue_base);
 
-	brx_vk_graphics_queue *new_brx_graphics_queue = new (new_brx_graphics_queue_base) brx_vk_graphics_queue{this->m_has_dedicated_upload_queue, this->m_upload_queue_family_index, this->m_graphics_queue_family_index, this->m_graphics_queue, pfn_queue_submit, pfn_queue_present};
+	brx_vk_graphics_queue *new_brx_graphics_queue = new (new_brx_graphics_queue_base) brx_vk_graphics_queue{this->m_has_dedicated_upload_queue, this->m_upload_queue_family_index, this->m_graphics_queue_family_index, this->m_graphics_queue, &this->m_graphics_queue_mutex, pfn_queue_submit, pfn_queue_present, flush_timeline_semaphore};
 	return new_brx_graphics_queue;
 }
 
@@ -1981,23 +2620,34 @@ void brx_vk_device::destroy_graphics_queue(brx_graphics_queue *brx_graphics_queu
 	brx_vk_graphics_queue *delete_graphics_queue = static_cast<brx_vk_graphics_queue *>(brx_graphics_queue);
 
 	VkQueue stealed_graphics_queue = VK_NULL_HANDLE;
-	delete_graphics_queue->steal(&stealed_graphics_queue);
+	VkSemaphore stealed_flush_timeline_semaphore = VK_NULL_HANDLE;
+	delete_graphics_queue->steal(&stealed_graphics_queue, &stealed_flush_timeline_semaphore);
 
 	delete_graphics_queue->~brx_vk_graphics_queue();
 	brx_free(delete_graphics_queue);
 
 	assert(stealed_graphics_queue == this->m_graphics_queue);
-}
 
-brx_upload_queue *brx_vk_device::create_upload_queue() const
+	if (VK_NULL_HANDLE != stealed_flush_timeline_semaphore)
+	{
+		PFN_vkDestroySemaphore pfn_destroy_semaphore = this->m_dispatch_table.pfn_destroy_semaphore;
+		assert(NULL != pfn_destroy_semaphore);
+
+		pfn_destroy_semaphore(this->m_device, stealed_flush_timeline_semaphore, this->m_allocation_callbacks);
+	}
+}
+
+brx_upload_queue *brx_vk_device::create_upload_queue() const
 {
-	PFN_vkQueueSubmit pfn_queue_submit = reinterpret_cast<PFN_vkQueueSubmit>(this->m_pfn_get_device_proc_addr(this->m_device, "vkQueueSubmit"));
+	PFN_vkQueueSubmit pfn_queue_submit = this->m_dispatch_table.pfn_queue_submit;
 	assert(NULL != pfn_queue_submit);
 
+	VkSemaphore flush_timeline_semaphore = this->m_physical_device_extension_timeline_semaphore ? __intermediate_create_timeline_semaphore(this->m_dispatch_table.pfn_create_semaphore, this->m_device, this->m_allocation_callbacks, 0U) : VK_NULL_HANDLE;
+
 	void *new_brx_upload_queue_base = brx_malloc(sizeof(brx_vk_upload_queue), alignof(brx_vk_upload_queue));
 	assert(NULL != new_brx_upload_queue_base);
 
-	brx_vk_upload_queue *new_brx_upload_queue = new (new_brx_upload_queue_base) brx_vk_upload_queue{this->m_has_dedicated_upload_queue, this->m_upload_queue_family_index, this->m_graphics_queue_family_index, this->m_upload_queue, pfn_queue_submit};
+	brx_vk_upload_queue *new_brx_upload_queue = new (new_brx_upload_queue_base) brx_vk_upload_queue{this->m_has_dedicated_upload_queue, this->m_upload_queue_family_index, this->m_graphics_queue_family_index, this->m_upload_queue, this->m_graphics_queue, this->m_has_dedicated_upload_queue ? &this->m_upload_queue_mutex : &this->m_graphics_queue_mutex, pfn_queue_submit, flush_timeline_semaphore};
 	return new_brx_upload_queue;
 }
 
@@ -2007,12 +2657,63 @@ void brx_vk_device::destroy_upload_queue(brx_upload_queue *brx_upload_queue) con
 	brx_vk_upload_queue *delete_upload_queue = static_cast<brx_vk_upload_queue *>(brx_upload_queue);
 
 	VkQueue stealed_upload_queue = VK_NULL_HANDLE;
-	delete_upload_queue->steal(&stealed_upload_queue);
+	VkSemaphore stealed_flush_timeline_semaphore = VK_NULL_HANDLE;
+	delete_upload_queue->steal(&stealed_upload_queue, &stealed_flush_timeline_semaphore);
 
 	delete_upload_queue->~brx_vk_upload_queue();
 	brx_free(delete_upload_queue);
 
 	assert(stealed_upload_queue == this->m_upload_queue);
+
+	if (VK_NULL_HANDLE != stealed_flush_timeline_semaphore)
+	{
+		PFN_vkDestroySemaphore pfn_destroy_semaphore = this->m_dispatch_table.pfn_destroy_semaphore;
+		assert(NULL != pfn_destroy_semaphore);
+
+		pfn_destroy_semaphore(this->m_device, stealed_flush_timeline_semaphore, this->m_allocation_callbacks);
+	}
+}
+
+bool brx_vk_device::is_async_compute_supported() const
+{
+	return this->m_has_dedicated_compute_queue;
+}
+
+brx_compute_queue *brx_vk_device::create_compute_queue() const
+{
+	PFN_vkQueueSubmit pfn_queue_submit = this->m_dispatch_table.pfn_queue_submit;
+	assert(NULL != pfn_queue_submit);
+
+	VkSemaphore flush_timeline_semaphore = this->m_physical_device_extension_timeline_semaphore ? __intermediate_create_timeline_semaphore(this->m_dispatch_table.pfn_create_semaphore, this->m_device, this->m_allocation_callbacks, 0U) : VK_NULL_HANDLE;
+
+	void *new_brx_compute_queue_base = brx_malloc(sizeof(brx_vk_compute_queue), alignof(brx_vk_compute_queue));
+	assert(NULL != new_brx_compute_queue_base);
+
+	brx_vk_compute_queue *new_brx_compute_queue = new (new_brx_compute_queue_base) brx_vk_compute_queue{this->m_compute_queue, this->m_has_dedicated_compute_queue ? &this->m_compute_queue_mutex : &this->m_graphics_queue_mutex, pfn_queue_submit, flush_timeline_semaphore};
+	return new_brx_compute_queue;
+}
+
+void brx_vk_device::destroy_compute_queue(brx_compute_queue *brx_compute_queue) const
+{
+	assert(NULL != brx_compute_queue);
+	brx_vk_compute_queue *delete_compute_queue = static_cast<brx_vk_compute_queue *>(brx_compute_queue);
+
+	VkQueue stealed_compute_queue = VK_NULL_HANDLE;
+	VkSemaphore stealed_flush_timeline_semaphore = VK_NULL_HANDLE;
+	delete_compute_queue->steal(&stealed_compute_queue, &stealed_flush_timeline_semaphore);
+
+	delete_compute_queue->~brx_vk_compute_queue();
+	brx_free(delete_compute_queue);
+
+	assert(stealed_compute_queue == this->m_compute_queue);
+
+	if (VK_NULL_HANDLE != stealed_flush_timeline_semaphore)
+	{
+		PFN_vkDestroySemaphore pfn_destroy_semaphore = this->m_dispatch_table.pfn_destroy_semaphore;
+		assert(NULL != pfn_destroy_semaphore);
+
+		pfn_destroy_semaphore(this->m_device, stealed_flush_timeline_semaphore, this->m_allocation_callbacks);
+	}
 }
 
 brx_graphics_command_buffer *brx_vk_device::create_graphics_command_buffer() const
@@ -2021,7 +2722,7 @@ brx_graphics_command_buffer *brx_vk_device::create_graphics_command_buffer() con
 	assert(NULL != new_unwrapped_graphics_command_buffer_base);
 
 	brx_vk_graphics_command_buffer *new_unwrapped_graphics_command_buffer = new (new_unwrapped_graphics_command_buffer_base) brx_vk_graphics_command_buffer{};
-	new_unwrapped_graphics_command_buffer->init(this->m_support_ray_tracing, this->m_has_dedicated_upload_queue, this->m_graphics_queue_family_index, this->m_upload_queue_family_index, this->m_pfn_get_instance_proc_addr, this->m_instance, this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	new_unwrapped_graphics_command_buffer->init(VK_COMMAND_BUFFER_LEVEL_PRIMARY, this->m_support_ray_tracing, this->m_physical_device_feature_multi_draw_indirect, this->m_has_dedicated_upload_queue, this->m_graphics_queue_family_index, this->m_upload_queue_family_index, this->m_compute_queue_family_index, &this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
 	return new_unwrapped_graphics_command_buffer;
 }
 
@@ -2030,7 +2731,7 @@ void brx_vk_device::reset_graphics_command_buffer(brx_graphics_command_buffer *b
 	assert(NULL != brx_graphics_command_buffer);
 	VkCommandPool command_pool = static_cast<brx_vk_graphics_command_buffer *>(brx_graphics_command_buffer)->get_command_pool();
 
-	VkResult res_reset_command_pool = this->m_pfn_reset_command_pool(this->m_device, command_pool, 0U);
+	VkResult res_reset_command_pool = this->m_dispatch_table.pfn_reset_command_pool(this->m_device, command_pool, 0U);
 	assert(VK_SUCCESS == res_reset_command_pool);
 }
 
@@ -2039,19 +2740,49 @@ void brx_vk_device::destroy_graphics_command_buffer(brx_graphics_command_buffer
 	assert(NULL != wrapped_graphics_command_buffer);
 	brx_vk_graphics_command_buffer *delete_unwrapped_graphics_command_buffer = static_cast<brx_vk_graphics_command_buffer *>(wrapped_graphics_command_buffer);
 
-	delete_unwrapped_graphics_command_buffer->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	delete_unwrapped_graphics_command_buffer->uninit(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
 
 	delete_unwrapped_graphics_command_buffer->~brx_vk_graphics_command_buffer();
 	brx_free(delete_unwrapped_graphics_command_buffer);
 }
 
+brx_secondary_graphics_command_buffer *brx_vk_device::create_secondary_graphics_command_buffer() const
+{
+	void *new_unwrapped_secondary_graphics_command_buffer_base = brx_malloc(sizeof(brx_vk_secondary_graphics_command_buffer), alignof(brx_vk_secondary_graphics_command_buffer));
+	assert(NULL != new_unwrapped_secondary_graphics_command_buffer_base);
+
+	brx_vk_secondary_graphics_command_buffer *new_unwrapped_secondary_graphics_command_buffer = new (new_unwrapped_secondary_graphics_command_buffer_base) brx_vk_secondary_graphics_command_buffer{};
+	new_unwrapped_secondary_graphics_command_buffer->init(this->m_support_ray_tracing, this->m_physical_device_feature_multi_draw_indirect, this->m_has_dedicated_upload_queue, this->m_graphics_queue_family_index, this->m_upload_queue_family_index, this->m_compute_queue_family_index, &this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
+	return new_unwrapped_secondary_graphics_command_buffer;
+}
+
+void brx_vk_device::reset_secondary_graphics_command_buffer(brx_secondary_graphics_command_buffer *wrapped_secondary_graphics_command_buffer) const
+{
+	assert(NULL != wrapped_secondary_graphics_command_buffer);
+	VkCommandPool command_pool = static_cast<brx_vk_secondary_graphics_command_buffer *>(wrapped_secondary_graphics_command_buffer)->get_command_pool();
+
+	VkResult res_reset_command_pool = this->m_dispatch_table.pfn_reset_command_pool(this->m_device, command_pool, 0U);
+	assert(VK_SUCCESS == res_reset_command_pool);
+}
+
+void brx_vk_device::destroy_secondary_graphics_command_buffer(brx_secondary_graphics_command_buffer *wrapped_secondary_graphics_command_buffer) const
+{
+	assert(NULL != wrapped_secondary_graphics_command_buffer);
+	brx_vk_secondary_graphics_command_buffer *delete_unwrapped_secondary_graphics_command_buffer = static_cast<brx_vk_secondary_graphics_command_buffer *>(wrapped_secondary_graphics_command_buffer);
+
+	delete_unwrapped_secondary_graphics_command_buffer->uninit(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
+
+	delete_unwrapped_secondary_graphics_command_buffer->~brx_vk_secondary_graphics_command_buffer();
+	brx_free(delete_unwrapped_secondary_graphics_command_buffer);
+}
+
 brx_upload_command_buffer *brx_vk_device::create_upload_command_buffer() const
 {
 	void *new_unwrapped_upload_command_buffer_base = brx_malloc(sizeof(brx_vk_upload_command_buffer), alignof(brx_vk_upload_command_buffer));
 	assert(NULL != new_unwrapped_upload_command_buffer_base);
 
 	brx_vk_upload_command_buffer *new_unwrapped_upload_command_buffer = new (new_unwrapped_upload_command_buffer_base) brx_vk_upload_command_buffer{};
-	new_unwrapped_upload_command_buffer->init(this->m_support_ray_tracing, this->m_has_dedicated_upload_queue, this->m_graphics_queue_family_index, this->m_upload_queue_family_index, this->m_pfn_get_instance_proc_addr, this->m_instance, this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	new_unwrapped_upload_command_buffer->init(this->m_support_ray_tracing, this->m_has_dedicated_upload_queue, this->m_upload_queue_family_support_timestamp, this->m_graphics_queue_family_index, this->m_upload_queue_family_index, &this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
 	return new_unwrapped_upload_command_buffer;
 }
 
@@ -2067,14 +2798,14 @@ void brx_vk_device::reset_upload_command_buffer(brx_upload_command_buffer *brx_u
 		{
 			assert(VK_NULL_HANDLE != upload_command_pool && VK_NULL_HANDLE == graphics_command_pool);
 
-			VkResult res_reset_upload_command_pool = this->m_pfn_reset_command_pool(this->m_device, upload_command_pool, 0U);
+			VkResult res_reset_upload_command_pool = this->m_dispatch_table.pfn_reset_command_pool(this->m_device, upload_command_pool, 0U);
 			assert(VK_SUCCESS == res_reset_upload_command_pool);
 		}
 		else
 		{
 			assert(VK_NULL_HANDLE != upload_command_pool && VK_NULL_HANDLE == graphics_command_pool);
 
-			VkResult res_reset_upload_command_pool = this->m_pfn_reset_command_pool(this->m_device, upload_command_pool, 0U);
+			VkResult res_reset_upload_command_pool = this->m_dispatch_table.pfn_reset_command_pool(this->m_device, upload_command_pool, 0U);
 			assert(VK_SUCCESS == res_reset_upload_command_pool);
 		}
 	}
@@ -2082,7 +2813,7 @@ void brx_vk_device::reset_upload_command_buffer(brx_upload_command_buffer *brx_u
 	{
 		assert(VK_NULL_HANDLE == upload_command_pool && VK_NULL_HANDLE != graphics_command_pool);
 
-		VkResult res_reset_graphics_command_pool = this->m_pfn_reset_command_pool(this->m_device, graphics_command_pool, 0U);
+		VkResult res_reset_graphics_command_pool = this->m_dispatch_table.pfn_reset_command_pool(this->m_device, graphics_command_pool, 0U);
 		assert(VK_SUCCESS == res_reset_graphics_command_pool);
 	}
 }
@@ -2092,17 +2823,47 @@ void brx_vk_device::destroy_upload_command_buffer(brx_upload_command_buffer *wra
 	assert(NULL != wrapped_upload_command_buffer);
 	brx_vk_upload_command_buffer *delete_unwrapped_upload_command_buffer = static_cast<brx_vk_upload_command_buffer *>(wrapped_upload_command_buffer);
 
-	delete_unwrapped_upload_command_buffer->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	delete_unwrapped_upload_command_buffer->uninit(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
 
 	delete_unwrapped_upload_command_buffer->~brx_vk_upload_command_buffer();
 	brx_free(delete_unwrapped_upload_command_buffer);
 }
 
+brx_compute_command_buffer *brx_vk_device::create_compute_command_buffer() const
+{
+	void *new_unwrapped_compute_command_buffer_base = brx_malloc(sizeof(brx_vk_compute_command_buffer), alignof(brx_vk_compute_command_buffer));
+	assert(NULL != new_unwrapped_compute_command_buffer_base);
+
+	brx_vk_compute_command_buffer *new_unwrapped_compute_command_buffer = new (new_unwrapped_compute_command_buffer_base) brx_vk_compute_command_buffer{};
+	new_unwrapped_compute_command_buffer->init(this->m_graphics_queue_family_index, this->m_compute_queue_family_index, &this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
+	return new_unwrapped_compute_command_buffer;
+}
+
+void brx_vk_device::reset_compute_command_buffer(brx_compute_command_buffer *wrapped_compute_command_buffer) const
+{
+	assert(NULL != wrapped_compute_command_buffer);
+	VkCommandPool command_pool = static_cast<brx_vk_compute_command_buffer *>(wrapped_compute_command_buffer)->get_command_pool();
+
+	VkResult res_reset_command_pool = this->m_dispatch_table.pfn_reset_command_pool(this->m_device, command_pool, 0U);
+	assert(VK_SUCCESS == res_reset_command_pool);
+}
+
+void brx_vk_device::destroy_compute_command_buffer(brx_compute_command_buffer *wrapped_compute_command_buffer) const
+{
+	assert(NULL != wrapped_compute_command_buffer);
+	brx_vk_compute_command_buffer *delete_unwrapped_compute_command_buffer = static_cast<brx_vk_compute_command_buffer *>(wrapped_compute_command_buffer);
+
+	delete_unwrapped_compute_command_buffer->uninit(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
+
+	delete_unwrapped_compute_command_buffer->~brx_vk_compute_command_buffer();
+	brx_free(delete_unwrapped_compute_command_buffer);
+}
+
 brx_fence *brx_vk_device::create_fence(bool signaled) const
 {
 	VkFence new_fence = VK_NULL_HANDLE;
 	{
-		PFN_vkCreateFence pfn_create_fence = reinterpret_cast<PFN_vkCreateFence>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateFence"));
+		PFN_vkCreateFence pfn_create_fence = this->m_dispatch_table.pfn_create_fence;
 		assert(NULL != pfn_create_fence);
 
 		VkFenceCreateInfo fence_create_info;
@@ -2125,8 +2886,11 @@ void brx_vk_device::wait_for_fence(brx_fence *brx_fence) const
 	assert(NULL != brx_fence);
 	VkFence fence = static_cast<brx_vk_fence *>(brx_fence)->get_fence();
 
-	VkResult res_wait_for_fences = this->m_pfn_wait_for_fences(this->m_device, 1U, &fence, VK_TRUE, UINT64_MAX);
+	VkResult res_wait_for_fences = this->m_dispatch_table.pfn_wait_for_fences(this->m_device, 1U, &fence, VK_TRUE, UINT64_MAX);
 	assert(VK_SUCCESS == res_wait_for_fences);
+
+	// the uploads associated with this fence have been completed
+	const_cast<brx_staging_upload_ring_manager *>(&this->m_staging_upload_ring_manager)->retire_fence(brx_fence);
 }
 
 void brx_vk_device::reset_fence(brx_fence *brx_fence) const
@@ -2134,7 +2898,7 @@ void brx_vk_device::reset_fence(brx_fence *brx_fence) const
 	assert(NULL != brx_fence);
 	VkFence fence = static_cast<brx_vk_fence *>(brx_fence)->get_fence();
 
-	VkResult res_reset_fences = this->m_pfn_reset_fences(this->m_device, 1U, &fence);
+	VkResult res_reset_fences = this->m_dispatch_table.pfn_reset_fences(this->m_device, 1U, &fence);
 	assert(VK_SUCCESS == res_reset_fences);
 }
 
@@ -2149,19 +2913,151 @@ void brx_vk_device::destroy_fence(brx_fence *brx_fence) const
 	delete_fence->~brx_vk_fence();
 	brx_free(delete_fence);
 
-	PFN_vkDestroyFence pfn_destroy_fence = reinterpret_cast<PFN_vkDestroyFence>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyFence"));
+	PFN_vkDestroyFence pfn_destroy_fence = this->m_dispatch_table.pfn_destroy_fence;
 	assert(NULL != pfn_destroy_fence);
 
 	pfn_destroy_fence(this->m_device, stealed_fence, this->m_allocation_callbacks);
 }
 
-brx_descriptor_set_layout *brx_vk_device::create_descriptor_set_layout(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings) const
+bool brx_vk_device::is_timeline_fence_supported() const
+{
+	return this->m_physical_device_extension_timeline_semaphore;
+}
+
+brx_timeline_fence *brx_vk_device::create_timeline_fence(uint64_t initial_value) const
+{
+	assert(this->m_physical_device_extension_timeline_semaphore);
+
+	VkSemaphore new_semaphore = __intermediate_create_timeline_semaphore(this->m_dispatch_table.pfn_create_semaphore, this->m_device, this->m_allocation_callbacks, initial_value);
+
+	void *new_brx_timeline_fence_base = brx_malloc(sizeof(brx_vk_timeline_fence), alignof(brx_vk_timeline_fence));
+	assert(NULL != new_brx_timeline_fence_base);
+
+	brx_vk_timeline_fence *new_brx_timeline_fence = new (new_brx_timeline_fence_base) brx_vk_timeline_fence{new_semaphore};
+	return new_brx_timeline_fence;
+}
+
+uint64_t brx_vk_device::get_timeline_fence_completed_value(brx_timeline_fence const *brx_timeline_fence) const
+{
+	assert(NULL != brx_timeline_fence);
+	VkSemaphore semaphore = static_cast<brx_vk_timeline_fence const *>(brx_timeline_fence)->get_semaphore();
+
+	uint64_t value = 0U;
+	VkResult res_get_semaphore_counter_value = this->m_dispatch_table.pfn_get_semaphore_counter_value(this->m_device, semaphore, &value);
+	assert(VK_SUCCESS == res_get_semaphore_counter_value);
+
+	return value;
+}
+
+void brx_vk_device::signal_timeline_fence(brx_timeline_fence *brx_timeline_fence, uint64_t value) const
+{
+	assert(NULL != brx_timeline_fence);
+	VkSemaphore semaphore = static_cast<brx_vk_timeline_fence *>(brx_timeline_fence)->get_semaphore();
+
+	VkSemaphoreSignalInfoKHR const semaphore_signal_info = {
+		VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO_KHR,
+		NULL,
+		semaphore,
+		value};
+	VkResult res_signal_semaphore = this->m_dispatch_table.pfn_signal_semaphore(this->m_device, &semaphore_signal_info);
+	assert(VK_SUCCESS == res_signal_semaphore);
+}
+
+bool brx_vk_device::wait_for_timeline_fences(uint32_t timeline_fence_count, brx_timeline_fence const *const *brx_timeline_fences, uint64_t const *values, bool wait_all, uint64_t timeout) const
+{
+	assert(timeline_fence_count > 0U);
+	assert(NULL != brx_timeline_fences);
+	assert(NULL != values);
+
+	brx_vector<VkSemaphore> semaphores(static_cast<size_t>(timeline_fence_count));
+	for (uint32_t timeline_fence_index = 0U; timeline_fence_index < timeline_fence_count; ++timeline_fence_index)
+	{
+		assert(NULL != brx_timeline_fences[timeline_fence_index]);
+		semaphores[timeline_fence_index] = static_cast<brx_vk_timeline_fence const *>(brx_timeline_fences[timeline_fence_index])->get_semaphore();
+	}
+
+	VkSemaphoreWaitInfoKHR const semaphore_wait_info = {
+		VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR,
+		NULL,
+		wait_all ? 0U : static_cast<VkSemaphoreWaitFlags>(VK_SEMAPHORE_WAIT_ANY_BIT_KHR),
+		timeline_fence_count,
+		&semaphores[0],
+		values};
+	VkResult res_wait_semaphores = this->m_dispatch_table.pfn_wait_semaphores(this->m_device, &semaphore_wait_info, timeout);
+	assert(VK_SUCCESS == res_wait_semaphores || VK_TIMEOUT == res_wait_semaphores);
+
+	return (VK_SUCCESS == res_wait_semaphores);
+}
+
+void brx_vk_device::destroy_timeline_fence(brx_timeline_fence *brx_timeline_fence) const
+{
+	assert(NULL != brx_timeline_fence);
+	brx_vk_timeline_fence *delete_timeline_fence = static_cast<brx_vk_timeline_fence *>(brx_timeline_fence);
+
+	VkSemaphore stealed_semaphore = VK_NULL_HANDLE;
+	delete_timeline_fence->steal(&stealed_semaphore);
+
+	delete_timeline_fence->~brx_vk_timeline_fence();
+	brx_free(delete_timeline_fence);
+
+	PFN_vkDestroySemaphore pfn_destroy_semaphore = this->m_dispatch_table.pfn_destroy_semaphore;
+	assert(NULL != pfn_destroy_semaphore);
+
+	pfn_destroy_semaphore(this->m_device, stealed_semaphore, this->m_allocation_callbacks);
+}
+
+brx_upload_scheduler *brx_vk_device::create_upload_scheduler(uint32_t batch_count)
+{
+	void *new_upload_scheduler_base = brx_malloc(sizeof(brx_upload_batch_scheduler), alignof(brx_upload_batch_scheduler));
+	assert(NULL != new_upload_scheduler_base);
+
+	brx_upload_batch_scheduler *new_upload_scheduler = new (new_upload_scheduler_base) brx_upload_batch_scheduler{};
+	new_upload_scheduler->init(this, batch_count);
+	return new_upload_scheduler;
+}
+
+brx_upload_command_buffer *brx_vk_device::begin_upload_batch(brx_upload_scheduler *upload_scheduler) const
+{
+	assert(NULL != upload_scheduler);
+	return static_cast<brx_upload_batch_scheduler *>(upload_scheduler)->begin_batch(this);
+}
+
+uint64_t brx_vk_device::submit_upload_batch(brx_upload_scheduler *upload_scheduler, brx_upload_queue *upload_queue, brx_upload_command_buffer *upload_command_buffer) const
+{
+	assert(NULL != upload_scheduler);
+	return static_cast<brx_upload_batch_scheduler *>(upload_scheduler)->submit_batch(upload_queue, upload_command_buffer);
+}
+
+brx_timeline_fence const *brx_vk_device::get_upload_scheduler_timeline_fence(brx_upload_scheduler const *upload_scheduler) const
+{
+	assert(NULL != upload_scheduler);
+	return static_cast<brx_upload_batch_scheduler const *>(upload_scheduler)->get_timeline_fence();
+}
+
+bool brx_vk_device::is_upload_batch_completed(brx_upload_scheduler const *upload_scheduler, uint64_t batch_value) const
+{
+	assert(NULL != upload_scheduler);
+	return static_cast<brx_upload_batch_scheduler const *>(upload_scheduler)->is_batch_completed(this, batch_value);
+}
+
+void brx_vk_device::destroy_upload_scheduler(brx_upload_scheduler *upload_scheduler)
+{
+	assert(NULL != upload_scheduler);
+	brx_upload_batch_scheduler *delete_upload_scheduler = static_cast<brx_upload_batch_scheduler *>(upload_scheduler);
+
+	delete_upload_scheduler->uninit(this);
+
+	delete_upload_scheduler->~brx_upload_batch_scheduler();
+	brx_free(delete_upload_scheduler);
+}
+
+brx_descriptor_set_layout *brx_vk_device::create_descriptor_set_layout(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings, bool descriptor_update_template) const
 {
 	void *new_unwrapped_descriptor_set_layout_base = brx_malloc(sizeof(brx_vk_descriptor_set_layout), alignof(brx_vk_descriptor_set_layout));
 	assert(NULL != new_unwrapped_descriptor_set_layout_base);
 
 	brx_vk_descriptor_set_layout *new_unwrapped_descriptor_set_layout = new (new_unwrapped_descriptor_set_layout_base) brx_vk_descriptor_set_layout{};
-	new_unwrapped_descriptor_set_layout->init(descriptor_set_binding_count, descriptor_set_bindings, this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	new_unwrapped_descriptor_set_layout->init(descriptor_set_binding_count, descriptor_set_bindings, descriptor_update_template, false, &this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
 	return new_unwrapped_descriptor_set_layout;
 }
 
@@ -2170,31 +3066,40 @@ void brx_vk_device::destroy_descriptor_set_layout(brx_descriptor_set_layout *wra
 	assert(NULL != wrapped_descriptor_set_layout);
 	brx_vk_descriptor_set_layout *delete_unwrapped_descriptor_set_layout = static_cast<brx_vk_descriptor_set_layout *>(wrapped_descriptor_set_layout);
 
-	delete_unwrapped_descriptor_set_layout->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	const_cast<brx_vk_descriptor_allocator *>(&this->m_descriptor_allocator)->release_descriptor_set_layout(delete_unwrapped_descriptor_set_layout->get_descriptor_set_layout());
+
+	delete_unwrapped_descriptor_set_layout->uninit(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
 
 	delete_unwrapped_descriptor_set_layout->~brx_vk_descriptor_set_layout();
 	brx_free(delete_unwrapped_descriptor_set_layout);
 }
 
-brx_pipeline_layout *brx_vk_device::create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *brx_descriptor_set_layouts) const
+brx_pipeline_layout *brx_vk_device::create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *brx_descriptor_set_layouts, uint32_t push_constant_size) const
 {
+	assert(0U == (push_constant_size & 3U));
+	assert(push_constant_size <= g_vk_max_push_constant_size);
+
+	constexpr uint32_t const max_descriptor_set_layout_count = g_vk_max_descriptor_set_layout_count;
+	assert(descriptor_set_layout_count <= max_descriptor_set_layout_count);
+	descriptor_set_layout_count = (descriptor_set_layout_count < max_descriptor_set_layout_count) ? descriptor_set_layout_count : max_descriptor_set_layout_count;
+
+	VkDescriptorSetLayout descriptor_set_layouts[max_descriptor_set_layout_count];
+
 	VkPipelineLayout new_pipeline_layout = VK_NULL_HANDLE;
 	{
-		PFN_vkCreatePipelineLayout pfn_create_pipeline_layout = reinterpret_cast<PFN_vkCreatePipelineLayout>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreatePipelineLayout"));
+		PFN_vkCreatePipelineLayout pfn_create_pipeline_layout = this->m_dispatch_table.pfn_create_pipeline_layout;
 		assert(NULL != pfn_create_pipeline_layout);
 
-		constexpr uint32_t const max_descriptor_set_layout_count = 4U;
-		assert(descriptor_set_layout_count < max_descriptor_set_layout_count);
-		descriptor_set_layout_count = (descriptor_set_layout_count < max_descriptor_set_layout_count) ? descriptor_set_layout_count : max_descriptor_set_layout_count;
-
-		VkDescriptorSetLayout descriptor_set_layouts[max_descriptor_set_layout_count];
 		for (uint32_t set_index = 0U; set_index < descriptor_set_layout_count; ++set_index)
 		{
 			assert(NULL != (brx_descriptor_set_layouts[set_index]));
 			descriptor_set_layouts[set_index] = static_cast<brx_vk_descriptor_set_layout const *>(brx_descriptor_set_layouts[set_index])->get_descriptor_set_layout();
 		}
 
-		VkPipelineLayoutCreateInfo pipeline_layout_create_info = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO, NULL, 0U, descriptor_set_layout_count, descriptor_set_layouts, 0U, NULL};
+		// the push constants are visible to all shader stages to be consistent with the root constants of D3D12
+		VkPushConstantRange const push_constant_range = {VK_SHADER_STAGE_ALL, 0U, push_constant_size};
+
+		VkPipelineLayoutCreateInfo pipeline_layout_create_info = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO, NULL, 0U, descriptor_set_layout_count, descriptor_set_layouts, (push_constant_size > 0U) ? 1U : 0U, (push_constant_size > 0U) ? &push_constant_range : NULL};
 
 		VkResult res_create_pipeline_layout = pfn_create_pipeline_layout(this->m_device, &pipeline_layout_create_info, this->m_allocation_callbacks, &new_pipeline_layout);
 		assert(VK_SUCCESS == res_create_pipeline_layout);
@@ -2203,7 +3108,7 @@ brx_pipeline_layout *brx_vk_device::create_pipeline_layout(uint32_t descriptor_s
 	void *new_brx_pipeline_layout_base = brx_malloc(sizeof(brx_vk_pipeline_layout), alignof(brx_vk_pipeline_layout));
 	assert(NULL != new_brx_pipeline_layout_base);
 
-	brx_vk_pipeline_layout *new_brx_pipeline_layout = new (new_brx_pipeline_layout_base) brx_vk_pipeline_layout{new_pipeline_layout};
+	brx_vk_pipeline_layout *new_brx_pipeline_layout = new (new_brx_pipeline_layout_base) brx_vk_pipeline_layout{new_pipeline_layout, descriptor_set_layout_count, descriptor_set_layouts, push_constant_size};
 	return new_brx_pipeline_layout;
 }
 
@@ -2218,7 +3123,7 @@ void brx_vk_device::destroy_pipeline_layout(brx_pipeline_layout *brx_pipeline_la
 	delete_pipeline_layout->~brx_vk_pipeline_layout();
 	brx_free(delete_pipeline_layout);
 
-	PFN_vkDestroyPipelineLayout pfn_destroy_pipeline_layout = reinterpret_cast<PFN_vkDestroyPipelineLayout>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyPipelineLayout"));
+	PFN_vkDestroyPipelineLayout pfn_destroy_pipeline_layout = this->m_dispatch_table.pfn_destroy_pipeline_layout;
 	assert(NULL != pfn_destroy_pipeline_layout);
 
 	pfn_destroy_pipeline_layout(this->m_device, stealed_pipeline_layout, this->m_allocation_callbacks);
@@ -2230,16 +3135,100 @@ brx_descriptor_set *brx_vk_device::create_descriptor_set(brx_descriptor_set_layo
 	assert(NULL != new_unwrapped_descriptor_set_base);
 
 	brx_vk_descriptor_set *new_unwrapped_descriptor_set = new (new_unwrapped_descriptor_set_base) brx_vk_descriptor_set{};
-	new_unwrapped_descriptor_set->init(descriptor_set_layout, this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	new_unwrapped_descriptor_set->init(&this->m_descriptor_allocator, descriptor_set_layout);
 	return new_unwrapped_descriptor_set;
 }
 
 void brx_vk_device::write_descriptor_set(brx_descriptor_set *wrapped_descriptor_set, BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t dst_binding, uint32_t dst_array_element, uint32_t src_descriptor_count, brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_storage_buffer const *const *src_storage_buffers, brx_sampled_image const *const *src_sampled_images, brx_sampler const *const *src_samplers, brx_storage_image const *const *src_storage_images, brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures) const
+{
+	BRX_WRITE_DESCRIPTOR_SET const write_descriptor_set = {
+		wrapped_descriptor_set,
+		descriptor_type,
+		dst_binding,
+		dst_array_element,
+		src_descriptor_count,
+		src_dynamic_uniform_buffers,
+		src_dynamic_uniform_buffer_ranges,
+		src_storage_buffers,
+		src_sampled_images,
+		src_samplers,
+		src_storage_images,
+		src_top_level_acceleration_structures};
+
+	this->write_descriptor_sets(1U, &write_descriptor_set);
+}
+
+void brx_vk_device::write_descriptor_sets(uint32_t write_descriptor_set_count, BRX_WRITE_DESCRIPTOR_SET const *write_descriptor_sets) const
+{
+	// the writes are gathered on the stack and submitted by one "vkUpdateDescriptorSets" unless the storage is exhausted
+	constexpr uint32_t const max_descriptor_write_count = 64U;
+	constexpr uint32_t const max_descriptor_info_count = 256U;
+
+	VkWriteDescriptorSet descriptor_writes[max_descriptor_write_count];
+	VkWriteDescriptorSetAccelerationStructureKHR descriptor_write_acceleration_structures[max_descriptor_write_count];
+	VkDescriptorBufferInfo buffer_infos[max_descriptor_info_count];
+	VkDescriptorImageInfo image_infos[max_descriptor_info_count];
+	VkAccelerationStructureKHR acceleration_structures[max_descriptor_info_count];
+
+	uint32_t descriptor_write_count = 0U;
+	uint32_t descriptor_info_count = 0U;
+
+	for (uint32_t write_descriptor_set_index = 0U; write_descriptor_set_index < write_descriptor_set_count; ++write_descriptor_set_index)
+	{
+		BRX_WRITE_DESCRIPTOR_SET const &write_descriptor_set = write_descriptor_sets[write_descriptor_set_index];
+
+		assert(NULL != write_descriptor_set.descriptor_set);
+		brx_vk_descriptor_set const *const unwrapped_descriptor_set = static_cast<brx_vk_descriptor_set const *>(write_descriptor_set.descriptor_set);
+
+		// the large writes are split into the slices which fit in the remaining storage
+		uint32_t descriptor_index = 0U;
+		while (descriptor_index < write_descriptor_set.src_descriptor_count)
+		{
+			if ((max_descriptor_write_count == descriptor_write_count) || (max_descriptor_info_count == descriptor_info_count))
+			{
+				this->m_dispatch_table.pfn_update_descriptor_sets(this->m_device, descriptor_write_count, descriptor_writes, 0U, NULL);
+				descriptor_write_count = 0U;
+				descriptor_info_count = 0U;
+			}
+
+			uint32_t const slice_descriptor_count = std::min(write_descriptor_set.src_descriptor_count - descriptor_index, max_descriptor_info_count - descriptor_info_count);
+
+			unwrapped_descriptor_set->fill_descriptor_write(
+				write_descriptor_set.descriptor_type,
+				write_descriptor_set.dst_binding,
+				write_descriptor_set.dst_array_element + descriptor_index,
+				slice_descriptor_count,
+				(NULL != write_descriptor_set.src_dynamic_uniform_buffers) ? (write_descriptor_set.src_dynamic_uniform_buffers + descriptor_index) : NULL,
+				(NULL != write_descriptor_set.src_dynamic_uniform_buffer_ranges) ? (write_descriptor_set.src_dynamic_uniform_buffer_ranges + descriptor_index) : NULL,
+				(NULL != write_descriptor_set.src_storage_buffers) ? (write_descriptor_set.src_storage_buffers + descriptor_index) : NULL,
+				(NULL != write_descriptor_set.src_sampled_images) ? (write_descriptor_set.src_sampled_images + descriptor_index) : NULL,
+				(NULL != write_descriptor_set.src_samplers) ? (write_descriptor_set.src_samplers + descriptor_index) : NULL,
+				(NULL != write_descriptor_set.src_storage_images) ? (write_descriptor_set.src_storage_images + descriptor_index) : NULL,
+				(NULL != write_descriptor_set.src_top_level_acceleration_structures) ? (write_descriptor_set.src_top_level_acceleration_structures + descriptor_index) : NULL,
+				&descriptor_writes[descriptor_write_count],
+				&buffer_infos[descriptor_info_count],
+				&image_infos[descriptor_info_count],
+				&descriptor_write_acceleration_structures[descriptor_write_count],
+				&acceleration_structures[descriptor_info_count]);
+
+			++descriptor_write_count;
+			descriptor_info_count += slice_descriptor_count;
+			descriptor_index += slice_descriptor_count;
+		}
+	}
+
+	if (descriptor_write_count > 0U)
+	{
+		this->m_dispatch_table.pfn_update_descriptor_sets(this->m_device, descriptor_write_count, descriptor_writes, 0U, NULL);
+	}
+}
+
+void brx_vk_device::write_descriptor_set_with_template(brx_descriptor_set *wrapped_descriptor_set, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges) const
 {
 	assert(NULL != wrapped_descriptor_set);
-	brx_vk_descriptor_set *const unwrapped_descriptor_set = static_cast<brx_vk_descriptor_set *>(wrapped_descriptor_set);
+	brx_vk_descriptor_set const *const unwrapped_descriptor_set = static_cast<brx_vk_descriptor_set const *>(wrapped_descriptor_set);
 
-	unwrapped_descriptor_set->write_descriptor(this->m_pfn_get_device_proc_addr, this->m_device, descriptor_type, dst_binding, dst_array_element, src_descriptor_count, src_dynamic_uniform_buffers, src_dynamic_uniform_buffer_ranges, src_storage_buffers, src_sampled_images, src_samplers, src_storage_images, src_top_level_acceleration_structures);
+	unwrapped_descriptor_set->write_descriptor_with_template(&this->m_dispatch_table, this->m_device, src_descriptors, src_dynamic_uniform_buffer_ranges);
 }
 
 void brx_vk_device::destroy_descriptor_set(brx_descriptor_set *wrapped_descriptor_set)
@@ -2247,26 +3236,175 @@ void brx_vk_device::destroy_descriptor_set(brx_descriptor_set *wrapped_descripto
 	assert(NULL != wrapped_descriptor_set);
 	brx_vk_descriptor_set *delete_unwrapped_descriptor_set = static_cast<brx_vk_descriptor_set *>(wrapped_descriptor_set);
 
-	delete_unwrapped_descriptor_set->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	delete_unwrapped_descriptor_set->uninit(&this->m_descriptor_allocator);
 
 	delete_unwrapped_descriptor_set->~brx_vk_descriptor_set();
 	brx_free(delete_unwrapped_descriptor_set);
 }
 
+bool brx_vk_device::is_bindless_table_supported() const
+{
+	return this->m_physical_device_feature_bindless_table;
+}
+
+brx_bindless_table *brx_vk_device::create_bindless_table(BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t descriptor_count)
+{
+	// the descriptor indexing extension is only enabled in the ray tracing mode
+	assert(this->m_physical_device_feature_bindless_table);
+
+	uint32_t max_descriptor_count;
+	switch (descriptor_type)
+	{
+	case BRX_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+	{
+		max_descriptor_count = this->m_max_bindless_table_sampled_image_descriptor_count;
+	}
+	break;
+	case BRX_DESCRIPTOR_TYPE_READ_ONLY_STORAGE_BUFFER:
+	{
+		max_descriptor_count = this->m_max_bindless_table_storage_buffer_descriptor_count;
+	}
+	break;
+	case BRX_DESCRIPTOR_TYPE_SAMPLER:
+	{
+		max_descriptor_count = this->m_max_bindless_table_sampler_descriptor_count;
+	}
+	break;
+	default:
+	{
+		assert(false);
+		max_descriptor_count = 0U;
+	}
+	}
+
+	if ((!this->m_physical_device_feature_bindless_table) || (descriptor_count > max_descriptor_count))
+	{
+		return NULL;
+	}
+
+	BRX_DESCRIPTOR_SET_LAYOUT_BINDING const descriptor_set_binding = {0U, descriptor_type, descriptor_count};
+
+	void *new_unwrapped_descriptor_set_layout_base = brx_malloc(sizeof(brx_vk_descriptor_set_layout), alignof(brx_vk_descriptor_set_layout));
+	assert(NULL != new_unwrapped_descriptor_set_layout_base);
+
+	brx_vk_descriptor_set_layout *new_unwrapped_descriptor_set_layout = new (new_unwrapped_descriptor_set_layout_base) brx_vk_descriptor_set_layout{};
+	new_unwrapped_descriptor_set_layout->init(1U, &descriptor_set_binding, false, true, &this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
+
+	brx_vk_descriptor_set *new_unwrapped_descriptor_set = static_cast<brx_vk_descriptor_set *>(this->create_descriptor_set(new_unwrapped_descriptor_set_layout));
+
+	void *new_unwrapped_bindless_table_base = brx_malloc(sizeof(brx_vk_bindless_table), alignof(brx_vk_bindless_table));
+	assert(NULL != new_unwrapped_bindless_table_base);
+
+	brx_vk_bindless_table *new_unwrapped_bindless_table = new (new_unwrapped_bindless_table_base) brx_vk_bindless_table{};
+	new_unwrapped_bindless_table->init(descriptor_type, descriptor_count, new_unwrapped_descriptor_set_layout, new_unwrapped_descriptor_set);
+	return new_unwrapped_bindless_table;
+}
+
+brx_descriptor_set_layout const *brx_vk_device::get_bindless_table_descriptor_set_layout(brx_bindless_table const *wrapped_bindless_table) const
+{
+	assert(NULL != wrapped_bindless_table);
+	return static_cast<brx_vk_bindless_table const *>(wrapped_bindless_table)->get_descriptor_set_layout();
+}
+
+brx_descriptor_set const *brx_vk_device::get_bindless_table_descriptor_set(brx_bindless_table const *wrapped_bindless_table) const
+{
+	assert(NULL != wrapped_bindless_table);
+	return static_cast<brx_vk_bindless_table const *>(wrapped_bindless_table)->get_descriptor_set();
+}
+
+uint32_t brx_vk_device::alloc_bindless_descriptor(brx_bindless_table *wrapped_bindless_table, brx_storage_buffer const *src_storage_buffer, brx_sampled_image const *src_sampled_image, brx_sampler const *src_sampler) const
+{
+	assert(NULL != wrapped_bindless_table);
+	brx_vk_bindless_table *const unwrapped_bindless_table = static_cast<brx_vk_bindless_table *>(wrapped_bindless_table);
+
+	uint32_t const descriptor_index = unwrapped_bindless_table->alloc_descriptor_index();
+
+	if (static_cast<uint32_t>(-1) != descriptor_index)
+	{
+		// the descriptor can be written while the descriptor set is bound since the descriptor binding is "update after bind"
+		this->write_descriptor_set(unwrapped_bindless_table->get_descriptor_set(), unwrapped_bindless_table->get_descriptor_type(), 0U, descriptor_index, 1U, NULL, NULL, (NULL != src_storage_buffer) ? &src_storage_buffer : NULL, (NULL != src_sampled_image) ? &src_sampled_image : NULL, (NULL != src_sampler) ? &src_sampler : NULL, NULL, NULL);
+	}
+
+	return descriptor_index;
+}
+
+void brx_vk_device::free_bindless_descriptor(brx_bindless_table *wrapped_bindless_table, uint32_t descriptor_index) const
+{
+	assert(NULL != wrapped_bindless_table);
+	brx_vk_bindless_table *const unwrapped_bindless_table = static_cast<brx_vk_bindless_table *>(wrapped_bindless_table);
+
+	unwrapped_bindless_table->free_descriptor_index(descriptor_index);
+}
+
+void brx_vk_device::destroy_bindless_table(brx_bindless_table *wrapped_bindless_table)
+{
+	assert(NULL != wrapped_bindless_table);
+	brx_vk_bindless_table *delete_unwrapped_bindless_table = static_cast<brx_vk_bindless_table *>(wrapped_bindless_table);
+
+	brx_vk_descriptor_set_layout *stealed_descriptor_set_layout = NULL;
+	brx_vk_descriptor_set *stealed_descriptor_set = NULL;
+	delete_unwrapped_bindless_table->steal(&stealed_descriptor_set_layout, &stealed_descriptor_set);
+
+	delete_unwrapped_bindless_table->~brx_vk_bindless_table();
+	brx_free(delete_unwrapped_bindless_table);
+
+	this->destroy_descriptor_set(stealed_descriptor_set);
+
+	this->destroy_descriptor_set_layout(stealed_descriptor_set_layout);
+}
+
+brx_transient_descriptor_allocator *brx_vk_device::create_transient_descriptor_allocator()
+{
+	void *new_unwrapped_transient_descriptor_allocator_base = brx_malloc(sizeof(brx_vk_transient_descriptor_allocator), alignof(brx_vk_transient_descriptor_allocator));
+	assert(NULL != new_unwrapped_transient_descriptor_allocator_base);
+
+	brx_vk_transient_descriptor_allocator *new_unwrapped_transient_descriptor_allocator = new (new_unwrapped_transient_descriptor_allocator_base) brx_vk_transient_descriptor_allocator{};
+	new_unwrapped_transient_descriptor_allocator->init(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks, this->m_support_ray_tracing);
+	return new_unwrapped_transient_descriptor_allocator;
+}
+
+brx_descriptor_set *brx_vk_device::alloc_transient_descriptor_set(brx_transient_descriptor_allocator *wrapped_transient_descriptor_allocator, brx_descriptor_set_layout const *descriptor_set_layout) const
+{
+	assert(NULL != wrapped_transient_descriptor_allocator);
+	return static_cast<brx_vk_transient_descriptor_allocator *>(wrapped_transient_descriptor_allocator)->alloc_descriptor_set(descriptor_set_layout);
+}
+
+void brx_vk_device::reset_transient_descriptor_allocator(brx_transient_descriptor_allocator *wrapped_transient_descriptor_allocator) const
+{
+	assert(NULL != wrapped_transient_descriptor_allocator);
+	static_cast<brx_vk_transient_descriptor_allocator *>(wrapped_transient_descriptor_allocator)->reset();
+}
+
+void brx_vk_device::destroy_transient_descriptor_allocator(brx_transient_descriptor_allocator *wrapped_transient_descriptor_allocator)
+{
+	assert(NULL != wrapped_transient_descriptor_allocator);
+	brx_vk_transient_descriptor_allocator *delete_unwrapped_transient_descriptor_allocator = static_cast<brx_vk_transient_descriptor_allocator *>(wrapped_transient_descriptor_allocator);
+
+	delete_unwrapped_transient_descriptor_allocator->uninit();
+
+	delete_unwrapped_transient_descriptor_allocator->~brx_vk_transient_descriptor_allocator();
+	brx_free(delete_unwrapped_transient_descriptor_allocator);
+}
+
 brx_render_pass *brx_vk_device::create_render_pass(uint32_t color_attachment_count, BRX_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment) const
 {
 	// NOTE: single subpass is enough
 	// input attachment is NOT necessary
 	// use VK_ARM_rasterization_order_attachment_access (VK_EXT_rasterization_order_attachment_access) instead
 
+	constexpr uint32_t const max_color_attachment_count = 8U;
+
+	// the formats are used to identify the compatible render passes
+	uint32_t new_render_pass_attachment_count = 0U;
+	VkFormat new_render_pass_attachment_formats[max_color_attachment_count + 1U];
+
 	VkRenderPass new_render_pass = VK_NULL_HANDLE;
 	{
 		bool require_subpass_dependency = false;
 
-		PFN_vkCreateRenderPass pfn_create_render_pass = reinterpret_cast<PFN_vkCreateRenderPass>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateRenderPass"));
+		PFN_vkCreateRenderPass pfn_create_render_pass = this->m_dispatch_table.pfn_create_render_pass;
 		assert(NULL != pfn_create_render_pass);
 
-		constexpr uint32_t const max_color_attachment_count = 8U;
 		assert(color_attachment_count < max_color_attachment_count);
 		color_attachment_count = (color_attachment_count < max_color_attachment_count) ? color_attachment_count : max_color_attachment_count;
 
@@ -2450,12 +3588,18 @@ brx_render_pass *brx_vk_device::create_render_pass(uint32_t color_attachment_cou
 
 		VkResult res_create_render_pass = pfn_create_render_pass(this->m_device, &render_pass_create_info, NULL, &new_render_pass);
 		assert(VK_SUCCESS == res_create_render_pass);
+
+		new_render_pass_attachment_count = render_pass_create_info.attachmentCount;
+		for (uint32_t attachment_index = 0U; attachment_index < new_render_pass_attachment_count; ++attachment_index)
+		{
+			new_render_pass_attachment_formats[attachment_index] = attachments_description[attachment_index].format;
+		}
 	}
 
 	void *new_brx_render_pass_base = brx_malloc(sizeof(brx_vk_render_pass), alignof(brx_vk_render_pass));
 	assert(NULL != new_brx_render_pass_base);
 
-	brx_vk_render_pass *new_brx_render_pass = new (new_brx_render_pass_base) brx_vk_render_pass{new_render_pass};
+	brx_vk_render_pass *new_brx_render_pass = new (new_brx_render_pass_base) brx_vk_render_pass{new_render_pass, new_render_pass_attachment_count, new_render_pass_attachment_formats};
 	return new_brx_render_pass;
 }
 
@@ -2470,7 +3614,7 @@ void brx_vk_device::destroy_render_pass(brx_render_pass *brx_render_pass) const
 	delete_render_pass->~brx_vk_render_pass();
 	brx_free(delete_render_pass);
 
-	PFN_vkDestroyRenderPass pfn_destroy_render_pass = reinterpret_cast<PFN_vkDestroyRenderPass>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyRenderPass"));
+	PFN_vkDestroyRenderPass pfn_destroy_render_pass = this->m_dispatch_table.pfn_destroy_render_pass;
 	assert(NULL != pfn_destroy_render_pass);
 
 	pfn_destroy_render_pass(this->m_device, stealed_render_pass, this->m_allocation_callbacks);
@@ -2478,12 +3622,7 @@ void brx_vk_device::destroy_render_pass(brx_render_pass *brx_render_pass) const
 
 brx_graphics_pipeline *brx_vk_device::create_graphics_pipeline(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation) const
 {
-	void *new_unwrapped_graphics_pipeline_base = brx_malloc(sizeof(brx_vk_graphics_pipeline), alignof(brx_vk_graphics_pipeline));
-	assert(NULL != new_unwrapped_graphics_pipeline_base);
-
-	brx_vk_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_vk_graphics_pipeline{};
-	new_unwrapped_graphics_pipeline->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, render_pass, pipeline_layout, vertex_shader_module_code_size, vertex_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, vertex_binding_count, vertex_bindings, vertex_attribute_count, vertex_attributes, depth_enable, depth_compare_operation);
-	return new_unwrapped_graphics_pipeline;
+	return const_cast<brx_vk_pipeline_state_cache *>(&this->m_pipeline_state_cache)->create_graphics_pipeline(render_pass, pipeline_layout, vertex_shader_module_code_size, vertex_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, vertex_binding_count, vertex_bindings, vertex_attribute_count, vertex_attributes, depth_enable, depth_compare_operation);
 }
 
 void brx_vk_device::destroy_graphics_pipeline(brx_graphics_pipeline *wrapped_graphics_pipeline) const
@@ -2491,20 +3630,13 @@ void brx_vk_device::destroy_graphics_pipeline(brx_graphics_pipeline *wrapped_gra
 	assert(NULL != wrapped_graphics_pipeline);
 	brx_vk_graphics_pipeline *delete_unwrapped_graphics_pipeline = static_cast<brx_vk_graphics_pipeline *>(wrapped_graphics_pipeline);
 
-	delete_unwrapped_graphics_pipeline->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
-
-	delete_unwrapped_graphics_pipeline->~brx_vk_graphics_pipeline();
-	brx_free(delete_unwrapped_graphics_pipeline);
+	// the pipeline is not destroyed until the last reference is released
+	const_cast<brx_vk_pipeline_state_cache *>(&this->m_pipeline_state_cache)->destroy_graphics_pipeline(delete_unwrapped_graphics_pipeline);
 }
 
 brx_compute_pipeline *brx_vk_device::create_compute_pipeline(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) const
 {
-	void *new_unwrapped_compute_pipeline_base = brx_malloc(sizeof(brx_vk_compute_pipeline), alignof(brx_vk_compute_pipeline));
-	assert(NULL != new_unwrapped_compute_pipeline_base);
-
-	brx_vk_compute_pipeline *new_unwrapped_compute_pipeline = new (new_unwrapped_compute_pipeline_base) brx_vk_compute_pipeline{};
-	new_unwrapped_compute_pipeline->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, pipeline_layout, compute_shader_module_code_size, compute_shader_module_code);
-	return new_unwrapped_compute_pipeline;
+	return const_cast<brx_vk_pipeline_state_cache *>(&this->m_pipeline_state_cache)->create_compute_pipeline(pipeline_layout, compute_shader_module_code_size, compute_shader_module_code);
 }
 
 void brx_vk_device::destroy_compute_pipeline(brx_compute_pipeline *wrapped_compute_pipeline) const
@@ -2512,10 +3644,105 @@ void brx_vk_device::destroy_compute_pipeline(brx_compute_pipeline *wrapped_compu
 	assert(NULL != wrapped_compute_pipeline);
 	brx_vk_compute_pipeline *delete_unwrapped_compute_pipeline = static_cast<brx_vk_compute_pipeline *>(wrapped_compute_pipeline);
 
-	delete_unwrapped_compute_pipeline->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	// the pipeline is not destroyed until the last reference is released
+	const_cast<brx_vk_pipeline_state_cache *>(&this->m_pipeline_state_cache)->destroy_compute_pipeline(delete_unwrapped_compute_pipeline);
+}
+
+bool brx_vk_device::is_pipeline_specialization_constant_supported() const
+{
+	return true;
+}
+
+brx_graphics_pipeline *brx_vk_device::create_graphics_pipeline_variant(brx_graphics_pipeline const *wrapped_base_graphics_pipeline, brx_render_pass const *wrapped_render_pass, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants) const
+{
+	assert(NULL != wrapped_base_graphics_pipeline);
+	brx_vk_graphics_pipeline const *unwrapped_base_graphics_pipeline = static_cast<brx_vk_graphics_pipeline const *>(wrapped_base_graphics_pipeline);
+
+	return const_cast<brx_vk_pipeline_state_cache *>(&this->m_pipeline_state_cache)->create_graphics_pipeline_variant(unwrapped_base_graphics_pipeline, wrapped_render_pass, specialization_constant_count, specialization_constants);
+}
+
+brx_compute_pipeline *brx_vk_device::create_compute_pipeline_variant(brx_compute_pipeline const *wrapped_base_compute_pipeline, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants) const
+{
+	assert(NULL != wrapped_base_compute_pipeline);
+	brx_vk_compute_pipeline const *unwrapped_base_compute_pipeline = static_cast<brx_vk_compute_pipeline const *>(wrapped_base_compute_pipeline);
+
+	return const_cast<brx_vk_pipeline_state_cache *>(&this->m_pipeline_state_cache)->create_compute_pipeline_variant(unwrapped_base_compute_pipeline, specialization_constant_count, specialization_constants);
+}
+
+brx_graphics_pipeline_compilation *brx_vk_device::create_graphics_pipeline_async(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation)
+{
+	return this->m_pipeline_compiler.create_graphics_pipeline_async(render_pass, pipeline_layout, vertex_shader_module_code_size, vertex_shader_module_code, fragment_shader_module_code_size, fragment_shader_module_code, vertex_binding_count, vertex_bindings, vertex_attribute_count, vertex_attributes, depth_enable, depth_compare_operation);
+}
+
+bool brx_vk_device::is_graphics_pipeline_compilation_completed(brx_graphics_pipeline_compilation const *graphics_pipeline_compilation) const
+{
+	return this->m_pipeline_compiler.is_graphics_pipeline_compilation_completed(graphics_pipeline_compilation);
+}
+
+brx_graphics_pipeline *brx_vk_device::wait_graphics_pipeline_compilation(brx_graphics_pipeline_compilation *graphics_pipeline_compilation)
+{
+	return this->m_pipeline_compiler.wait_graphics_pipeline_compilation(graphics_pipeline_compilation);
+}
+
+brx_compute_pipeline_compilation *brx_vk_device::create_compute_pipeline_async(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code)
+{
+	return this->m_pipeline_compiler.create_compute_pipeline_async(pipeline_layout, compute_shader_module_code_size, compute_shader_module_code);
+}
+
+bool brx_vk_device::is_compute_pipeline_compilation_completed(brx_compute_pipeline_compilation const *compute_pipeline_compilation) const
+{
+	return this->m_pipeline_compiler.is_compute_pipeline_compilation_completed(compute_pipeline_compilation);
+}
+
+brx_compute_pipeline *brx_vk_device::wait_compute_pipeline_compilation(brx_compute_pipeline_compilation *compute_pipeline_compilation)
+{
+	return this->m_pipeline_compiler.wait_compute_pipeline_compilation(compute_pipeline_compilation);
+}
+
+bool brx_vk_device::load_pipeline_cache(size_t pipeline_cache_data_size, void const *pipeline_cache_data)
+{
+	// the data may be read from a file, and thus is not guaranteed to be aligned
+	bool valid_header = false;
+	if ((NULL != pipeline_cache_data) && (pipeline_cache_data_size >= sizeof(VkPipelineCacheHeaderVersionOne)))
+	{
+		VkPipelineCacheHeaderVersionOne pipeline_cache_header;
+		std::memcpy(&pipeline_cache_header, pipeline_cache_data, sizeof(VkPipelineCacheHeaderVersionOne));
+
+		valid_header = (pipeline_cache_header.headerSize >= sizeof(VkPipelineCacheHeaderVersionOne)) && (pipeline_cache_header.headerSize <= pipeline_cache_data_size) && (VK_PIPELINE_CACHE_HEADER_VERSION_ONE == pipeline_cache_header.headerVersion) && (this->m_physical_device_vendor_id == pipeline_cache_header.vendorID) && (this->m_physical_device_device_id == pipeline_cache_header.deviceID) && (0 == std::memcmp(this->m_physical_device_pipeline_cache_uuid, pipeline_cache_header.pipelineCacheUUID, VK_UUID_SIZE));
+	}
+
+	bool loaded = false;
+	if (valid_header)
+	{
+		// the pipelines which have already been created by the device are retained by merging
+		VkPipelineCacheCreateInfo const pipeline_cache_create_info = {
+			VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+			NULL,
+			0U,
+			pipeline_cache_data_size,
+			pipeline_cache_data};
+
+		VkPipelineCache source_pipeline_cache = VK_NULL_HANDLE;
+		VkResult const res_create_pipeline_cache = this->m_dispatch_table.pfn_create_pipeline_cache(this->m_device, &pipeline_cache_create_info, this->m_allocation_callbacks, &source_pipeline_cache);
+		if (VK_SUCCESS == res_create_pipeline_cache)
+		{
+			// the merge is serialized with the pipeline compilations (which may be performed by the worker threads of the pipeline compiler)
+			loaded = this->m_pipeline_state_cache.merge_pipeline_cache(source_pipeline_cache);
+
+			this->m_dispatch_table.pfn_destroy_pipeline_cache(this->m_device, source_pipeline_cache, this->m_allocation_callbacks);
+		}
+	}
 
-	delete_unwrapped_compute_pipeline->~brx_vk_compute_pipeline();
-	brx_free(delete_unwrapped_compute_pipeline);
+	return loaded;
+}
+
+size_t brx_vk_device::store_pipeline_cache(size_t pipeline_cache_data_size, void *pipeline_cache_data) const
+{
+	size_t data_size = (NULL != pipeline_cache_data) ? pipeline_cache_data_size : 0U;
+	VkResult const res_get_pipeline_cache_data = const_cast<brx_vk_pipeline_state_cache *>(&this->m_pipeline_state_cache)->get_pipeline_cache_data(&data_size, pipeline_cache_data);
+	// the "VK_INCOMPLETE" means that the "pipeline_cache_data_size" is too small, and no data is written
+	assert(VK_SUCCESS == res_get_pipeline_cache_data || VK_INCOMPLETE == res_get_pipeline_cache_data);
+	return (VK_SUCCESS == res_get_pipeline_cache_data) ? data_size : 0U;
 }
 
 brx_frame_buffer *brx_vk_device::create_frame_buffer(brx_render_pass const *brx_render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_color_attachment_image const *const *color_attachments, brx_depth_stencil_attachment_image const *depth_stencil_attachment) const
@@ -2525,7 +3752,7 @@ brx_frame_buffer *brx_vk_device::create_frame_buffer(brx_render_pass const *brx_
 
 	VkFramebuffer new_frame_buffer = VK_NULL_HANDLE;
 	{
-		PFN_vkCreateFramebuffer pfn_create_frame_buffer = reinterpret_cast<PFN_vkCreateFramebuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateFramebuffer"));
+		PFN_vkCreateFramebuffer pfn_create_frame_buffer = this->m_dispatch_table.pfn_create_frame_buffer;
 
 		constexpr uint32_t const max_color_attachment_count = 8U;
 		assert(color_attachment_count < max_color_attachment_count);
@@ -2578,7 +3805,7 @@ void brx_vk_device::destroy_frame_buffer(brx_frame_buffer *brx_frame_buffer) con
 	delete_frame_buffer->~brx_vk_frame_buffer();
 	brx_free(delete_frame_buffer);
 
-	PFN_vkDestroyFramebuffer pfn_destroy_framebuffer = reinterpret_cast<PFN_vkDestroyFramebuffer>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyFramebuffer"));
+	PFN_vkDestroyFramebuffer pfn_destroy_framebuffer = this->m_dispatch_table.pfn_destroy_frame_buffer;
 	assert(NULL != pfn_destroy_framebuffer);
 
 	pfn_destroy_framebuffer(this->m_device, stealed_frame_buffer, this->m_allocation_callbacks);
@@ -2605,6 +3832,45 @@ void brx_vk_device::destroy_uniform_upload_buffer(brx_uniform_upload_buffer *wra
 	brx_free(delete_unwrapped_uniform_upload_buffer);
 }
 
+brx_uniform_upload_ring *brx_vk_device::create_uniform_upload_ring(uint32_t frame_count, uint32_t frame_size)
+{
+	void *new_uniform_upload_ring_base = brx_malloc(sizeof(brx_uniform_upload_ring_allocator), alignof(brx_uniform_upload_ring_allocator));
+	assert(NULL != new_uniform_upload_ring_base);
+
+	brx_uniform_upload_ring_allocator *new_uniform_upload_ring = new (new_uniform_upload_ring_base) brx_uniform_upload_ring_allocator{};
+	new_uniform_upload_ring->init(this, this->m_min_uniform_buffer_offset_alignment, frame_count, frame_size);
+	return new_uniform_upload_ring;
+}
+
+brx_uniform_upload_buffer const *brx_vk_device::get_uniform_upload_ring_buffer(brx_uniform_upload_ring const *uniform_upload_ring) const
+{
+	assert(NULL != uniform_upload_ring);
+	return static_cast<brx_uniform_upload_ring_allocator const *>(uniform_upload_ring)->get_uniform_upload_buffer();
+}
+
+void brx_vk_device::begin_uniform_upload_ring_frame(brx_uniform_upload_ring *uniform_upload_ring, uint32_t frame_index) const
+{
+	assert(NULL != uniform_upload_ring);
+	static_cast<brx_uniform_upload_ring_allocator *>(uniform_upload_ring)->begin_frame(frame_index);
+}
+
+void *brx_vk_device::alloc_uniform_upload_ring_range(brx_uniform_upload_ring *uniform_upload_ring, uint32_t size, uint32_t *out_dynamic_offset) const
+{
+	assert(NULL != uniform_upload_ring);
+	return static_cast<brx_uniform_upload_ring_allocator *>(uniform_upload_ring)->alloc(size, out_dynamic_offset);
+}
+
+void brx_vk_device::destroy_uniform_upload_ring(brx_uniform_upload_ring *uniform_upload_ring)
+{
+	assert(NULL != uniform_upload_ring);
+	brx_uniform_upload_ring_allocator *delete_uniform_upload_ring = static_cast<brx_uniform_upload_ring_allocator *>(uniform_upload_ring);
+
+	delete_uniform_upload_ring->uninit(this);
+
+	delete_uniform_upload_ring->~brx_uniform_upload_ring_allocator();
+	brx_free(delete_uniform_upload_ring);
+}
+
 uint32_t brx_vk_device::get_staging_upload_buffer_offset_alignment() const
 {
 	return this->m_optimal_buffer_copy_offset_alignment;
@@ -2636,13 +3902,43 @@ void brx_vk_device::destroy_staging_upload_buffer(brx_staging_upload_buffer *wra
 	brx_free(delete_unwrapped_staging_upload_buffer);
 }
 
-brx_intermediate_storage_buffer *brx_vk_device::create_intermediate_storage_buffer(uint32_t size, bool allow_vertex_position, bool allow_vertex_varying) const
+brx_staging_upload_ring *brx_vk_device::create_staging_upload_ring(uint32_t initial_size)
+{
+	return this->m_staging_upload_ring_manager.create_staging_upload_ring(initial_size);
+}
+
+void *brx_vk_device::alloc_staging_upload_ring_range(brx_staging_upload_ring *staging_upload_ring, uint32_t size, brx_staging_upload_buffer **out_staging_upload_buffer, uint64_t *out_offset)
+{
+	return this->m_staging_upload_ring_manager.alloc_staging_upload_ring_range(staging_upload_ring, size, out_staging_upload_buffer, out_offset);
+}
+
+void brx_vk_device::submit_staging_upload_ring(brx_staging_upload_ring *staging_upload_ring, brx_fence const *fence)
+{
+	this->m_staging_upload_ring_manager.submit_staging_upload_ring(staging_upload_ring, fence);
+}
+
+void brx_vk_device::submit_staging_upload_ring_timeline_fence(brx_staging_upload_ring *staging_upload_ring, brx_timeline_fence const *timeline_fence, uint64_t value)
+{
+	this->m_staging_upload_ring_manager.submit_staging_upload_ring(staging_upload_ring, timeline_fence, value);
+}
+
+BRX_STAGING_UPLOAD_RING_STATISTICS brx_vk_device::get_staging_upload_ring_statistics(brx_staging_upload_ring const *staging_upload_ring)
+{
+	return this->m_staging_upload_ring_manager.get_staging_upload_ring_statistics(staging_upload_ring);
+}
+
+void brx_vk_device::destroy_staging_upload_ring(brx_staging_upload_ring *staging_upload_ring)
+{
+	this->m_staging_upload_ring_manager.destroy_staging_upload_ring(staging_upload_ring);
+}
+
+brx_intermediate_storage_buffer *brx_vk_device::create_intermediate_storage_buffer(uint32_t size, bool allow_vertex_position, bool allow_vertex_varying, bool allow_indirect_argument) const
 {
 	void *new_unwrapped_intermediate_storage_buffer_base = brx_malloc(sizeof(brx_vk_intermediate_storage_buffer), alignof(brx_vk_intermediate_storage_buffer));
 	assert(NULL != new_unwrapped_intermediate_storage_buffer_base);
 
 	brx_vk_intermediate_storage_buffer *new_unwrapped_intermediate_storage_buffer = new (new_unwrapped_intermediate_storage_buffer_base) brx_vk_intermediate_storage_buffer{};
-	new_unwrapped_intermediate_storage_buffer->init(this->m_support_ray_tracing, this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->m_storage_buffer_memory_pool, size, allow_vertex_position, allow_vertex_varying);
+	new_unwrapped_intermediate_storage_buffer->init(this->m_support_ray_tracing, this->m_device, this->m_dispatch_table.pfn_get_buffer_device_address, this->m_memory_allocator, this->m_storage_buffer_memory_pool, size, allow_vertex_position, allow_vertex_varying, allow_indirect_argument);
 	return new_unwrapped_intermediate_storage_buffer;
 }
 
@@ -2663,7 +3959,7 @@ brx_asset_vertex_position_buffer *brx_vk_device::create_asset_vertex_position_bu
 	assert(NULL != new_unwrapped_asset_vertex_position_buffer_base);
 
 	brx_vk_asset_vertex_position_buffer *new_unwrapped_asset_vertex_position_buffer = new (new_unwrapped_asset_vertex_position_buffer_base) brx_vk_asset_vertex_position_buffer{};
-	new_unwrapped_asset_vertex_position_buffer->init(this->m_support_ray_tracing, this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->m_asset_vertex_position_buffer_memory_pool, size);
+	new_unwrapped_asset_vertex_position_buffer->init(this->m_support_ray_tracing, this->m_device, this->m_dispatch_table.pfn_get_buffer_device_address, this->m_memory_allocator, this->m_asset_vertex_position_buffer_memory_pool, size);
 	return new_unwrapped_asset_vertex_position_buffer;
 }
 
@@ -2705,7 +4001,7 @@ brx_asset_index_buffer *brx_vk_device::create_asset_index_buffer(uint32_t size)
 	assert(NULL != new_unwrapped_asset_index_buffer_base);
 
 	brx_vk_asset_index_buffer *new_unwrapped_asset_index_buffer = new (new_unwrapped_asset_index_buffer_base) brx_vk_asset_index_buffer{};
-	new_unwrapped_asset_index_buffer->init(this->m_support_ray_tracing, this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->m_asset_index_buffer_memory_pool, size);
+	new_unwrapped_asset_index_buffer->init(this->m_support_ray_tracing, this->m_device, this->m_dispatch_table.pfn_get_buffer_device_address, this->m_memory_allocator, this->m_asset_index_buffer_memory_pool, size);
 	return new_unwrapped_asset_index_buffer;
 }
 
@@ -2720,13 +4016,46 @@ void brx_vk_device::destroy_asset_index_buffer(brx_asset_index_buffer *wrapped_a
 	brx_free(delete_unwrapped_asset_index_buffer);
 }
 
+brx_asset_buffer_sub_allocator *brx_vk_device::create_asset_buffer_sub_allocator(uint64_t size, uint32_t alignment) const
+{
+	void *new_asset_buffer_sub_allocator_base = brx_malloc(sizeof(brx_asset_buffer_sub_allocator_instance), alignof(brx_asset_buffer_sub_allocator_instance));
+	assert(NULL != new_asset_buffer_sub_allocator_base);
+
+	brx_asset_buffer_sub_allocator_instance *new_asset_buffer_sub_allocator = new (new_asset_buffer_sub_allocator_base) brx_asset_buffer_sub_allocator_instance{};
+	new_asset_buffer_sub_allocator->init(size, alignment);
+	return new_asset_buffer_sub_allocator;
+}
+
+bool brx_vk_device::alloc_asset_buffer_range(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator, uint32_t size, uint64_t *out_offset) const
+{
+	assert(NULL != asset_buffer_sub_allocator);
+	return static_cast<brx_asset_buffer_sub_allocator_instance *>(asset_buffer_sub_allocator)->alloc(size, out_offset);
+}
+
+void brx_vk_device::free_asset_buffer_range(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator, uint64_t offset) const
+{
+	assert(NULL != asset_buffer_sub_allocator);
+	static_cast<brx_asset_buffer_sub_allocator_instance *>(asset_buffer_sub_allocator)->free(offset);
+}
+
+void brx_vk_device::destroy_asset_buffer_sub_allocator(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator) const
+{
+	assert(NULL != asset_buffer_sub_allocator);
+	brx_asset_buffer_sub_allocator_instance *delete_asset_buffer_sub_allocator = static_cast<brx_asset_buffer_sub_allocator_instance *>(asset_buffer_sub_allocator);
+
+	delete_asset_buffer_sub_allocator->uninit();
+
+	delete_asset_buffer_sub_allocator->~brx_asset_buffer_sub_allocator_instance();
+	brx_free(delete_asset_buffer_sub_allocator);
+}
+
 brx_color_attachment_image *brx_vk_device::create_color_attachment_image(BRX_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const
 {
 	void *new_unwrapped_color_attachment_image_base = brx_malloc(sizeof(brx_vk_intermediate_color_attachment_image), alignof(brx_vk_intermediate_color_attachment_image));
 	assert(NULL != new_unwrapped_color_attachment_image_base);
 
 	brx_vk_intermediate_color_attachment_image *new_unwrapped_color_attachment_image = new (new_unwrapped_color_attachment_image_base) brx_vk_intermediate_color_attachment_image{};
-	new_unwrapped_color_attachment_image->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, this->m_color_transient_attachment_image_memory_index, this->m_color_attachment_sampled_image_memory_index, wrapped_color_attachment_image_format, width, height, allow_sampled_image);
+	new_unwrapped_color_attachment_image->init(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks, this->m_color_transient_attachment_image_memory_index, this->m_color_attachment_sampled_image_memory_index, wrapped_color_attachment_image_format, width, height, allow_sampled_image);
 	return new_unwrapped_color_attachment_image;
 }
 
@@ -2735,7 +4064,7 @@ void brx_vk_device::destroy_color_attachment_image(brx_color_attachment_image *w
 	assert(NULL != wrapped_color_attachment_image);
 	brx_vk_intermediate_color_attachment_image *delete_unwrapped_color_attachment_image = static_cast<brx_vk_intermediate_color_attachment_image *>(wrapped_color_attachment_image);
 
-	delete_unwrapped_color_attachment_image->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	delete_unwrapped_color_attachment_image->uninit(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
 
 	delete_unwrapped_color_attachment_image->~brx_vk_intermediate_color_attachment_image();
 	brx_free(delete_unwrapped_color_attachment_image);
@@ -2787,7 +4116,7 @@ brx_depth_stencil_attachment_image *brx_vk_device::create_depth_stencil_attachme
 	assert(NULL != new_unwrapped_depth_stencil_attachment_image_base);
 
 	brx_vk_intermediate_depth_stencil_attachment_image *new_unwrapped_depth_stencil_attachment_image = new (new_unwrapped_depth_stencil_attachment_image_base) brx_vk_intermediate_depth_stencil_attachment_image{};
-	new_unwrapped_depth_stencil_attachment_image->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, this->m_depth_transient_attachment_image_memory_index, this->m_depth_attachment_sampled_image_memory_index, this->m_depth_stencil_transient_attachment_image_memory_index, this->m_depth_stencil_attachment_sampled_image_memory_index, wrapped_depth_stencil_attachment_image_format, width, height, allow_sampled_image);
+	new_unwrapped_depth_stencil_attachment_image->init(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks, this->m_depth_transient_attachment_image_memory_index, this->m_depth_attachment_sampled_image_memory_index, this->m_depth_stencil_transient_attachment_image_memory_index, this->m_depth_stencil_attachment_sampled_image_memory_index, wrapped_depth_stencil_attachment_image_format, width, height, allow_sampled_image);
 	return new_unwrapped_depth_stencil_attachment_image;
 }
 
@@ -2796,7 +4125,7 @@ void brx_vk_device::destroy_depth_stencil_attachment_image(brx_depth_stencil_att
 	assert(NULL != wrapped_depth_stencil_attachment_image);
 	brx_vk_intermediate_depth_stencil_attachment_image *delete_unwrapped_depth_stencil_attachment_image = static_cast<brx_vk_intermediate_depth_stencil_attachment_image *>(wrapped_depth_stencil_attachment_image);
 
-	delete_unwrapped_depth_stencil_attachment_image->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	delete_unwrapped_depth_stencil_attachment_image->uninit(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
 
 	delete_unwrapped_depth_stencil_attachment_image->~brx_vk_intermediate_depth_stencil_attachment_image();
 	brx_free(delete_unwrapped_depth_stencil_attachment_image);
@@ -2825,7 +4154,7 @@ brx_storage_image *brx_vk_device::create_storage_image(BRX_STORAGE_IMAGE_FORMAT
 	assert(NULL != new_unwrapped_storage_image_base);
 
 	brx_vk_intermediate_storage_image *new_unwrapped_storage_image = new (new_unwrapped_storage_image_base) brx_vk_intermediate_storage_image{};
-	new_unwrapped_storage_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->m_storage_image_memory_pool, unwrapped_storage_image_format, width, height, allow_sampled_image);
+	new_unwrapped_storage_image->init(this->m_device, this->m_dispatch_table.pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->m_storage_image_memory_pool, unwrapped_storage_image_format, width, height, allow_sampled_image);
 	return new_unwrapped_storage_image;
 }
 
@@ -2834,7 +4163,7 @@ void brx_vk_device::destroy_storage_image(brx_storage_image *wrapped_storage_ima
 	assert(NULL != wrapped_storage_image);
 	brx_vk_intermediate_storage_image *delete_unwrapped_storage_image = static_cast<brx_vk_intermediate_storage_image *>(wrapped_storage_image);
 
-	delete_unwrapped_storage_image->uninit(this->m_device, this->m_pfn_destroy_image_view, this->m_allocation_callbacks, this->m_memory_allocator);
+	delete_unwrapped_storage_image->uninit(this->m_device, this->m_dispatch_table.pfn_destroy_image_view, this->m_allocation_callbacks, this->m_memory_allocator);
 
 	delete_unwrapped_storage_image->~brx_vk_intermediate_storage_image();
 	brx_free(delete_unwrapped_storage_image);
@@ -2850,6 +4179,11 @@ bool brx_vk_device::is_asset_sampled_image_compression_astc_supported() const
 	return this->m_physical_device_feature_texture_compression_ASTC_LDR;
 }
 
+bool brx_vk_device::is_indirect_argument_count_supported() const
+{
+	return this->m_physical_device_extension_draw_indirect_count;
+}
+
 brx_asset_sampled_image *brx_vk_device::create_asset_sampled_image(BRX_ASSET_IMAGE_FORMAT wrapped_asset_sampled_image_format, uint32_t width, uint32_t height, uint32_t mip_levels) const
 {
 	VkFormat unwrapped_asset_sampled_image_format;
@@ -2874,7 +4208,7 @@ brx_asset_sampled_image *brx_vk_device::create_asset_sampled_image(BRX_ASSET_IMA
 
 	brx_vk_asset_sampled_image *new_brx_asset_sampled_image = new (new_brx_asset_sampled_image_base) brx_vk_asset_sampled_image{};
 
-	new_brx_asset_sampled_image->init(this->m_device, this->m_pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->m_asset_sampled_image_memory_pool, unwrapped_asset_sampled_image_format, width, height, mip_levels);
+	new_brx_asset_sampled_image->init(this->m_device, this->m_dispatch_table.pfn_create_image_view, this->m_allocation_callbacks, this->m_memory_allocator, this->m_asset_sampled_image_memory_pool, unwrapped_asset_sampled_image_format, width, height, mip_levels);
 
 	return new_brx_asset_sampled_image;
 }
@@ -2884,7 +4218,7 @@ void brx_vk_device::destroy_asset_sampled_image(brx_asset_sampled_image *wrapped
 	assert(NULL != wrapped_asset_sampled_image);
 	brx_vk_asset_sampled_image *delete_unwrapped_asset_sampled_image = static_cast<brx_vk_asset_sampled_image *>(wrapped_asset_sampled_image);
 
-	delete_unwrapped_asset_sampled_image->uninit(this->m_device, this->m_pfn_destroy_image_view, this->m_allocation_callbacks, this->m_memory_allocator);
+	delete_unwrapped_asset_sampled_image->uninit(this->m_device, this->m_dispatch_table.pfn_destroy_image_view, this->m_allocation_callbacks, this->m_memory_allocator);
 
 	delete_unwrapped_asset_sampled_image->~brx_vk_asset_sampled_image();
 	brx_free(delete_unwrapped_asset_sampled_image);
@@ -2912,7 +4246,7 @@ brx_sampler *brx_vk_device::create_sampler(BRX_SAMPLER_FILTER wrapped_filter) co
 
 	VkSampler new_sampler = VK_NULL_HANDLE;
 	{
-		PFN_vkCreateSampler pfn_create_sampler = reinterpret_cast<PFN_vkCreateSampler>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateSampler"));
+		PFN_vkCreateSampler pfn_create_sampler = this->m_dispatch_table.pfn_create_sampler;
 		assert(NULL != pfn_create_sampler);
 
 		VkSamplerCreateInfo sampler_create_info;
@@ -2956,7 +4290,7 @@ void brx_vk_device::destroy_sampler(brx_sampler *brx_sampler) const
 	delete_sampler->~brx_vk_sampler();
 	brx_free(delete_sampler);
 
-	PFN_vkDestroySampler pfn_destroy_sampler = reinterpret_cast<PFN_vkDestroySampler>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroySampler"));
+	PFN_vkDestroySampler pfn_destroy_sampler = this->m_dispatch_table.pfn_destroy_sampler;
 	assert(NULL != pfn_destroy_sampler);
 
 	pfn_destroy_sampler(this->m_device, stealed_sampler, this->m_allocation_callbacks);
@@ -2996,6 +4330,10 @@ brx_surface *brx_vk_device::create_surface(void *window_void) const
 		VkResult res_create_win32_surface = pfn_create_win32_surface(this->m_instance, &win32_surface_create_info, this->m_allocation_callbacks, &new_surface);
 		assert(VK_SUCCESS == res_create_win32_surface);
 	}
+#elif defined(__GNUC__) && defined(__linux__)
+	// headless
+	assert(false);
+	return NULL;
 #else
 #error Unknown Platform
 #endif
@@ -3135,7 +4473,7 @@ brx_swap_chain *brx_vk_device::create_swap_chain(brx_surface *brx_surface) const
 
 	// Create Swap Chain
 	{
-		PFN_vkCreateSwapchainKHR pfn_create_swap_chain = reinterpret_cast<PFN_vkCreateSwapchainKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateSwapchainKHR"));
+		PFN_vkCreateSwapchainKHR pfn_create_swap_chain = this->m_dispatch_table.pfn_create_swap_chain;
 		assert(NULL != pfn_create_swap_chain);
 
 		VkSwapchainCreateInfoKHR swap_chain_create_info = {
@@ -3168,7 +4506,7 @@ brx_swap_chain *brx_vk_device::create_swap_chain(brx_surface *brx_surface) const
 	uint32_t new_swap_chain_image_count = static_cast<uint32_t>(-1);
 	VkImage *new_swap_chain_images = NULL;
 	{
-		PFN_vkGetSwapchainImagesKHR pfn_get_swap_chain_images = reinterpret_cast<PFN_vkGetSwapchainImagesKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetSwapchainImagesKHR"));
+		PFN_vkGetSwapchainImagesKHR pfn_get_swap_chain_images = this->m_dispatch_table.pfn_get_swap_chain_images;
 		assert(NULL != pfn_get_swap_chain_images);
 
 		uint32_t swap_chain_image_count_1 = uint32_t(-1);
@@ -3191,7 +4529,7 @@ brx_swap_chain *brx_vk_device::create_swap_chain(brx_surface *brx_surface) const
 	{
 		new_swap_chain_image_views = static_cast<brx_vk_swap_chain_image_view *>(brx_malloc(sizeof(brx_vk_swap_chain_image_view) * new_swap_chain_image_count, alignof(brx_vk_swap_chain_image_view)));
 
-		PFN_vkCreateImageView pfn_create_image_view = reinterpret_cast<PFN_vkCreateImageView>(this->m_pfn_get_device_proc_addr(this->m_device, "vkCreateImageView"));
+		PFN_vkCreateImageView pfn_create_image_view = this->m_dispatch_table.pfn_create_image_view;
 		assert(NULL != pfn_create_image_view);
 
 		for (uint32_t swap_chain_image_index = 0U; swap_chain_image_index < new_swap_chain_image_count; ++swap_chain_image_index)
@@ -3235,7 +4573,7 @@ bool brx_vk_device::acquire_next_image(brx_graphics_command_buffer *brx_graphics
 	VkSemaphore acquire_next_image_semaphore = static_cast<brx_vk_graphics_command_buffer const *>(brx_graphics_command_buffer)->get_acquire_next_image_semaphore();
 	VkSwapchainKHR swap_chain = static_cast<brx_vk_swap_chain const *>(brx_swap_chain)->get_swap_chain();
 
-	VkResult res_acquire_next_image = this->m_pfn_acquire_next_image(this->m_device, swap_chain, UINT64_MAX, acquire_next_image_semaphore, VK_NULL_HANDLE, out_swap_chain_image_index);
+	VkResult res_acquire_next_image = this->m_dispatch_table.pfn_acquire_next_image(this->m_device, swap_chain, UINT64_MAX, acquire_next_image_semaphore, VK_NULL_HANDLE, out_swap_chain_image_index);
 	switch (res_acquire_next_image)
 	{
 	case VK_SUCCESS:
@@ -3264,9 +4602,9 @@ void brx_vk_device::destroy_swap_chain(brx_swap_chain *brx_swap_chain) const
 	delete_swap_chain->~brx_vk_swap_chain();
 	brx_free(delete_swap_chain);
 
-	PFN_vkDestroyImageView pfn_destroy_image_view = reinterpret_cast<PFN_vkDestroyImageView>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroyImageView"));
+	PFN_vkDestroyImageView pfn_destroy_image_view = this->m_dispatch_table.pfn_destroy_image_view;
 	assert(NULL != pfn_destroy_image_view);
-	PFN_vkDestroySwapchainKHR pfn_destroy_swapchain = reinterpret_cast<PFN_vkDestroySwapchainKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkDestroySwapchainKHR"));
+	PFN_vkDestroySwapchainKHR pfn_destroy_swapchain = this->m_dispatch_table.pfn_destroy_swap_chain;
 	assert(NULL != pfn_destroy_swapchain);
 
 	for (uint32_t swap_chain_image_index = 0U; swap_chain_image_index < stealed_swap_chain_image_count; ++swap_chain_image_index)
@@ -3282,13 +4620,82 @@ void brx_vk_device::destroy_swap_chain(brx_swap_chain *brx_swap_chain) const
 	pfn_destroy_swapchain(this->m_device, stealed_swap_chain, this->m_allocation_callbacks);
 }
 
+brx_timestamp_query_pool *brx_vk_device::create_timestamp_query_pool(uint32_t query_count) const
+{
+	void *new_unwrapped_timestamp_query_pool_base = brx_malloc(sizeof(brx_vk_timestamp_query_pool), alignof(brx_vk_timestamp_query_pool));
+	assert(NULL != new_unwrapped_timestamp_query_pool_base);
+
+	brx_vk_timestamp_query_pool *new_unwrapped_timestamp_query_pool = new (new_unwrapped_timestamp_query_pool_base) brx_vk_timestamp_query_pool{};
+	new_unwrapped_timestamp_query_pool->init(query_count, &this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
+	return new_unwrapped_timestamp_query_pool;
+}
+
+double brx_vk_device::get_timestamp_period() const
+{
+	return this->m_timestamp_period;
+}
+
+bool brx_vk_device::is_upload_command_buffer_timestamp_supported() const
+{
+	return this->m_upload_queue_family_support_timestamp;
+}
+
+bool brx_vk_device::get_timestamp_query_pool_results(brx_timestamp_query_pool const *wrapped_timestamp_query_pool, uint32_t first_query, uint32_t query_count, uint64_t *out_timestamps) const
+{
+	assert(NULL != wrapped_timestamp_query_pool);
+	brx_vk_timestamp_query_pool const *const unwrapped_timestamp_query_pool = static_cast<brx_vk_timestamp_query_pool const *>(wrapped_timestamp_query_pool);
+
+	assert(first_query <= unwrapped_timestamp_query_pool->get_query_count());
+	assert(query_count <= (unwrapped_timestamp_query_pool->get_query_count() - first_query));
+
+	if (query_count > 0U)
+	{
+		// without the "VK_QUERY_RESULT_WAIT_BIT", the "VK_NOT_READY" is returned immediately when any of the queries is NOT available
+		VkResult const res_get_query_pool_results = this->m_dispatch_table.pfn_get_query_pool_results(this->m_device, unwrapped_timestamp_query_pool->get_query_pool(), first_query, query_count, sizeof(uint64_t) * query_count, out_timestamps, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+		assert(VK_SUCCESS == res_get_query_pool_results || VK_NOT_READY == res_get_query_pool_results);
+
+		return (VK_SUCCESS == res_get_query_pool_results);
+	}
+	else
+	{
+		return true;
+	}
+}
+
+bool brx_vk_device::get_timestamp_query_pool_label_timings(brx_timestamp_query_pool *wrapped_timestamp_query_pool, uint32_t *out_label_timing_count, BRX_TIMESTAMP_LABEL_TIMING const **out_label_timings) const
+{
+	assert(NULL != wrapped_timestamp_query_pool);
+	brx_timestamp_query_label_list *const label_list = static_cast<brx_vk_timestamp_query_pool *>(wrapped_timestamp_query_pool)->get_label_list();
+
+	if (this->get_timestamp_query_pool_results(wrapped_timestamp_query_pool, 0U, label_list->get_used_query_count(), label_list->get_timestamps()))
+	{
+		label_list->resolve(this->m_timestamp_period, out_label_timing_count, out_label_timings);
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+void brx_vk_device::destroy_timestamp_query_pool(brx_timestamp_query_pool *wrapped_timestamp_query_pool) const
+{
+	assert(NULL != wrapped_timestamp_query_pool);
+	brx_vk_timestamp_query_pool *delete_unwrapped_timestamp_query_pool = static_cast<brx_vk_timestamp_query_pool *>(wrapped_timestamp_query_pool);
+
+	delete_unwrapped_timestamp_query_pool->uninit(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
+
+	delete_unwrapped_timestamp_query_pool->~brx_vk_timestamp_query_pool();
+	brx_free(delete_unwrapped_timestamp_query_pool);
+}
+
 brx_scratch_buffer *brx_vk_device::create_scratch_buffer(uint32_t size) const
 {
 	void *new_unwrapped_scratch_buffer_base = brx_malloc(sizeof(brx_vk_scratch_buffer), alignof(brx_vk_scratch_buffer));
 	assert(NULL != new_unwrapped_scratch_buffer_base);
 
 	brx_vk_scratch_buffer *new_unwrapped_scratch_buffer = new (new_unwrapped_scratch_buffer_base) brx_vk_scratch_buffer{};
-	new_unwrapped_scratch_buffer->init(this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->m_scratch_buffer_memory_pool, size);
+	new_unwrapped_scratch_buffer->init(this->m_device, this->m_dispatch_table.pfn_get_buffer_device_address, this->m_memory_allocator, this->m_scratch_buffer_memory_pool, size);
 	return new_unwrapped_scratch_buffer;
 }
 
@@ -3309,7 +4716,7 @@ void brx_vk_device::get_staging_non_compacted_bottom_level_acceleration_structur
 	assert(NULL != staging_non_compacted_bottom_level_acceleration_structure_size);
 	assert(NULL != build_scratch_size);
 
-	PFN_vkGetAccelerationStructureBuildSizesKHR pfn_get_acceleration_structure_build_sizes = reinterpret_cast<PFN_vkGetAccelerationStructureBuildSizesKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetAccelerationStructureBuildSizesKHR"));
+	PFN_vkGetAccelerationStructureBuildSizesKHR pfn_get_acceleration_structure_build_sizes = this->m_dispatch_table.pfn_get_acceleration_structure_build_sizes;
 	assert(NULL != pfn_get_acceleration_structure_build_sizes);
 
 	brx_vector<VkAccelerationStructureGeometryKHR> acceleration_structure_geometries;
@@ -3412,7 +4819,7 @@ brx_staging_non_compacted_bottom_level_acceleration_structure *brx_vk_device::cr
 	assert(NULL != new_unwrapped_staging_non_compacted_bottom_level_acceleration_structure_base);
 
 	brx_vk_staging_non_compacted_bottom_level_acceleration_structure *new_unwrapped_staging_non_compacted_bottom_level_acceleration_structure = new (new_unwrapped_staging_non_compacted_bottom_level_acceleration_structure_base) brx_vk_staging_non_compacted_bottom_level_acceleration_structure{};
-	new_unwrapped_staging_non_compacted_bottom_level_acceleration_structure->init(this->m_memory_allocator, this->m_staging_non_compacted_bottom_level_acceleration_structure_memory_pool, size, this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	new_unwrapped_staging_non_compacted_bottom_level_acceleration_structure->init(this->m_memory_allocator, this->m_staging_non_compacted_bottom_level_acceleration_structure_memory_pool, size, &this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
 	return new_unwrapped_staging_non_compacted_bottom_level_acceleration_structure;
 }
 
@@ -3421,7 +4828,7 @@ void brx_vk_device::destroy_staging_non_compacted_bottom_level_acceleration_stru
 	assert(NULL != wrapped_staging_non_compacted_bottom_level_acceleration_structure);
 	brx_vk_staging_non_compacted_bottom_level_acceleration_structure *delete_unwrapped_staging_non_compacted_bottom_level_acceleration_structure = static_cast<brx_vk_staging_non_compacted_bottom_level_acceleration_structure *>(wrapped_staging_non_compacted_bottom_level_acceleration_structure);
 
-	delete_unwrapped_staging_non_compacted_bottom_level_acceleration_structure->uninit(this->m_memory_allocator, this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	delete_unwrapped_staging_non_compacted_bottom_level_acceleration_structure->uninit(this->m_memory_allocator, &this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
 
 	delete_unwrapped_staging_non_compacted_bottom_level_acceleration_structure->~brx_vk_staging_non_compacted_bottom_level_acceleration_structure();
 	brx_free(delete_unwrapped_staging_non_compacted_bottom_level_acceleration_structure);
@@ -3433,7 +4840,7 @@ brx_compacted_bottom_level_acceleration_structure_size_query_pool *brx_vk_device
 	assert(NULL != new_unwrapped_compacted_bottom_level_acceleration_structure_size_query_pool_base);
 
 	brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool *new_unwrapped_compacted_bottom_level_acceleration_structure_size_query_pool = new (new_unwrapped_compacted_bottom_level_acceleration_structure_size_query_pool_base) brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool{};
-	new_unwrapped_compacted_bottom_level_acceleration_structure_size_query_pool->init(query_count, this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	new_unwrapped_compacted_bottom_level_acceleration_structure_size_query_pool->init(query_count, &this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
 	return new_unwrapped_compacted_bottom_level_acceleration_structure_size_query_pool;
 }
 
@@ -3446,7 +4853,7 @@ uint32_t brx_vk_device::get_compacted_bottom_level_acceleration_structure_size_q
 
 	VkDeviceSize compacted_bottom_level_acceleration_structure_size = static_cast<VkDeviceSize>(-1);
 	VkResult res_get_query_pool_results;
-	while (VK_NOT_READY == (res_get_query_pool_results = this->m_pfn_get_query_pool_results(this->m_device, query_pool, query_index, 1U, sizeof(VkDeviceSize), &compacted_bottom_level_acceleration_structure_size, sizeof(VkDeviceSize), 0U)))
+	while (VK_NOT_READY == (res_get_query_pool_results = this->m_dispatch_table.pfn_get_query_pool_results(this->m_device, query_pool, query_index, 1U, sizeof(VkDeviceSize), &compacted_bottom_level_acceleration_structure_size, sizeof(VkDeviceSize), 0U)))
 	{
 		brx_pause();
 	}
@@ -3460,7 +4867,7 @@ void brx_vk_device::destroy_compacted_bottom_level_acceleration_structure_size_q
 	assert(NULL != wrapped_compacted_bottom_level_acceleration_structure_size_query_pool);
 	brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool *delete_unwrapped_compacted_bottom_level_acceleration_structure_size_query_pool = static_cast<brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool *>(wrapped_compacted_bottom_level_acceleration_structure_size_query_pool);
 
-	delete_unwrapped_compacted_bottom_level_acceleration_structure_size_query_pool->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks);
+	delete_unwrapped_compacted_bottom_level_acceleration_structure_size_query_pool->uninit(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
 
 	delete_unwrapped_compacted_bottom_level_acceleration_structure_size_query_pool->~brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool();
 	brx_free(delete_unwrapped_compacted_bottom_level_acceleration_structure_size_query_pool);
@@ -3472,7 +4879,7 @@ brx_asset_compacted_bottom_level_acceleration_structure *brx_vk_device::create_a
 	assert(NULL != new_unwrapped_asset_compacted_bottom_level_acceleration_structure_base);
 
 	brx_vk_asset_compacted_bottom_level_acceleration_structure *new_unwrapped_asset_compacted_bottom_level_acceleration_structure = new (new_unwrapped_asset_compacted_bottom_level_acceleration_structure_base) brx_vk_asset_compacted_bottom_level_acceleration_structure{};
-	new_unwrapped_asset_compacted_bottom_level_acceleration_structure->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, this->m_memory_allocator, this->m_asset_compacted_bottom_level_acceleration_structure_memory_pool, size);
+	new_unwrapped_asset_compacted_bottom_level_acceleration_structure->init(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks, this->m_memory_allocator, this->m_asset_compacted_bottom_level_acceleration_structure_memory_pool, size);
 	return new_unwrapped_asset_compacted_bottom_level_acceleration_structure;
 }
 
@@ -3481,7 +4888,7 @@ void brx_vk_device::destroy_asset_compacted_bottom_level_acceleration_structure(
 	assert(NULL != wrapped_asset_compacted_bottom_level_acceleration_structure);
 	brx_vk_asset_compacted_bottom_level_acceleration_structure *delete_unwrapped_asset_compacted_bottom_level_acceleration_structure = static_cast<brx_vk_asset_compacted_bottom_level_acceleration_structure *>(wrapped_asset_compacted_bottom_level_acceleration_structure);
 
-	delete_unwrapped_asset_compacted_bottom_level_acceleration_structure->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, this->m_memory_allocator);
+	delete_unwrapped_asset_compacted_bottom_level_acceleration_structure->uninit(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks, this->m_memory_allocator);
 
 	delete_unwrapped_asset_compacted_bottom_level_acceleration_structure->~brx_vk_asset_compacted_bottom_level_acceleration_structure();
 	brx_free(delete_unwrapped_asset_compacted_bottom_level_acceleration_structure);
@@ -3493,7 +4900,7 @@ brx_top_level_acceleration_structure_instance_upload_buffer *brx_vk_device::crea
 	assert(NULL != new_unwrapped_top_level_acceleration_structure_instance_upload_buffer_base);
 
 	brx_vk_top_level_acceleration_structure_instance_upload_buffer *new_unwrapped_top_level_acceleration_structure_instance_upload_buffer = new (new_unwrapped_top_level_acceleration_structure_instance_upload_buffer_base) brx_vk_top_level_acceleration_structure_instance_upload_buffer{};
-	new_unwrapped_top_level_acceleration_structure_instance_upload_buffer->init(this->m_device, this->m_pfn_get_buffer_device_address, this->m_memory_allocator, this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool, instance_count);
+	new_unwrapped_top_level_acceleration_structure_instance_upload_buffer->init(this->m_device, this->m_dispatch_table.pfn_get_buffer_device_address, this->m_memory_allocator, this->m_top_level_acceleration_structure_instance_upload_buffer_memory_pool, instance_count);
 	return new_unwrapped_top_level_acceleration_structure_instance_upload_buffer;
 }
 
@@ -3514,7 +4921,7 @@ void brx_vk_device::get_top_level_acceleration_structure_size(uint32_t top_level
 	assert(NULL != build_scratch_size);
 	assert(NULL != update_scratch_size);
 
-	PFN_vkGetAccelerationStructureBuildSizesKHR pfn_get_acceleration_structure_build_sizes = reinterpret_cast<PFN_vkGetAccelerationStructureBuildSizesKHR>(this->m_pfn_get_device_proc_addr(this->m_device, "vkGetAccelerationStructureBuildSizesKHR"));
+	PFN_vkGetAccelerationStructureBuildSizesKHR pfn_get_acceleration_structure_build_sizes = this->m_dispatch_table.pfn_get_acceleration_structure_build_sizes;
 	assert(NULL != pfn_get_acceleration_structure_build_sizes);
 
 	VkAccelerationStructureGeometryKHR const acceleration_structure_geometry = {
@@ -3562,7 +4969,7 @@ brx_top_level_acceleration_structure *brx_vk_device::create_top_level_accelerati
 	assert(NULL != new_unwrapped_top_level_acceleration_structure_base);
 
 	brx_vk_top_level_acceleration_structure *new_unwrapped_top_level_acceleration_structure = new (new_unwrapped_top_level_acceleration_structure_base) brx_vk_top_level_acceleration_structure{};
-	new_unwrapped_top_level_acceleration_structure->init(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, this->m_memory_allocator, this->m_top_level_acceleration_structure_memory_pool, size);
+	new_unwrapped_top_level_acceleration_structure->init(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks, this->m_memory_allocator, this->m_top_level_acceleration_structure_memory_pool, size);
 	return new_unwrapped_top_level_acceleration_structure;
 }
 
@@ -3571,7 +4978,7 @@ void brx_vk_device::destroy_top_level_acceleration_structure(brx_top_level_accel
 	assert(NULL != wrapped_top_level_acceleration_structure);
 	brx_vk_top_level_acceleration_structure *delete_unwrapped_top_level_acceleration_structure = static_cast<brx_vk_top_level_acceleration_structure *>(wrapped_top_level_acceleration_structure);
 
-	delete_unwrapped_top_level_acceleration_structure->uninit(this->m_pfn_get_device_proc_addr, this->m_device, this->m_allocation_callbacks, this->m_memory_allocator);
+	delete_unwrapped_top_level_acceleration_structure->uninit(&this->m_dispatch_table, this->m_device, this->m_allocation_callbacks, this->m_memory_allocator);
 
 	delete_unwrapped_top_level_acceleration_structure->~brx_vk_top_level_acceleration_structure();
 	brx_free(delete_unwrapped_top_level_acceleration_structure);
@@ -3590,6 +4997,8 @@ static VkBool32 VKAPI_PTR __intermediate_debug_utils_messenger_callback(VkDebugU
 	}
 
 	__android_log_write(ANDROID_LOG_DEBUG, "Vulkan-Demo", pCallbackData->pMessage);
+#elif defined(__linux__)
+	fprintf(stderr, "%s\n", pCallbackData->pMessage);
 #else
 #error Unknown Platform
 #endif
@@ -3647,3 +5056,25 @@ static inline uint32_t __intermediate_find_lowest_memory_type_index(struct VkPhy
 		return __intermediate_find_lowest_memory_type_index(physical_device_memory_properties, memory_requirements_size, memory_requirements_memory_type_bits, required_property_flags);
 	}
 }
+
+static inline VkSemaphore __intermediate_create_timeline_semaphore(PFN_vkCreateSemaphore pfn_create_semaphore, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, uint64_t initial_value)
+{
+	assert(NULL != pfn_create_semaphore);
+
+	VkSemaphoreTypeCreateInfoKHR const semaphore_type_create_info = {
+		VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR,
+		NULL,
+		VK_SEMAPHORE_TYPE_TIMELINE_KHR,
+		initial_value};
+
+	VkSemaphoreCreateInfo const semaphore_create_info = {
+		VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+		&semaphore_type_create_info,
+		0U};
+
+	VkSemaphore new_semaphore = VK_NULL_HANDLE;
+	VkResult res_create_semaphore = pfn_create_semaphore(device, &semaphore_create_info, allocation_callbacks, &new_semaphore);
+	assert(VK_SUCCESS == res_create_semaphore);
+
+	return new_semaphore;
+}
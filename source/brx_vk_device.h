@@ -22,6 +22,8 @@
 #if defined(__GNUC__)
 #if defined(__linux__) && defined(__ANDROID__)
 #define VK_USE_PLATFORM_ANDROID_KHR 1
+#elif defined(__linux__)
+// Desktop Linux is headless: neither the surface nor the swapchain is supported
 #else
 #error Unknown Platform
 #endif
@@ -36,16 +38,132 @@
 #endif
 #include "../thirdparty/Vulkan-Headers/include/vulkan/vulkan.h"
 #include "../thirdparty/VulkanMemoryAllocator/include/vk_mem_alloc.h"
+#include "brx_vk_descriptor_allocator.h"
+#include "brx_vk_pipeline_state_cache.h"
+#include "brx_pipeline_compiler.h"
+#include "brx_staging_upload_ring.h"
+#include "brx_uniform_upload_ring.h"
+#include "brx_asset_buffer_sub_allocator.h"
+#include "brx_timestamp_query_label_list.h"
+#include "brx_upload_scheduler.h"
+#include <mutex>
 
 // TODO: may be used by other stages
 extern VkPipelineStageFlags const g_graphics_queue_family_all_supported_shader_stages;
 extern VkPipelineStageFlags const g_upload_queue_family_all_supported_shader_stages;
 
+struct brx_vk_device_dispatch_table
+{
+	PFN_vkGetDeviceQueue pfn_get_device_queue;
+	PFN_vkDestroyDevice pfn_destroy_device;
+	PFN_vkQueueSubmit pfn_queue_submit;
+	PFN_vkCreateFence pfn_create_fence;
+	PFN_vkDestroyFence pfn_destroy_fence;
+	PFN_vkWaitForFences pfn_wait_for_fences;
+	PFN_vkResetFences pfn_reset_fences;
+	PFN_vkCreateSemaphore pfn_create_semaphore;
+	PFN_vkDestroySemaphore pfn_destroy_semaphore;
+	PFN_vkGetSemaphoreCounterValueKHR pfn_get_semaphore_counter_value;
+	PFN_vkWaitSemaphoresKHR pfn_wait_semaphores;
+	PFN_vkSignalSemaphoreKHR pfn_signal_semaphore;
+	PFN_vkCreateCommandPool pfn_create_command_pool;
+	PFN_vkDestroyCommandPool pfn_destroy_command_pool;
+	PFN_vkResetCommandPool pfn_reset_command_pool;
+	PFN_vkAllocateCommandBuffers pfn_allocate_command_buffers;
+	PFN_vkFreeCommandBuffers pfn_free_command_buffers;
+	PFN_vkBeginCommandBuffer pfn_begin_command_buffer;
+	PFN_vkEndCommandBuffer pfn_end_command_buffer;
+	PFN_vkCreateBuffer pfn_create_buffer;
+	PFN_vkDestroyBuffer pfn_destroy_buffer;
+	PFN_vkGetBufferMemoryRequirements pfn_get_buffer_memory_requirements;
+	PFN_vkCreateImage pfn_create_image;
+	PFN_vkDestroyImage pfn_destroy_image;
+	PFN_vkGetImageMemoryRequirements pfn_get_image_memory_requirements;
+	PFN_vkAllocateMemory pfn_allocate_memory;
+	PFN_vkFreeMemory pfn_free_memory;
+	PFN_vkBindImageMemory pfn_bind_image_memory;
+	PFN_vkCreateImageView pfn_create_image_view;
+	PFN_vkDestroyImageView pfn_destroy_image_view;
+	PFN_vkCreateSampler pfn_create_sampler;
+	PFN_vkDestroySampler pfn_destroy_sampler;
+	PFN_vkCreateRenderPass pfn_create_render_pass;
+	PFN_vkDestroyRenderPass pfn_destroy_render_pass;
+	PFN_vkCreateFramebuffer pfn_create_frame_buffer;
+	PFN_vkDestroyFramebuffer pfn_destroy_frame_buffer;
+	PFN_vkCreateDescriptorSetLayout pfn_create_descriptor_set_layout;
+	PFN_vkDestroyDescriptorSetLayout pfn_destroy_descriptor_set_layout;
+	PFN_vkCreatePipelineLayout pfn_create_pipeline_layout;
+	PFN_vkDestroyPipelineLayout pfn_destroy_pipeline_layout;
+	PFN_vkCreateDescriptorPool pfn_create_descriptor_pool;
+	PFN_vkDestroyDescriptorPool pfn_destroy_descriptor_pool;
+	PFN_vkResetDescriptorPool pfn_reset_descriptor_pool;
+	PFN_vkAllocateDescriptorSets pfn_allocate_descriptor_sets;
+	PFN_vkUpdateDescriptorSets pfn_update_descriptor_sets;
+	PFN_vkCreateDescriptorUpdateTemplate pfn_create_descriptor_update_template;
+	PFN_vkDestroyDescriptorUpdateTemplate pfn_destroy_descriptor_update_template;
+	PFN_vkUpdateDescriptorSetWithTemplate pfn_update_descriptor_set_with_template;
+	PFN_vkCreateShaderModule pfn_create_shader_module;
+	PFN_vkDestroyShaderModule pfn_destroy_shader_module;
+	PFN_vkCreateGraphicsPipelines pfn_create_graphics_pipelines;
+	PFN_vkCreateComputePipelines pfn_create_compute_pipelines;
+	PFN_vkDestroyPipeline pfn_destroy_pipeline;
+	PFN_vkCreatePipelineCache pfn_create_pipeline_cache;
+	PFN_vkDestroyPipelineCache pfn_destroy_pipeline_cache;
+	PFN_vkGetPipelineCacheData pfn_get_pipeline_cache_data;
+	PFN_vkMergePipelineCaches pfn_merge_pipeline_caches;
+	PFN_vkCreateQueryPool pfn_create_query_pool;
+	PFN_vkDestroyQueryPool pfn_destroy_query_pool;
+	PFN_vkGetQueryPoolResults pfn_get_query_pool_results;
+	PFN_vkCmdPipelineBarrier pfn_cmd_pipeline_barrier;
+	PFN_vkCmdBeginRenderPass pfn_cmd_begin_render_pass;
+	PFN_vkCmdEndRenderPass pfn_cmd_end_render_pass;
+	PFN_vkCmdExecuteCommands pfn_cmd_execute_commands;
+	PFN_vkCmdBindPipeline pfn_cmd_bind_pipeline;
+	PFN_vkCmdSetViewport pfn_cmd_set_view_port;
+	PFN_vkCmdSetScissor pfn_cmd_set_scissor;
+	PFN_vkCmdBindDescriptorSets pfn_cmd_bind_descriptor_sets;
+	PFN_vkCmdPushConstants pfn_cmd_push_constants;
+	PFN_vkCmdBindVertexBuffers pfn_cmd_bind_vertex_buffers;
+	PFN_vkCmdBindIndexBuffer pfn_cmd_bind_index_buffer;
+	PFN_vkCmdDraw pfn_cmd_draw;
+	PFN_vkCmdDrawIndexed pfn_cmd_draw_indexed;
+	PFN_vkCmdDrawIndirect pfn_cmd_draw_indirect;
+	PFN_vkCmdDrawIndexedIndirect pfn_cmd_draw_indexed_indirect;
+	PFN_vkCmdDispatch pfn_cmd_dispatch;
+	PFN_vkCmdDispatchIndirect pfn_cmd_dispatch_indirect;
+	PFN_vkCmdCopyBuffer pfn_cmd_copy_buffer;
+	PFN_vkCmdCopyBufferToImage pfn_cmd_copy_buffer_to_image;
+	PFN_vkCmdResetQueryPool pfn_cmd_reset_query_pool;
+	PFN_vkCmdWriteTimestamp pfn_cmd_write_timestamp;
+#ifndef NDEBUG
+	PFN_vkCmdBeginDebugUtilsLabelEXT pfn_cmd_begin_debug_utils_label;
+	PFN_vkCmdEndDebugUtilsLabelEXT pfn_cmd_end_debug_utils_label;
+#endif
+	// only available when the "VK_KHR_draw_indirect_count" is supported
+	PFN_vkCmdDrawIndirectCountKHR pfn_cmd_draw_indirect_count;
+	PFN_vkCmdDrawIndexedIndirectCountKHR pfn_cmd_draw_indexed_indirect_count;
+	// only available when the ray tracing is supported
+	PFN_vkCreateAccelerationStructureKHR pfn_create_acceleration_structure;
+	PFN_vkDestroyAccelerationStructureKHR pfn_destroy_acceleration_structure;
+	PFN_vkGetAccelerationStructureBuildSizesKHR pfn_get_acceleration_structure_build_sizes;
+	PFN_vkGetAccelerationStructureDeviceAddressKHR pfn_get_acceleration_structure_device_address;
+	PFN_vkGetBufferDeviceAddressKHR pfn_get_buffer_device_address;
+	PFN_vkCmdBuildAccelerationStructuresKHR pfn_cmd_build_acceleration_structure;
+	PFN_vkCmdWriteAccelerationStructuresPropertiesKHR pfn_cmd_write_acceleration_structures_properties;
+	PFN_vkCmdCopyAccelerationStructureKHR pfn_cmd_copy_acceleration_structure;
+	// not available on the headless platform
+	PFN_vkCreateSwapchainKHR pfn_create_swap_chain;
+	PFN_vkDestroySwapchainKHR pfn_destroy_swap_chain;
+	PFN_vkGetSwapchainImagesKHR pfn_get_swap_chain_images;
+	PFN_vkAcquireNextImageKHR pfn_acquire_next_image;
+	PFN_vkQueuePresentKHR pfn_queue_present;
+};
+
 class brx_vk_device : public brx_device
 {
 
 #if defined(__GNUC__)
-#if defined(__linux__) && defined(__ANDROID__)
+#if defined(__linux__)
 	void *m_dynamic_library_vulkan;
 #else
 #error Unknown Platform
@@ -69,22 +187,44 @@ class brx_vk_device : public brx_device
 #endif
 
 	VkPhysicalDevice m_physical_device;
+	uint32_t m_physical_device_vendor_id;
+	uint32_t m_physical_device_device_id;
+	uint8_t m_physical_device_pipeline_cache_uuid[VK_UUID_SIZE];
 	uint32_t m_min_uniform_buffer_offset_alignment;
 	uint32_t m_min_storage_buffer_offset_alignment;
 	uint32_t m_optimal_buffer_copy_offset_alignment;
 	uint32_t m_optimal_buffer_copy_row_pitch_alignment;
+	// the duration (in milliseconds) of one timestamp tick
+	double m_timestamp_period;
 
 	bool m_has_dedicated_upload_queue;
 	uint32_t m_graphics_queue_family_index;
 	uint32_t m_upload_queue_family_index;
+	bool m_upload_queue_family_support_timestamp;
+	// the compute queue is the same queue as the graphics queue when there is no dedicated compute queue
+	bool m_has_dedicated_compute_queue;
+	uint32_t m_compute_queue_family_index;
 
 	PFN_vkGetDeviceProcAddr m_pfn_get_device_proc_addr;
 	bool m_physical_device_feature_texture_compression_BC;
 	bool m_physical_device_feature_texture_compression_ASTC_LDR;
+	bool m_physical_device_feature_multi_draw_indirect;
+	bool m_physical_device_extension_draw_indirect_count;
+	bool m_physical_device_extension_timeline_semaphore;
+	bool m_physical_device_feature_bindless_table;
+	uint32_t m_max_bindless_table_sampled_image_descriptor_count;
+	uint32_t m_max_bindless_table_storage_buffer_descriptor_count;
+	uint32_t m_max_bindless_table_sampler_descriptor_count;
 	VkDevice m_device;
 
 	VkQueue m_graphics_queue;
 	VkQueue m_upload_queue;
+	VkQueue m_compute_queue;
+
+	// the "vkQueueSubmit" and "vkQueuePresentKHR" should be externally synchronized, and the same VkQueue may be shared by the different queue objects (e.g., the upload queue uses the graphics queue when there is no dedicated upload queue)
+	mutable std::mutex m_graphics_queue_mutex;
+	mutable std::mutex m_upload_queue_mutex;
+	mutable std::mutex m_compute_queue_mutex;
 
 	VkFormat m_depth_attachment_image_format;
 	VkFormat m_depth_stencil_attachment_image_format;
@@ -113,14 +253,16 @@ class brx_vk_device : public brx_device
 	VmaPool m_top_level_acceleration_structure_instance_upload_buffer_memory_pool;
 	VmaPool m_top_level_acceleration_structure_memory_pool;
 
-	PFN_vkWaitForFences m_pfn_wait_for_fences;
-	PFN_vkResetFences m_pfn_reset_fences;
-	PFN_vkResetCommandPool m_pfn_reset_command_pool;
-	PFN_vkAcquireNextImageKHR m_pfn_acquire_next_image;
-	PFN_vkCreateImageView m_pfn_create_image_view;
-	PFN_vkDestroyImageView m_pfn_destroy_image_view;
-	PFN_vkGetBufferDeviceAddressKHR m_pfn_get_buffer_device_address;
-	PFN_vkGetQueryPoolResults m_pfn_get_query_pool_results;
+	brx_vk_device_dispatch_table m_dispatch_table;
+
+	brx_vk_descriptor_allocator m_descriptor_allocator;
+
+	VkPipelineCache m_pipeline_cache;
+
+	brx_vk_pipeline_state_cache m_pipeline_state_cache;
+
+	brx_pipeline_compiler m_pipeline_compiler;
+	brx_staging_upload_ring_manager m_staging_upload_ring_manager;
 
 public:
 	brx_vk_device();
@@ -131,38 +273,94 @@ public:
 	void destroy_graphics_queue(brx_graphics_queue *graphics_queue) const override;
 	brx_upload_queue *create_upload_queue() const override;
 	void destroy_upload_queue(brx_upload_queue *upload_queue) const override;
+	bool is_async_compute_supported() const override;
+	brx_compute_queue *create_compute_queue() const override;
+	void destroy_compute_queue(brx_compute_queue *compute_queue) const override;
 	brx_graphics_command_buffer *create_graphics_command_buffer() const override;
 	void reset_graphics_command_buffer(brx_graphics_command_buffer *graphics_command_buffer) const override;
 	void destroy_graphics_command_buffer(brx_graphics_command_buffer *graphics_command_buffer) const override;
+	brx_secondary_graphics_command_buffer *create_secondary_graphics_command_buffer() const override;
+	void reset_secondary_graphics_command_buffer(brx_secondary_graphics_command_buffer *secondary_graphics_command_buffer) const override;
+	void destroy_secondary_graphics_command_buffer(brx_secondary_graphics_command_buffer *secondary_graphics_command_buffer) const override;
 	brx_upload_command_buffer *create_upload_command_buffer() const override;
 	void reset_upload_command_buffer(brx_upload_command_buffer *upload_command_buffer) const override;
 	void destroy_upload_command_buffer(brx_upload_command_buffer *upload_command_buffer) const override;
+	brx_compute_command_buffer *create_compute_command_buffer() const override;
+	void reset_compute_command_buffer(brx_compute_command_buffer *compute_command_buffer) const override;
+	void destroy_compute_command_buffer(brx_compute_command_buffer *compute_command_buffer) const override;
 	brx_fence *create_fence(bool signaled) const override;
 	void wait_for_fence(brx_fence *fence) const override;
 	void reset_fence(brx_fence *fence) const override;
 	void destroy_fence(brx_fence *fence) const override;
-	brx_descriptor_set_layout *create_descriptor_set_layout(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings) const override;
+	bool is_timeline_fence_supported() const override;
+	brx_timeline_fence *create_timeline_fence(uint64_t initial_value) const override;
+	uint64_t get_timeline_fence_completed_value(brx_timeline_fence const *timeline_fence) const override;
+	void signal_timeline_fence(brx_timeline_fence *timeline_fence, uint64_t value) const override;
+	bool wait_for_timeline_fences(uint32_t timeline_fence_count, brx_timeline_fence const *const *timeline_fences, uint64_t const *values, bool wait_all, uint64_t timeout) const override;
+	void destroy_timeline_fence(brx_timeline_fence *timeline_fence) const override;
+	brx_upload_scheduler *create_upload_scheduler(uint32_t batch_count) override;
+	brx_upload_command_buffer *begin_upload_batch(brx_upload_scheduler *upload_scheduler) const override;
+	uint64_t submit_upload_batch(brx_upload_scheduler *upload_scheduler, brx_upload_queue *upload_queue, brx_upload_command_buffer *upload_command_buffer) const override;
+	brx_timeline_fence const *get_upload_scheduler_timeline_fence(brx_upload_scheduler const *upload_scheduler) const override;
+	bool is_upload_batch_completed(brx_upload_scheduler const *upload_scheduler, uint64_t batch_value) const override;
+	void destroy_upload_scheduler(brx_upload_scheduler *upload_scheduler) override;
+	brx_descriptor_set_layout *create_descriptor_set_layout(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings, bool descriptor_update_template) const override;
 	void destroy_descriptor_set_layout(brx_descriptor_set_layout *descriptor_set_layout) const override;
-	brx_pipeline_layout *create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *descriptor_set_layouts) const override;
+	brx_pipeline_layout *create_pipeline_layout(uint32_t descriptor_set_layout_count, brx_descriptor_set_layout const *const *descriptor_set_layouts, uint32_t push_constant_size) const override;
 	void destroy_pipeline_layout(brx_pipeline_layout *pipeline_layout) const;
 	brx_descriptor_set *create_descriptor_set(brx_descriptor_set_layout const *descriptor_set_layout) override;
 	void write_descriptor_set(brx_descriptor_set *descriptor_set, BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t dst_binding, uint32_t dst_array_element, uint32_t src_descriptor_count, brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_storage_buffer const *const *src_storage_buffers, brx_sampled_image const *const *src_sampled_images, brx_sampler const *const *src_samplers, brx_storage_image const *const *src_storage_images, brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures) const override;
+	void write_descriptor_sets(uint32_t write_descriptor_set_count, BRX_WRITE_DESCRIPTOR_SET const *write_descriptor_sets) const override;
+	void write_descriptor_set_with_template(brx_descriptor_set *descriptor_set, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges) const override;
 	void destroy_descriptor_set(brx_descriptor_set *descriptor_set) override;
+	bool is_bindless_table_supported() const override;
+	brx_bindless_table *create_bindless_table(BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t descriptor_count) override;
+	brx_descriptor_set_layout const *get_bindless_table_descriptor_set_layout(brx_bindless_table const *bindless_table) const override;
+	brx_descriptor_set const *get_bindless_table_descriptor_set(brx_bindless_table const *bindless_table) const override;
+	uint32_t alloc_bindless_descriptor(brx_bindless_table *bindless_table, brx_storage_buffer const *src_storage_buffer, brx_sampled_image const *src_sampled_image, brx_sampler const *src_sampler) const override;
+	void free_bindless_descriptor(brx_bindless_table *bindless_table, uint32_t descriptor_index) const override;
+	void destroy_bindless_table(brx_bindless_table *bindless_table) override;
+	brx_transient_descriptor_allocator *create_transient_descriptor_allocator() override;
+	brx_descriptor_set *alloc_transient_descriptor_set(brx_transient_descriptor_allocator *transient_descriptor_allocator, brx_descriptor_set_layout const *descriptor_set_layout) const override;
+	void reset_transient_descriptor_allocator(brx_transient_descriptor_allocator *transient_descriptor_allocator) const override;
+	void destroy_transient_descriptor_allocator(brx_transient_descriptor_allocator *transient_descriptor_allocator) override;
 	brx_render_pass *create_render_pass(uint32_t color_attachment_count, BRX_RENDER_PASS_COLOR_ATTACHMENT const *color_attachments, BRX_RENDER_PASS_DEPTH_STENCIL_ATTACHMENT const *depth_stencil_attachment) const override;
 	void destroy_render_pass(brx_render_pass *render_pass) const override;
 	brx_graphics_pipeline *create_graphics_pipeline(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation) const override;
 	void destroy_graphics_pipeline(brx_graphics_pipeline *graphics_pipeline) const override;
 	brx_compute_pipeline *create_compute_pipeline(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) const override;
 	void destroy_compute_pipeline(brx_compute_pipeline *compute_pipeline) const override;
+	bool is_pipeline_specialization_constant_supported() const override;
+	brx_graphics_pipeline *create_graphics_pipeline_variant(brx_graphics_pipeline const *base_graphics_pipeline, brx_render_pass const *render_pass, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants) const override;
+	brx_compute_pipeline *create_compute_pipeline_variant(brx_compute_pipeline const *base_compute_pipeline, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants) const override;
+	brx_graphics_pipeline_compilation *create_graphics_pipeline_async(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation) override;
+	bool is_graphics_pipeline_compilation_completed(brx_graphics_pipeline_compilation const *graphics_pipeline_compilation) const override;
+	brx_graphics_pipeline *wait_graphics_pipeline_compilation(brx_graphics_pipeline_compilation *graphics_pipeline_compilation) override;
+	brx_compute_pipeline_compilation *create_compute_pipeline_async(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code) override;
+	bool is_compute_pipeline_compilation_completed(brx_compute_pipeline_compilation const *compute_pipeline_compilation) const override;
+	brx_compute_pipeline *wait_compute_pipeline_compilation(brx_compute_pipeline_compilation *compute_pipeline_compilation) override;
+	bool load_pipeline_cache(size_t pipeline_cache_data_size, void const *pipeline_cache_data) override;
+	size_t store_pipeline_cache(size_t pipeline_cache_data_size, void *pipeline_cache_data) const override;
 	brx_frame_buffer *create_frame_buffer(brx_render_pass const *render_pass, uint32_t width, uint32_t height, uint32_t color_attachment_count, brx_color_attachment_image const *const *color_attachments, brx_depth_stencil_attachment_image const *depth_stencil_attachment) const override;
 	void destroy_frame_buffer(brx_frame_buffer *frame_buffer) const override;
 	brx_uniform_upload_buffer *create_uniform_upload_buffer(uint32_t size) const override;
 	void destroy_uniform_upload_buffer(brx_uniform_upload_buffer *uniform_upload_buffer) const override;
+	brx_uniform_upload_ring *create_uniform_upload_ring(uint32_t frame_count, uint32_t frame_size) override;
+	brx_uniform_upload_buffer const *get_uniform_upload_ring_buffer(brx_uniform_upload_ring const *uniform_upload_ring) const override;
+	void begin_uniform_upload_ring_frame(brx_uniform_upload_ring *uniform_upload_ring, uint32_t frame_index) const override;
+	void *alloc_uniform_upload_ring_range(brx_uniform_upload_ring *uniform_upload_ring, uint32_t size, uint32_t *out_dynamic_offset) const override;
+	void destroy_uniform_upload_ring(brx_uniform_upload_ring *uniform_upload_ring) override;
 	uint32_t get_staging_upload_buffer_offset_alignment() const override;
 	uint32_t get_staging_upload_buffer_row_pitch_alignment() const override;
 	brx_staging_upload_buffer *create_staging_upload_buffer(uint32_t size) const override;
 	void destroy_staging_upload_buffer(brx_staging_upload_buffer *staging_upload_buffer) const override;
-	brx_intermediate_storage_buffer *create_intermediate_storage_buffer(uint32_t size, bool allow_vertex_position, bool allow_vertex_varying) const override;
+	brx_staging_upload_ring *create_staging_upload_ring(uint32_t initial_size) override;
+	void *alloc_staging_upload_ring_range(brx_staging_upload_ring *staging_upload_ring, uint32_t size, brx_staging_upload_buffer **out_staging_upload_buffer, uint64_t *out_offset) override;
+	void submit_staging_upload_ring(brx_staging_upload_ring *staging_upload_ring, brx_fence const *fence) override;
+	void submit_staging_upload_ring_timeline_fence(brx_staging_upload_ring *staging_upload_ring, brx_timeline_fence const *timeline_fence, uint64_t value) override;
+	BRX_STAGING_UPLOAD_RING_STATISTICS get_staging_upload_ring_statistics(brx_staging_upload_ring const *staging_upload_ring) override;
+	void destroy_staging_upload_ring(brx_staging_upload_ring *staging_upload_ring) override;
+	brx_intermediate_storage_buffer *create_intermediate_storage_buffer(uint32_t size, bool allow_vertex_position, bool allow_vertex_varying, bool allow_indirect_argument) const override;
 	void destroy_intermediate_storage_buffer(brx_intermediate_storage_buffer *intermediate_storage_buffer) const override;
 	brx_asset_vertex_position_buffer *create_asset_vertex_position_buffer(uint32_t size) const override;
 	void destroy_asset_vertex_position_buffer(brx_asset_vertex_position_buffer *asset_vertex_position_buffer) const override;
@@ -170,6 +368,10 @@ public:
 	void destroy_asset_vertex_varying_buffer(brx_asset_vertex_varying_buffer *asset_vertex_varying_buffer) const override;
 	brx_asset_index_buffer *create_asset_index_buffer(uint32_t size) const override;
 	void destroy_asset_index_buffer(brx_asset_index_buffer *asset_index_buffer) const override;
+	brx_asset_buffer_sub_allocator *create_asset_buffer_sub_allocator(uint64_t size, uint32_t alignment) const override;
+	bool alloc_asset_buffer_range(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator, uint32_t size, uint64_t *out_offset) const override;
+	void free_asset_buffer_range(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator, uint64_t offset) const override;
+	void destroy_asset_buffer_sub_allocator(brx_asset_buffer_sub_allocator *asset_buffer_sub_allocator) const override;
 	brx_color_attachment_image *create_color_attachment_image(BRX_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image) const override;
 	void destroy_color_attachment_image(brx_color_attachment_image *color_attachment_image) const override;
 	BRX_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT get_depth_attachment_image_format() const override;
@@ -180,6 +382,7 @@ public:
 	void destroy_storage_image(brx_storage_image *storage_image) const override;
 	bool is_asset_sampled_image_compression_bc_supported() const override;
 	bool is_asset_sampled_image_compression_astc_supported() const override;
+	bool is_indirect_argument_count_supported() const override;
 	brx_asset_sampled_image *create_asset_sampled_image(BRX_ASSET_IMAGE_FORMAT asset_sampled_image_format, uint32_t width, uint32_t height, uint32_t mip_levels) const override;
 	void destroy_asset_sampled_image(brx_asset_sampled_image *asset_sampled_image) const override;
 	brx_sampler *create_sampler(BRX_SAMPLER_FILTER filter) const override;
@@ -189,6 +392,12 @@ public:
 	brx_swap_chain *create_swap_chain(brx_surface *surface) const override;
 	bool acquire_next_image(brx_graphics_command_buffer *graphics_command_buffer, brx_swap_chain const *swap_chain, uint32_t *out_swap_chain_image_index) const override;
 	void destroy_swap_chain(brx_swap_chain *swap_chain) const override;
+	brx_timestamp_query_pool *create_timestamp_query_pool(uint32_t query_count) const override;
+	double get_timestamp_period() const override;
+	bool is_upload_command_buffer_timestamp_supported() const override;
+	bool get_timestamp_query_pool_results(brx_timestamp_query_pool const *timestamp_query_pool, uint32_t first_query, uint32_t query_count, uint64_t *out_timestamps) const override;
+	bool get_timestamp_query_pool_label_timings(brx_timestamp_query_pool *timestamp_query_pool, uint32_t *out_label_timing_count, BRX_TIMESTAMP_LABEL_TIMING const **out_label_timings) const override;
+	void destroy_timestamp_query_pool(brx_timestamp_query_pool *timestamp_query_pool) const override;
 	brx_scratch_buffer *create_scratch_buffer(uint32_t size) const override;
 	void destroy_scratch_buffer(brx_scratch_buffer *scratch_buffer) const override;
 	void get_staging_non_compacted_bottom_level_acceleration_structure_size(uint32_t acceleration_structure_geometry_count, BRX_BOTTOM_LEVEL_ACCELERATION_STRUCTURE_GEOMETRY const *acceleration_structure_geometries, uint32_t *acceleration_structure_size, uint32_t *build_scratch_size) const override;
@@ -206,9 +415,27 @@ public:
 	void destroy_top_level_acceleration_structure(brx_top_level_acceleration_structure *top_level_acceleration_structure) const override;
 };
 
+static constexpr uint32_t const g_vk_max_pending_wait_timeline_semaphore_count = 16U;
+static constexpr uint32_t const g_vk_max_signal_timeline_semaphore_count = 16U;
+static constexpr uint32_t const g_vk_max_queue_submit_command_buffer_count = 32U;
+// at most one binary semaphore is waited or signaled by each submission
+static constexpr uint32_t const g_vk_max_queue_submit_binary_semaphore_count = 1U;
+
+struct brx_vk_pending_wait_timeline_semaphores
+{
+	// the wait operation of the semaphore only applies to the same batch, and thus the waits are deferred to the next submission
+	uint32_t count;
+	VkSemaphore semaphores[g_vk_max_pending_wait_timeline_semaphore_count];
+	uint64_t values[g_vk_max_pending_wait_timeline_semaphore_count];
+	// when the pending waits are full, they are flushed by an empty submission which signals this timeline semaphore (owned by the queue), and only this timeline semaphore is waited by the next submission instead
+	VkSemaphore flush_timeline_semaphore;
+	uint64_t flush_timeline_semaphore_value;
+};
+
 class brx_vk_graphics_queue : public brx_graphics_queue
 {
 	VkQueue m_graphics_queue;
+	std::mutex *m_graphics_queue_mutex;
 
 	bool m_has_dedicated_upload_queue;
 	uint32_t m_upload_queue_family_index;
@@ -217,11 +444,17 @@ class brx_vk_graphics_queue : public brx_graphics_queue
 	PFN_vkQueueSubmit m_pfn_queue_submit;
 	PFN_vkQueuePresentKHR m_pfn_queue_present;
 
+	brx_vk_pending_wait_timeline_semaphores m_pending_wait_timeline_semaphores;
+
 public:
-	brx_vk_graphics_queue(bool has_dedicated_upload_queue, uint32_t upload_queue_family_index, uint32_t graphics_queue_family_index, VkQueue graphics_queue, PFN_vkQueueSubmit pfn_queue_submit, PFN_vkQueuePresentKHR pfn_queue_present);
-	void wait_and_submit(brx_upload_command_buffer const *upload_command_buffer, brx_graphics_command_buffer const *graphics_command_buffer, brx_fence *fence) const override;
-	bool submit_and_present(brx_graphics_command_buffer *graphics_command_buffer, brx_swap_chain *swap_chain, uint32_t swap_chain_image_index, brx_fence *fence) const override;
-	void steal(VkQueue *out_graphics_queue);
+	brx_vk_graphics_queue(bool has_dedicated_upload_queue, uint32_t upload_queue_family_index, uint32_t graphics_queue_family_index, VkQueue graphics_queue, std::mutex *graphics_queue_mutex, PFN_vkQueueSubmit pfn_queue_submit, PFN_vkQueuePresentKHR pfn_queue_present, VkSemaphore flush_timeline_semaphore);
+	void wait_and_submit(brx_upload_command_buffer const *upload_command_buffer, brx_graphics_command_buffer const *graphics_command_buffer, brx_fence *fence) override;
+	bool submit_and_present(brx_graphics_command_buffer *graphics_command_buffer, brx_swap_chain *swap_chain, uint32_t swap_chain_image_index, brx_fence *fence) override;
+	void signal_timeline_fence(brx_timeline_fence *timeline_fence, uint64_t value) override;
+	void wait_timeline_fence(brx_timeline_fence const *timeline_fence, uint64_t value) override;
+	void submit_batch(uint32_t graphics_command_buffer_count, brx_graphics_command_buffer const *const *graphics_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *signal_timeline_fences, uint64_t const *signal_values, brx_fence *fence) override;
+	bool submit_batch_and_present(uint32_t graphics_command_buffer_count, brx_graphics_command_buffer *const *graphics_command_buffers, brx_swap_chain *swap_chain, uint32_t swap_chain_image_index, brx_fence *fence) override;
+	void steal(VkQueue *out_graphics_queue, VkSemaphore *out_flush_timeline_semaphore);
 	~brx_vk_graphics_queue();
 };
 
@@ -233,23 +466,95 @@ class brx_vk_upload_queue : public brx_upload_queue
 	uint32_t m_upload_queue_family_index;
 	uint32_t m_graphics_queue_family_index;
 
+	// the upload command buffer is submitted to the graphics queue when there is no dedicated upload queue, and thus the submissions are serialized with the graphics queue by the same mutex
+	VkQueue m_graphics_queue;
+	std::mutex *m_queue_mutex;
+
 	PFN_vkQueueSubmit m_pfn_queue_submit;
 
+	brx_vk_pending_wait_timeline_semaphores m_pending_wait_timeline_semaphores;
+
 public:
-	brx_vk_upload_queue(bool has_dedicated_upload_queue, uint32_t upload_queue_family_index, uint32_t graphics_queue_family_index, VkQueue upload_queue, PFN_vkQueueSubmit pfn_queue_submit);
-	void submit_and_signal(brx_upload_command_buffer const *upload_command_buffer) const override;
-	void steal(VkQueue *out_upload_queue);
+	brx_vk_upload_queue(bool has_dedicated_upload_queue, uint32_t upload_queue_family_index, uint32_t graphics_queue_family_index, VkQueue upload_queue, VkQueue graphics_queue, std::mutex *queue_mutex, PFN_vkQueueSubmit pfn_queue_submit, VkSemaphore flush_timeline_semaphore);
+	void submit_and_signal(brx_upload_command_buffer const *upload_command_buffer) override;
+	void submit_and_signal_timeline_fence(brx_upload_command_buffer const *upload_command_buffer, brx_timeline_fence *timeline_fence, uint64_t value) override;
+	void signal_timeline_fence(brx_timeline_fence *timeline_fence, uint64_t value) override;
+	void wait_timeline_fence(brx_timeline_fence const *timeline_fence, uint64_t value) override;
+	void submit_batch(uint32_t upload_command_buffer_count, brx_upload_command_buffer const *const *upload_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *signal_timeline_fences, uint64_t const *signal_values) override;
+	void steal(VkQueue *out_upload_queue, VkSemaphore *out_flush_timeline_semaphore);
 	~brx_vk_upload_queue();
 };
 
+class brx_vk_compute_queue : public brx_compute_queue
+{
+	VkQueue m_compute_queue;
+	// the compute queue is the same VkQueue as the graphics queue when there is no dedicated compute queue, and thus the submissions are serialized with the graphics queue by the same mutex
+	std::mutex *m_compute_queue_mutex;
+
+	PFN_vkQueueSubmit m_pfn_queue_submit;
+
+	brx_vk_pending_wait_timeline_semaphores m_pending_wait_timeline_semaphores;
+
+public:
+	brx_vk_compute_queue(VkQueue compute_queue, std::mutex *compute_queue_mutex, PFN_vkQueueSubmit pfn_queue_submit, VkSemaphore flush_timeline_semaphore);
+	void signal_timeline_fence(brx_timeline_fence *timeline_fence, uint64_t value) override;
+	void wait_timeline_fence(brx_timeline_fence const *timeline_fence, uint64_t value) override;
+	void submit_batch(uint32_t compute_command_buffer_count, brx_compute_command_buffer const *const *compute_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *signal_timeline_fences, uint64_t const *signal_values, brx_fence *fence) override;
+	void steal(VkQueue *out_compute_queue, VkSemaphore *out_flush_timeline_semaphore);
+	~brx_vk_compute_queue();
+};
+
+static constexpr uint32_t const g_vk_max_descriptor_set_layout_count = 4U;
+static constexpr uint32_t const g_vk_max_dynamic_offset_count = 16U;
+static constexpr uint32_t const g_vk_max_vertex_buffer_count = 16U;
+// the minimum of the "maxPushConstantsSize" guaranteed by the Vulkan specification
+static constexpr uint32_t const g_vk_max_push_constant_size = 128U;
+static constexpr uint32_t const g_vk_max_pending_buffer_memory_barrier_count = 32U;
+static constexpr uint32_t const g_vk_max_pending_image_memory_barrier_count = 32U;
+static constexpr uint32_t const g_vk_max_inline_bottom_level_acceleration_structure_geometry_count = 16U;
+
+struct brx_vk_descriptor_set_binding_state
+{
+	// the descriptor sets remain bound when the pipeline layouts are compatible, namely the push constant ranges and the descriptor set layouts of the lower set numbers are identical
+	uint32_t descriptor_set_count;
+	uint32_t push_constant_size;
+	VkDescriptorSetLayout descriptor_set_layouts[g_vk_max_descriptor_set_layout_count];
+	VkDescriptorSet descriptor_sets[g_vk_max_descriptor_set_layout_count];
+	uint32_t dynamic_offsets[g_vk_max_dynamic_offset_count];
+};
+
+class brx_vk_pending_pipeline_barrier
+{
+	// the barriers are merged into one "vkCmdPipelineBarrier" which is recorded before the next action command
+	VkPipelineStageFlags m_source_stage_mask;
+	VkPipelineStageFlags m_destination_stage_mask;
+	// the pending barriers are flushed when the fixed-capacity arrays are full
+	uint32_t m_buffer_memory_barrier_count;
+	VkBufferMemoryBarrier m_buffer_memory_barriers[g_vk_max_pending_buffer_memory_barrier_count];
+	uint32_t m_image_memory_barrier_count;
+	VkImageMemoryBarrier m_image_memory_barriers[g_vk_max_pending_image_memory_barrier_count];
+
+public:
+	brx_vk_pending_pipeline_barrier();
+	void pipeline_barrier(PFN_vkCmdPipelineBarrier pfn_cmd_pipeline_barrier, VkCommandBuffer command_buffer, VkPipelineStageFlags source_stage_mask, VkPipelineStageFlags destination_stage_mask, uint32_t buffer_memory_barrier_count, VkBufferMemoryBarrier const *buffer_memory_barriers, uint32_t image_memory_barrier_count, VkImageMemoryBarrier const *image_memory_barriers);
+	void flush(PFN_vkCmdPipelineBarrier pfn_cmd_pipeline_barrier, VkCommandBuffer command_buffer);
+	~brx_vk_pending_pipeline_barrier();
+};
+
 class brx_vk_graphics_command_buffer : public brx_graphics_command_buffer
 {
 	bool m_support_ray_tracing;
 
+	// the "drawCount" greater than one is emulated by the multiple indirect commands when the "multiDrawIndirect" is NOT supported
+	bool m_support_multi_draw_indirect;
+
 	bool m_has_dedicated_upload_queue;
 	uint32_t m_graphics_queue_family_index;
 	uint32_t m_upload_queue_family_index;
+	uint32_t m_compute_queue_family_index;
 
+	// the secondary command buffer is recorded inside the render pass, and does NOT own the semaphores
+	VkCommandBufferLevel m_command_buffer_level;
 	VkCommandPool m_command_pool;
 	VkCommandBuffer m_command_buffer;
 
@@ -267,20 +572,55 @@ class brx_vk_graphics_command_buffer : public brx_graphics_command_buffer
 	PFN_vkCmdSetViewport m_pfn_cmd_set_view_port;
 	PFN_vkCmdSetScissor m_pfn_cmd_set_scissor;
 	PFN_vkCmdBindDescriptorSets m_pfn_cmd_bind_descriptor_sets;
+	PFN_vkCmdPushConstants m_pfn_cmd_push_constants;
 	PFN_vkCmdBindVertexBuffers m_pfn_cmd_bind_vertex_buffers;
 	PFN_vkCmdBindIndexBuffer m_pfn_cmd_bind_index_buffer;
 	PFN_vkCmdDraw m_pfn_cmd_draw;
 	PFN_vkCmdDrawIndexed m_pfn_cmd_draw_indexed;
+	PFN_vkCmdDrawIndirect m_pfn_cmd_draw_indirect;
+	PFN_vkCmdDrawIndexedIndirect m_pfn_cmd_draw_indexed_indirect;
+	PFN_vkCmdDrawIndirectCountKHR m_pfn_cmd_draw_indirect_count;
+	PFN_vkCmdDrawIndexedIndirectCountKHR m_pfn_cmd_draw_indexed_indirect_count;
 	PFN_vkCmdEndRenderPass m_pfn_cmd_end_render_pass;
+	PFN_vkCmdExecuteCommands m_pfn_cmd_execute_commands;
 	PFN_vkCmdDispatch m_pfn_cmd_dispatch;
+	PFN_vkCmdDispatchIndirect m_pfn_cmd_dispatch_indirect;
 	PFN_vkCmdBuildAccelerationStructuresKHR m_pfn_cmd_build_acceleration_structure;
+	PFN_vkCmdResetQueryPool m_pfn_cmd_reset_query_pool;
+	PFN_vkCmdWriteTimestamp m_pfn_cmd_write_timestamp;
 	PFN_vkEndCommandBuffer m_pfn_end_command_buffer;
 
+	// the label regions are timed only when the pool is set, and the pool is unset by the "begin"
+	VkQueryPool m_debug_utils_label_query_pool;
+	brx_timestamp_query_label_list *m_debug_utils_label_list;
+
+	// the shadow state is used to drop the redundant state commands, and is invalidated by the "begin"
+	VkPipeline m_bound_graphics_pipeline;
+	VkPipeline m_bound_compute_pipeline;
+	uint32_t m_bound_view_port_width;
+	uint32_t m_bound_view_port_height;
+	uint32_t m_bound_scissor_width;
+	uint32_t m_bound_scissor_height;
+	brx_vk_descriptor_set_binding_state m_bound_graphics_descriptor_sets;
+	brx_vk_descriptor_set_binding_state m_bound_compute_descriptor_sets;
+	uint32_t m_bound_vertex_buffer_count;
+	VkBuffer m_bound_vertex_buffers[g_vk_max_vertex_buffer_count];
+	VkDeviceSize m_bound_vertex_buffer_offsets[g_vk_max_vertex_buffer_count];
+	VkBuffer m_bound_index_buffer;
+	VkIndexType m_bound_index_type;
+	BRX_GRAPHICS_COMMAND_BUFFER_STATISTICS m_statistics;
+
+	brx_vk_pending_pipeline_barrier m_pending_pipeline_barrier;
+
+	void invalidate_shadow_state();
+	void bind_index_buffer(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type);
+
 public:
 	brx_vk_graphics_command_buffer();
-	void init(bool support_ray_tracing, bool has_dedicated_upload_queue, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, PFN_vkGetInstanceProcAddr pfn_get_instance_proc_addr, VkInstance instance, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
-	void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void init(VkCommandBufferLevel command_buffer_level, bool support_ray_tracing, bool support_multi_draw_indirect, bool has_dedicated_upload_queue, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, uint32_t compute_queue_family_index, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
 	~brx_vk_graphics_command_buffer();
+	void begin_secondary(brx_render_pass const *render_pass, brx_frame_buffer const *frame_buffer, uint32_t width, uint32_t height);
 	VkCommandPool get_command_pool() const;
 	VkCommandBuffer get_command_buffer() const;
 	VkSemaphore get_acquire_next_image_semaphore() const;
@@ -293,24 +633,113 @@ public:
 	void acquire_asset_compacted_bottom_level_acceleration_structure(brx_asset_compacted_bottom_level_acceleration_structure *asset_compacted_bottom_level_acceleration_structure) override;
 	void begin_debug_utils_label(char const *label_name) override;
 	void end_debug_utils_label() override;
-	void begin_render_pass(brx_render_pass const *render_pass, brx_frame_buffer const *frame_buffer, uint32_t width, uint32_t height, uint32_t color_clear_value_count, float const (*color_clear_values)[4], float const *depth_clear_value, uint8_t const *stencil_clear_value) override;
+	void reset_timestamp_query_pool(brx_timestamp_query_pool *timestamp_query_pool) override;
+	void write_timestamp(brx_timestamp_query_pool *timestamp_query_pool, uint32_t query_index) override;
+	void set_debug_utils_label_timestamp_query_pool(brx_timestamp_query_pool *timestamp_query_pool) override;
+	void begin_render_pass(brx_render_pass const *render_pass, brx_frame_buffer const *frame_buffer, uint32_t width, uint32_t height, uint32_t color_clear_value_count, float const (*color_clear_values)[4], float const *depth_clear_value, uint8_t const *stencil_clear_value, bool secondary_graphics_command_buffers) override;
+	void execute_secondary_graphics_command_buffers(uint32_t secondary_graphics_command_buffer_count, brx_secondary_graphics_command_buffer const *const *secondary_graphics_command_buffers) override;
 	void bind_graphics_pipeline(brx_graphics_pipeline const *graphics_pipeline) override;
 	void set_view_port(uint32_t width, uint32_t height) override;
 	void set_scissor(uint32_t width, uint32_t height) override;
 	void bind_graphics_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
-	void bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers) override;
-	void draw(uint32_t vertex_count, uint32_t instance_count) override;
-	void draw_index(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, uint32_t index_count, uint32_t instance_count) override;
+	void push_graphics_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values) override;
+	void bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers, uint64_t const *vertex_buffer_offsets) override;
+	void draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance) override;
+	void draw_index(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance) override;
+	void draw_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer, uint64_t count_offset) override;
+	void draw_index_indirect(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer, uint64_t count_offset) override;
 	void end_render_pass() override;
 	void compute_pass_load_storage_image(brx_storage_image const *storage_image, BRX_STORAGE_IMAGE_LOAD_OPERATION load_operation) override;
+	void compute_pass_load_indirect_argument_buffer(brx_indirect_argument_buffer const *indirect_argument_buffer) override;
 	void bind_compute_pipeline(brx_compute_pipeline const *compute_pipeline) override;
 	void bind_compute_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
+	void push_compute_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values) override;
 	void dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) override;
+	void dispatch_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset) override;
 	void compute_pass_store_storage_image(brx_storage_image const *storage_image, BRX_STORAGE_IMAGE_STORE_OPERATION store_operation) override;
+	void compute_pass_store_indirect_argument_buffer(brx_indirect_argument_buffer const *indirect_argument_buffer) override;
+	void release_storage_buffer_to_compute_queue(brx_intermediate_storage_buffer const *storage_buffer) override;
+	void release_storage_image_to_compute_queue(brx_storage_image const *storage_image) override;
+	void acquire_storage_buffer_from_compute_queue(brx_intermediate_storage_buffer const *storage_buffer) override;
+	void acquire_storage_image_from_compute_queue(brx_storage_image const *storage_image) override;
 	void build_top_level_acceleration_structure(brx_top_level_acceleration_structure *top_level_acceleration_structure, uint32_t top_level_acceleration_structure_instance_count, brx_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer, brx_scratch_buffer *scratch_buffer) override;
 	void update_top_level_acceleration_structure(brx_top_level_acceleration_structure *top_level_acceleration_structure, brx_top_level_acceleration_structure_instance_upload_buffer *top_level_acceleration_structure_instance_upload_buffer, brx_scratch_buffer *scratch_buffer) override;
 	void acceleration_structure_pass_store_top_level(brx_top_level_acceleration_structure *top_level_acceleration_structure) override;
 	void end() override;
+	BRX_GRAPHICS_COMMAND_BUFFER_STATISTICS get_statistics() const override;
+};
+
+class brx_vk_secondary_graphics_command_buffer : public brx_secondary_graphics_command_buffer
+{
+	// the recording (including the shadow state) is shared with the primary graphics command buffer
+	brx_vk_graphics_command_buffer m_graphics_command_buffer;
+
+public:
+	brx_vk_secondary_graphics_command_buffer();
+	void init(bool support_ray_tracing, bool support_multi_draw_indirect, bool has_dedicated_upload_queue, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, uint32_t compute_queue_family_index, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	~brx_vk_secondary_graphics_command_buffer();
+	VkCommandPool get_command_pool() const;
+	VkCommandBuffer get_command_buffer() const;
+	void begin(brx_render_pass const *render_pass, brx_frame_buffer const *frame_buffer, uint32_t width, uint32_t height) override;
+	void bind_graphics_pipeline(brx_graphics_pipeline const *graphics_pipeline) override;
+	void bind_graphics_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
+	void push_graphics_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values) override;
+	void bind_vertex_buffers(uint32_t vertex_buffer_count, brx_vertex_buffer const *const *vertex_buffers, uint64_t const *vertex_buffer_offsets) override;
+	void draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance) override;
+	void draw_index(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance) override;
+	void draw_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer, uint64_t count_offset) override;
+	void draw_index_indirect(brx_index_buffer const *index_buffer, BRX_GRAPHICS_PIPELINE_INDEX_TYPE index_type, brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset, uint32_t max_draw_count, brx_indirect_argument_buffer const *count_buffer, uint64_t count_offset) override;
+	void end() override;
+	BRX_GRAPHICS_COMMAND_BUFFER_STATISTICS get_statistics() const override;
+};
+
+class brx_vk_compute_command_buffer : public brx_compute_command_buffer
+{
+	// the queue family ownership transfer is NOT required when the compute queue family is the same as the graphics queue family
+	uint32_t m_graphics_queue_family_index;
+	uint32_t m_compute_queue_family_index;
+
+	VkCommandPool m_command_pool;
+	VkCommandBuffer m_command_buffer;
+
+	PFN_vkBeginCommandBuffer m_pfn_begin_command_buffer;
+	PFN_vkCmdPipelineBarrier m_pfn_cmd_pipeline_barrier;
+	PFN_vkCmdBindPipeline m_pfn_cmd_bind_pipeline;
+	PFN_vkCmdBindDescriptorSets m_pfn_cmd_bind_descriptor_sets;
+	PFN_vkCmdPushConstants m_pfn_cmd_push_constants;
+	PFN_vkCmdDispatch m_pfn_cmd_dispatch;
+	PFN_vkCmdDispatchIndirect m_pfn_cmd_dispatch_indirect;
+	PFN_vkEndCommandBuffer m_pfn_end_command_buffer;
+
+	// the shadow state is invalidated by the "begin"
+	VkPipeline m_bound_compute_pipeline;
+	brx_vk_descriptor_set_binding_state m_bound_compute_descriptor_sets;
+
+	brx_vk_pending_pipeline_barrier m_pending_pipeline_barrier;
+
+public:
+	brx_vk_compute_command_buffer();
+	void init(uint32_t graphics_queue_family_index, uint32_t compute_queue_family_index, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	~brx_vk_compute_command_buffer();
+	VkCommandPool get_command_pool() const;
+	VkCommandBuffer get_command_buffer() const;
+	void begin() override;
+	void acquire_storage_buffer_from_graphics_queue(brx_intermediate_storage_buffer const *storage_buffer) override;
+	void acquire_storage_image_from_graphics_queue(brx_storage_image const *storage_image) override;
+	void compute_pass_load_storage_image(brx_storage_image const *storage_image, BRX_STORAGE_IMAGE_LOAD_OPERATION load_operation) override;
+	void compute_pass_load_indirect_argument_buffer(brx_indirect_argument_buffer const *indirect_argument_buffer) override;
+	void bind_compute_pipeline(brx_compute_pipeline const *compute_pipeline) override;
+	void bind_compute_descriptor_sets(brx_pipeline_layout const *pipeline_layout, uint32_t descriptor_set_count, brx_descriptor_set const *const *descriptor_sets, uint32_t dynamic_offet_count, uint32_t const *dynamic_offsets) override;
+	void push_compute_constants(brx_pipeline_layout const *pipeline_layout, uint32_t offset, uint32_t size, void const *values) override;
+	void dispatch(uint32_t group_count_x, uint32_t group_count_y, uint32_t group_count_z) override;
+	void dispatch_indirect(brx_indirect_argument_buffer const *argument_buffer, uint64_t argument_offset) override;
+	void compute_pass_store_storage_image(brx_storage_image const *storage_image, BRX_STORAGE_IMAGE_STORE_OPERATION store_operation) override;
+	void compute_pass_store_indirect_argument_buffer(brx_indirect_argument_buffer const *indirect_argument_buffer) override;
+	void release_storage_buffer_to_graphics_queue(brx_intermediate_storage_buffer const *storage_buffer) override;
+	void release_storage_image_to_graphics_queue(brx_storage_image const *storage_image) override;
+	void end() override;
 };
 
 class brx_vk_upload_command_buffer : public brx_upload_command_buffer
@@ -321,6 +750,9 @@ class brx_vk_upload_command_buffer : public brx_upload_command_buffer
 	uint32_t m_graphics_queue_family_index;
 	uint32_t m_upload_queue_family_index;
 
+	// the "write_timestamp" does nothing when the upload queue family does NOT support the timestamp
+	bool m_support_timestamp;
+
 	VkCommandPool m_graphics_command_pool;
 	VkCommandBuffer m_graphics_command_buffer;
 	VkCommandPool m_upload_command_pool;
@@ -336,12 +768,22 @@ class brx_vk_upload_command_buffer : public brx_upload_command_buffer
 	PFN_vkCmdResetQueryPool m_pfn_cmd_reset_query_pool;
 	PFN_vkCmdWriteAccelerationStructuresPropertiesKHR m_pfn_cmd_write_acceleration_structures_properties;
 	PFN_vkCmdCopyAccelerationStructureKHR m_pfn_cmd_copy_acceleration_structure;
+	PFN_vkCmdWriteTimestamp m_pfn_cmd_write_timestamp;
 	PFN_vkEndCommandBuffer m_pfn_end_command_buffer;
 
+	brx_vk_pending_pipeline_barrier m_pending_pipeline_barrier;
+
+	// the geometries of one bottom level acceleration structure can NOT be split into multiple builds
+	// the scratch arrays are only used (and keep their capacity) when the inline arrays are NOT enough
+	VkAccelerationStructureGeometryKHR m_inline_acceleration_structure_geometries[g_vk_max_inline_bottom_level_acceleration_structure_geometry_count];
+	VkAccelerationStructureBuildRangeInfoKHR m_inline_acceleration_structure_build_range_infos[g_vk_max_inline_bottom_level_acceleration_structure_geometry_count];
+	brx_vector<VkAccelerationStructureGeometryKHR> m_scratch_acceleration_structure_geometries;
+	brx_vector<VkAccelerationStructureBuildRangeInfoKHR> m_scratch_acceleration_structure_build_range_infos;
+
 public:
 	brx_vk_upload_command_buffer();
-	void init(bool support_ray_tracing, bool has_dedicated_upload_queue, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, PFN_vkGetInstanceProcAddr pfn_get_instance_proc_addr, VkInstance instance, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
-	void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void init(bool support_ray_tracing, bool has_dedicated_upload_queue, bool support_timestamp, uint32_t graphics_queue_family_index, uint32_t upload_queue_family_index, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
 	~brx_vk_upload_command_buffer();
 	VkCommandPool get_upload_command_pool() const;
 	VkCommandBuffer get_upload_command_buffer() const;
@@ -360,6 +802,8 @@ public:
 	void release_asset_index_buffer(brx_asset_index_buffer *asset_index_buffer) override;
 	void release_asset_sampled_image(brx_asset_sampled_image *asset_sampled_image, uint32_t dst_mip_level) override;
 	void release_asset_compacted_bottom_level_acceleration_structure(brx_asset_compacted_bottom_level_acceleration_structure *asset_compacted_bottom_level_acceleration_structure) override;
+	void reset_timestamp_query_pool(brx_timestamp_query_pool *timestamp_query_pool) override;
+	void write_timestamp(brx_timestamp_query_pool *timestamp_query_pool, uint32_t query_index) override;
 	void end() override;
 };
 
@@ -374,9 +818,30 @@ public:
 	~brx_vk_fence();
 };
 
+class brx_vk_timeline_fence : public brx_timeline_fence
+{
+	VkSemaphore m_semaphore;
+
+public:
+	brx_vk_timeline_fence(VkSemaphore semaphore);
+	VkSemaphore get_semaphore() const;
+	void steal(VkSemaphore *out_semaphore);
+	~brx_vk_timeline_fence();
+};
+
+union brx_vk_descriptor_update_template_data
+{
+	VkDescriptorBufferInfo buffer_info;
+	VkDescriptorImageInfo image_info;
+	VkAccelerationStructureKHR acceleration_structure;
+};
+
 class brx_vk_descriptor_set_layout : public brx_descriptor_set_layout
 {
 	VkDescriptorSetLayout m_descriptor_set_layout;
+	bool m_update_after_bind;
+	VkDescriptorUpdateTemplate m_descriptor_update_template;
+	brx_vector<BRX_DESCRIPTOR_TYPE> m_descriptor_update_template_descriptor_types;
 	uint32_t m_dynamic_uniform_buffer_descriptor_count;
 	uint32_t m_storage_buffer_descriptor_count;
 	uint32_t m_sampled_image_descriptor_count;
@@ -386,50 +851,108 @@ class brx_vk_descriptor_set_layout : public brx_descriptor_set_layout
 
 public:
 	brx_vk_descriptor_set_layout();
-	void init(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
-	void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void init(uint32_t descriptor_set_binding_count, BRX_DESCRIPTOR_SET_LAYOUT_BINDING const *descriptor_set_bindings, bool descriptor_update_template, bool update_after_bind, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
 	~brx_vk_descriptor_set_layout();
 	VkDescriptorSetLayout get_descriptor_set_layout() const;
+	bool get_update_after_bind() const;
 	uint32_t get_dynamic_uniform_buffer_descriptor_count() const;
 	uint32_t get_storage_buffer_descriptor_count() const;
 	uint32_t get_sampled_image_descriptor_count() const;
 	uint32_t get_sampler_descriptor_count() const;
 	uint32_t get_storage_image_descriptor_count() const;
 	uint32_t get_top_level_acceleration_structure_descriptor_count() const;
+	VkDescriptorUpdateTemplate get_descriptor_update_template() const;
+	uint32_t get_descriptor_update_template_descriptor_count() const;
+	BRX_DESCRIPTOR_TYPE const *get_descriptor_update_template_descriptor_types() const;
 };
 
 class brx_vk_pipeline_layout : public brx_pipeline_layout
 {
 	VkPipelineLayout m_pipeline_layout;
+	uint32_t m_descriptor_set_layout_count;
+	VkDescriptorSetLayout m_descriptor_set_layouts[g_vk_max_descriptor_set_layout_count];
+	uint32_t m_push_constant_size;
 
 public:
-	brx_vk_pipeline_layout(VkPipelineLayout pipeline_layout);
+	brx_vk_pipeline_layout(VkPipelineLayout pipeline_layout, uint32_t descriptor_set_layout_count, VkDescriptorSetLayout const *descriptor_set_layouts, uint32_t push_constant_size);
 	VkPipelineLayout get_pipeline_layout() const;
+	uint32_t get_descriptor_set_layout_count() const;
+	VkDescriptorSetLayout const *get_descriptor_set_layouts() const;
+	uint32_t get_push_constant_size() const;
 	void steal(VkPipelineLayout *out_pipeline_layout);
 	~brx_vk_pipeline_layout();
 };
 
 class brx_vk_descriptor_set : public brx_descriptor_set
 {
-	VkDescriptorPool m_descriptor_pool;
+	brx_vk_descriptor_set_layout const *m_descriptor_set_layout;
 	VkDescriptorSet m_descriptor_set;
 
 public:
 	brx_vk_descriptor_set();
-	void init(brx_descriptor_set_layout const *descriptor_set_layout, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
-	void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void init(brx_vk_descriptor_allocator *descriptor_allocator, brx_descriptor_set_layout const *descriptor_set_layout);
+	void uninit(brx_vk_descriptor_allocator *descriptor_allocator);
+	void init_transient(brx_vk_descriptor_set_layout const *descriptor_set_layout, VkDescriptorSet descriptor_set);
+	void uninit_transient();
 	~brx_vk_descriptor_set();
-	void write_descriptor(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t dst_binding, uint32_t dst_array_element, uint32_t src_descriptor_count, brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_storage_buffer const *const *src_storage_buffers, brx_sampled_image const *const *src_sampled_images, brx_sampler const *const *src_samplers, brx_storage_image const *const *src_storage_images, brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures);
+	void fill_descriptor_write(BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t dst_binding, uint32_t dst_array_element, uint32_t src_descriptor_count, brx_uniform_upload_buffer const *const *src_dynamic_uniform_buffers, uint32_t const *src_dynamic_uniform_buffer_ranges, brx_storage_buffer const *const *src_storage_buffers, brx_sampled_image const *const *src_sampled_images, brx_sampler const *const *src_samplers, brx_storage_image const *const *src_storage_images, brx_top_level_acceleration_structure const *const *src_top_level_acceleration_structures, VkWriteDescriptorSet *out_descriptor_write, VkDescriptorBufferInfo *out_buffer_infos, VkDescriptorImageInfo *out_image_infos, VkWriteDescriptorSetAccelerationStructureKHR *out_descriptor_write_acceleration_structure, VkAccelerationStructureKHR *out_acceleration_structures) const;
+	void write_descriptor_with_template(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, void const *const *src_descriptors, uint32_t const *src_dynamic_uniform_buffer_ranges) const;
 	VkDescriptorSet get_descriptor_set() const;
+	uint32_t get_dynamic_uniform_buffer_descriptor_count() const;
+};
+
+class brx_vk_bindless_table : public brx_bindless_table
+{
+	BRX_DESCRIPTOR_TYPE m_descriptor_type;
+	brx_vk_descriptor_set_layout *m_descriptor_set_layout;
+	brx_vk_descriptor_set *m_descriptor_set;
+	brx_vector<uint32_t> m_free_descriptor_indices;
+
+public:
+	brx_vk_bindless_table();
+	void init(BRX_DESCRIPTOR_TYPE descriptor_type, uint32_t descriptor_count, brx_vk_descriptor_set_layout *descriptor_set_layout, brx_vk_descriptor_set *descriptor_set);
+	void steal(brx_vk_descriptor_set_layout **out_descriptor_set_layout, brx_vk_descriptor_set **out_descriptor_set);
+	~brx_vk_bindless_table();
+	BRX_DESCRIPTOR_TYPE get_descriptor_type() const;
+	brx_vk_descriptor_set_layout *get_descriptor_set_layout() const;
+	brx_vk_descriptor_set *get_descriptor_set() const;
+	uint32_t alloc_descriptor_index();
+	void free_descriptor_index(uint32_t descriptor_index);
+};
+
+class brx_vk_transient_descriptor_allocator : public brx_transient_descriptor_allocator
+{
+	brx_vk_device_dispatch_table const *m_dispatch_table;
+	VkDevice m_device;
+	VkAllocationCallbacks const *m_allocation_callbacks;
+	bool m_support_ray_tracing;
+
+	brx_vector<VkDescriptorPool> m_descriptor_pools;
+	uint32_t m_current_descriptor_pool_index;
+
+	brx_vector<brx_vk_descriptor_set *> m_descriptor_sets;
+	uint32_t m_descriptor_set_count;
+
+public:
+	brx_vk_transient_descriptor_allocator();
+	void init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, bool support_ray_tracing);
+	void uninit();
+	~brx_vk_transient_descriptor_allocator();
+	brx_vk_descriptor_set *alloc_descriptor_set(brx_descriptor_set_layout const *descriptor_set_layout);
+	void reset();
 };
 
 class brx_vk_render_pass : public brx_render_pass
 {
 	VkRenderPass m_render_pass;
+	brx_vector<VkFormat> m_attachment_formats;
 
 public:
-	brx_vk_render_pass(VkRenderPass render_pass);
+	brx_vk_render_pass(VkRenderPass render_pass, uint32_t attachment_count, VkFormat const *attachment_formats);
 	VkRenderPass get_render_pass() const;
+	uint32_t get_attachment_count() const;
+	VkFormat const *get_attachment_formats() const;
 	void steal(VkRenderPass *out_render_pass);
 	~brx_vk_render_pass();
 };
@@ -438,24 +961,43 @@ class brx_vk_graphics_pipeline : public brx_graphics_pipeline
 {
 	VkPipeline m_pipeline;
 
+	// the state is retained to create the variants
+	// the render pass is NOT retained, since the pipeline may be shared by the render passes with the same attachment formats, and any of them may be destroyed at first
+	brx_pipeline_layout const *m_pipeline_layout;
+	brx_vector<BRX_GRAPHICS_PIPELINE_VERTEX_BINDING> m_vertex_bindings;
+	brx_vector<BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE> m_vertex_attributes;
+	bool m_depth_enable;
+	BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION m_depth_compare_operation;
+
 public:
 	brx_vk_graphics_pipeline();
-	void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation);
-	void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VkPipelineCache pipeline_cache, brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, VkShaderModule vertex_shader_module, VkShaderModule fragment_shader_module, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants, VkPipeline base_pipeline);
+	void uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
 	~brx_vk_graphics_pipeline();
 	VkPipeline get_pipeline() const;
+	brx_pipeline_layout const *get_pipeline_layout() const;
+	uint32_t get_vertex_binding_count() const;
+	BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *get_vertex_bindings() const;
+	uint32_t get_vertex_attribute_count() const;
+	BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *get_vertex_attributes() const;
+	bool get_depth_enable() const;
+	BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION get_depth_compare_operation() const;
 };
 
 class brx_vk_compute_pipeline : public brx_compute_pipeline
 {
 	VkPipeline m_pipeline;
 
+	// the state is retained to create the variants
+	brx_pipeline_layout const *m_pipeline_layout;
+
 public:
 	brx_vk_compute_pipeline();
-	void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code);
-	void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VkPipelineCache pipeline_cache, brx_pipeline_layout const *pipeline_layout, VkShaderModule compute_shader_module, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants, VkPipeline base_pipeline);
+	void uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
 	~brx_vk_compute_pipeline();
 	VkPipeline get_pipeline() const;
+	brx_pipeline_layout const *get_pipeline_layout() const;
 };
 
 class brx_vk_frame_buffer : public brx_frame_buffer
@@ -532,7 +1074,13 @@ public:
 	virtual VkDeviceSize get_size() const = 0;
 };
 
-class brx_vk_intermediate_storage_buffer : public brx_intermediate_storage_buffer, brx_vk_storage_buffer, brx_vk_vertex_position_buffer, brx_vk_vertex_varying_buffer, brx_vk_vertex_buffer
+class brx_vk_indirect_argument_buffer : public brx_indirect_argument_buffer
+{
+public:
+	virtual VkBuffer get_buffer() const = 0;
+};
+
+class brx_vk_intermediate_storage_buffer : public brx_intermediate_storage_buffer, brx_vk_storage_buffer, brx_vk_vertex_position_buffer, brx_vk_vertex_varying_buffer, brx_vk_vertex_buffer, brx_vk_indirect_argument_buffer
 {
 	VkBuffer m_buffer;
 	VmaAllocation m_allocation;
@@ -541,7 +1089,7 @@ class brx_vk_intermediate_storage_buffer : public brx_intermediate_storage_buffe
 
 public:
 	brx_vk_intermediate_storage_buffer();
-	void init(bool support_ray_tracing, VkDevice device, PFN_vkGetBufferDeviceAddressKHR pfn_get_buffer_device_address, VmaAllocator memory_allocator, VmaPool storage_buffer_memory_pool, uint32_t size, bool allow_vertex_position, bool allow_vertex_varying);
+	void init(bool support_ray_tracing, VkDevice device, PFN_vkGetBufferDeviceAddressKHR pfn_get_buffer_device_address, VmaAllocator memory_allocator, VmaPool storage_buffer_memory_pool, uint32_t size, bool allow_vertex_position, bool allow_vertex_varying, bool allow_indirect_argument);
 	void uninit(VmaAllocator memory_allocator);
 	~brx_vk_intermediate_storage_buffer();
 	VkBuffer get_buffer() const override;
@@ -551,6 +1099,7 @@ public:
 	brx_vertex_position_buffer const *get_vertex_position_buffer() const override;
 	brx_vertex_varying_buffer const *get_vertex_varying_buffer() const override;
 	brx_storage_buffer const *get_storage_buffer() const override;
+	brx_indirect_argument_buffer const *get_indirect_argument_buffer() const override;
 };
 
 class brx_vk_asset_vertex_position_buffer : public brx_asset_vertex_position_buffer, brx_vk_vertex_position_buffer, brx_vk_vertex_buffer, brx_vk_storage_buffer
@@ -643,8 +1192,8 @@ class brx_vk_intermediate_color_attachment_image : public brx_vk_color_attachmen
 
 public:
 	brx_vk_intermediate_color_attachment_image();
-	void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, uint32_t color_transient_attachment_image_memory_index, uint32_t color_attachment_sampled_image_memory_index, BRX_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image);
-	void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, uint32_t color_transient_attachment_image_memory_index, uint32_t color_attachment_sampled_image_memory_index, BRX_COLOR_ATTACHMENT_IMAGE_FORMAT color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image);
+	void uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
 	~brx_vk_intermediate_color_attachment_image();
 	VkImageView get_image_view() const override;
 	brx_sampled_image const *get_sampled_image() const override;
@@ -658,8 +1207,8 @@ class brx_vk_intermediate_depth_stencil_attachment_image : public brx_vk_depth_s
 
 public:
 	brx_vk_intermediate_depth_stencil_attachment_image();
-	void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, uint32_t depth_transient_attachment_image_memory_index, uint32_t depth_attachment_sampled_image_memory_index, uint32_t depth_stencil_transient_attachment_image_memory_index, uint32_t depth_stencil_attachment_sampled_image_memory_index, BRX_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image);
-	void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, uint32_t depth_transient_attachment_image_memory_index, uint32_t depth_attachment_sampled_image_memory_index, uint32_t depth_stencil_transient_attachment_image_memory_index, uint32_t depth_stencil_attachment_sampled_image_memory_index, BRX_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image);
+	void uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
 	~brx_vk_intermediate_depth_stencil_attachment_image();
 	VkImageView get_image_view() const override;
 	brx_sampled_image const *get_sampled_image() const override;
@@ -775,8 +1324,8 @@ class brx_vk_staging_non_compacted_bottom_level_acceleration_structure : public
 
 public:
 	brx_vk_staging_non_compacted_bottom_level_acceleration_structure();
-	void init(VmaAllocator memory_allocator, VmaPool staging_non_compacted_bottom_level_acceleration_structure_memory_pool, uint32_t size, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
-	void uninit(VmaAllocator memory_allocator, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void init(VmaAllocator memory_allocator, VmaPool staging_non_compacted_bottom_level_acceleration_structure_memory_pool, uint32_t size, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void uninit(VmaAllocator memory_allocator, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
 	~brx_vk_staging_non_compacted_bottom_level_acceleration_structure();
 	VkAccelerationStructureKHR get_acceleration_structure() const;
 };
@@ -787,12 +1336,28 @@ class brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool : pub
 
 public:
 	brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool();
-	void init(uint32_t query_count, PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
-	void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void init(uint32_t query_count, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
 	~brx_vk_compacted_bottom_level_acceleration_structure_size_query_pool();
 	VkQueryPool get_query_pool() const;
 };
 
+class brx_vk_timestamp_query_pool : public brx_timestamp_query_pool
+{
+	VkQueryPool m_query_pool;
+	uint32_t m_query_count;
+	brx_timestamp_query_label_list m_label_list;
+
+public:
+	brx_vk_timestamp_query_pool();
+	void init(uint32_t query_count, brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	void uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks);
+	~brx_vk_timestamp_query_pool();
+	VkQueryPool get_query_pool() const;
+	uint32_t get_query_count() const;
+	brx_timestamp_query_label_list *get_label_list();
+};
+
 class brx_vk_asset_compacted_bottom_level_acceleration_structure : public brx_asset_compacted_bottom_level_acceleration_structure
 {
 	VkBuffer m_buffer;
@@ -802,8 +1367,8 @@ class brx_vk_asset_compacted_bottom_level_acceleration_structure : public brx_as
 
 public:
 	brx_vk_asset_compacted_bottom_level_acceleration_structure();
-	void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool asset_compacted_bottom_level_acceleration_structure_memory_pool, uint32_t size);
-	void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator);
+	void init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool asset_compacted_bottom_level_acceleration_structure_memory_pool, uint32_t size);
+	void uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator);
 	~brx_vk_asset_compacted_bottom_level_acceleration_structure();
 	VkBuffer get_buffer() const;
 	VkAccelerationStructureKHR get_acceleration_structure() const;
@@ -836,8 +1401,8 @@ class brx_vk_top_level_acceleration_structure : public brx_top_level_acceleratio
 
 public:
 	brx_vk_top_level_acceleration_structure();
-	void init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool top_level_acceleration_structure_memory_pool, uint32_t size);
-	void uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator);
+	void init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator, VmaPool top_level_acceleration_structure_memory_pool, uint32_t size);
+	void uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VmaAllocator memory_allocator);
 	~brx_vk_top_level_acceleration_structure();
 	VkBuffer get_buffer() const;
 	VkAccelerationStructureKHR get_acceleration_structure() const;
@@ -39,4 +39,26 @@ void brx_vk_fence::steal(VkFence *out_fence)
 brx_vk_fence::~brx_vk_fence()
 {
 	assert(VK_NULL_HANDLE == this->m_fence);
-}
\ No newline at end of file
+}
+brx_vk_timeline_fence::brx_vk_timeline_fence(VkSemaphore semaphore) : m_semaphore(semaphore)
+{
+}
+
+VkSemaphore brx_vk_timeline_fence::get_semaphore() const
+{
+	return this->m_semaphore;
+}
+
+void brx_vk_timeline_fence::steal(VkSemaphore *out_semaphore)
+{
+	assert(NULL != out_semaphore);
+
+	(*out_semaphore) = this->m_semaphore;
+
+	this->m_semaphore = VK_NULL_HANDLE;
+}
+
+brx_vk_timeline_fence::~brx_vk_timeline_fence()
+{
+	assert(VK_NULL_HANDLE == this->m_semaphore);
+}
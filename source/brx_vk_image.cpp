@@ -22,17 +22,17 @@ brx_vk_intermediate_color_attachment_image::brx_vk_intermediate_color_attachment
 {
 }
 
-void brx_vk_intermediate_color_attachment_image::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, uint32_t color_transient_attachment_image_memory_index, uint32_t color_attachment_sampled_image_memory_index, BRX_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image)
+void brx_vk_intermediate_color_attachment_image::init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, uint32_t color_transient_attachment_image_memory_index, uint32_t color_attachment_sampled_image_memory_index, BRX_COLOR_ATTACHMENT_IMAGE_FORMAT wrapped_color_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image)
 {
-	PFN_vkCreateImage const pfn_create_image = reinterpret_cast<PFN_vkCreateImage>(pfn_get_device_proc_addr(device, "vkCreateImage"));
+	PFN_vkCreateImage const pfn_create_image = dispatch_table->pfn_create_image;
 	assert(NULL != pfn_create_image);
-	PFN_vkGetImageMemoryRequirements const pfn_get_image_memory_requirements = reinterpret_cast<PFN_vkGetImageMemoryRequirements>(pfn_get_device_proc_addr(device, "vkGetImageMemoryRequirements"));
+	PFN_vkGetImageMemoryRequirements const pfn_get_image_memory_requirements = dispatch_table->pfn_get_image_memory_requirements;
 	assert(NULL != pfn_get_image_memory_requirements);
-	PFN_vkAllocateMemory const pfn_allocate_memory = reinterpret_cast<PFN_vkAllocateMemory>(pfn_get_device_proc_addr(device, "vkAllocateMemory"));
+	PFN_vkAllocateMemory const pfn_allocate_memory = dispatch_table->pfn_allocate_memory;
 	assert(NULL != pfn_allocate_memory);
-	PFN_vkBindImageMemory const pfn_bind_image_memory = reinterpret_cast<PFN_vkBindImageMemory>(pfn_get_device_proc_addr(device, "vkBindImageMemory"));
+	PFN_vkBindImageMemory const pfn_bind_image_memory = dispatch_table->pfn_bind_image_memory;
 	assert(NULL != pfn_bind_image_memory);
-	PFN_vkCreateImageView const pfn_create_image_view = reinterpret_cast<PFN_vkCreateImageView>(pfn_get_device_proc_addr(device, "vkCreateImageView"));
+	PFN_vkCreateImageView const pfn_create_image_view = dispatch_table->pfn_create_image_view;
 	assert(NULL != pfn_create_image_view);
 
 	VkFormat format;
@@ -115,13 +115,13 @@ void brx_vk_intermediate_color_attachment_image::init(PFN_vkGetDeviceProcAddr pf
 	assert(VK_SUCCESS == res_create_image_view);
 }
 
-void brx_vk_intermediate_color_attachment_image::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_intermediate_color_attachment_image::uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
-	PFN_vkDestroyImageView const pfn_destroy_image_view = reinterpret_cast<PFN_vkDestroyImageView>(pfn_get_device_proc_addr(device, "vkDestroyImageView"));
+	PFN_vkDestroyImageView const pfn_destroy_image_view = dispatch_table->pfn_destroy_image_view;
 	assert(NULL != pfn_destroy_image_view);
-	PFN_vkDestroyImage const pfn_destroy_image = reinterpret_cast<PFN_vkDestroyImage>(pfn_get_device_proc_addr(device, "vkDestroyImage"));
+	PFN_vkDestroyImage const pfn_destroy_image = dispatch_table->pfn_destroy_image;
 	assert(NULL != pfn_destroy_image);
-	PFN_vkFreeMemory const pfn_free_memory = reinterpret_cast<PFN_vkFreeMemory>(pfn_get_device_proc_addr(device, "vkFreeMemory"));
+	PFN_vkFreeMemory const pfn_free_memory = dispatch_table->pfn_free_memory;
 	assert(NULL != pfn_free_memory);
 
 	assert(VK_NULL_HANDLE != this->m_image_view);
@@ -158,17 +158,17 @@ brx_vk_intermediate_depth_stencil_attachment_image::brx_vk_intermediate_depth_st
 {
 }
 
-void brx_vk_intermediate_depth_stencil_attachment_image::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, uint32_t depth_transient_attachment_image_memory_index, uint32_t depth_attachment_sampled_image_memory_index, uint32_t depth_stencil_transient_attachment_image_memory_index, uint32_t depth_stencil_attachment_sampled_image_memory_index, BRX_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image)
+void brx_vk_intermediate_depth_stencil_attachment_image::init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, uint32_t depth_transient_attachment_image_memory_index, uint32_t depth_attachment_sampled_image_memory_index, uint32_t depth_stencil_transient_attachment_image_memory_index, uint32_t depth_stencil_attachment_sampled_image_memory_index, BRX_DEPTH_STENCIL_ATTACHMENT_IMAGE_FORMAT wrapped_depth_stencil_attachment_image_format, uint32_t width, uint32_t height, bool allow_sampled_image)
 {
-	PFN_vkCreateImage const pfn_create_image = reinterpret_cast<PFN_vkCreateImage>(pfn_get_device_proc_addr(device, "vkCreateImage"));
+	PFN_vkCreateImage const pfn_create_image = dispatch_table->pfn_create_image;
 	assert(NULL != pfn_create_image);
-	PFN_vkGetImageMemoryRequirements const pfn_get_image_memory_requirements = reinterpret_cast<PFN_vkGetImageMemoryRequirements>(pfn_get_device_proc_addr(device, "vkGetImageMemoryRequirements"));
+	PFN_vkGetImageMemoryRequirements const pfn_get_image_memory_requirements = dispatch_table->pfn_get_image_memory_requirements;
 	assert(NULL != pfn_get_image_memory_requirements);
-	PFN_vkAllocateMemory const pfn_allocate_memory = reinterpret_cast<PFN_vkAllocateMemory>(pfn_get_device_proc_addr(device, "vkAllocateMemory"));
+	PFN_vkAllocateMemory const pfn_allocate_memory = dispatch_table->pfn_allocate_memory;
 	assert(NULL != pfn_allocate_memory);
-	PFN_vkBindImageMemory const pfn_bind_image_memory = reinterpret_cast<PFN_vkBindImageMemory>(pfn_get_device_proc_addr(device, "vkBindImageMemory"));
+	PFN_vkBindImageMemory const pfn_bind_image_memory = dispatch_table->pfn_bind_image_memory;
 	assert(NULL != pfn_bind_image_memory);
-	PFN_vkCreateImageView const pfn_create_image_view = reinterpret_cast<PFN_vkCreateImageView>(pfn_get_device_proc_addr(device, "vkCreateImageView"));
+	PFN_vkCreateImageView const pfn_create_image_view = dispatch_table->pfn_create_image_view;
 	assert(NULL != pfn_create_image_view);
 
 	VkFormat format;
@@ -256,13 +256,13 @@ void brx_vk_intermediate_depth_stencil_attachment_image::init(PFN_vkGetDevicePro
 	assert(VK_SUCCESS == res_create_image_view);
 }
 
-void brx_vk_intermediate_depth_stencil_attachment_image::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_intermediate_depth_stencil_attachment_image::uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
-	PFN_vkDestroyImageView const pfn_destroy_image_view = reinterpret_cast<PFN_vkDestroyImageView>(pfn_get_device_proc_addr(device, "vkDestroyImageView"));
+	PFN_vkDestroyImageView const pfn_destroy_image_view = dispatch_table->pfn_destroy_image_view;
 	assert(NULL != pfn_destroy_image_view);
-	PFN_vkDestroyImage const pfn_destroy_image = reinterpret_cast<PFN_vkDestroyImage>(pfn_get_device_proc_addr(device, "vkDestroyImage"));
+	PFN_vkDestroyImage const pfn_destroy_image = dispatch_table->pfn_destroy_image;
 	assert(NULL != pfn_destroy_image);
-	PFN_vkFreeMemory const pfn_free_memory = reinterpret_cast<PFN_vkFreeMemory>(pfn_get_device_proc_addr(device, "vkFreeMemory"));
+	PFN_vkFreeMemory const pfn_free_memory = dispatch_table->pfn_free_memory;
 	assert(NULL != pfn_free_memory);
 
 	assert(VK_NULL_HANDLE != this->m_image_view);
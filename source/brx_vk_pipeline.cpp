@@ -19,17 +19,13 @@
 #include "brx_vector.h"
 #include <assert.h>
 
-brx_vk_graphics_pipeline::brx_vk_graphics_pipeline() : m_pipeline(VK_NULL_HANDLE)
+brx_vk_graphics_pipeline::brx_vk_graphics_pipeline() : m_pipeline(VK_NULL_HANDLE), m_pipeline_layout(NULL), m_depth_enable(false), m_depth_compare_operation(BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION_ALWAYS)
 {
 }
 
-void brx_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_render_pass const *wrapped_render_pass, brx_pipeline_layout const *wrapped_pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION wrapped_depth_compare_operation)
+void brx_vk_graphics_pipeline::init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VkPipelineCache pipeline_cache, brx_render_pass const *wrapped_render_pass, brx_pipeline_layout const *wrapped_pipeline_layout, VkShaderModule vertex_shader_module, VkShaderModule fragment_shader_module, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION wrapped_depth_compare_operation, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants, VkPipeline base_pipeline)
 {
-	PFN_vkCreateShaderModule const pfn_create_shader_module = reinterpret_cast<PFN_vkCreateShaderModule>(pfn_get_device_proc_addr(device, "vkCreateShaderModule"));
-	assert(pfn_create_shader_module);
-	PFN_vkDestroyShaderModule const pfn_destroy_shader_module = reinterpret_cast<PFN_vkDestroyShaderModule>(pfn_get_device_proc_addr(device, "vkDestroyShaderModule"));
-	assert(pfn_destroy_shader_module);
-	PFN_vkCreateGraphicsPipelines const pfn_create_graphics_pipelines = reinterpret_cast<PFN_vkCreateGraphicsPipelines>(pfn_get_device_proc_addr(device, "vkCreateGraphicsPipelines"));
+	PFN_vkCreateGraphicsPipelines const pfn_create_graphics_pipelines = dispatch_table->pfn_create_graphics_pipelines;
 	assert(pfn_create_graphics_pipelines);
 
 	// NOTE: single subpass is enough
@@ -43,32 +39,27 @@ void brx_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_
 	assert(NULL != wrapped_pipeline_layout);
 	VkPipelineLayout pipeline_layout = static_cast<brx_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
 
-	VkShaderModule vertex_shader_module = VK_NULL_HANDLE;
-	{
-		VkShaderModuleCreateInfo const shader_module_create_info = {
-			VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
-			NULL,
-			0U,
-			vertex_shader_module_code_size,
-			static_cast<uint32_t const *>(vertex_shader_module_code)};
-
-		VkResult const res_create_shader_module = pfn_create_shader_module(device, &shader_module_create_info, NULL, &vertex_shader_module);
-		assert(VK_SUCCESS == res_create_shader_module);
-	}
+	// the shader modules are owned by the pipeline state cache of the device
+	assert(VK_NULL_HANDLE != vertex_shader_module);
+	assert(VK_NULL_HANDLE != fragment_shader_module);
 
-	VkShaderModule fragment_shader_module = VK_NULL_HANDLE;
+	// the same specialization constants are used by both stages, and the constant ids which are not used by the stage are ignored
+	brx_vector<VkSpecializationMapEntry> specialization_map_entries(static_cast<size_t>(specialization_constant_count));
+	brx_vector<uint32_t> specialization_data(static_cast<size_t>(specialization_constant_count));
+	for (uint32_t specialization_constant_index = 0U; specialization_constant_index < specialization_constant_count; ++specialization_constant_index)
 	{
-		VkShaderModuleCreateInfo const shader_module_create_info = {
-			VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
-			NULL,
-			0U,
-			fragment_shader_module_code_size,
-			static_cast<uint32_t const *>(fragment_shader_module_code)};
-
-		VkResult const res_create_shader_module = pfn_create_shader_module(device, &shader_module_create_info, NULL, &fragment_shader_module);
-		assert(VK_SUCCESS == res_create_shader_module);
+		specialization_map_entries[specialization_constant_index].constantID = specialization_constants[specialization_constant_index].constant_id;
+		specialization_map_entries[specialization_constant_index].offset = sizeof(uint32_t) * specialization_constant_index;
+		specialization_map_entries[specialization_constant_index].size = sizeof(uint32_t);
+		specialization_data[specialization_constant_index] = specialization_constants[specialization_constant_index].value;
 	}
 
+	VkSpecializationInfo const specialization_info = {
+		specialization_constant_count,
+		(specialization_constant_count > 0U) ? &specialization_map_entries[0] : NULL,
+		sizeof(uint32_t) * specialization_constant_count,
+		(specialization_constant_count > 0U) ? &specialization_data[0] : NULL};
+
 	VkPipelineShaderStageCreateInfo const stages[2] =
 		{
 			{VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
@@ -77,14 +68,14 @@ void brx_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_
 			 VK_SHADER_STAGE_VERTEX_BIT,
 			 vertex_shader_module,
 			 "main",
-			 NULL},
+			 (specialization_constant_count > 0U) ? &specialization_info : NULL},
 			{VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
 			 NULL,
 			 0U,
 			 VK_SHADER_STAGE_FRAGMENT_BIT,
 			 fragment_shader_module,
 			 "main",
-			 NULL}};
+			 (specialization_constant_count > 0U) ? &specialization_info : NULL}};
 
 	brx_vector<VkVertexInputBindingDescription> vertex_binding_descriptions(static_cast<size_t>(vertex_binding_count));
 	for (uint32_t vertex_binding_index = 0U; vertex_binding_index < vertex_binding_count; ++vertex_binding_index)
@@ -227,10 +218,11 @@ void brx_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_
 		sizeof(dynamic_states) / sizeof(dynamic_states[0]),
 		dynamic_states};
 
+	// the variants are derived from the base pipeline, which may shorten the compile time on some drivers
 	VkGraphicsPipelineCreateInfo const graphics_pipeline_create_info = {
 		VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
 		NULL,
-		0U,
+		(VK_NULL_HANDLE != base_pipeline) ? (VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT | VK_PIPELINE_CREATE_DERIVATIVE_BIT) : VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT,
 		sizeof(stages) / sizeof(stages[0]),
 		stages,
 		&vertex_input_state,
@@ -245,19 +237,22 @@ void brx_vk_graphics_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_
 		pipeline_layout,
 		render_pass,
 		subpass_index,
-		VK_NULL_HANDLE,
-		0U};
+		base_pipeline,
+		-1};
 	assert(VK_NULL_HANDLE == this->m_pipeline);
-	VkResult const res_create_graphics_pipelines = pfn_create_graphics_pipelines(device, VK_NULL_HANDLE, 1U, &graphics_pipeline_create_info, allocation_callbacks, &this->m_pipeline);
+	VkResult const res_create_graphics_pipelines = pfn_create_graphics_pipelines(device, pipeline_cache, 1U, &graphics_pipeline_create_info, allocation_callbacks, &this->m_pipeline);
 	assert(VK_SUCCESS == res_create_graphics_pipelines);
 
-	pfn_destroy_shader_module(device, vertex_shader_module, allocation_callbacks);
-	pfn_destroy_shader_module(device, fragment_shader_module, allocation_callbacks);
+	this->m_pipeline_layout = wrapped_pipeline_layout;
+	this->m_vertex_bindings.assign(vertex_bindings, vertex_bindings + vertex_binding_count);
+	this->m_vertex_attributes.assign(vertex_attributes, vertex_attributes + vertex_attribute_count);
+	this->m_depth_enable = depth_enable;
+	this->m_depth_compare_operation = wrapped_depth_compare_operation;
 }
 
-void brx_vk_graphics_pipeline::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_graphics_pipeline::uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
-	PFN_vkDestroyPipeline const pfn_destroy_pipeline = reinterpret_cast<PFN_vkDestroyPipeline>(pfn_get_device_proc_addr(device, "vkDestroyPipeline"));
+	PFN_vkDestroyPipeline const pfn_destroy_pipeline = dispatch_table->pfn_destroy_pipeline;
 	assert(NULL != pfn_destroy_pipeline);
 
 	assert(VK_NULL_HANDLE != this->m_pipeline);
@@ -277,53 +272,90 @@ VkPipeline brx_vk_graphics_pipeline::get_pipeline() const
 	return this->m_pipeline;
 }
 
-brx_vk_compute_pipeline::brx_vk_compute_pipeline() : m_pipeline(VK_NULL_HANDLE)
+brx_pipeline_layout const *brx_vk_graphics_pipeline::get_pipeline_layout() const
+{
+	return this->m_pipeline_layout;
+}
+
+uint32_t brx_vk_graphics_pipeline::get_vertex_binding_count() const
+{
+	return static_cast<uint32_t>(this->m_vertex_bindings.size());
+}
+
+BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *brx_vk_graphics_pipeline::get_vertex_bindings() const
+{
+	return this->m_vertex_bindings.data();
+}
+
+uint32_t brx_vk_graphics_pipeline::get_vertex_attribute_count() const
+{
+	return static_cast<uint32_t>(this->m_vertex_attributes.size());
+}
+
+BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *brx_vk_graphics_pipeline::get_vertex_attributes() const
 {
+	return this->m_vertex_attributes.data();
 }
 
-void brx_vk_compute_pipeline::init(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, brx_pipeline_layout const *wrapped_pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code)
+bool brx_vk_graphics_pipeline::get_depth_enable() const
 {
-	PFN_vkCreateShaderModule const pfn_create_shader_module = reinterpret_cast<PFN_vkCreateShaderModule>(pfn_get_device_proc_addr(device, "vkCreateShaderModule"));
-	assert(pfn_create_shader_module);
-	PFN_vkDestroyShaderModule const pfn_destroy_shader_module = reinterpret_cast<PFN_vkDestroyShaderModule>(pfn_get_device_proc_addr(device, "vkDestroyShaderModule"));
-	assert(pfn_destroy_shader_module);
-	PFN_vkCreateComputePipelines const pfn_create_compute_pipelines = reinterpret_cast<PFN_vkCreateComputePipelines>(pfn_get_device_proc_addr(device, "vkCreateComputePipelines"));
+	return this->m_depth_enable;
+}
+
+BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION brx_vk_graphics_pipeline::get_depth_compare_operation() const
+{
+	return this->m_depth_compare_operation;
+}
+
+brx_vk_compute_pipeline::brx_vk_compute_pipeline() : m_pipeline(VK_NULL_HANDLE), m_pipeline_layout(NULL)
+{
+}
+
+void brx_vk_compute_pipeline::init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VkPipelineCache pipeline_cache, brx_pipeline_layout const *wrapped_pipeline_layout, VkShaderModule compute_shader_module, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants, VkPipeline base_pipeline)
+{
+	PFN_vkCreateComputePipelines const pfn_create_compute_pipelines = dispatch_table->pfn_create_compute_pipelines;
 	assert(pfn_create_compute_pipelines);
 
 	assert(NULL != wrapped_pipeline_layout);
 	VkPipelineLayout pipeline_layout = static_cast<brx_vk_pipeline_layout const *>(wrapped_pipeline_layout)->get_pipeline_layout();
 
-	VkShaderModule compute_shader_module = VK_NULL_HANDLE;
+	// the shader module is owned by the pipeline state cache of the device
+	assert(VK_NULL_HANDLE != compute_shader_module);
+
+	brx_vector<VkSpecializationMapEntry> specialization_map_entries(static_cast<size_t>(specialization_constant_count));
+	brx_vector<uint32_t> specialization_data(static_cast<size_t>(specialization_constant_count));
+	for (uint32_t specialization_constant_index = 0U; specialization_constant_index < specialization_constant_count; ++specialization_constant_index)
 	{
-		VkShaderModuleCreateInfo const shader_module_create_info = {
-			VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
-			NULL,
-			0U,
-			compute_shader_module_code_size,
-			static_cast<uint32_t const *>(compute_shader_module_code)};
-
-		VkResult const res_create_shader_module = pfn_create_shader_module(device, &shader_module_create_info, NULL, &compute_shader_module);
-		assert(VK_SUCCESS == res_create_shader_module);
+		specialization_map_entries[specialization_constant_index].constantID = specialization_constants[specialization_constant_index].constant_id;
+		specialization_map_entries[specialization_constant_index].offset = sizeof(uint32_t) * specialization_constant_index;
+		specialization_map_entries[specialization_constant_index].size = sizeof(uint32_t);
+		specialization_data[specialization_constant_index] = specialization_constants[specialization_constant_index].value;
 	}
 
+	VkSpecializationInfo const specialization_info = {
+		specialization_constant_count,
+		(specialization_constant_count > 0U) ? &specialization_map_entries[0] : NULL,
+		sizeof(uint32_t) * specialization_constant_count,
+		(specialization_constant_count > 0U) ? &specialization_data[0] : NULL};
+
 	VkComputePipelineCreateInfo const compute_pipeline_create_info = {
 		VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
 		NULL,
-		0U,
-		{VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, NULL, 0U, VK_SHADER_STAGE_COMPUTE_BIT, compute_shader_module, "main", NULL},
+		(VK_NULL_HANDLE != base_pipeline) ? (VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT | VK_PIPELINE_CREATE_DERIVATIVE_BIT) : VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT,
+		{VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, NULL, 0U, VK_SHADER_STAGE_COMPUTE_BIT, compute_shader_module, "main", (specialization_constant_count > 0U) ? &specialization_info : NULL},
 		pipeline_layout,
-		VK_NULL_HANDLE,
-		0U};
+		base_pipeline,
+		-1};
 	assert(VK_NULL_HANDLE == this->m_pipeline);
-	VkResult const res_create_compute_pipelines = pfn_create_compute_pipelines(device, VK_NULL_HANDLE, 1U, &compute_pipeline_create_info, allocation_callbacks, &this->m_pipeline);
+	VkResult const res_create_compute_pipelines = pfn_create_compute_pipelines(device, pipeline_cache, 1U, &compute_pipeline_create_info, allocation_callbacks, &this->m_pipeline);
 	assert(VK_SUCCESS == res_create_compute_pipelines);
 
-	pfn_destroy_shader_module(device, compute_shader_module, allocation_callbacks);
+	this->m_pipeline_layout = wrapped_pipeline_layout;
 }
 
-void brx_vk_compute_pipeline::uninit(PFN_vkGetDeviceProcAddr pfn_get_device_proc_addr, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
+void brx_vk_compute_pipeline::uninit(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks)
 {
-	PFN_vkDestroyPipeline const pfn_destroy_pipeline = reinterpret_cast<PFN_vkDestroyPipeline>(pfn_get_device_proc_addr(device, "vkDestroyPipeline"));
+	PFN_vkDestroyPipeline const pfn_destroy_pipeline = dispatch_table->pfn_destroy_pipeline;
 	assert(NULL != pfn_destroy_pipeline);
 
 	assert(VK_NULL_HANDLE != this->m_pipeline);
@@ -342,3 +374,8 @@ VkPipeline brx_vk_compute_pipeline::get_pipeline() const
 {
 	return this->m_pipeline;
 }
+
+brx_pipeline_layout const *brx_vk_compute_pipeline::get_pipeline_layout() const
+{
+	return this->m_pipeline_layout;
+}
@@ -0,0 +1,469 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "brx_vk_device.h"
+#include "brx_malloc.h"
+#include <tuple>
+#include <algorithm>
+#include <assert.h>
+#include <new>
+
+static inline uint64_t brx_vk_shader_module_code_hash(size_t shader_module_code_size, void const *shader_module_code);
+
+bool brx_vk_shader_module_key::operator<(brx_vk_shader_module_key const &other) const
+{
+	return std::tie(this->code_hash, this->code) < std::tie(other.code_hash, other.code);
+}
+
+bool brx_vk_graphics_pipeline_state_key::operator<(brx_vk_graphics_pipeline_state_key const &other) const
+{
+	return std::tie(this->vertex_shader_module, this->fragment_shader_module, this->pipeline_layout, this->depth_enable, this->depth_compare_operation, this->render_pass_attachment_formats, this->vertex_input_state, this->specialization_constants) < std::tie(other.vertex_shader_module, other.fragment_shader_module, other.pipeline_layout, other.depth_enable, other.depth_compare_operation, other.render_pass_attachment_formats, other.vertex_input_state, other.specialization_constants);
+}
+
+bool brx_vk_compute_pipeline_state_key::operator<(brx_vk_compute_pipeline_state_key const &other) const
+{
+	return std::tie(this->compute_shader_module, this->pipeline_layout, this->specialization_constants) < std::tie(other.compute_shader_module, other.pipeline_layout, other.specialization_constants);
+}
+
+brx_vk_pipeline_state_cache::brx_vk_pipeline_state_cache()
+	: m_dispatch_table(NULL),
+	  m_device(VK_NULL_HANDLE),
+	  m_allocation_callbacks(NULL),
+	  m_pipeline_cache(VK_NULL_HANDLE),
+	  m_compiling_pipeline_count(0U)
+{
+}
+
+void brx_vk_pipeline_state_cache::init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VkPipelineCache pipeline_cache)
+{
+	assert(NULL == this->m_dispatch_table);
+	this->m_dispatch_table = dispatch_table;
+
+	assert(VK_NULL_HANDLE == this->m_device);
+	this->m_device = device;
+
+	assert(NULL == this->m_allocation_callbacks);
+	this->m_allocation_callbacks = allocation_callbacks;
+
+	assert(VK_NULL_HANDLE == this->m_pipeline_cache);
+	this->m_pipeline_cache = pipeline_cache;
+}
+
+void brx_vk_pipeline_state_cache::uninit()
+{
+	// the shader modules are released when the pipelines are destroyed
+	assert(this->m_graphics_pipelines.empty());
+	assert(this->m_compute_pipelines.empty());
+	assert(this->m_shader_modules.empty());
+	assert(0U == this->m_compiling_pipeline_count);
+
+	this->m_pipeline_cache = VK_NULL_HANDLE;
+
+	this->m_allocation_callbacks = NULL;
+
+	assert(VK_NULL_HANDLE != this->m_device);
+	this->m_device = VK_NULL_HANDLE;
+
+	assert(NULL != this->m_dispatch_table);
+	this->m_dispatch_table = NULL;
+}
+
+brx_vk_pipeline_state_cache::~brx_vk_pipeline_state_cache()
+{
+	assert(NULL == this->m_dispatch_table);
+	assert(VK_NULL_HANDLE == this->m_device);
+	assert(this->m_shader_modules.empty());
+	assert(this->m_graphics_pipelines.empty());
+	assert(this->m_compute_pipelines.empty());
+}
+
+VkShaderModule brx_vk_pipeline_state_cache::acquire_shader_module(size_t shader_module_code_size, void const *shader_module_code)
+{
+	brx_vk_shader_module_key shader_module_key;
+	shader_module_key.code_hash = brx_vk_shader_module_code_hash(shader_module_code_size, shader_module_code);
+	shader_module_key.code.assign(static_cast<uint8_t const *>(shader_module_code), static_cast<uint8_t const *>(shader_module_code) + shader_module_code_size);
+
+	brx_map<brx_vk_shader_module_key, brx_vk_pipeline_state_cache_entry<VkShaderModule>>::iterator const found = this->m_shader_modules.find(shader_module_key);
+	if (this->m_shader_modules.end() != found)
+	{
+		++found->second.ref_count;
+		return found->second.value;
+	}
+
+	VkShaderModule shader_module = VK_NULL_HANDLE;
+	{
+		VkShaderModuleCreateInfo const shader_module_create_info = {
+			VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+			NULL,
+			0U,
+			shader_module_code_size,
+			static_cast<uint32_t const *>(shader_module_code)};
+
+		VkResult const res_create_shader_module = this->m_dispatch_table->pfn_create_shader_module(this->m_device, &shader_module_create_info, this->m_allocation_callbacks, &shader_module);
+		assert(VK_SUCCESS == res_create_shader_module);
+	}
+
+	brx_vk_pipeline_state_cache_entry<VkShaderModule> const shader_module_entry = {shader_module, 1U};
+	brx_map<brx_vk_shader_module_key, brx_vk_pipeline_state_cache_entry<VkShaderModule>>::iterator const inserted = this->m_shader_modules.emplace(std::move(shader_module_key), shader_module_entry).first;
+	this->m_shader_module_keys.emplace(shader_module, inserted);
+
+	return shader_module;
+}
+
+void brx_vk_pipeline_state_cache::release_shader_module(VkShaderModule shader_module)
+{
+	brx_map<VkShaderModule, brx_map<brx_vk_shader_module_key, brx_vk_pipeline_state_cache_entry<VkShaderModule>>::iterator>::iterator const found_key = this->m_shader_module_keys.find(shader_module);
+	assert(this->m_shader_module_keys.end() != found_key);
+
+	brx_map<brx_vk_shader_module_key, brx_vk_pipeline_state_cache_entry<VkShaderModule>>::iterator const found = found_key->second;
+	assert(shader_module == found->second.value);
+
+	assert(found->second.ref_count > 0U);
+	--found->second.ref_count;
+
+	if (0U == found->second.ref_count)
+	{
+		this->m_shader_modules.erase(found);
+		this->m_shader_module_keys.erase(found_key);
+
+		this->m_dispatch_table->pfn_destroy_shader_module(this->m_device, shader_module, this->m_allocation_callbacks);
+	}
+}
+
+void brx_vk_pipeline_state_cache::retain_shader_module(VkShaderModule shader_module)
+{
+	brx_map<VkShaderModule, brx_map<brx_vk_shader_module_key, brx_vk_pipeline_state_cache_entry<VkShaderModule>>::iterator>::iterator const found_key = this->m_shader_module_keys.find(shader_module);
+	assert(this->m_shader_module_keys.end() != found_key);
+
+	assert(found_key->second->second.ref_count > 0U);
+	++found_key->second->second.ref_count;
+}
+
+brx_vk_graphics_pipeline *brx_vk_pipeline_state_cache::create_graphics_pipeline(brx_render_pass const *wrapped_render_pass, brx_pipeline_layout const *wrapped_pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation)
+{
+	assert(NULL != wrapped_render_pass);
+	brx_vk_render_pass const *const unwrapped_render_pass = static_cast<brx_vk_render_pass const *>(wrapped_render_pass);
+
+	assert(NULL != wrapped_pipeline_layout);
+	brx_vk_pipeline_layout const *const unwrapped_pipeline_layout = static_cast<brx_vk_pipeline_layout const *>(wrapped_pipeline_layout);
+
+	brx_vk_graphics_pipeline_state_key graphics_pipeline_state_key;
+	graphics_pipeline_state_key.vertex_shader_module = VK_NULL_HANDLE;
+	graphics_pipeline_state_key.fragment_shader_module = VK_NULL_HANDLE;
+	graphics_pipeline_state_key.pipeline_layout = unwrapped_pipeline_layout->get_pipeline_layout();
+	graphics_pipeline_state_key.render_pass_attachment_formats.assign(unwrapped_render_pass->get_attachment_formats(), unwrapped_render_pass->get_attachment_formats() + unwrapped_render_pass->get_attachment_count());
+	graphics_pipeline_state_key.vertex_input_state.reserve(vertex_binding_count + 3U * vertex_attribute_count);
+	for (uint32_t vertex_binding_index = 0U; vertex_binding_index < vertex_binding_count; ++vertex_binding_index)
+	{
+		graphics_pipeline_state_key.vertex_input_state.push_back(vertex_bindings[vertex_binding_index].stride);
+	}
+	for (uint32_t vertex_attribute_index = 0U; vertex_attribute_index < vertex_attribute_count; ++vertex_attribute_index)
+	{
+		graphics_pipeline_state_key.vertex_input_state.push_back(vertex_attributes[vertex_attribute_index].binding);
+		graphics_pipeline_state_key.vertex_input_state.push_back(vertex_attributes[vertex_attribute_index].offset);
+		graphics_pipeline_state_key.vertex_input_state.push_back(static_cast<uint32_t>(vertex_attributes[vertex_attribute_index].format));
+	}
+	graphics_pipeline_state_key.depth_enable = depth_enable;
+	graphics_pipeline_state_key.depth_compare_operation = depth_compare_operation;
+
+	std::unique_lock<std::mutex> lock(this->m_mutex);
+
+	// the handles of the shader modules are unique for the same code, and thus can be used as part of the key
+	graphics_pipeline_state_key.vertex_shader_module = this->acquire_shader_module(vertex_shader_module_code_size, vertex_shader_module_code);
+	graphics_pipeline_state_key.fragment_shader_module = this->acquire_shader_module(fragment_shader_module_code_size, fragment_shader_module_code);
+
+	return this->create_graphics_pipeline(lock, std::move(graphics_pipeline_state_key), wrapped_render_pass, wrapped_pipeline_layout, vertex_binding_count, vertex_bindings, vertex_attribute_count, vertex_attributes, depth_enable, depth_compare_operation, 0U, NULL, VK_NULL_HANDLE);
+}
+
+brx_vk_graphics_pipeline *brx_vk_pipeline_state_cache::create_graphics_pipeline_variant(brx_vk_graphics_pipeline const *base_graphics_pipeline, brx_render_pass const *wrapped_render_pass, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants)
+{
+	// the base pipeline may be shared by the render passes with the same attachment formats, and thus the render pass used to create it is NOT retained (which may have been destroyed)
+	assert(NULL != wrapped_render_pass);
+	brx_vk_render_pass const *const unwrapped_render_pass = static_cast<brx_vk_render_pass const *>(wrapped_render_pass);
+
+	std::unique_lock<std::mutex> lock(this->m_mutex);
+
+	brx_map<brx_vk_graphics_pipeline const *, brx_map<brx_vk_graphics_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_graphics_pipeline *>>::iterator>::iterator const found_key = this->m_graphics_pipeline_keys.find(base_graphics_pipeline);
+	assert(this->m_graphics_pipeline_keys.end() != found_key);
+
+	// the variant only differs from the base pipeline in the specialization constants
+	brx_vk_graphics_pipeline_state_key graphics_pipeline_state_key = found_key->second->first;
+	assert(graphics_pipeline_state_key.render_pass_attachment_formats.size() == unwrapped_render_pass->get_attachment_count());
+	assert(std::equal(graphics_pipeline_state_key.render_pass_attachment_formats.begin(), graphics_pipeline_state_key.render_pass_attachment_formats.end(), unwrapped_render_pass->get_attachment_formats()));
+	graphics_pipeline_state_key.specialization_constants.clear();
+	graphics_pipeline_state_key.specialization_constants.reserve(2U * specialization_constant_count);
+	for (uint32_t specialization_constant_index = 0U; specialization_constant_index < specialization_constant_count; ++specialization_constant_index)
+	{
+		graphics_pipeline_state_key.specialization_constants.push_back(specialization_constants[specialization_constant_index].constant_id);
+		graphics_pipeline_state_key.specialization_constants.push_back(specialization_constants[specialization_constant_index].value);
+	}
+
+	this->retain_shader_module(graphics_pipeline_state_key.vertex_shader_module);
+	this->retain_shader_module(graphics_pipeline_state_key.fragment_shader_module);
+
+	return this->create_graphics_pipeline(lock, std::move(graphics_pipeline_state_key), wrapped_render_pass, base_graphics_pipeline->get_pipeline_layout(), base_graphics_pipeline->get_vertex_binding_count(), base_graphics_pipeline->get_vertex_bindings(), base_graphics_pipeline->get_vertex_attribute_count(), base_graphics_pipeline->get_vertex_attributes(), base_graphics_pipeline->get_depth_enable(), base_graphics_pipeline->get_depth_compare_operation(), specialization_constant_count, specialization_constants, base_graphics_pipeline->get_pipeline());
+}
+
+brx_vk_graphics_pipeline *brx_vk_pipeline_state_cache::create_graphics_pipeline(std::unique_lock<std::mutex> &lock, brx_vk_graphics_pipeline_state_key &&graphics_pipeline_state_key, brx_render_pass const *wrapped_render_pass, brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants, VkPipeline base_pipeline)
+{
+	assert(lock.owns_lock());
+
+	{
+		brx_map<brx_vk_graphics_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_graphics_pipeline *>>::iterator const found = this->m_graphics_pipelines.find(graphics_pipeline_state_key);
+		if (this->m_graphics_pipelines.end() != found)
+		{
+			++found->second.ref_count;
+			this->release_shader_module(graphics_pipeline_state_key.vertex_shader_module);
+			this->release_shader_module(graphics_pipeline_state_key.fragment_shader_module);
+			return found->second.value;
+		}
+	}
+
+	// the pipeline is compiled without the lock, and the shader modules are kept alive by the references acquired by the caller
+	++this->m_compiling_pipeline_count;
+	lock.unlock();
+
+	void *new_unwrapped_graphics_pipeline_base = brx_malloc(sizeof(brx_vk_graphics_pipeline), alignof(brx_vk_graphics_pipeline));
+	assert(NULL != new_unwrapped_graphics_pipeline_base);
+
+	brx_vk_graphics_pipeline *new_unwrapped_graphics_pipeline = new (new_unwrapped_graphics_pipeline_base) brx_vk_graphics_pipeline{};
+	new_unwrapped_graphics_pipeline->init(this->m_dispatch_table, this->m_device, this->m_allocation_callbacks, this->m_pipeline_cache, wrapped_render_pass, wrapped_pipeline_layout, graphics_pipeline_state_key.vertex_shader_module, graphics_pipeline_state_key.fragment_shader_module, vertex_binding_count, vertex_bindings, vertex_attribute_count, vertex_attributes, depth_enable, depth_compare_operation, specialization_constant_count, specialization_constants, base_pipeline);
+
+	lock.lock();
+
+	assert(this->m_compiling_pipeline_count > 0U);
+	--this->m_compiling_pipeline_count;
+	if (0U == this->m_compiling_pipeline_count)
+	{
+		this->m_compiling_pipeline_condition.notify_all();
+	}
+
+	{
+		brx_map<brx_vk_graphics_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_graphics_pipeline *>>::iterator const found = this->m_graphics_pipelines.find(graphics_pipeline_state_key);
+		if (this->m_graphics_pipelines.end() != found)
+		{
+			// the same pipeline has been created by the other thread at the same time
+			++found->second.ref_count;
+			this->release_shader_module(graphics_pipeline_state_key.vertex_shader_module);
+			this->release_shader_module(graphics_pipeline_state_key.fragment_shader_module);
+			brx_vk_graphics_pipeline *const existing_unwrapped_graphics_pipeline = found->second.value;
+
+			lock.unlock();
+
+			new_unwrapped_graphics_pipeline->uninit(this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
+			new_unwrapped_graphics_pipeline->~brx_vk_graphics_pipeline();
+			brx_free(new_unwrapped_graphics_pipeline);
+
+			return existing_unwrapped_graphics_pipeline;
+		}
+	}
+
+	brx_vk_pipeline_state_cache_entry<brx_vk_graphics_pipeline *> const graphics_pipeline_entry = {new_unwrapped_graphics_pipeline, 1U};
+	brx_map<brx_vk_graphics_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_graphics_pipeline *>>::iterator const inserted = this->m_graphics_pipelines.emplace(std::move(graphics_pipeline_state_key), graphics_pipeline_entry).first;
+	this->m_graphics_pipeline_keys.emplace(new_unwrapped_graphics_pipeline, inserted);
+
+	return new_unwrapped_graphics_pipeline;
+}
+
+void brx_vk_pipeline_state_cache::destroy_graphics_pipeline(brx_vk_graphics_pipeline *unwrapped_graphics_pipeline)
+{
+	std::unique_lock<std::mutex> lock(this->m_mutex);
+
+	brx_map<brx_vk_graphics_pipeline const *, brx_map<brx_vk_graphics_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_graphics_pipeline *>>::iterator>::iterator const found_key = this->m_graphics_pipeline_keys.find(unwrapped_graphics_pipeline);
+	assert(this->m_graphics_pipeline_keys.end() != found_key);
+
+	brx_map<brx_vk_graphics_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_graphics_pipeline *>>::iterator const found = found_key->second;
+	assert(unwrapped_graphics_pipeline == found->second.value);
+
+	assert(found->second.ref_count > 0U);
+	--found->second.ref_count;
+
+	if (0U == found->second.ref_count)
+	{
+		VkShaderModule const vertex_shader_module = found->first.vertex_shader_module;
+		VkShaderModule const fragment_shader_module = found->first.fragment_shader_module;
+
+		this->m_graphics_pipelines.erase(found);
+		this->m_graphics_pipeline_keys.erase(found_key);
+
+		this->release_shader_module(vertex_shader_module);
+		this->release_shader_module(fragment_shader_module);
+
+		lock.unlock();
+
+		unwrapped_graphics_pipeline->uninit(this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
+		unwrapped_graphics_pipeline->~brx_vk_graphics_pipeline();
+		brx_free(unwrapped_graphics_pipeline);
+	}
+}
+
+brx_vk_compute_pipeline *brx_vk_pipeline_state_cache::create_compute_pipeline(brx_pipeline_layout const *wrapped_pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code)
+{
+	assert(NULL != wrapped_pipeline_layout);
+	brx_vk_pipeline_layout const *const unwrapped_pipeline_layout = static_cast<brx_vk_pipeline_layout const *>(wrapped_pipeline_layout);
+
+	brx_vk_compute_pipeline_state_key compute_pipeline_state_key;
+	compute_pipeline_state_key.compute_shader_module = VK_NULL_HANDLE;
+	compute_pipeline_state_key.pipeline_layout = unwrapped_pipeline_layout->get_pipeline_layout();
+
+	std::unique_lock<std::mutex> lock(this->m_mutex);
+
+	compute_pipeline_state_key.compute_shader_module = this->acquire_shader_module(compute_shader_module_code_size, compute_shader_module_code);
+
+	return this->create_compute_pipeline(lock, std::move(compute_pipeline_state_key), wrapped_pipeline_layout, 0U, NULL, VK_NULL_HANDLE);
+}
+
+brx_vk_compute_pipeline *brx_vk_pipeline_state_cache::create_compute_pipeline_variant(brx_vk_compute_pipeline const *base_compute_pipeline, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants)
+{
+	std::unique_lock<std::mutex> lock(this->m_mutex);
+
+	brx_map<brx_vk_compute_pipeline const *, brx_map<brx_vk_compute_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_compute_pipeline *>>::iterator>::iterator const found_key = this->m_compute_pipeline_keys.find(base_compute_pipeline);
+	assert(this->m_compute_pipeline_keys.end() != found_key);
+
+	// the variant only differs from the base pipeline in the specialization constants
+	brx_vk_compute_pipeline_state_key compute_pipeline_state_key = found_key->second->first;
+	compute_pipeline_state_key.specialization_constants.clear();
+	compute_pipeline_state_key.specialization_constants.reserve(2U * specialization_constant_count);
+	for (uint32_t specialization_constant_index = 0U; specialization_constant_index < specialization_constant_count; ++specialization_constant_index)
+	{
+		compute_pipeline_state_key.specialization_constants.push_back(specialization_constants[specialization_constant_index].constant_id);
+		compute_pipeline_state_key.specialization_constants.push_back(specialization_constants[specialization_constant_index].value);
+	}
+
+	this->retain_shader_module(compute_pipeline_state_key.compute_shader_module);
+
+	return this->create_compute_pipeline(lock, std::move(compute_pipeline_state_key), base_compute_pipeline->get_pipeline_layout(), specialization_constant_count, specialization_constants, base_compute_pipeline->get_pipeline());
+}
+
+brx_vk_compute_pipeline *brx_vk_pipeline_state_cache::create_compute_pipeline(std::unique_lock<std::mutex> &lock, brx_vk_compute_pipeline_state_key &&compute_pipeline_state_key, brx_pipeline_layout const *wrapped_pipeline_layout, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants, VkPipeline base_pipeline)
+{
+	assert(lock.owns_lock());
+
+	{
+		brx_map<brx_vk_compute_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_compute_pipeline *>>::iterator const found = this->m_compute_pipelines.find(compute_pipeline_state_key);
+		if (this->m_compute_pipelines.end() != found)
+		{
+			++found->second.ref_count;
+			this->release_shader_module(compute_pipeline_state_key.compute_shader_module);
+			return found->second.value;
+		}
+	}
+
+	++this->m_compiling_pipeline_count;
+	lock.unlock();
+
+	void *new_unwrapped_compute_pipeline_base = brx_malloc(sizeof(brx_vk_compute_pipeline), alignof(brx_vk_compute_pipeline));
+	assert(NULL != new_unwrapped_compute_pipeline_base);
+
+	brx_vk_compute_pipeline *new_unwrapped_compute_pipeline = new (new_unwrapped_compute_pipeline_base) brx_vk_compute_pipeline{};
+	new_unwrapped_compute_pipeline->init(this->m_dispatch_table, this->m_device, this->m_allocation_callbacks, this->m_pipeline_cache, wrapped_pipeline_layout, compute_pipeline_state_key.compute_shader_module, specialization_constant_count, specialization_constants, base_pipeline);
+
+	lock.lock();
+
+	assert(this->m_compiling_pipeline_count > 0U);
+	--this->m_compiling_pipeline_count;
+	if (0U == this->m_compiling_pipeline_count)
+	{
+		this->m_compiling_pipeline_condition.notify_all();
+	}
+
+	{
+		brx_map<brx_vk_compute_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_compute_pipeline *>>::iterator const found = this->m_compute_pipelines.find(compute_pipeline_state_key);
+		if (this->m_compute_pipelines.end() != found)
+		{
+			// the same pipeline has been created by the other thread at the same time
+			++found->second.ref_count;
+			this->release_shader_module(compute_pipeline_state_key.compute_shader_module);
+			brx_vk_compute_pipeline *const existing_unwrapped_compute_pipeline = found->second.value;
+
+			lock.unlock();
+
+			new_unwrapped_compute_pipeline->uninit(this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
+			new_unwrapped_compute_pipeline->~brx_vk_compute_pipeline();
+			brx_free(new_unwrapped_compute_pipeline);
+
+			return existing_unwrapped_compute_pipeline;
+		}
+	}
+
+	brx_vk_pipeline_state_cache_entry<brx_vk_compute_pipeline *> const compute_pipeline_entry = {new_unwrapped_compute_pipeline, 1U};
+	brx_map<brx_vk_compute_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_compute_pipeline *>>::iterator const inserted = this->m_compute_pipelines.emplace(std::move(compute_pipeline_state_key), compute_pipeline_entry).first;
+	this->m_compute_pipeline_keys.emplace(new_unwrapped_compute_pipeline, inserted);
+
+	return new_unwrapped_compute_pipeline;
+}
+
+void brx_vk_pipeline_state_cache::destroy_compute_pipeline(brx_vk_compute_pipeline *unwrapped_compute_pipeline)
+{
+	std::unique_lock<std::mutex> lock(this->m_mutex);
+
+	brx_map<brx_vk_compute_pipeline const *, brx_map<brx_vk_compute_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_compute_pipeline *>>::iterator>::iterator const found_key = this->m_compute_pipeline_keys.find(unwrapped_compute_pipeline);
+	assert(this->m_compute_pipeline_keys.end() != found_key);
+
+	brx_map<brx_vk_compute_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_compute_pipeline *>>::iterator const found = found_key->second;
+	assert(unwrapped_compute_pipeline == found->second.value);
+
+	assert(found->second.ref_count > 0U);
+	--found->second.ref_count;
+
+	if (0U == found->second.ref_count)
+	{
+		VkShaderModule const compute_shader_module = found->first.compute_shader_module;
+
+		this->m_compute_pipelines.erase(found);
+		this->m_compute_pipeline_keys.erase(found_key);
+
+		this->release_shader_module(compute_shader_module);
+
+		lock.unlock();
+
+		unwrapped_compute_pipeline->uninit(this->m_dispatch_table, this->m_device, this->m_allocation_callbacks);
+		unwrapped_compute_pipeline->~brx_vk_compute_pipeline();
+		brx_free(unwrapped_compute_pipeline);
+	}
+}
+
+bool brx_vk_pipeline_state_cache::merge_pipeline_cache(VkPipelineCache source_pipeline_cache)
+{
+	std::unique_lock<std::mutex> lock(this->m_mutex);
+
+	this->m_compiling_pipeline_condition.wait(lock, [this]() -> bool
+											  { return (0U == this->m_compiling_pipeline_count); });
+
+	VkResult const res_merge_pipeline_caches = this->m_dispatch_table->pfn_merge_pipeline_caches(this->m_device, this->m_pipeline_cache, 1U, &source_pipeline_cache);
+	return (VK_SUCCESS == res_merge_pipeline_caches);
+}
+
+VkResult brx_vk_pipeline_state_cache::get_pipeline_cache_data(size_t *pipeline_cache_data_size, void *pipeline_cache_data)
+{
+	// the pipeline cache may be merged into by the "merge_pipeline_cache" concurrently
+	std::unique_lock<std::mutex> lock(this->m_mutex);
+
+	return this->m_dispatch_table->pfn_get_pipeline_cache_data(this->m_device, this->m_pipeline_cache, pipeline_cache_data_size, pipeline_cache_data);
+}
+
+static inline uint64_t brx_vk_shader_module_code_hash(size_t shader_module_code_size, void const *shader_module_code)
+{
+	// FNV-1a
+	uint64_t hash = 14695981039346656037ULL;
+	for (size_t byte_index = 0U; byte_index < shader_module_code_size; ++byte_index)
+	{
+		hash ^= static_cast<uint64_t>(static_cast<uint8_t const *>(shader_module_code)[byte_index]);
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
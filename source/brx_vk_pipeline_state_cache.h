@@ -0,0 +1,118 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#ifndef _BRX_VK_PIPELINE_STATE_CACHE_H_
+#define _BRX_VK_PIPELINE_STATE_CACHE_H_ 1
+
+#include "brx_vector.h"
+#include "brx_map.h"
+#include <mutex>
+#include <condition_variable>
+
+struct brx_vk_device_dispatch_table;
+class brx_vk_graphics_pipeline;
+class brx_vk_compute_pipeline;
+
+struct brx_vk_shader_module_key
+{
+	// the hash is compared at first, and the code is compared only if the hashes are the same
+	uint64_t code_hash;
+	brx_vector<uint8_t> code;
+	bool operator<(brx_vk_shader_module_key const &other) const;
+};
+
+struct brx_vk_graphics_pipeline_state_key
+{
+	VkShaderModule vertex_shader_module;
+	VkShaderModule fragment_shader_module;
+	VkPipelineLayout pipeline_layout;
+	// the render passes are compatible if the formats of the attachments are the same, since the sample counts are always 1
+	brx_vector<VkFormat> render_pass_attachment_formats;
+	// the vertex binding strides followed by the binding, offset and format of each vertex attribute
+	brx_vector<uint32_t> vertex_input_state;
+	bool depth_enable;
+	BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation;
+	// the constant id and value of each specialization constant
+	brx_vector<uint32_t> specialization_constants;
+	bool operator<(brx_vk_graphics_pipeline_state_key const &other) const;
+};
+
+struct brx_vk_compute_pipeline_state_key
+{
+	VkShaderModule compute_shader_module;
+	VkPipelineLayout pipeline_layout;
+	// the constant id and value of each specialization constant
+	brx_vector<uint32_t> specialization_constants;
+	bool operator<(brx_vk_compute_pipeline_state_key const &other) const;
+};
+
+template <typename T>
+struct brx_vk_pipeline_state_cache_entry
+{
+	T value;
+	uint32_t ref_count;
+};
+
+// the shader modules are shared by the pipelines with the same code
+// the pipelines with the same state are shared, and the same pipeline is returned with the reference count increased
+class brx_vk_pipeline_state_cache
+{
+	brx_vk_device_dispatch_table const *m_dispatch_table;
+	VkDevice m_device;
+	VkAllocationCallbacks const *m_allocation_callbacks;
+	VkPipelineCache m_pipeline_cache;
+
+	// the pipelines may be created by the worker threads of the pipeline compiler
+	std::mutex m_mutex;
+
+	// the pipelines are compiled without the lock, but the "vkMergePipelineCaches" requires the destination pipeline cache to be externally synchronized
+	// the merge waits until no pipeline is being compiled, and no new compilation can start since the lock is held by the merge
+	uint32_t m_compiling_pipeline_count;
+	std::condition_variable m_compiling_pipeline_condition;
+
+	brx_map<brx_vk_shader_module_key, brx_vk_pipeline_state_cache_entry<VkShaderModule>> m_shader_modules;
+	brx_map<VkShaderModule, brx_map<brx_vk_shader_module_key, brx_vk_pipeline_state_cache_entry<VkShaderModule>>::iterator> m_shader_module_keys;
+
+	brx_map<brx_vk_graphics_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_graphics_pipeline *>> m_graphics_pipelines;
+	brx_map<brx_vk_graphics_pipeline const *, brx_map<brx_vk_graphics_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_graphics_pipeline *>>::iterator> m_graphics_pipeline_keys;
+
+	brx_map<brx_vk_compute_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_compute_pipeline *>> m_compute_pipelines;
+	brx_map<brx_vk_compute_pipeline const *, brx_map<brx_vk_compute_pipeline_state_key, brx_vk_pipeline_state_cache_entry<brx_vk_compute_pipeline *>>::iterator> m_compute_pipeline_keys;
+
+	VkShaderModule acquire_shader_module(size_t shader_module_code_size, void const *shader_module_code);
+	void release_shader_module(VkShaderModule shader_module);
+	void retain_shader_module(VkShaderModule shader_module);
+	// the references to the shader modules in the key are transferred to the pipeline
+	brx_vk_graphics_pipeline *create_graphics_pipeline(std::unique_lock<std::mutex> &lock, brx_vk_graphics_pipeline_state_key &&graphics_pipeline_state_key, brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants, VkPipeline base_pipeline);
+	brx_vk_compute_pipeline *create_compute_pipeline(std::unique_lock<std::mutex> &lock, brx_vk_compute_pipeline_state_key &&compute_pipeline_state_key, brx_pipeline_layout const *pipeline_layout, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants, VkPipeline base_pipeline);
+
+public:
+	brx_vk_pipeline_state_cache();
+	void init(brx_vk_device_dispatch_table const *dispatch_table, VkDevice device, VkAllocationCallbacks const *allocation_callbacks, VkPipelineCache pipeline_cache);
+	void uninit();
+	~brx_vk_pipeline_state_cache();
+	brx_vk_graphics_pipeline *create_graphics_pipeline(brx_render_pass const *render_pass, brx_pipeline_layout const *pipeline_layout, size_t vertex_shader_module_code_size, void const *vertex_shader_module_code, size_t fragment_shader_module_code_size, void const *fragment_shader_module_code, uint32_t vertex_binding_count, BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const *vertex_bindings, uint32_t vertex_attribute_count, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const *vertex_attributes, bool depth_enable, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION depth_compare_operation);
+	brx_vk_graphics_pipeline *create_graphics_pipeline_variant(brx_vk_graphics_pipeline const *base_graphics_pipeline, brx_render_pass const *render_pass, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants);
+	void destroy_graphics_pipeline(brx_vk_graphics_pipeline *graphics_pipeline);
+	brx_vk_compute_pipeline *create_compute_pipeline(brx_pipeline_layout const *pipeline_layout, size_t compute_shader_module_code_size, void const *compute_shader_module_code);
+	brx_vk_compute_pipeline *create_compute_pipeline_variant(brx_vk_compute_pipeline const *base_compute_pipeline, uint32_t specialization_constant_count, BRX_PIPELINE_SPECIALIZATION_CONSTANT const *specialization_constants);
+	void destroy_compute_pipeline(brx_vk_compute_pipeline *compute_pipeline);
+	bool merge_pipeline_cache(VkPipelineCache source_pipeline_cache);
+	VkResult get_pipeline_cache_data(size_t *pipeline_cache_data_size, void *pipeline_cache_data);
+};
+
+#endif
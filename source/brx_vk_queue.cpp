@@ -18,23 +18,31 @@
 #include "brx_vk_device.h"
 #include <assert.h>
 
+static inline VkResult __intermediate_queue_submit(PFN_vkQueueSubmit pfn_queue_submit, VkQueue queue, VkSubmitInfo const *submit_info, brx_vk_pending_wait_timeline_semaphores *pending_wait_timeline_semaphores, uint32_t signal_timeline_semaphore_count, VkSemaphore const *signal_timeline_semaphores, uint64_t const *signal_timeline_semaphore_values, VkFence fence);
+
+static inline void __intermediate_push_pending_wait_timeline_semaphore(PFN_vkQueueSubmit pfn_queue_submit, VkQueue queue, std::mutex *queue_mutex, brx_vk_pending_wait_timeline_semaphores *pending_wait_timeline_semaphores, VkSemaphore timeline_semaphore, uint64_t value);
+
 brx_vk_graphics_queue::brx_vk_graphics_queue(
 	bool has_dedicated_upload_queue,
 	uint32_t upload_queue_family_index,
 	uint32_t graphics_queue_family_index,
 	VkQueue graphics_queue,
+	std::mutex *graphics_queue_mutex,
 	PFN_vkQueueSubmit pfn_queue_submit,
-	PFN_vkQueuePresentKHR pfn_queue_present)
+	PFN_vkQueuePresentKHR pfn_queue_present,
+	VkSemaphore flush_timeline_semaphore)
 	: m_has_dedicated_upload_queue(has_dedicated_upload_queue),
 	  m_upload_queue_family_index(upload_queue_family_index),
 	  m_graphics_queue_family_index(graphics_queue_family_index),
 	  m_graphics_queue(graphics_queue),
+	  m_graphics_queue_mutex(graphics_queue_mutex),
 	  m_pfn_queue_submit(pfn_queue_submit),
-	  m_pfn_queue_present(pfn_queue_present)
+	  m_pfn_queue_present(pfn_queue_present),
+	  m_pending_wait_timeline_semaphores{0U, {}, {}, flush_timeline_semaphore, 0U}
 {
 }
 
-void brx_vk_graphics_queue::wait_and_submit(brx_upload_command_buffer const *brx_upload_command_buffer, brx_graphics_command_buffer const *brx_graphics_command_buffer, brx_fence *brx_fence) const
+void brx_vk_graphics_queue::wait_and_submit(brx_upload_command_buffer const *brx_upload_command_buffer, brx_graphics_command_buffer const *brx_graphics_command_buffer, brx_fence *brx_fence)
 {
 	assert(NULL != brx_upload_command_buffer);
 	assert(NULL != brx_fence);
@@ -44,6 +52,8 @@ void brx_vk_graphics_queue::wait_and_submit(brx_upload_command_buffer const *brx
 	VkCommandBuffer graphics_command_buffer = static_cast<brx_vk_graphics_command_buffer const *>(brx_graphics_command_buffer)->get_command_buffer();
 	VkFence fence = static_cast<brx_vk_fence const *>(brx_fence)->get_fence();
 
+	std::lock_guard<std::mutex> lock_guard(*this->m_graphics_queue_mutex);
+
 	if (this->m_has_dedicated_upload_queue)
 	{
 		if (this->m_upload_queue_family_index != this->m_graphics_queue_family_index)
@@ -66,7 +76,7 @@ void brx_vk_graphics_queue::wait_and_submit(brx_upload_command_buffer const *brx
 				&graphics_command_buffer,
 				0U,
 				NULL};
-			VkResult res_queue_submit = this->m_pfn_queue_submit(this->m_graphics_queue, 1U, &submit_info, fence);
+			VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_graphics_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, 0U, NULL, NULL, fence);
 			assert(VK_SUCCESS == res_queue_submit);
 		}
 		else
@@ -84,7 +94,7 @@ void brx_vk_graphics_queue::wait_and_submit(brx_upload_command_buffer const *brx
 				NULL,
 				0U,
 				NULL};
-			VkResult res_queue_submit = this->m_pfn_queue_submit(this->m_graphics_queue, 1U, &submit_info, fence);
+			VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_graphics_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, 0U, NULL, NULL, fence);
 			assert(VK_SUCCESS == res_queue_submit);
 		}
 	}
@@ -92,22 +102,23 @@ void brx_vk_graphics_queue::wait_and_submit(brx_upload_command_buffer const *brx
 	{
 		assert(VK_NULL_HANDLE == upload_upload_command_buffer && VK_NULL_HANDLE != upload_graphics_command_buffer && VK_NULL_HANDLE == upload_queue_submit_semaphore);
 
+		// the upload command buffer has been submitted to the same queue by the "submit_and_signal" of the upload queue, and the fence signal operation covers all the commands which occur earlier in submission order
 		VkSubmitInfo submit_info{
 			VK_STRUCTURE_TYPE_SUBMIT_INFO,
 			NULL,
 			0U,
 			NULL,
 			NULL,
-			1U,
-			&upload_graphics_command_buffer,
+			0U,
+			NULL,
 			0U,
 			NULL};
-		VkResult res_queue_submit = this->m_pfn_queue_submit(this->m_graphics_queue, 1U, &submit_info, fence);
+		VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_graphics_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, 0U, NULL, NULL, fence);
 		assert(VK_SUCCESS == res_queue_submit);
 	}
 }
 
-bool brx_vk_graphics_queue::submit_and_present(brx_graphics_command_buffer *brx_graphics_command_buffer, brx_swap_chain *brx_swap_chain, uint32_t swap_chain_image_index, brx_fence *brx_fence) const
+bool brx_vk_graphics_queue::submit_and_present(brx_graphics_command_buffer *brx_graphics_command_buffer, brx_swap_chain *brx_swap_chain, uint32_t swap_chain_image_index, brx_fence *brx_fence)
 {
 	assert(NULL != brx_graphics_command_buffer);
 	assert(NULL != brx_swap_chain);
@@ -129,7 +140,148 @@ bool brx_vk_graphics_queue::submit_and_present(brx_graphics_command_buffer *brx_
 		&command_buffer,
 		1U,
 		&queue_submit_semaphore};
-	VkResult res_queue_submit = this->m_pfn_queue_submit(this->m_graphics_queue, 1U, &submit_info, fence);
+
+	std::lock_guard<std::mutex> lock_guard(*this->m_graphics_queue_mutex);
+
+	VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_graphics_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, 0U, NULL, NULL, fence);
+	assert(VK_SUCCESS == res_queue_submit);
+
+	VkPresentInfoKHR present_info = {
+		VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+		NULL,
+		1U,
+		&queue_submit_semaphore,
+		1U,
+		&swap_chain,
+		&swap_chain_image_index,
+		NULL};
+	VkResult res_queue_present = this->m_pfn_queue_present(this->m_graphics_queue, &present_info);
+	switch (res_queue_present)
+	{
+	case VK_SUCCESS:
+		return true;
+	case VK_SUBOPTIMAL_KHR:
+		return false;
+	case VK_ERROR_OUT_OF_DATE_KHR:
+		return false;
+	default:
+		assert(false);
+		return false;
+	}
+}
+
+void brx_vk_graphics_queue::signal_timeline_fence(brx_timeline_fence *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_timeline_fence);
+	VkSemaphore timeline_semaphore = static_cast<brx_vk_timeline_fence const *>(brx_timeline_fence)->get_semaphore();
+
+	// the first synchronization scope of the signal operation includes all commands that occur earlier in submission order
+	VkSubmitInfo submit_info{
+		VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		NULL,
+		0U,
+		NULL,
+		NULL,
+		0U,
+		NULL,
+		0U,
+		NULL};
+
+	std::lock_guard<std::mutex> lock_guard(*this->m_graphics_queue_mutex);
+
+	VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_graphics_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, 1U, &timeline_semaphore, &value, VK_NULL_HANDLE);
+	assert(VK_SUCCESS == res_queue_submit);
+}
+
+void brx_vk_graphics_queue::wait_timeline_fence(brx_timeline_fence const *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_timeline_fence);
+	VkSemaphore timeline_semaphore = static_cast<brx_vk_timeline_fence const *>(brx_timeline_fence)->get_semaphore();
+
+	__intermediate_push_pending_wait_timeline_semaphore(this->m_pfn_queue_submit, this->m_graphics_queue, this->m_graphics_queue_mutex, &this->m_pending_wait_timeline_semaphores, timeline_semaphore, value);
+}
+
+void brx_vk_graphics_queue::submit_batch(uint32_t graphics_command_buffer_count, brx_graphics_command_buffer const *const *brx_graphics_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *brx_wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *brx_signal_timeline_fences, uint64_t const *signal_values, brx_fence *brx_fence)
+{
+	assert(graphics_command_buffer_count <= g_vk_max_queue_submit_command_buffer_count);
+	VkCommandBuffer command_buffers[g_vk_max_queue_submit_command_buffer_count];
+	for (uint32_t graphics_command_buffer_index = 0U; graphics_command_buffer_index < graphics_command_buffer_count; ++graphics_command_buffer_index)
+	{
+		assert(NULL != brx_graphics_command_buffers[graphics_command_buffer_index]);
+		command_buffers[graphics_command_buffer_index] = static_cast<brx_vk_graphics_command_buffer const *>(brx_graphics_command_buffers[graphics_command_buffer_index])->get_command_buffer();
+	}
+
+	// the waits of the same batch are merged with the pending waits
+	for (uint32_t wait_timeline_fence_index = 0U; wait_timeline_fence_index < wait_timeline_fence_count; ++wait_timeline_fence_index)
+	{
+		assert(NULL != brx_wait_timeline_fences[wait_timeline_fence_index]);
+		__intermediate_push_pending_wait_timeline_semaphore(this->m_pfn_queue_submit, this->m_graphics_queue, this->m_graphics_queue_mutex, &this->m_pending_wait_timeline_semaphores, static_cast<brx_vk_timeline_fence const *>(brx_wait_timeline_fences[wait_timeline_fence_index])->get_semaphore(), wait_values[wait_timeline_fence_index]);
+	}
+
+	assert(signal_timeline_fence_count <= g_vk_max_signal_timeline_semaphore_count);
+	VkSemaphore signal_timeline_semaphores[g_vk_max_signal_timeline_semaphore_count];
+	for (uint32_t signal_timeline_fence_index = 0U; signal_timeline_fence_index < signal_timeline_fence_count; ++signal_timeline_fence_index)
+	{
+		assert(NULL != brx_signal_timeline_fences[signal_timeline_fence_index]);
+		signal_timeline_semaphores[signal_timeline_fence_index] = static_cast<brx_vk_timeline_fence const *>(brx_signal_timeline_fences[signal_timeline_fence_index])->get_semaphore();
+	}
+
+	VkFence fence = (NULL != brx_fence) ? static_cast<brx_vk_fence const *>(brx_fence)->get_fence() : VK_NULL_HANDLE;
+
+	VkSubmitInfo submit_info{
+		VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		NULL,
+		0U,
+		NULL,
+		NULL,
+		graphics_command_buffer_count,
+		(graphics_command_buffer_count > 0U) ? command_buffers : NULL,
+		0U,
+		NULL};
+
+	std::lock_guard<std::mutex> lock_guard(*this->m_graphics_queue_mutex);
+
+	VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_graphics_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, signal_timeline_fence_count, (signal_timeline_fence_count > 0U) ? signal_timeline_semaphores : NULL, signal_values, fence);
+	assert(VK_SUCCESS == res_queue_submit);
+}
+
+bool brx_vk_graphics_queue::submit_batch_and_present(uint32_t graphics_command_buffer_count, brx_graphics_command_buffer *const *brx_graphics_command_buffers, brx_swap_chain *brx_swap_chain, uint32_t swap_chain_image_index, brx_fence *brx_fence)
+{
+	assert(graphics_command_buffer_count > 0U);
+	assert(NULL != brx_graphics_command_buffers);
+	assert(NULL != brx_swap_chain);
+	assert(NULL != brx_fence);
+
+	assert(graphics_command_buffer_count <= g_vk_max_queue_submit_command_buffer_count);
+	VkCommandBuffer command_buffers[g_vk_max_queue_submit_command_buffer_count];
+	for (uint32_t graphics_command_buffer_index = 0U; graphics_command_buffer_index < graphics_command_buffer_count; ++graphics_command_buffer_index)
+	{
+		assert(NULL != brx_graphics_command_buffers[graphics_command_buffer_index]);
+		command_buffers[graphics_command_buffer_index] = static_cast<brx_vk_graphics_command_buffer const *>(brx_graphics_command_buffers[graphics_command_buffer_index])->get_command_buffer();
+	}
+
+	// the semaphores of the last command buffer, which is passed to the "acquire_next_image", are used by the whole batch
+	brx_graphics_command_buffer const *const last_graphics_command_buffer = brx_graphics_command_buffers[graphics_command_buffer_count - 1U];
+	VkSemaphore acquire_next_image_semaphore = static_cast<brx_vk_graphics_command_buffer const *>(last_graphics_command_buffer)->get_acquire_next_image_semaphore();
+	VkSemaphore queue_submit_semaphore = static_cast<brx_vk_graphics_command_buffer const *>(last_graphics_command_buffer)->get_queue_submit_semaphore();
+	VkSwapchainKHR swap_chain = static_cast<brx_vk_swap_chain const *>(brx_swap_chain)->get_swap_chain();
+	VkFence fence = static_cast<brx_vk_fence const *>(brx_fence)->get_fence();
+
+	VkPipelineStageFlags wait_dst_stage_mask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+	VkSubmitInfo submit_info = {
+		VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		NULL,
+		1U,
+		&acquire_next_image_semaphore,
+		&wait_dst_stage_mask,
+		graphics_command_buffer_count,
+		command_buffers,
+		1U,
+		&queue_submit_semaphore};
+
+	std::lock_guard<std::mutex> lock_guard(*this->m_graphics_queue_mutex);
+
+	VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_graphics_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, 0U, NULL, NULL, fence);
 	assert(VK_SUCCESS == res_queue_submit);
 
 	VkPresentInfoKHR present_info = {
@@ -156,18 +308,22 @@ bool brx_vk_graphics_queue::submit_and_present(brx_graphics_command_buffer *brx_
 	}
 }
 
-void brx_vk_graphics_queue::steal(VkQueue *out_graphics_queue)
+void brx_vk_graphics_queue::steal(VkQueue *out_graphics_queue, VkSemaphore *out_flush_timeline_semaphore)
 {
 	assert(NULL != out_graphics_queue);
+	assert(NULL != out_flush_timeline_semaphore);
 
 	(*out_graphics_queue) = this->m_graphics_queue;
+	(*out_flush_timeline_semaphore) = this->m_pending_wait_timeline_semaphores.flush_timeline_semaphore;
 
 	this->m_graphics_queue = VK_NULL_HANDLE;
+	this->m_pending_wait_timeline_semaphores.flush_timeline_semaphore = VK_NULL_HANDLE;
 }
 
 brx_vk_graphics_queue::~brx_vk_graphics_queue()
 {
 	assert(VK_NULL_HANDLE == this->m_graphics_queue);
+	assert(VK_NULL_HANDLE == this->m_pending_wait_timeline_semaphores.flush_timeline_semaphore);
 }
 
 brx_vk_upload_queue::brx_vk_upload_queue(
@@ -175,75 +331,418 @@ brx_vk_upload_queue::brx_vk_upload_queue(
 	uint32_t upload_queue_family_index,
 	uint32_t graphics_queue_family_index,
 	VkQueue upload_queue,
-	PFN_vkQueueSubmit pfn_queue_submit)
+	VkQueue graphics_queue,
+	std::mutex *queue_mutex,
+	PFN_vkQueueSubmit pfn_queue_submit,
+	VkSemaphore flush_timeline_semaphore)
 	: m_has_dedicated_upload_queue(has_dedicated_upload_queue),
 	  m_upload_queue_family_index(upload_queue_family_index),
 	  m_graphics_queue_family_index(graphics_queue_family_index),
 	  m_upload_queue(upload_queue),
-	  m_pfn_queue_submit(pfn_queue_submit)
+	  m_graphics_queue(graphics_queue),
+	  m_queue_mutex(queue_mutex),
+	  m_pfn_queue_submit(pfn_queue_submit),
+	  m_pending_wait_timeline_semaphores{0U, {}, {}, flush_timeline_semaphore, 0U}
 {
 }
 
-void brx_vk_upload_queue::submit_and_signal(brx_upload_command_buffer const *brx_upload_command_buffer) const
+void brx_vk_upload_queue::submit_and_signal(brx_upload_command_buffer const *brx_upload_command_buffer)
 {
 	assert(NULL != brx_upload_command_buffer);
 	VkCommandBuffer upload_command_buffer = static_cast<brx_vk_upload_command_buffer const *>(brx_upload_command_buffer)->get_upload_command_buffer();
 	VkCommandBuffer graphics_command_buffer = static_cast<brx_vk_upload_command_buffer const *>(brx_upload_command_buffer)->get_graphics_command_buffer();
 	VkSemaphore upload_queue_submit_semaphore = static_cast<brx_vk_upload_command_buffer const *>(brx_upload_command_buffer)->get_upload_queue_submit_semaphore();
 
+	std::lock_guard<std::mutex> lock_guard(*this->m_queue_mutex);
+
 	if (this->m_has_dedicated_upload_queue)
 	{
-		if (this->m_upload_queue_family_index != this->m_graphics_queue_family_index)
-		{
-			assert(VK_NULL_HANDLE != upload_command_buffer && VK_NULL_HANDLE == graphics_command_buffer && VK_NULL_HANDLE != upload_queue_submit_semaphore);
-
-			VkSubmitInfo submit_info{
-				VK_STRUCTURE_TYPE_SUBMIT_INFO,
-				NULL,
-				0U,
-				NULL,
-				NULL,
-				1U,
-				&upload_command_buffer,
-				1U,
-				&upload_queue_submit_semaphore};
-			VkResult res_queue_submit = this->m_pfn_queue_submit(this->m_upload_queue, 1U, &submit_info, VK_NULL_HANDLE);
-			assert(VK_SUCCESS == res_queue_submit);
-		}
-		else
-		{
-			assert(VK_NULL_HANDLE != upload_command_buffer && VK_NULL_HANDLE == graphics_command_buffer && VK_NULL_HANDLE != upload_queue_submit_semaphore);
+		assert(VK_NULL_HANDLE != upload_command_buffer && VK_NULL_HANDLE == graphics_command_buffer && VK_NULL_HANDLE != upload_queue_submit_semaphore);
 
-			VkSubmitInfo submit_info{
-				VK_STRUCTURE_TYPE_SUBMIT_INFO,
-				NULL,
-				0U,
-				NULL,
-				NULL,
-				1U,
-				&upload_command_buffer,
-				1U,
-				&upload_queue_submit_semaphore};
-			VkResult res_upload_queue_submit = this->m_pfn_queue_submit(this->m_upload_queue, 1U, &submit_info, VK_NULL_HANDLE);
-			assert(VK_SUCCESS == res_upload_queue_submit);
-		}
+		// the binary semaphore is waited by the "wait_and_submit" of the graphics queue
+		VkSubmitInfo submit_info{
+			VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			NULL,
+			0U,
+			NULL,
+			NULL,
+			1U,
+			&upload_command_buffer,
+			1U,
+			&upload_queue_submit_semaphore};
+		VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_upload_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, 0U, NULL, NULL, VK_NULL_HANDLE);
+		assert(VK_SUCCESS == res_queue_submit);
 	}
 	else
 	{
 		assert(VK_NULL_HANDLE == upload_command_buffer && VK_NULL_HANDLE != graphics_command_buffer && VK_NULL_HANDLE == upload_queue_submit_semaphore);
+
+		// the upload command buffer is recorded for the graphics queue family, and is submitted to the graphics queue immediately
+		// the following "wait_and_submit" of the graphics queue only signals the fence, and the following "signal_timeline_fence" of this queue covers the upload command buffer
+		VkSubmitInfo submit_info{
+			VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			NULL,
+			0U,
+			NULL,
+			NULL,
+			1U,
+			&graphics_command_buffer,
+			0U,
+			NULL};
+		VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_graphics_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, 0U, NULL, NULL, VK_NULL_HANDLE);
+		assert(VK_SUCCESS == res_queue_submit);
+	}
+}
+
+void brx_vk_upload_queue::submit_and_signal_timeline_fence(brx_upload_command_buffer const *brx_upload_command_buffer, brx_timeline_fence *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_upload_command_buffer);
+	assert(NULL != brx_timeline_fence);
+	VkCommandBuffer upload_command_buffer = static_cast<brx_vk_upload_command_buffer const *>(brx_upload_command_buffer)->get_upload_command_buffer();
+	VkCommandBuffer graphics_command_buffer = static_cast<brx_vk_upload_command_buffer const *>(brx_upload_command_buffer)->get_graphics_command_buffer();
+	VkSemaphore timeline_semaphore = static_cast<brx_vk_timeline_fence const *>(brx_timeline_fence)->get_semaphore();
+
+	// the upload command buffer is recorded for the graphics queue family when there is no dedicated upload queue
+	assert(this->m_has_dedicated_upload_queue ? (VK_NULL_HANDLE != upload_command_buffer && VK_NULL_HANDLE == graphics_command_buffer) : (VK_NULL_HANDLE == upload_command_buffer && VK_NULL_HANDLE != graphics_command_buffer));
+	VkCommandBuffer command_buffer = this->m_has_dedicated_upload_queue ? upload_command_buffer : graphics_command_buffer;
+
+	// the binary semaphore of the upload command buffer is NOT signaled, since it is NOT waited by the "wait_and_submit" of the graphics queue
+	VkSubmitInfo submit_info{
+		VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		NULL,
+		0U,
+		NULL,
+		NULL,
+		1U,
+		&command_buffer,
+		0U,
+		NULL};
+
+	std::lock_guard<std::mutex> lock_guard(*this->m_queue_mutex);
+
+	VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_has_dedicated_upload_queue ? this->m_upload_queue : this->m_graphics_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, 1U, &timeline_semaphore, &value, VK_NULL_HANDLE);
+	assert(VK_SUCCESS == res_queue_submit);
+}
+
+void brx_vk_upload_queue::submit_batch(uint32_t upload_command_buffer_count, brx_upload_command_buffer const *const *brx_upload_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *brx_wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *brx_signal_timeline_fences, uint64_t const *signal_values)
+{
+	// the upload command buffers are recorded for the graphics queue family when there is no dedicated upload queue
+	assert(upload_command_buffer_count <= g_vk_max_queue_submit_command_buffer_count);
+	VkCommandBuffer command_buffers[g_vk_max_queue_submit_command_buffer_count];
+	for (uint32_t upload_command_buffer_index = 0U; upload_command_buffer_index < upload_command_buffer_count; ++upload_command_buffer_index)
+	{
+		assert(NULL != brx_upload_command_buffers[upload_command_buffer_index]);
+		brx_vk_upload_command_buffer const *const upload_command_buffer = static_cast<brx_vk_upload_command_buffer const *>(brx_upload_command_buffers[upload_command_buffer_index]);
+		command_buffers[upload_command_buffer_index] = this->m_has_dedicated_upload_queue ? upload_command_buffer->get_upload_command_buffer() : upload_command_buffer->get_graphics_command_buffer();
+		assert(VK_NULL_HANDLE != command_buffers[upload_command_buffer_index]);
+	}
+
+	for (uint32_t wait_timeline_fence_index = 0U; wait_timeline_fence_index < wait_timeline_fence_count; ++wait_timeline_fence_index)
+	{
+		assert(NULL != brx_wait_timeline_fences[wait_timeline_fence_index]);
+		__intermediate_push_pending_wait_timeline_semaphore(this->m_pfn_queue_submit, this->m_has_dedicated_upload_queue ? this->m_upload_queue : this->m_graphics_queue, this->m_queue_mutex, &this->m_pending_wait_timeline_semaphores, static_cast<brx_vk_timeline_fence const *>(brx_wait_timeline_fences[wait_timeline_fence_index])->get_semaphore(), wait_values[wait_timeline_fence_index]);
+	}
+
+	assert(signal_timeline_fence_count <= g_vk_max_signal_timeline_semaphore_count);
+	VkSemaphore signal_timeline_semaphores[g_vk_max_signal_timeline_semaphore_count];
+	for (uint32_t signal_timeline_fence_index = 0U; signal_timeline_fence_index < signal_timeline_fence_count; ++signal_timeline_fence_index)
+	{
+		assert(NULL != brx_signal_timeline_fences[signal_timeline_fence_index]);
+		signal_timeline_semaphores[signal_timeline_fence_index] = static_cast<brx_vk_timeline_fence const *>(brx_signal_timeline_fences[signal_timeline_fence_index])->get_semaphore();
 	}
+
+	VkSubmitInfo submit_info{
+		VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		NULL,
+		0U,
+		NULL,
+		NULL,
+		upload_command_buffer_count,
+		(upload_command_buffer_count > 0U) ? command_buffers : NULL,
+		0U,
+		NULL};
+
+	std::lock_guard<std::mutex> lock_guard(*this->m_queue_mutex);
+
+	VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_has_dedicated_upload_queue ? this->m_upload_queue : this->m_graphics_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, signal_timeline_fence_count, (signal_timeline_fence_count > 0U) ? signal_timeline_semaphores : NULL, signal_values, VK_NULL_HANDLE);
+	assert(VK_SUCCESS == res_queue_submit);
 }
 
-void brx_vk_upload_queue::steal(VkQueue *out_upload_queue)
+void brx_vk_upload_queue::signal_timeline_fence(brx_timeline_fence *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_timeline_fence);
+	VkSemaphore timeline_semaphore = static_cast<brx_vk_timeline_fence const *>(brx_timeline_fence)->get_semaphore();
+
+	VkSubmitInfo submit_info{
+		VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		NULL,
+		0U,
+		NULL,
+		NULL,
+		0U,
+		NULL,
+		0U,
+		NULL};
+
+	// the upload command buffers are submitted to this queue (or the graphics queue when there is no dedicated upload queue) by the "submit_and_signal", and thus the signal is queued behind all of them
+	std::lock_guard<std::mutex> lock_guard(*this->m_queue_mutex);
+
+	VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_has_dedicated_upload_queue ? this->m_upload_queue : this->m_graphics_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, 1U, &timeline_semaphore, &value, VK_NULL_HANDLE);
+	assert(VK_SUCCESS == res_queue_submit);
+}
+
+void brx_vk_upload_queue::wait_timeline_fence(brx_timeline_fence const *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_timeline_fence);
+	VkSemaphore timeline_semaphore = static_cast<brx_vk_timeline_fence const *>(brx_timeline_fence)->get_semaphore();
+
+	// the wait is performed by the GPU when the next submission of this queue is executed, even if the graphics queue is used when there is no dedicated upload queue
+	__intermediate_push_pending_wait_timeline_semaphore(this->m_pfn_queue_submit, this->m_has_dedicated_upload_queue ? this->m_upload_queue : this->m_graphics_queue, this->m_queue_mutex, &this->m_pending_wait_timeline_semaphores, timeline_semaphore, value);
+}
+
+void brx_vk_upload_queue::steal(VkQueue *out_upload_queue, VkSemaphore *out_flush_timeline_semaphore)
 {
 	assert(NULL != out_upload_queue);
+	assert(NULL != out_flush_timeline_semaphore);
 
 	(*out_upload_queue) = this->m_upload_queue;
+	(*out_flush_timeline_semaphore) = this->m_pending_wait_timeline_semaphores.flush_timeline_semaphore;
 
 	this->m_upload_queue = VK_NULL_HANDLE;
+	this->m_pending_wait_timeline_semaphores.flush_timeline_semaphore = VK_NULL_HANDLE;
 }
 
 brx_vk_upload_queue::~brx_vk_upload_queue()
 {
 	assert(VK_NULL_HANDLE == this->m_upload_queue);
-}
\ No newline at end of file
+	assert(VK_NULL_HANDLE == this->m_pending_wait_timeline_semaphores.flush_timeline_semaphore);
+}
+
+brx_vk_compute_queue::brx_vk_compute_queue(
+	VkQueue compute_queue,
+	std::mutex *compute_queue_mutex,
+	PFN_vkQueueSubmit pfn_queue_submit,
+	VkSemaphore flush_timeline_semaphore)
+	: m_compute_queue(compute_queue),
+	  m_compute_queue_mutex(compute_queue_mutex),
+	  m_pfn_queue_submit(pfn_queue_submit),
+	  m_pending_wait_timeline_semaphores{0U, {}, {}, flush_timeline_semaphore, 0U}
+{
+}
+
+void brx_vk_compute_queue::signal_timeline_fence(brx_timeline_fence *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_timeline_fence);
+	VkSemaphore timeline_semaphore = static_cast<brx_vk_timeline_fence const *>(brx_timeline_fence)->get_semaphore();
+
+	VkSubmitInfo submit_info{
+		VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		NULL,
+		0U,
+		NULL,
+		NULL,
+		0U,
+		NULL,
+		0U,
+		NULL};
+
+	std::lock_guard<std::mutex> lock_guard(*this->m_compute_queue_mutex);
+
+	VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_compute_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, 1U, &timeline_semaphore, &value, VK_NULL_HANDLE);
+	assert(VK_SUCCESS == res_queue_submit);
+}
+
+void brx_vk_compute_queue::wait_timeline_fence(brx_timeline_fence const *brx_timeline_fence, uint64_t value)
+{
+	assert(NULL != brx_timeline_fence);
+	VkSemaphore timeline_semaphore = static_cast<brx_vk_timeline_fence const *>(brx_timeline_fence)->get_semaphore();
+
+	__intermediate_push_pending_wait_timeline_semaphore(this->m_pfn_queue_submit, this->m_compute_queue, this->m_compute_queue_mutex, &this->m_pending_wait_timeline_semaphores, timeline_semaphore, value);
+}
+
+void brx_vk_compute_queue::submit_batch(uint32_t compute_command_buffer_count, brx_compute_command_buffer const *const *brx_compute_command_buffers, uint32_t wait_timeline_fence_count, brx_timeline_fence const *const *brx_wait_timeline_fences, uint64_t const *wait_values, uint32_t signal_timeline_fence_count, brx_timeline_fence *const *brx_signal_timeline_fences, uint64_t const *signal_values, brx_fence *brx_fence)
+{
+	assert(compute_command_buffer_count <= g_vk_max_queue_submit_command_buffer_count);
+	VkCommandBuffer command_buffers[g_vk_max_queue_submit_command_buffer_count];
+	for (uint32_t compute_command_buffer_index = 0U; compute_command_buffer_index < compute_command_buffer_count; ++compute_command_buffer_index)
+	{
+		assert(NULL != brx_compute_command_buffers[compute_command_buffer_index]);
+		command_buffers[compute_command_buffer_index] = static_cast<brx_vk_compute_command_buffer const *>(brx_compute_command_buffers[compute_command_buffer_index])->get_command_buffer();
+	}
+
+	for (uint32_t wait_timeline_fence_index = 0U; wait_timeline_fence_index < wait_timeline_fence_count; ++wait_timeline_fence_index)
+	{
+		assert(NULL != brx_wait_timeline_fences[wait_timeline_fence_index]);
+		__intermediate_push_pending_wait_timeline_semaphore(this->m_pfn_queue_submit, this->m_compute_queue, this->m_compute_queue_mutex, &this->m_pending_wait_timeline_semaphores, static_cast<brx_vk_timeline_fence const *>(brx_wait_timeline_fences[wait_timeline_fence_index])->get_semaphore(), wait_values[wait_timeline_fence_index]);
+	}
+
+	assert(signal_timeline_fence_count <= g_vk_max_signal_timeline_semaphore_count);
+	VkSemaphore signal_timeline_semaphores[g_vk_max_signal_timeline_semaphore_count];
+	for (uint32_t signal_timeline_fence_index = 0U; signal_timeline_fence_index < signal_timeline_fence_count; ++signal_timeline_fence_index)
+	{
+		assert(NULL != brx_signal_timeline_fences[signal_timeline_fence_index]);
+		signal_timeline_semaphores[signal_timeline_fence_index] = static_cast<brx_vk_timeline_fence const *>(brx_signal_timeline_fences[signal_timeline_fence_index])->get_semaphore();
+	}
+
+	VkFence fence = (NULL != brx_fence) ? static_cast<brx_vk_fence const *>(brx_fence)->get_fence() : VK_NULL_HANDLE;
+
+	VkSubmitInfo submit_info{
+		VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		NULL,
+		0U,
+		NULL,
+		NULL,
+		compute_command_buffer_count,
+		(compute_command_buffer_count > 0U) ? command_buffers : NULL,
+		0U,
+		NULL};
+
+	std::lock_guard<std::mutex> lock_guard(*this->m_compute_queue_mutex);
+
+	VkResult res_queue_submit = __intermediate_queue_submit(this->m_pfn_queue_submit, this->m_compute_queue, &submit_info, &this->m_pending_wait_timeline_semaphores, signal_timeline_fence_count, (signal_timeline_fence_count > 0U) ? signal_timeline_semaphores : NULL, signal_values, fence);
+	assert(VK_SUCCESS == res_queue_submit);
+}
+
+void brx_vk_compute_queue::steal(VkQueue *out_compute_queue, VkSemaphore *out_flush_timeline_semaphore)
+{
+	assert(NULL != out_compute_queue);
+	assert(NULL != out_flush_timeline_semaphore);
+
+	(*out_compute_queue) = this->m_compute_queue;
+	(*out_flush_timeline_semaphore) = this->m_pending_wait_timeline_semaphores.flush_timeline_semaphore;
+
+	this->m_compute_queue = VK_NULL_HANDLE;
+	this->m_pending_wait_timeline_semaphores.flush_timeline_semaphore = VK_NULL_HANDLE;
+}
+
+brx_vk_compute_queue::~brx_vk_compute_queue()
+{
+	assert(VK_NULL_HANDLE == this->m_compute_queue);
+	assert(VK_NULL_HANDLE == this->m_pending_wait_timeline_semaphores.flush_timeline_semaphore);
+}
+static inline VkResult __intermediate_queue_submit(PFN_vkQueueSubmit pfn_queue_submit, VkQueue queue, VkSubmitInfo const *submit_info, brx_vk_pending_wait_timeline_semaphores *pending_wait_timeline_semaphores, uint32_t signal_timeline_semaphore_count, VkSemaphore const *signal_timeline_semaphores, uint64_t const *signal_timeline_semaphore_values, VkFence fence)
+{
+	if ((0U == pending_wait_timeline_semaphores->count) && (0U == signal_timeline_semaphore_count))
+	{
+		return pfn_queue_submit(queue, 1U, submit_info, fence);
+	}
+	else
+	{
+		assert(NULL == submit_info->pNext);
+		assert(submit_info->waitSemaphoreCount <= g_vk_max_queue_submit_binary_semaphore_count);
+		assert(submit_info->signalSemaphoreCount <= g_vk_max_queue_submit_binary_semaphore_count);
+		assert(signal_timeline_semaphore_count <= g_vk_max_signal_timeline_semaphore_count);
+
+		// the binary semaphores are followed by the timeline semaphores, and the values of the binary semaphores are ignored
+		VkSemaphore wait_semaphores[g_vk_max_queue_submit_binary_semaphore_count + g_vk_max_pending_wait_timeline_semaphore_count];
+		VkPipelineStageFlags wait_dst_stage_masks[g_vk_max_queue_submit_binary_semaphore_count + g_vk_max_pending_wait_timeline_semaphore_count];
+		uint64_t wait_semaphore_values[g_vk_max_queue_submit_binary_semaphore_count + g_vk_max_pending_wait_timeline_semaphore_count];
+		uint32_t wait_semaphore_count = 0U;
+		for (uint32_t wait_semaphore_index = 0U; wait_semaphore_index < submit_info->waitSemaphoreCount; ++wait_semaphore_index)
+		{
+			wait_semaphores[wait_semaphore_count] = submit_info->pWaitSemaphores[wait_semaphore_index];
+			wait_dst_stage_masks[wait_semaphore_count] = submit_info->pWaitDstStageMask[wait_semaphore_index];
+			wait_semaphore_values[wait_semaphore_count] = 0U;
+			++wait_semaphore_count;
+		}
+		for (uint32_t pending_wait_timeline_semaphore_index = 0U; pending_wait_timeline_semaphore_index < pending_wait_timeline_semaphores->count; ++pending_wait_timeline_semaphore_index)
+		{
+			wait_semaphores[wait_semaphore_count] = pending_wait_timeline_semaphores->semaphores[pending_wait_timeline_semaphore_index];
+			wait_dst_stage_masks[wait_semaphore_count] = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+			wait_semaphore_values[wait_semaphore_count] = pending_wait_timeline_semaphores->values[pending_wait_timeline_semaphore_index];
+			++wait_semaphore_count;
+		}
+
+		VkSemaphore signal_semaphores[g_vk_max_queue_submit_binary_semaphore_count + g_vk_max_signal_timeline_semaphore_count];
+		uint64_t signal_semaphore_values[g_vk_max_queue_submit_binary_semaphore_count + g_vk_max_signal_timeline_semaphore_count];
+		uint32_t signal_semaphore_count = 0U;
+		for (uint32_t signal_semaphore_index = 0U; signal_semaphore_index < submit_info->signalSemaphoreCount; ++signal_semaphore_index)
+		{
+			signal_semaphores[signal_semaphore_count] = submit_info->pSignalSemaphores[signal_semaphore_index];
+			signal_semaphore_values[signal_semaphore_count] = 0U;
+			++signal_semaphore_count;
+		}
+		for (uint32_t signal_timeline_semaphore_index = 0U; signal_timeline_semaphore_index < signal_timeline_semaphore_count; ++signal_timeline_semaphore_index)
+		{
+			signal_semaphores[signal_semaphore_count] = signal_timeline_semaphores[signal_timeline_semaphore_index];
+			signal_semaphore_values[signal_semaphore_count] = signal_timeline_semaphore_values[signal_timeline_semaphore_index];
+			++signal_semaphore_count;
+		}
+
+		VkTimelineSemaphoreSubmitInfoKHR const timeline_semaphore_submit_info = {
+			VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR,
+			NULL,
+			wait_semaphore_count,
+			(wait_semaphore_count > 0U) ? wait_semaphore_values : NULL,
+			signal_semaphore_count,
+			(signal_semaphore_count > 0U) ? signal_semaphore_values : NULL};
+
+		VkSubmitInfo const timeline_submit_info = {
+			VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			&timeline_semaphore_submit_info,
+			wait_semaphore_count,
+			(wait_semaphore_count > 0U) ? wait_semaphores : NULL,
+			(wait_semaphore_count > 0U) ? wait_dst_stage_masks : NULL,
+			submit_info->commandBufferCount,
+			submit_info->pCommandBuffers,
+			signal_semaphore_count,
+			(signal_semaphore_count > 0U) ? signal_semaphores : NULL};
+
+		pending_wait_timeline_semaphores->count = 0U;
+
+		return pfn_queue_submit(queue, 1U, &timeline_submit_info, fence);
+	}
+}
+
+static inline void __intermediate_push_pending_wait_timeline_semaphore(PFN_vkQueueSubmit pfn_queue_submit, VkQueue queue, std::mutex *queue_mutex, brx_vk_pending_wait_timeline_semaphores *pending_wait_timeline_semaphores, VkSemaphore timeline_semaphore, uint64_t value)
+{
+	// the value of the timeline semaphore is monotonically increasing, and thus only the greatest value is waited when the same timeline semaphore is waited more than once
+	for (uint32_t pending_wait_timeline_semaphore_index = 0U; pending_wait_timeline_semaphore_index < pending_wait_timeline_semaphores->count; ++pending_wait_timeline_semaphore_index)
+	{
+		if (timeline_semaphore == pending_wait_timeline_semaphores->semaphores[pending_wait_timeline_semaphore_index])
+		{
+			if (value > pending_wait_timeline_semaphores->values[pending_wait_timeline_semaphore_index])
+			{
+				pending_wait_timeline_semaphores->values[pending_wait_timeline_semaphore_index] = value;
+			}
+			return;
+		}
+	}
+
+	// the wait operation of the empty submission does NOT block the following submissions by itself, and thus the following submissions wait for the flush timeline semaphore signaled by the empty submission
+	if (pending_wait_timeline_semaphores->count >= g_vk_max_pending_wait_timeline_semaphore_count)
+	{
+		assert(VK_NULL_HANDLE != pending_wait_timeline_semaphores->flush_timeline_semaphore);
+
+		++pending_wait_timeline_semaphores->flush_timeline_semaphore_value;
+		VkSemaphore const flush_timeline_semaphore = pending_wait_timeline_semaphores->flush_timeline_semaphore;
+		uint64_t const flush_timeline_semaphore_value = pending_wait_timeline_semaphores->flush_timeline_semaphore_value;
+
+		VkSubmitInfo const submit_info{
+			VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			NULL,
+			0U,
+			NULL,
+			NULL,
+			0U,
+			NULL,
+			0U,
+			NULL};
+
+		{
+			std::lock_guard<std::mutex> lock_guard(*queue_mutex);
+
+			VkResult res_queue_submit = __intermediate_queue_submit(pfn_queue_submit, queue, &submit_info, pending_wait_timeline_semaphores, 1U, &flush_timeline_semaphore, &flush_timeline_semaphore_value, VK_NULL_HANDLE);
+			assert(VK_SUCCESS == res_queue_submit);
+		}
+
+		assert(0U == pending_wait_timeline_semaphores->count);
+		pending_wait_timeline_semaphores->semaphores[0] = flush_timeline_semaphore;
+		pending_wait_timeline_semaphores->values[0] = flush_timeline_semaphore_value;
+		pending_wait_timeline_semaphores->count = 1U;
+	}
+
+	pending_wait_timeline_semaphores->semaphores[pending_wait_timeline_semaphores->count] = timeline_semaphore;
+	pending_wait_timeline_semaphores->values[pending_wait_timeline_semaphores->count] = value;
+	++pending_wait_timeline_semaphores->count;
+}
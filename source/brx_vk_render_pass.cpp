@@ -18,7 +18,7 @@
 #include "brx_vk_device.h"
 #include <assert.h>
 
-brx_vk_render_pass::brx_vk_render_pass(VkRenderPass render_pass) : m_render_pass(render_pass)
+brx_vk_render_pass::brx_vk_render_pass(VkRenderPass render_pass, uint32_t attachment_count, VkFormat const *attachment_formats) : m_render_pass(render_pass), m_attachment_formats(attachment_formats, attachment_formats + attachment_count)
 {
 }
 
@@ -27,6 +27,16 @@ VkRenderPass brx_vk_render_pass::get_render_pass() const
 	return this->m_render_pass;
 }
 
+uint32_t brx_vk_render_pass::get_attachment_count() const
+{
+	return static_cast<uint32_t>(this->m_attachment_formats.size());
+}
+
+VkFormat const *brx_vk_render_pass::get_attachment_formats() const
+{
+	return this->m_attachment_formats.data();
+}
+
 void brx_vk_render_pass::steal(VkRenderPass *out_render_pass)
 {
 	assert(NULL != out_render_pass);
@@ -0,0 +1,137 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "../include/brx_device.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// create and destroy 100k descriptor sets of the same layout, which is the material churn the pooled descriptor set allocation is designed for
+
+static constexpr uint32_t const g_descriptor_set_count = 100000U;
+static constexpr uint32_t const g_thread_count = 4U;
+
+static double benchmark_create_then_destroy(brx_device *device, brx_descriptor_set_layout const *descriptor_set_layout, uint32_t descriptor_set_count);
+
+static double benchmark_interleaved_churn(brx_device *device, brx_descriptor_set_layout const *descriptor_set_layout, uint32_t descriptor_set_count);
+
+int main(int argc, char **argv)
+{
+	brx_device *device = brx_init_vk_device(false);
+	if (NULL == device)
+	{
+		fprintf(stderr, "failed to create the Vulkan device\n");
+		return EXIT_FAILURE;
+	}
+
+	BRX_DESCRIPTOR_SET_LAYOUT_BINDING const descriptor_set_layout_bindings[] = {
+		{0U, BRX_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER, 1U},
+		{1U, BRX_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 4U},
+		{2U, BRX_DESCRIPTOR_TYPE_SAMPLER, 1U}};
+	brx_descriptor_set_layout *descriptor_set_layout = device->create_descriptor_set_layout(sizeof(descriptor_set_layout_bindings) / sizeof(descriptor_set_layout_bindings[0]), descriptor_set_layout_bindings);
+
+	// the first pass creates the descriptor pools, and the second pass measures the recycled descriptor sets
+	double const create_then_destroy_cold_milliseconds = benchmark_create_then_destroy(device, descriptor_set_layout, g_descriptor_set_count);
+	double const create_then_destroy_warm_milliseconds = benchmark_create_then_destroy(device, descriptor_set_layout, g_descriptor_set_count);
+	printf("create then destroy %u descriptor sets: cold %.3f ms, warm %.3f ms\n", g_descriptor_set_count, create_then_destroy_cold_milliseconds, create_then_destroy_warm_milliseconds);
+
+	double const interleaved_churn_milliseconds = benchmark_interleaved_churn(device, descriptor_set_layout, g_descriptor_set_count);
+	printf("interleaved churn of %u descriptor sets: %.3f ms\n", g_descriptor_set_count, interleaved_churn_milliseconds);
+
+	// the descriptor sets of the same layout are allocated from the shared descriptor pools by multiple threads concurrently
+	{
+		std::chrono::steady_clock::time_point const begin = std::chrono::steady_clock::now();
+
+		std::vector<std::thread> threads;
+		for (uint32_t thread_index = 0U; thread_index < g_thread_count; ++thread_index)
+		{
+			threads.emplace_back(benchmark_interleaved_churn, device, descriptor_set_layout, g_descriptor_set_count / g_thread_count);
+		}
+
+		for (std::thread &thread : threads)
+		{
+			thread.join();
+		}
+
+		std::chrono::steady_clock::time_point const end = std::chrono::steady_clock::now();
+		printf("interleaved churn of %u descriptor sets by %u threads: %.3f ms\n", g_descriptor_set_count, g_thread_count, std::chrono::duration<double, std::milli>(end - begin).count());
+	}
+
+	device->destroy_descriptor_set_layout(descriptor_set_layout);
+
+	brx_destroy_vk_device(device);
+
+	return EXIT_SUCCESS;
+}
+
+static double benchmark_create_then_destroy(brx_device *device, brx_descriptor_set_layout const *descriptor_set_layout, uint32_t descriptor_set_count)
+{
+	std::vector<brx_descriptor_set *> descriptor_sets(static_cast<size_t>(descriptor_set_count), NULL);
+
+	std::chrono::steady_clock::time_point const begin = std::chrono::steady_clock::now();
+
+	for (uint32_t descriptor_set_index = 0U; descriptor_set_index < descriptor_set_count; ++descriptor_set_index)
+	{
+		descriptor_sets[descriptor_set_index] = device->create_descriptor_set(descriptor_set_layout);
+		assert(NULL != descriptor_sets[descriptor_set_index]);
+	}
+
+	for (uint32_t descriptor_set_index = 0U; descriptor_set_index < descriptor_set_count; ++descriptor_set_index)
+	{
+		device->destroy_descriptor_set(descriptor_sets[descriptor_set_index]);
+	}
+
+	std::chrono::steady_clock::time_point const end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+static double benchmark_interleaved_churn(brx_device *device, brx_descriptor_set_layout const *descriptor_set_layout, uint32_t descriptor_set_count)
+{
+	// at most "live_descriptor_set_count" descriptor sets are alive at the same time, and the oldest one is destroyed when a new one is created
+	constexpr uint32_t const live_descriptor_set_count = 256U;
+	std::vector<brx_descriptor_set *> descriptor_sets(static_cast<size_t>(live_descriptor_set_count), NULL);
+
+	std::chrono::steady_clock::time_point const begin = std::chrono::steady_clock::now();
+
+	for (uint32_t descriptor_set_index = 0U; descriptor_set_index < descriptor_set_count; ++descriptor_set_index)
+	{
+		brx_descriptor_set *&descriptor_set = descriptor_sets[descriptor_set_index % live_descriptor_set_count];
+		if (NULL != descriptor_set)
+		{
+			device->destroy_descriptor_set(descriptor_set);
+		}
+
+		descriptor_set = device->create_descriptor_set(descriptor_set_layout);
+		assert(NULL != descriptor_set);
+	}
+
+	for (brx_descriptor_set *descriptor_set : descriptor_sets)
+	{
+		if (NULL != descriptor_set)
+		{
+			device->destroy_descriptor_set(descriptor_set);
+		}
+	}
+
+	std::chrono::steady_clock::time_point const end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::milli>(end - begin).count();
+}
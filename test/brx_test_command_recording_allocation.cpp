@@ -0,0 +1,364 @@
+//
+// Copyright (C) YuqiaoZhang(HanetakaChou)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+//
+
+#include "../include/brx_device.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+
+// the command recording and submission path should NOT allocate from the heap, and each allocation of the library between the "begin" of the command buffer and the "submit_batch" of the queue is counted by the malloc hook
+
+static constexpr uint32_t const g_frame_count = 8U;
+static constexpr uint32_t const g_dispatch_count = 256U;
+static constexpr uint32_t const g_draw_count = 256U;
+static constexpr uint32_t const g_color_attachment_width = 64U;
+static constexpr uint32_t const g_color_attachment_height = 64U;
+static constexpr uint32_t const g_uniform_buffer_range = 256U;
+
+// #version 450
+// layout(local_size_x = 1, local_size_y = 1, local_size_z = 1) in;
+// void main() {}
+static uint32_t const g_empty_compute_shader_module_code[] = {
+	0x07230203U, 0x00010000U, 0x00000000U, 0x00000005U, 0x00000000U,
+	// OpCapability Shader
+	0x00020011U, 0x00000001U,
+	// OpMemoryModel Logical GLSL450
+	0x0003000EU, 0x00000000U, 0x00000001U,
+	// OpEntryPoint GLCompute %3 "main"
+	0x0005000FU, 0x00000005U, 0x00000003U, 0x6E69616DU, 0x00000000U,
+	// OpExecutionMode %3 LocalSize 1 1 1
+	0x00060010U, 0x00000003U, 0x00000011U, 0x00000001U, 0x00000001U, 0x00000001U,
+	// %1 = OpTypeVoid
+	0x00020013U, 0x00000001U,
+	// %2 = OpTypeFunction %1
+	0x00030021U, 0x00000002U, 0x00000001U,
+	// %3 = OpFunction %1 None %2
+	0x00050036U, 0x00000001U, 0x00000003U, 0x00000000U, 0x00000002U,
+	// %4 = OpLabel
+	0x000200F8U, 0x00000004U,
+	// OpReturn
+	0x000100FDU,
+	// OpFunctionEnd
+	0x00010038U};
+
+// #version 450
+// layout(location = 0) in vec3 in_position;
+// void main() { gl_Position = vec4(in_position, 1.0); }
+static uint32_t const g_position_vertex_shader_module_code[] = {
+	0x07230203U, 0x00010000U, 0x00000000U, 0x00000012U, 0x00000000U,
+	// OpCapability Shader
+	0x00020011U, 0x00000001U,
+	// OpMemoryModel Logical GLSL450
+	0x0003000EU, 0x00000000U, 0x00000001U,
+	// OpEntryPoint Vertex %11 "main" %8 %9
+	0x0007000FU, 0x00000000U, 0x0000000BU, 0x6E69616DU, 0x00000000U, 0x00000008U, 0x00000009U,
+	// OpDecorate %8 Location 0
+	0x00040047U, 0x00000008U, 0x0000001EU, 0x00000000U,
+	// OpDecorate %9 BuiltIn Position
+	0x00040047U, 0x00000009U, 0x0000000BU, 0x00000000U,
+	// %1 = OpTypeVoid
+	0x00020013U, 0x00000001U,
+	// %2 = OpTypeFunction %1
+	0x00030021U, 0x00000002U, 0x00000001U,
+	// %3 = OpTypeFloat 32
+	0x00030016U, 0x00000003U, 0x00000020U,
+	// %4 = OpTypeVector %3 3
+	0x00040017U, 0x00000004U, 0x00000003U, 0x00000003U,
+	// %5 = OpTypeVector %3 4
+	0x00040017U, 0x00000005U, 0x00000003U, 0x00000004U,
+	// %6 = OpTypePointer Input %4
+	0x00040020U, 0x00000006U, 0x00000001U, 0x00000004U,
+	// %7 = OpTypePointer Output %5
+	0x00040020U, 0x00000007U, 0x00000003U, 0x00000005U,
+	// %8 = OpVariable %6 Input
+	0x0004003BU, 0x00000006U, 0x00000008U, 0x00000001U,
+	// %9 = OpVariable %7 Output
+	0x0004003BU, 0x00000007U, 0x00000009U, 0x00000003U,
+	// %10 = OpConstant %3 1.0
+	0x0004002BU, 0x00000003U, 0x0000000AU, 0x3F800000U,
+	// %11 = OpFunction %1 None %2
+	0x00050036U, 0x00000001U, 0x0000000BU, 0x00000000U, 0x00000002U,
+	// %12 = OpLabel
+	0x000200F8U, 0x0000000CU,
+	// %13 = OpLoad %4 %8
+	0x0004003DU, 0x00000004U, 0x0000000DU, 0x00000008U,
+	// %14 = OpCompositeExtract %3 %13 0
+	0x00050051U, 0x00000003U, 0x0000000EU, 0x0000000DU, 0x00000000U,
+	// %15 = OpCompositeExtract %3 %13 1
+	0x00050051U, 0x00000003U, 0x0000000FU, 0x0000000DU, 0x00000001U,
+	// %16 = OpCompositeExtract %3 %13 2
+	0x00050051U, 0x00000003U, 0x00000010U, 0x0000000DU, 0x00000002U,
+	// %17 = OpCompositeConstruct %5 %14 %15 %16 %10
+	0x00070050U, 0x00000005U, 0x00000011U, 0x0000000EU, 0x0000000FU, 0x00000010U, 0x0000000AU,
+	// OpStore %9 %17
+	0x0003003EU, 0x00000009U, 0x00000011U,
+	// OpReturn
+	0x000100FDU,
+	// OpFunctionEnd
+	0x00010038U};
+
+// #version 450
+// layout(location = 0) out vec4 out_color;
+// void main() { out_color = vec4(1.0, 1.0, 1.0, 1.0); }
+static uint32_t const g_white_fragment_shader_module_code[] = {
+	0x07230203U, 0x00010000U, 0x00000000U, 0x0000000BU, 0x00000000U,
+	// OpCapability Shader
+	0x00020011U, 0x00000001U,
+	// OpMemoryModel Logical GLSL450
+	0x0003000EU, 0x00000000U, 0x00000001U,
+	// OpEntryPoint Fragment %9 "main" %6
+	0x0006000FU, 0x00000004U, 0x00000009U, 0x6E69616DU, 0x00000000U, 0x00000006U,
+	// OpExecutionMode %9 OriginUpperLeft
+	0x00030010U, 0x00000009U, 0x00000007U,
+	// OpDecorate %6 Location 0
+	0x00040047U, 0x00000006U, 0x0000001EU, 0x00000000U,
+	// %1 = OpTypeVoid
+	0x00020013U, 0x00000001U,
+	// %2 = OpTypeFunction %1
+	0x00030021U, 0x00000002U, 0x00000001U,
+	// %3 = OpTypeFloat 32
+	0x00030016U, 0x00000003U, 0x00000020U,
+	// %4 = OpTypeVector %3 4
+	0x00040017U, 0x00000004U, 0x00000003U, 0x00000004U,
+	// %5 = OpTypePointer Output %4
+	0x00040020U, 0x00000005U, 0x00000003U, 0x00000004U,
+	// %6 = OpVariable %5 Output
+	0x0004003BU, 0x00000005U, 0x00000006U, 0x00000003U,
+	// %7 = OpConstant %3 1.0
+	0x0004002BU, 0x00000003U, 0x00000007U, 0x3F800000U,
+	// %8 = OpConstantComposite %4 %7 %7 %7 %7
+	0x0007002CU, 0x00000004U, 0x00000008U, 0x00000007U, 0x00000007U, 0x00000007U, 0x00000007U,
+	// %9 = OpFunction %1 None %2
+	0x00050036U, 0x00000001U, 0x00000009U, 0x00000000U, 0x00000002U,
+	// %10 = OpLabel
+	0x000200F8U, 0x0000000AU,
+	// OpStore %6 %8
+	0x0003003EU, 0x00000006U, 0x00000008U,
+	// OpReturn
+	0x000100FDU,
+	// OpFunctionEnd
+	0x00010038U};
+
+// one triangle which covers the center of the color attachment
+static float const g_triangle_positions[3][3] = {
+	{-0.5F, -0.5F, 0.0F},
+	{0.5F, -0.5F, 0.0F},
+	{0.0F, 0.5F, 0.0F}};
+
+static uint32_t const g_triangle_indices[3] = {0U, 1U, 2U};
+
+static std::atomic<uint32_t> g_allocation_count(0U);
+
+static void count_allocation(size_t size, size_t alignment, void *user_data);
+
+int main(int argc, char **argv)
+{
+	brx_device *device = brx_init_vk_device(false);
+	if (NULL == device)
+	{
+		fprintf(stderr, "failed to create the Vulkan device\n");
+		return EXIT_FAILURE;
+	}
+
+	brx_graphics_queue *graphics_queue = device->create_graphics_queue();
+	brx_upload_queue *upload_queue = device->create_upload_queue();
+	brx_graphics_command_buffer *graphics_command_buffer = device->create_graphics_command_buffer();
+	brx_upload_command_buffer *upload_command_buffer = device->create_upload_command_buffer();
+	brx_fence *fence = device->create_fence(true);
+
+	BRX_DESCRIPTOR_SET_LAYOUT_BINDING const descriptor_set_layout_bindings[] = {
+		{0U, BRX_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER, 1U}};
+	brx_descriptor_set_layout *descriptor_set_layout = device->create_descriptor_set_layout(sizeof(descriptor_set_layout_bindings) / sizeof(descriptor_set_layout_bindings[0]), descriptor_set_layout_bindings);
+
+	brx_pipeline_layout *pipeline_layout = device->create_pipeline_layout(1U, &descriptor_set_layout, 16U);
+
+	brx_compute_pipeline *compute_pipeline = device->create_compute_pipeline(pipeline_layout, sizeof(g_empty_compute_shader_module_code), g_empty_compute_shader_module_code);
+
+	brx_uniform_upload_buffer *uniform_upload_buffer = device->create_uniform_upload_buffer(g_uniform_buffer_range * 2U);
+
+	brx_descriptor_set *descriptor_set = device->create_descriptor_set(descriptor_set_layout);
+	{
+		brx_uniform_upload_buffer const *const src_dynamic_uniform_buffers[1] = {uniform_upload_buffer};
+		uint32_t const src_dynamic_uniform_buffer_ranges[1] = {g_uniform_buffer_range};
+		device->write_descriptor_set(descriptor_set, BRX_DESCRIPTOR_TYPE_DYNAMIC_UNIFORM_BUFFER, 0U, 0U, 1U, src_dynamic_uniform_buffers, src_dynamic_uniform_buffer_ranges, NULL, NULL, NULL, NULL, NULL);
+	}
+
+	// the storage image and the indirect argument buffer are used to record the pending barriers
+	brx_storage_image *storage_image = device->create_storage_image(BRX_STORAGE_IMAGE_FORMAT_R32_UINT, 64U, 64U, false);
+
+	brx_intermediate_storage_buffer *indirect_argument_buffer = device->create_intermediate_storage_buffer(64U, false, false, true);
+
+	BRX_RENDER_PASS_COLOR_ATTACHMENT const render_pass_color_attachments[1] = {
+		{BRX_COLOR_ATTACHMENT_FORMAT_R8G8B8A8_UNORM, BRX_RENDER_PASS_COLOR_ATTACHMENT_LOAD_OPERATION_CLEAR, BRX_RENDER_PASS_COLOR_ATTACHMENT_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE}};
+	brx_render_pass *render_pass = device->create_render_pass(1U, render_pass_color_attachments, NULL);
+
+	brx_color_attachment_image *color_attachment_image = device->create_color_attachment_image(BRX_COLOR_ATTACHMENT_FORMAT_R8G8B8A8_UNORM, g_color_attachment_width, g_color_attachment_height, true);
+
+	brx_frame_buffer *frame_buffer = device->create_frame_buffer(render_pass, g_color_attachment_width, g_color_attachment_height, 1U, &color_attachment_image, NULL);
+
+	BRX_GRAPHICS_PIPELINE_VERTEX_BINDING const vertex_bindings[1] = {
+		{sizeof(g_triangle_positions[0])}};
+	BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE const vertex_attributes[1] = {
+		{0U, BRX_GRAPHICS_PIPELINE_VERTEX_ATTRIBUTE_FORMAT_R32G32B32_SFLOAT, 0U}};
+	brx_graphics_pipeline *graphics_pipeline = device->create_graphics_pipeline(render_pass, pipeline_layout, sizeof(g_position_vertex_shader_module_code), g_position_vertex_shader_module_code, sizeof(g_white_fragment_shader_module_code), g_white_fragment_shader_module_code, 1U, vertex_bindings, 1U, vertex_attributes, false, BRX_GRAPHICS_PIPELINE_COMPARE_OPERATION_ALWAYS);
+
+	// the vertex buffer and the index buffer are uploaded before the counted frames
+	brx_asset_vertex_position_buffer *vertex_position_buffer = device->create_asset_vertex_position_buffer(sizeof(g_triangle_positions));
+	brx_asset_index_buffer *index_buffer = device->create_asset_index_buffer(sizeof(g_triangle_indices));
+	brx_staging_upload_buffer *staging_upload_buffer = device->create_staging_upload_buffer(sizeof(g_triangle_positions) + sizeof(g_triangle_indices));
+	{
+		memcpy(staging_upload_buffer->get_host_memory_range_base(), g_triangle_positions, sizeof(g_triangle_positions));
+		memcpy(static_cast<uint8_t *>(staging_upload_buffer->get_host_memory_range_base()) + sizeof(g_triangle_positions), g_triangle_indices, sizeof(g_triangle_indices));
+
+		upload_command_buffer->begin();
+		upload_command_buffer->upload_from_staging_upload_buffer_to_asset_vertex_position_buffer(vertex_position_buffer, 0U, staging_upload_buffer, 0U, sizeof(g_triangle_positions));
+		upload_command_buffer->upload_from_staging_upload_buffer_to_asset_index_buffer(index_buffer, 0U, staging_upload_buffer, sizeof(g_triangle_positions), sizeof(g_triangle_indices));
+		upload_command_buffer->release_asset_vertex_position_buffer(vertex_position_buffer);
+		upload_command_buffer->release_asset_index_buffer(index_buffer);
+		upload_command_buffer->end();
+
+		upload_queue->submit_and_signal(upload_command_buffer);
+
+		device->wait_for_fence(fence);
+		device->reset_fence(fence);
+
+		graphics_command_buffer->begin();
+		graphics_command_buffer->acquire_asset_vertex_position_buffer(vertex_position_buffer);
+		graphics_command_buffer->acquire_asset_index_buffer(index_buffer);
+		graphics_command_buffer->end();
+
+		graphics_queue->wait_and_submit(upload_command_buffer, graphics_command_buffer, fence);
+	}
+
+	bool success = true;
+
+	for (uint32_t frame_index = 0U; frame_index < g_frame_count; ++frame_index)
+	{
+		device->wait_for_fence(fence);
+		device->reset_fence(fence);
+
+		brx_set_malloc_hook(count_allocation, NULL);
+		g_allocation_count.store(0U);
+
+		graphics_command_buffer->begin();
+
+		graphics_command_buffer->compute_pass_load_storage_image(storage_image, BRX_STORAGE_IMAGE_LOAD_OPERATION_DONT_CARE);
+
+		graphics_command_buffer->compute_pass_load_indirect_argument_buffer(indirect_argument_buffer->get_indirect_argument_buffer());
+
+		graphics_command_buffer->bind_compute_pipeline(compute_pipeline);
+
+		for (uint32_t dispatch_index = 0U; dispatch_index < g_dispatch_count; ++dispatch_index)
+		{
+			// the dynamic offset is changed by each dispatch, and thus the bind is NOT elided
+			uint32_t const dynamic_offset = g_uniform_buffer_range * (dispatch_index % 2U);
+			brx_descriptor_set const *const descriptor_sets[1] = {descriptor_set};
+			graphics_command_buffer->bind_compute_descriptor_sets(pipeline_layout, 1U, descriptor_sets, 1U, &dynamic_offset);
+
+			uint32_t const push_constants[4] = {frame_index, dispatch_index, 0U, 0U};
+			graphics_command_buffer->push_compute_constants(pipeline_layout, 0U, sizeof(push_constants), push_constants);
+
+			graphics_command_buffer->dispatch(1U, 1U, 1U);
+		}
+
+		graphics_command_buffer->compute_pass_store_indirect_argument_buffer(indirect_argument_buffer->get_indirect_argument_buffer());
+
+		graphics_command_buffer->compute_pass_store_storage_image(storage_image, BRX_STORAGE_IMAGE_STORE_OPERATION_FLUSH_FOR_SAMPLED_IMAGE);
+
+		float const color_clear_values[1][4] = {{0.0F, 0.0F, 0.0F, 0.0F}};
+		graphics_command_buffer->begin_render_pass(render_pass, frame_buffer, g_color_attachment_width, g_color_attachment_height, 1U, color_clear_values, NULL, NULL);
+
+		graphics_command_buffer->bind_graphics_pipeline(graphics_pipeline);
+
+		graphics_command_buffer->set_view_port(g_color_attachment_width, g_color_attachment_height);
+
+		graphics_command_buffer->set_scissor(g_color_attachment_width, g_color_attachment_height);
+
+		brx_vertex_buffer const *const vertex_buffers[1] = {vertex_position_buffer->get_vertex_buffer()};
+		graphics_command_buffer->bind_vertex_buffers(1U, vertex_buffers);
+
+		for (uint32_t draw_index = 0U; draw_index < g_draw_count; ++draw_index)
+		{
+			// the dynamic offset is changed by each draw, and thus the bind is NOT elided
+			uint32_t const dynamic_offset = g_uniform_buffer_range * (draw_index % 2U);
+			brx_descriptor_set const *const descriptor_sets[1] = {descriptor_set};
+			graphics_command_buffer->bind_graphics_descriptor_sets(pipeline_layout, 1U, descriptor_sets, 1U, &dynamic_offset);
+
+			uint32_t const push_constants[4] = {frame_index, draw_index, 0U, 0U};
+			graphics_command_buffer->push_graphics_constants(pipeline_layout, 0U, sizeof(push_constants), push_constants);
+
+			graphics_command_buffer->draw_index(index_buffer->get_index_buffer(), BRX_GRAPHICS_PIPELINE_INDEX_TYPE_UINT32, 3U, 1U);
+		}
+
+		graphics_command_buffer->end_render_pass();
+
+		graphics_command_buffer->end();
+
+		brx_graphics_command_buffer const *const graphics_command_buffers[1] = {graphics_command_buffer};
+		graphics_queue->submit_batch(1U, graphics_command_buffers, 0U, NULL, NULL, 0U, NULL, NULL, fence);
+
+		uint32_t const allocation_count = g_allocation_count.load();
+		brx_set_malloc_hook(NULL, NULL);
+
+		// the first frame should NOT allocate either, since the capacity is fixed rather than retained after the warm-up
+		if (0U != allocation_count)
+		{
+			fprintf(stderr, "frame %u: %u allocations when recording and submitting %u dispatches and %u draws\n", frame_index, allocation_count, g_dispatch_count, g_draw_count);
+			success = false;
+		}
+	}
+
+	device->wait_for_fence(fence);
+
+	device->destroy_staging_upload_buffer(staging_upload_buffer);
+	device->destroy_asset_index_buffer(index_buffer);
+	device->destroy_asset_vertex_position_buffer(vertex_position_buffer);
+	device->destroy_graphics_pipeline(graphics_pipeline);
+	device->destroy_frame_buffer(frame_buffer);
+	device->destroy_color_attachment_image(color_attachment_image);
+	device->destroy_render_pass(render_pass);
+	device->destroy_intermediate_storage_buffer(indirect_argument_buffer);
+	device->destroy_storage_image(storage_image);
+	device->destroy_descriptor_set(descriptor_set);
+	device->destroy_uniform_upload_buffer(uniform_upload_buffer);
+	device->destroy_compute_pipeline(compute_pipeline);
+	device->destroy_pipeline_layout(pipeline_layout);
+	device->destroy_descriptor_set_layout(descriptor_set_layout);
+	device->destroy_fence(fence);
+	device->destroy_upload_command_buffer(upload_command_buffer);
+	device->destroy_graphics_command_buffer(graphics_command_buffer);
+	device->destroy_upload_queue(upload_queue);
+	device->destroy_graphics_queue(graphics_queue);
+
+	brx_destroy_vk_device(device);
+
+	if (success)
+	{
+		printf("no allocation when recording and submitting %u frames of %u dispatches and %u draws\n", g_frame_count, g_dispatch_count, g_draw_count);
+		return EXIT_SUCCESS;
+	}
+	else
+	{
+		return EXIT_FAILURE;
+	}
+}
+
+static void count_allocation(size_t size, size_t alignment, void *user_data)
+{
+	g_allocation_count.fetch_add(1U);
+}